@@ -0,0 +1,225 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "AccountId.h"
+#include "Client.h"
+#include "ED25519PrivateKey.h"
+#include "Hbar.h"
+#include "PrivateKey.h"
+#include "TransactionId.h"
+#include "TransferTransaction.h"
+#include "impl/ArenaPool.h"
+
+#include <atomic>
+#include <basic_types.pb.h>
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <cstdlib>
+#include <exchange_rate.pb.h>
+#include <google/protobuf/arena.h>
+#include <memory>
+#include <new>
+#include <response.pb.h>
+#include <response_header.pb.h>
+#include <string>
+#include <transaction_body.pb.h>
+#include <transaction_get_receipt.pb.h>
+#include <transaction_receipt.pb.h>
+#include <unordered_map>
+
+using namespace Hiero;
+
+namespace
+{
+// The number of allocations made through the global operator new by the whole benchmark process.
+std::atomic<std::uint64_t> gAllocations = 0ULL;
+
+// The number of nodes on the network of the benchmarked Client.
+constexpr auto NUMBER_OF_NODES = 30ULL;
+
+// The number of transfers in the benchmarked TransactionBody.
+constexpr auto NUMBER_OF_TRANSFERS = 10LL;
+
+// Whether a benchmark builds its protobuf messages on the heap, or on an Arena from the ArenaPool.
+enum Allocation : int64_t
+{
+  HEAP = 0,
+  ARENA = 1
+};
+
+//-----
+void reportAllocations(benchmark::State& state, std::uint64_t allocations)
+{
+  state.counters["allocations"] =
+    benchmark::Counter(static_cast<double>(allocations), benchmark::Counter::kAvgIterations);
+}
+
+//-----
+const Client& getClient()
+{
+  // No requests are sent, so the nodes don't have to be reachable.
+  static const Client client = []()
+  {
+    std::unordered_map<std::string, AccountId> network;
+    for (auto i = 0ULL; i < NUMBER_OF_NODES; ++i)
+    {
+      network.try_emplace("127.0.0.1:" + std::to_string(50211ULL + i), AccountId(3ULL + i));
+    }
+
+    Client client = Client::forNetwork(network);
+    client.setOperator(AccountId(2ULL), ED25519PrivateKey::generatePrivateKey());
+    return client;
+  }();
+
+  return client;
+}
+
+//-----
+proto::TransactionBody getTransactionBody()
+{
+  proto::TransactionBody body;
+  *body.mutable_transactionid() = *TransactionId::generate(AccountId(2ULL)).toProtobuf();
+  body.set_transactionfee(100000000ULL);
+  body.mutable_transactionvalidduration()->set_seconds(120LL);
+  body.set_memo("A transfer to many accounts");
+  for (auto i = 0LL; i < NUMBER_OF_TRANSFERS; ++i)
+  {
+    proto::AccountAmount* accountAmount = body.mutable_cryptotransfer()->mutable_transfers()->add_accountamounts();
+    accountAmount->mutable_accountid()->set_accountnum(1000LL + i);
+    accountAmount->set_amount(i == 0LL ? -(NUMBER_OF_TRANSFERS - 1LL) : 1LL);
+  }
+
+  return body;
+}
+
+//-----
+std::string getSerializedReceiptResponse()
+{
+  proto::Response response;
+  proto::TransactionGetReceiptResponse* receiptResponse = response.mutable_transactiongetreceipt();
+  receiptResponse->mutable_header()->set_nodetransactionprecheckcode(proto::ResponseCodeEnum::OK);
+  proto::TransactionReceipt* receipt = receiptResponse->mutable_receipt();
+  receipt->set_status(proto::ResponseCodeEnum::SUCCESS);
+  receipt->mutable_accountid()->set_accountnum(1001LL);
+  receipt->mutable_exchangerate()->mutable_currentrate()->set_hbarequiv(30000);
+  receipt->mutable_exchangerate()->mutable_currentrate()->set_centequiv(150000);
+  receipt->mutable_exchangerate()->mutable_currentrate()->mutable_expirationtime()->set_seconds(1LL);
+  receipt->mutable_exchangerate()->mutable_nextrate()->set_hbarequiv(30000);
+  receipt->mutable_exchangerate()->mutable_nextrate()->set_centequiv(150000);
+  receipt->mutable_exchangerate()->mutable_nextrate()->mutable_expirationtime()->set_seconds(2LL);
+  return response.SerializeAsString();
+}
+
+} // namespace
+
+/**
+ * Count every allocation made through the global operator new, so that the benchmarks below can report how many heap
+ * allocations each of their iterations makes. Counting is a single relaxed atomic increment, so it doesn't noticeably
+ * slow down the other benchmarks of this executable.
+ */
+void* operator new(std::size_t size)
+{
+  gAllocations.fetch_add(1ULL, std::memory_order_relaxed);
+  if (void* pointer = std::malloc(size == 0 ? 1 : size))
+  {
+    return pointer;
+  }
+
+  throw std::bad_alloc();
+}
+
+//-----
+void operator delete(void* pointer) noexcept
+{
+  std::free(pointer);
+}
+
+//-----
+void operator delete(void* pointer, std::size_t) noexcept
+{
+  std::free(pointer);
+}
+
+//-----
+static void BM_AllocationsToParseResponse(benchmark::State& state)
+{
+  // The way Executable parses the response to each request.
+  const std::string bytes = getSerializedReceiptResponse();
+
+  const std::uint64_t allocations = gAllocations.load(std::memory_order_relaxed);
+  for (auto _ : state)
+  {
+    if (state.range(0) == Allocation::ARENA)
+    {
+      const internal::ArenaPool::Lease arena = internal::ArenaPool::getInstance().acquire();
+      auto* response = google::protobuf::Arena::CreateMessage<proto::Response>(arena.get());
+      benchmark::DoNotOptimize(response->ParseFromString(bytes));
+    }
+    else
+    {
+      proto::Response response;
+      benchmark::DoNotOptimize(response.ParseFromString(bytes));
+    }
+  }
+
+  reportAllocations(state, gAllocations.load(std::memory_order_relaxed) - allocations);
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_AllocationsToParseResponse)->ArgName("arena")->Arg(Allocation::HEAP)->Arg(Allocation::ARENA);
+
+//-----
+static void BM_AllocationsToSerializeTransactionBodySuffix(benchmark::State& state)
+{
+  // The way TransactionBodyTemplate serializes the fields of a TransactionBody after the node account ID, from a
+  // scratch copy of the body, once for all the nodes of a Transaction.
+  const proto::TransactionBody body = getTransactionBody();
+  std::string suffix;
+
+  const std::uint64_t allocations = gAllocations.load(std::memory_order_relaxed);
+  for (auto _ : state)
+  {
+    if (state.range(0) == Allocation::ARENA)
+    {
+      const internal::ArenaPool::Lease arena = internal::ArenaPool::getInstance().acquire();
+      auto* scratch = google::protobuf::Arena::CreateMessage<proto::TransactionBody>(arena.get());
+      scratch->CopyFrom(body);
+      scratch->clear_transactionid();
+      scratch->clear_nodeaccountid();
+      scratch->SerializeToString(&suffix);
+    }
+    else
+    {
+      proto::TransactionBody scratch = body;
+      scratch.clear_transactionid();
+      scratch.clear_nodeaccountid();
+      scratch.SerializeToString(&suffix);
+    }
+
+    benchmark::DoNotOptimize(suffix);
+  }
+
+  reportAllocations(state, gAllocations.load(std::memory_order_relaxed) - allocations);
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_AllocationsToSerializeTransactionBodySuffix)
+  ->ArgName("arena")
+  ->Arg(Allocation::HEAP)
+  ->Arg(Allocation::ARENA);
+
+//-----
+static void BM_AllocationsToBuildTransaction(benchmark::State& state)
+{
+  // Freezing and serializing a Transaction builds its source TransactionBody and a signed Transaction for each node of
+  // the Client's network. Most of these allocations are of the protobuf objects kept by the Transaction, which outlive
+  // any Arena.
+  const std::uint64_t allocations = gAllocations.load(std::memory_order_relaxed);
+  for (auto _ : state)
+  {
+    TransferTransaction transaction;
+    transaction.addHbarTransfer(AccountId(2ULL), Hbar(-1LL)).addHbarTransfer(AccountId(1000ULL), Hbar(1LL));
+    transaction.freezeWith(&getClient()).signWithOperator(getClient());
+    benchmark::DoNotOptimize(transaction.toBytes());
+  }
+
+  reportAllocations(state, gAllocations.load(std::memory_order_relaxed) - allocations);
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_AllocationsToBuildTransaction);
@@ -0,0 +1,120 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "ECDSAsecp256k1PrivateKey.h"
+#include "ED25519PrivateKey.h"
+#include "PublicKey.h"
+#include "impl/openssl_utils/OpenSSLUtils.h"
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+using namespace Hiero;
+
+namespace
+{
+// The size of the message to sign, verify, and hash. This is roughly the size of a serialized TransactionBody.
+constexpr auto MESSAGE_SIZE = 256;
+
+//-----
+std::vector<std::byte> getMessage()
+{
+  return std::vector<std::byte>(MESSAGE_SIZE, std::byte(0xAB));
+}
+
+} // namespace
+
+//-----
+static void BM_ECDSAsecp256k1Sign(benchmark::State& state)
+{
+  const std::unique_ptr<ECDSAsecp256k1PrivateKey> privateKey = ECDSAsecp256k1PrivateKey::generatePrivateKey();
+  const std::vector<std::byte> message = getMessage();
+
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(privateKey->sign(message));
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ECDSAsecp256k1Sign)->ThreadRange(1, 8)->UseRealTime();
+
+//-----
+static void BM_ECDSAsecp256k1Verify(benchmark::State& state)
+{
+  const std::unique_ptr<ECDSAsecp256k1PrivateKey> privateKey = ECDSAsecp256k1PrivateKey::generatePrivateKey();
+  const std::shared_ptr<PublicKey> publicKey = privateKey->getPublicKey();
+  const std::vector<std::byte> message = getMessage();
+  const std::vector<std::byte> signature = privateKey->sign(message);
+
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(publicKey->verifySignature(signature, message));
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ECDSAsecp256k1Verify)->ThreadRange(1, 8)->UseRealTime();
+
+//-----
+static void BM_ED25519Sign(benchmark::State& state)
+{
+  const std::unique_ptr<ED25519PrivateKey> privateKey = ED25519PrivateKey::generatePrivateKey();
+  const std::vector<std::byte> message = getMessage();
+
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(privateKey->sign(message));
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ED25519Sign)->ThreadRange(1, 8)->UseRealTime();
+
+//-----
+static void BM_ED25519Verify(benchmark::State& state)
+{
+  const std::unique_ptr<ED25519PrivateKey> privateKey = ED25519PrivateKey::generatePrivateKey();
+  const std::shared_ptr<PublicKey> publicKey = privateKey->getPublicKey();
+  const std::vector<std::byte> message = getMessage();
+  const std::vector<std::byte> signature = privateKey->sign(message);
+
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(publicKey->verifySignature(signature, message));
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ED25519Verify)->ThreadRange(1, 8)->UseRealTime();
+
+//-----
+static void BM_KECCAK256(benchmark::State& state)
+{
+  const std::vector<std::byte> message = getMessage();
+
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(internal::OpenSSLUtils::computeKECCAK256(message));
+  }
+
+  state.SetItemsProcessed(state.iterations());
+  state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(message.size()));
+}
+BENCHMARK(BM_KECCAK256)->ThreadRange(1, 8)->UseRealTime();
+
+//-----
+static void BM_SHA512HMAC(benchmark::State& state)
+{
+  const std::vector<std::byte> key(32, std::byte(0x01));
+  const std::vector<std::byte> message = getMessage();
+
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(internal::OpenSSLUtils::computeSHA512HMAC(key, message));
+  }
+
+  state.SetItemsProcessed(state.iterations());
+  state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(message.size()));
+}
+BENCHMARK(BM_SHA512HMAC)->ThreadRange(1, 8)->UseRealTime();
@@ -0,0 +1,96 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "ContractFunctionParameters.h"
+#include "MnemonicBIP39.h"
+#include "impl/RLPItem.h"
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace Hiero;
+
+namespace
+{
+//-----
+RLPItem getRLPItem()
+{
+  // Roughly the shape of an EIP-1559 Ethereum transaction: a list of values, one of which is a list itself.
+  RLPItem item(RLPItem::RLPType::LIST_TYPE);
+  for (int i = 0; i < 9; ++i)
+  {
+    item.pushBack(std::vector<std::byte>(32, std::byte(i)));
+  }
+
+  RLPItem accessList(RLPItem::RLPType::LIST_TYPE);
+  accessList.pushBack(std::vector<std::byte>(20, std::byte(0xAB)));
+  item.pushBack(accessList);
+  item.pushBack(std::vector<std::byte>(256, std::byte(0xCD)));
+  return item;
+}
+
+} // namespace
+
+//-----
+static void BM_ContractFunctionParametersToBytes(benchmark::State& state)
+{
+  ContractFunctionParameters parameters;
+  parameters.addString("Hello, Hiero!")
+    .addAddress("0x00000000000000000000000000000000000003e8")
+    .addUint256(std::vector<std::byte>(32, std::byte(0x01)))
+    .addStringArray({ "one", "two", "three" });
+
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(parameters.toBytes("setMessage"));
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ContractFunctionParametersToBytes);
+
+//-----
+static void BM_RLPItemWrite(benchmark::State& state)
+{
+  const RLPItem item = getRLPItem();
+
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(item.write());
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_RLPItemWrite);
+
+//-----
+static void BM_RLPItemRead(benchmark::State& state)
+{
+  const std::vector<std::byte> bytes = getRLPItem().write();
+
+  for (auto _ : state)
+  {
+    RLPItem item;
+    item.read(bytes);
+    benchmark::DoNotOptimize(item);
+  }
+
+  state.SetItemsProcessed(state.iterations());
+  state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(bytes.size()));
+}
+BENCHMARK(BM_RLPItemRead);
+
+//-----
+static void BM_MnemonicToSeed(benchmark::State& state)
+{
+  const MnemonicBIP39 mnemonic = MnemonicBIP39::generate24WordBIP39Mnemonic();
+
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(mnemonic.toSeed("passphrase"));
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_MnemonicToSeed);
@@ -0,0 +1,186 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "AccountBalance.h"
+#include "AccountBalanceQuery.h"
+#include "AccountId.h"
+#include "Client.h"
+#include "Defaults.h"
+#include "ED25519PrivateKey.h"
+#include "Hbar.h"
+#include "MockNetwork.h"
+#include "TransactionReceipt.h"
+#include "TransactionResponse.h"
+#include "TransferTransaction.h"
+
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <memory>
+
+using namespace Hiero;
+
+namespace
+{
+// The number of nodes on the mock networks.
+constexpr auto NUMBER_OF_NODES = 4U;
+
+// The median latency of the nodes of the mock network with a realistic latency.
+constexpr auto MEDIAN_LATENCY = std::chrono::milliseconds(2);
+
+// The spread of the latency of the nodes of the mock network with a realistic latency. Its 99th percentile is about
+// four times the median.
+constexpr auto LATENCY_SIGMA = 0.6;
+
+// The time until the receipt of a transaction is available on the mock network with a realistic latency.
+constexpr auto RECEIPT_DELAY = std::chrono::milliseconds(5);
+
+//-----
+MockNetwork::Behavior getRealisticBehavior()
+{
+  MockNetwork::Behavior behavior;
+  behavior.mLatency = MockNetwork::logNormalLatency(MEDIAN_LATENCY, LATENCY_SIGMA);
+  behavior.mReceiptDelay = RECEIPT_DELAY;
+  return behavior;
+}
+
+//-----
+MockNetwork::Behavior getBusyBehavior()
+{
+  MockNetwork::Behavior behavior = getRealisticBehavior();
+  behavior.mBusyProbability = 0.2;
+  behavior.mPlatformNotActiveProbability = 0.05;
+  return behavior;
+}
+
+/**
+ * A mock network, and a Client connected to it that pays for transactions.
+ */
+struct MockNetworkClient
+{
+  explicit MockNetworkClient(const MockNetwork::Behavior& behavior)
+    : MockNetworkClient(NUMBER_OF_NODES, behavior)
+  {
+  }
+
+  MockNetworkClient(unsigned int nodes, const MockNetwork::Behavior& behavior)
+    : mNetwork(nodes, behavior)
+    , mClient(mNetwork.createClient())
+  {
+    mClient.setOperator(AccountId(2ULL), ED25519PrivateKey::generatePrivateKey());
+  }
+
+  ~MockNetworkClient() { mClient.close(); }
+
+  MockNetwork mNetwork;
+  Client mClient;
+};
+
+// The latency of the single node of the mock network to which requests are submitted concurrently.
+constexpr auto SINGLE_NODE_LATENCY = std::chrono::milliseconds(5);
+
+//-----
+Client& getSingleNodeClient()
+{
+  // Every request takes the same time, so the throughput only depends on how many requests are in flight to the node.
+  MockNetwork::Behavior behavior;
+  behavior.mLatency = MockNetwork::constantLatency(SINGLE_NODE_LATENCY);
+
+  static MockNetworkClient client{ 1U, behavior };
+  return client.mClient;
+}
+
+//-----
+Client& getInstantClient()
+{
+  static MockNetworkClient client{ MockNetwork::Behavior() };
+  return client.mClient;
+}
+
+//-----
+Client& getRealisticClient()
+{
+  static MockNetworkClient client{ getRealisticBehavior() };
+  return client.mClient;
+}
+
+//-----
+Client& getBusyClient()
+{
+  static MockNetworkClient client{ getBusyBehavior() };
+  return client.mClient;
+}
+
+//-----
+void executeQuery(benchmark::State& state, const Client& client)
+{
+  AccountBalanceQuery query;
+  query.setAccountId(AccountId(1000ULL));
+
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(query.execute(client));
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+//-----
+void executeTransfer(benchmark::State& state, const Client& client)
+{
+  for (auto _ : state)
+  {
+    // Execute a transfer and wait for its receipt, the way most transactions are submitted.
+    const TransactionResponse response = TransferTransaction()
+                                           .addHbarTransfer(AccountId(2ULL), Hbar(-1LL))
+                                           .addHbarTransfer(AccountId(1000ULL), Hbar(1LL))
+                                           .execute(client);
+    benchmark::DoNotOptimize(response.getReceipt(client));
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+} // namespace
+
+//-----
+static void BM_ExecuteQuery(benchmark::State& state)
+{
+  executeQuery(state, getInstantClient());
+}
+BENCHMARK(BM_ExecuteQuery)->ThreadRange(1, 8)->UseRealTime();
+
+//-----
+static void BM_ExecuteQueryWithLatency(benchmark::State& state)
+{
+  executeQuery(state, getRealisticClient());
+}
+BENCHMARK(BM_ExecuteQueryWithLatency)->ThreadRange(1, 64)->UseRealTime();
+
+//-----
+static void BM_ExecuteTransfer(benchmark::State& state)
+{
+  executeTransfer(state, getInstantClient());
+}
+BENCHMARK(BM_ExecuteTransfer)->ThreadRange(1, 8)->UseRealTime();
+
+//-----
+static void BM_ExecuteTransferWithLatency(benchmark::State& state)
+{
+  executeTransfer(state, getRealisticClient());
+}
+BENCHMARK(BM_ExecuteTransferWithLatency)->ThreadRange(1, 64)->UseRealTime();
+
+//-----
+static void BM_ExecuteTransferWithRetries(benchmark::State& state)
+{
+  // A quarter of the requests are answered BUSY or PLATFORM_NOT_ACTIVE, and have to be retried.
+  executeTransfer(state, getBusyClient());
+}
+BENCHMARK(BM_ExecuteTransferWithRetries)->ThreadRange(1, 64)->UseRealTime();
+
+//-----
+static void BM_ConcurrentSubmissionsToOneNode(benchmark::State& state)
+{
+  // Requests to a node are in flight concurrently, so the throughput grows linearly with the number of threads (up to
+  // the maximum number of requests in flight per node) instead of being capped at one request per round trip.
+  executeQuery(state, getSingleNodeClient());
+}
+BENCHMARK(BM_ConcurrentSubmissionsToOneNode)->ThreadRange(1, DEFAULT_MAX_REQUESTS_IN_FLIGHT_PER_NODE)->UseRealTime();
@@ -0,0 +1,919 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "MockNetwork.h"
+#include "impl/TimestampConverter.h"
+
+#include <atomic>
+#include <basic_types.pb.h>
+#include <cmath>
+#include <condition_variable>
+#include <consensus_service.grpc.pb.h>
+#include <crypto_transfer.pb.h>
+#include <cstddef>
+#include <cstdint>
+#include <crypto_service.grpc.pb.h>
+#include <file_service.grpc.pb.h>
+#include <grpcpp/grpcpp.h>
+#include <map>
+#include <mirror/consensus_service.grpc.pb.h>
+#include <mirror/mirror_network_service.grpc.pb.h>
+#include <mutex>
+#include <optional>
+#include <query.pb.h>
+#include <query_header.pb.h>
+#include <response.pb.h>
+#include <response_header.pb.h>
+#include <stdexcept>
+#include <thread>
+#include <token_service.grpc.pb.h>
+#include <transaction.pb.h>
+#include <transaction_body.pb.h>
+#include <transaction_contents.pb.h>
+#include <transaction_receipt.pb.h>
+#include <transaction_record.pb.h>
+#include <transaction_response.pb.h>
+#include <utility>
+#include <vector>
+
+namespace Hiero
+{
+namespace
+{
+// The number of the first entity created on a MockNetwork.
+constexpr auto FIRST_ENTITY_NUM = 1001LL;
+
+// The running hash of every topic message. Its size is that of a SHA-384 hash.
+constexpr auto RUNNING_HASH_SIZE = 48ULL;
+
+// The version of the running hashes of topic messages.
+constexpr auto RUNNING_HASH_VERSION = 3ULL;
+
+// The balance of every account.
+constexpr auto ACCOUNT_BALANCE = 100000000ULL;
+
+// How often a topic subscription checks for new messages and cancellation.
+constexpr auto TOPIC_POLL_INTERVAL = std::chrono::milliseconds(10);
+
+// The time given to the requests in progress to complete when a MockNetwork is shut down.
+constexpr auto SHUTDOWN_GRACE_PERIOD = std::chrono::milliseconds(100);
+
+// The address of the loopback interface, on which all nodes listen.
+constexpr auto LOOPBACK_ADDRESS = "127.0.0.1";
+
+/**
+ * The state shared by the nodes of a MockNetwork: the receipts of the submitted transactions, the contents of the
+ * created files and the messages submitted to topics.
+ */
+class Ledger
+{
+public:
+  /**
+   * A transaction that has been submitted.
+   */
+  struct Entry
+  {
+    /**
+     * The receipt of the transaction.
+     */
+    proto::TransactionReceipt mReceipt;
+
+    /**
+     * The time from which the transaction has reached consensus.
+     */
+    std::chrono::system_clock::time_point mConsensusTime;
+  };
+
+  explicit Ledger(const MockNetwork::Behavior& behavior)
+    : mReceiptDelay(behavior.mReceiptDelay)
+    , mConsensusJitter(behavior.mConsensusJitter)
+    , mRandom(behavior.mSeed)
+  {
+  }
+
+  // Submit a transaction. Returns DUPLICATE_TRANSACTION if a transaction with the same ID has already been submitted.
+  proto::ResponseCodeEnum submit(const proto::TransactionBody& body)
+  {
+    std::unique_lock lock(mMutex);
+    const std::string key = body.transactionid().SerializeAsString();
+    if (mEntries.find(key) != mEntries.end())
+    {
+      return proto::ResponseCodeEnum::DUPLICATE_TRANSACTION;
+    }
+
+    const std::chrono::nanoseconds jitter(
+      std::uniform_int_distribution<std::chrono::nanoseconds::rep>(0, mConsensusJitter.count())(mRandom));
+
+    Entry& entry = mEntries[key];
+    entry.mConsensusTime = std::chrono::system_clock::now() +
+                           std::chrono::duration_cast<std::chrono::system_clock::duration>(mReceiptDelay + jitter);
+    entry.mReceipt.set_status(proto::ResponseCodeEnum::SUCCESS);
+
+    switch (body.data_case())
+    {
+      case proto::TransactionBody::DataCase::kCryptoCreateAccount:
+        entry.mReceipt.mutable_accountid()->set_accountnum(mNextEntityNum++);
+        break;
+      case proto::TransactionBody::DataCase::kTokenCreation:
+        entry.mReceipt.mutable_tokenid()->set_tokennum(mNextEntityNum++);
+        break;
+      case proto::TransactionBody::DataCase::kConsensusCreateTopic:
+        entry.mReceipt.mutable_topicid()->set_topicnum(mNextEntityNum++);
+        break;
+      case proto::TransactionBody::DataCase::kFileCreate:
+        entry.mReceipt.mutable_fileid()->set_filenum(mNextEntityNum);
+        mFiles[mNextEntityNum++].emplace(entry.mConsensusTime, body.filecreate().contents());
+        break;
+      case proto::TransactionBody::DataCase::kFileAppend:
+        mFiles[body.fileappend().fileid().filenum()].emplace(entry.mConsensusTime, body.fileappend().contents());
+        break;
+      case proto::TransactionBody::DataCase::kConsensusSubmitMessage:
+      {
+        const proto::ConsensusSubmitMessageTransactionBody& submitMessage = body.consensussubmitmessage();
+        std::vector<com::hedera::mirror::api::proto::ConsensusTopicResponse>& messages =
+          mTopicMessages[submitMessage.topicid().topicnum()];
+
+        com::hedera::mirror::api::proto::ConsensusTopicResponse& message = messages.emplace_back();
+        message.set_allocated_consensustimestamp(internal::TimestampConverter::toProtobuf(entry.mConsensusTime));
+        message.set_message(submitMessage.message());
+        message.set_runninghash(std::string(RUNNING_HASH_SIZE, '\0'));
+        message.set_sequencenumber(messages.size());
+        message.set_runninghashversion(RUNNING_HASH_VERSION);
+        if (submitMessage.has_chunkinfo())
+        {
+          *message.mutable_chunkinfo() = submitMessage.chunkinfo();
+        }
+
+        entry.mReceipt.set_topicsequencenumber(messages.size());
+        entry.mReceipt.set_topicrunninghash(message.runninghash());
+        entry.mReceipt.set_topicrunninghashversion(RUNNING_HASH_VERSION);
+        mTopicMessageAdded.notify_all();
+        break;
+      }
+      default:
+        break;
+    }
+
+    return proto::ResponseCodeEnum::OK;
+  }
+
+  // Get a submitted transaction, if it has been submitted.
+  [[nodiscard]] std::optional<Entry> find(const proto::TransactionID& transactionId) const
+  {
+    std::unique_lock lock(mMutex);
+    if (const auto iter = mEntries.find(transactionId.SerializeAsString()); iter != mEntries.end())
+    {
+      return iter->second;
+    }
+
+    return std::nullopt;
+  }
+
+  // Get the contents of a file, as appended in the order of consensus by the transactions that have reached it. Files
+  // that don't exist are empty.
+  [[nodiscard]] std::string getFileContents(const proto::FileID& fileId) const
+  {
+    std::unique_lock lock(mMutex);
+    const auto iter = mFiles.find(fileId.filenum());
+    if (iter == mFiles.end())
+    {
+      return {};
+    }
+
+    std::string contents;
+    const std::chrono::system_clock::time_point now = std::chrono::system_clock::now();
+    for (auto part = iter->second.cbegin(); part != iter->second.cend() && part->first <= now; ++part)
+    {
+      contents += part->second;
+    }
+
+    return contents;
+  }
+
+  // Wait for the messages of a topic from a sequence number that have reached consensus. Returns no messages if none
+  // have reached consensus within the poll interval, or if the ledger is closed.
+  [[nodiscard]] std::vector<com::hedera::mirror::api::proto::ConsensusTopicResponse> waitForTopicMessages(
+    std::int64_t topicNum,
+    std::uint64_t sequenceNumber)
+  {
+    // The number of messages of the topic, from the sequence number, that have reached consensus.
+    const auto getReadyMessages = [this, topicNum, sequenceNumber]()
+    {
+      const auto iter = mTopicMessages.find(topicNum);
+      if (iter == mTopicMessages.end())
+      {
+        return 0ULL;
+      }
+
+      const std::chrono::system_clock::time_point now = std::chrono::system_clock::now();
+      auto ready = 0ULL;
+      for (std::uint64_t i = sequenceNumber - 1ULL; i < iter->second.size(); ++i, ++ready)
+      {
+        if (internal::TimestampConverter::fromProtobuf(iter->second.at(i).consensustimestamp()) > now)
+        {
+          break;
+        }
+      }
+
+      return ready;
+    };
+
+    std::unique_lock lock(mMutex);
+    mTopicMessageAdded.wait_for(
+      lock, TOPIC_POLL_INTERVAL, [this, &getReadyMessages]() { return mClosed || getReadyMessages() > 0ULL; });
+    if (mClosed)
+    {
+      return {};
+    }
+
+    const auto ready = static_cast<std::ptrdiff_t>(getReadyMessages());
+    if (ready == 0)
+    {
+      return {};
+    }
+
+    const auto first = mTopicMessages.at(topicNum).cbegin() + static_cast<std::ptrdiff_t>(sequenceNumber - 1ULL);
+    return std::vector<com::hedera::mirror::api::proto::ConsensusTopicResponse>(first, first + ready);
+  }
+
+  // Close this Ledger, waking up all topic subscriptions so that they end.
+  void close()
+  {
+    std::unique_lock lock(mMutex);
+    mClosed = true;
+    mTopicMessageAdded.notify_all();
+  }
+
+  [[nodiscard]] bool isClosed() const
+  {
+    std::unique_lock lock(mMutex);
+    return mClosed;
+  }
+
+private:
+  // The time from the submission of a transaction until it reaches consensus.
+  const std::chrono::nanoseconds mReceiptDelay;
+
+  // The maximum random time added to the receipt delay of each transaction.
+  const std::chrono::nanoseconds mConsensusJitter;
+
+  // The random number generator of the consensus jitter.
+  std::mt19937_64 mRandom;
+
+  // The submitted transactions, by their serialized transaction ID.
+  std::unordered_map<std::string, Entry> mEntries;
+
+  // The contents created and appended by the transactions on each file, by file number and then by consensus time.
+  std::unordered_map<std::int64_t, std::multimap<std::chrono::system_clock::time_point, std::string>> mFiles;
+
+  // The messages submitted to each topic, by topic number, ordered by sequence number.
+  std::unordered_map<std::int64_t, std::vector<com::hedera::mirror::api::proto::ConsensusTopicResponse>> mTopicMessages;
+
+  // The number of the next created entity.
+  std::int64_t mNextEntityNum = FIRST_ENTITY_NUM;
+
+  // Has this Ledger been closed?
+  bool mClosed = false;
+
+  // Notified when a message is submitted to a topic, or when this Ledger is closed.
+  std::condition_variable mTopicMessageAdded;
+
+  // The mutex protecting this Ledger.
+  mutable std::mutex mMutex;
+};
+
+/**
+ * The counters of the requests answered by the nodes of a MockNetwork.
+ */
+struct Counters
+{
+  std::atomic<std::uint64_t> mTransactions = 0ULL;
+  std::atomic<std::uint64_t> mQueries = 0ULL;
+  std::atomic<std::uint64_t> mBusy = 0ULL;
+  std::atomic<std::uint64_t> mPlatformNotActive = 0ULL;
+};
+
+/**
+ * The state of a consensus node, with which its services answer requests.
+ */
+class NodeState
+{
+public:
+  NodeState(const MockNetwork::Behavior& behavior, std::uint64_t seed, Ledger& ledger, Counters& counters)
+    : mBehavior(behavior)
+    , mRandom(seed)
+    , mLedger(ledger)
+    , mCounters(counters)
+  {
+  }
+
+  // Submit a transaction to the Ledger, after the sampled latency and unless a failure is injected.
+  grpc::Status submit(const proto::Transaction& transaction, proto::TransactionResponse* response)
+  {
+    mCounters.mTransactions.fetch_add(1ULL, std::memory_order_relaxed);
+    proto::ResponseCodeEnum code = getPrecheckCode();
+    if (code == proto::ResponseCodeEnum::OK)
+    {
+      proto::SignedTransaction signedTransaction;
+      proto::TransactionBody body;
+      if (!signedTransaction.ParseFromString(transaction.signedtransactionbytes()) ||
+          !body.ParseFromString(signedTransaction.bodybytes()))
+      {
+        code = proto::ResponseCodeEnum::INVALID_TRANSACTION_BODY;
+      }
+      else
+      {
+        code = mLedger.submit(body);
+      }
+    }
+
+    response->set_nodetransactionprecheckcode(code);
+    return grpc::Status::OK;
+  }
+
+  // Answer the header of a query, after the sampled latency and unless a failure is injected. Returns true if the
+  // query should be answered, false if it's answered by its header alone (a failure, or the cost of the query).
+  bool answerQuery(const proto::QueryHeader& queryHeader, proto::ResponseHeader* responseHeader, bool paid)
+  {
+    mCounters.mQueries.fetch_add(1ULL, std::memory_order_relaxed);
+    const proto::ResponseCodeEnum code = getPrecheckCode();
+    responseHeader->set_nodetransactionprecheckcode(code);
+    responseHeader->set_responsetype(queryHeader.responsetype());
+    if (code != proto::ResponseCodeEnum::OK)
+    {
+      return false;
+    }
+
+    if (queryHeader.responsetype() == proto::ResponseType::COST_ANSWER)
+    {
+      responseHeader->set_cost(paid ? mBehavior.mQueryCost : 0ULL);
+      return false;
+    }
+
+    // A paid query whose payment doesn't cover its cost is answered without the cost, so the cost has to be asked for.
+    if (paid && getPayment(queryHeader.payment()) < mBehavior.mQueryCost)
+    {
+      responseHeader->set_nodetransactionprecheckcode(proto::ResponseCodeEnum::INSUFFICIENT_TX_FEE);
+      return false;
+    }
+
+    return true;
+  }
+
+  [[nodiscard]] Ledger& getLedger() const { return mLedger; }
+
+private:
+  // Get the number of tinybars a query payment transfers to the node.
+  [[nodiscard]] static std::uint64_t getPayment(const proto::Transaction& payment)
+  {
+    proto::SignedTransaction signedTransaction;
+    proto::TransactionBody body;
+    if (!signedTransaction.ParseFromString(payment.signedtransactionbytes()) ||
+        !body.ParseFromString(signedTransaction.bodybytes()))
+    {
+      return 0ULL;
+    }
+
+    std::uint64_t amount = 0ULL;
+    for (const proto::AccountAmount& accountAmount : body.cryptotransfer().transfers().accountamounts())
+    {
+      if (accountAmount.amount() > 0LL)
+      {
+        amount += static_cast<std::uint64_t>(accountAmount.amount());
+      }
+    }
+
+    return amount;
+  }
+
+  // Sleep for a sampled latency, and sample the precheck code with which to answer.
+  proto::ResponseCodeEnum getPrecheckCode()
+  {
+    std::chrono::nanoseconds latency;
+    double draw = 0.0;
+    {
+      std::unique_lock lock(mMutex);
+      latency = mBehavior.mLatency(mRandom);
+      draw = std::uniform_real_distribution<double>(0.0, 1.0)(mRandom);
+    }
+
+    std::this_thread::sleep_for(latency);
+
+    if (draw < mBehavior.mBusyProbability)
+    {
+      mCounters.mBusy.fetch_add(1ULL, std::memory_order_relaxed);
+      return proto::ResponseCodeEnum::BUSY;
+    }
+
+    if (draw < mBehavior.mBusyProbability + mBehavior.mPlatformNotActiveProbability)
+    {
+      mCounters.mPlatformNotActive.fetch_add(1ULL, std::memory_order_relaxed);
+      return proto::ResponseCodeEnum::PLATFORM_NOT_ACTIVE;
+    }
+
+    return proto::ResponseCodeEnum::OK;
+  }
+
+  // The behavior of this node.
+  const MockNetwork::Behavior& mBehavior;
+
+  // The random number generator of this node.
+  std::mt19937_64 mRandom;
+
+  // The ledger shared by the nodes of the network.
+  Ledger& mLedger;
+
+  // The counters shared by the nodes of the network.
+  Counters& mCounters;
+
+  // The mutex protecting the random number generator.
+  std::mutex mMutex;
+};
+
+/**
+ * The CryptoService of a consensus node.
+ */
+class CryptoService : public proto::CryptoService::Service
+{
+public:
+  explicit CryptoService(NodeState& node)
+    : mNode(node)
+  {
+  }
+
+  grpc::Status createAccount(grpc::ServerContext*,
+                             const proto::Transaction* request,
+                             proto::TransactionResponse* response) override
+  {
+    return mNode.submit(*request, response);
+  }
+
+  grpc::Status cryptoTransfer(grpc::ServerContext*,
+                              const proto::Transaction* request,
+                              proto::TransactionResponse* response) override
+  {
+    return mNode.submit(*request, response);
+  }
+
+  grpc::Status cryptoGetBalance(grpc::ServerContext*, const proto::Query* request, proto::Response* response) override
+  {
+    const proto::CryptoGetAccountBalanceQuery& query = request->cryptogetaccountbalance();
+    proto::CryptoGetAccountBalanceResponse* answer = response->mutable_cryptogetaccountbalance();
+    if (mNode.answerQuery(query.header(), answer->mutable_header(), false))
+    {
+      *answer->mutable_accountid() = query.accountid();
+      answer->set_balance(ACCOUNT_BALANCE);
+    }
+
+    return grpc::Status::OK;
+  }
+
+  grpc::Status getTransactionReceipts(grpc::ServerContext*,
+                                      const proto::Query* request,
+                                      proto::Response* response) override
+  {
+    const proto::TransactionGetReceiptQuery& query = request->transactiongetreceipt();
+    proto::TransactionGetReceiptResponse* answer = response->mutable_transactiongetreceipt();
+    if (mNode.answerQuery(query.header(), answer->mutable_header(), false))
+    {
+      const std::optional<Ledger::Entry> entry = mNode.getLedger().find(query.transactionid());
+      if (!entry.has_value())
+      {
+        answer->mutable_header()->set_nodetransactionprecheckcode(proto::ResponseCodeEnum::RECEIPT_NOT_FOUND);
+      }
+      else if (entry->mConsensusTime > std::chrono::system_clock::now())
+      {
+        answer->mutable_receipt()->set_status(proto::ResponseCodeEnum::UNKNOWN);
+      }
+      else
+      {
+        *answer->mutable_receipt() = entry->mReceipt;
+      }
+    }
+
+    return grpc::Status::OK;
+  }
+
+  grpc::Status getTxRecordByTxID(grpc::ServerContext*, const proto::Query* request, proto::Response* response) override
+  {
+    const proto::TransactionGetRecordQuery& query = request->transactiongetrecord();
+    proto::TransactionGetRecordResponse* answer = response->mutable_transactiongetrecord();
+    if (mNode.answerQuery(query.header(), answer->mutable_header(), true))
+    {
+      const std::optional<Ledger::Entry> entry = mNode.getLedger().find(query.transactionid());
+      if (!entry.has_value())
+      {
+        answer->mutable_header()->set_nodetransactionprecheckcode(proto::ResponseCodeEnum::RECORD_NOT_FOUND);
+      }
+      else if (entry->mConsensusTime > std::chrono::system_clock::now())
+      {
+        answer->mutable_transactionrecord()->mutable_receipt()->set_status(proto::ResponseCodeEnum::UNKNOWN);
+      }
+      else
+      {
+        proto::TransactionRecord* record = answer->mutable_transactionrecord();
+        *record->mutable_receipt() = entry->mReceipt;
+        *record->mutable_transactionid() = query.transactionid();
+        record->set_allocated_consensustimestamp(internal::TimestampConverter::toProtobuf(entry->mConsensusTime));
+      }
+    }
+
+    return grpc::Status::OK;
+  }
+
+private:
+  NodeState& mNode;
+};
+
+/**
+ * The TokenService of a consensus node.
+ */
+class TokenService : public proto::TokenService::Service
+{
+public:
+  explicit TokenService(NodeState& node)
+    : mNode(node)
+  {
+  }
+
+  grpc::Status createToken(grpc::ServerContext*,
+                           const proto::Transaction* request,
+                           proto::TransactionResponse* response) override
+  {
+    return mNode.submit(*request, response);
+  }
+
+  grpc::Status mintToken(grpc::ServerContext*,
+                         const proto::Transaction* request,
+                         proto::TransactionResponse* response) override
+  {
+    return mNode.submit(*request, response);
+  }
+
+  grpc::Status associateTokens(grpc::ServerContext*,
+                               const proto::Transaction* request,
+                               proto::TransactionResponse* response) override
+  {
+    return mNode.submit(*request, response);
+  }
+
+private:
+  NodeState& mNode;
+};
+
+/**
+ * The ConsensusService of a consensus node.
+ */
+class ConsensusService : public proto::ConsensusService::Service
+{
+public:
+  explicit ConsensusService(NodeState& node)
+    : mNode(node)
+  {
+  }
+
+  grpc::Status createTopic(grpc::ServerContext*,
+                           const proto::Transaction* request,
+                           proto::TransactionResponse* response) override
+  {
+    return mNode.submit(*request, response);
+  }
+
+  grpc::Status submitMessage(grpc::ServerContext*,
+                             const proto::Transaction* request,
+                             proto::TransactionResponse* response) override
+  {
+    return mNode.submit(*request, response);
+  }
+
+private:
+  NodeState& mNode;
+};
+
+/**
+ * The FileService of a consensus node.
+ */
+class FileService : public proto::FileService::Service
+{
+public:
+  explicit FileService(NodeState& node)
+    : mNode(node)
+  {
+  }
+
+  grpc::Status createFile(grpc::ServerContext*,
+                          const proto::Transaction* request,
+                          proto::TransactionResponse* response) override
+  {
+    return mNode.submit(*request, response);
+  }
+
+  grpc::Status appendContent(grpc::ServerContext*,
+                             const proto::Transaction* request,
+                             proto::TransactionResponse* response) override
+  {
+    return mNode.submit(*request, response);
+  }
+
+  grpc::Status getFileContent(grpc::ServerContext*, const proto::Query* request, proto::Response* response) override
+  {
+    const proto::FileGetContentsQuery& query = request->filegetcontents();
+    proto::FileGetContentsResponse* answer = response->mutable_filegetcontents();
+    if (mNode.answerQuery(query.header(), answer->mutable_header(), true))
+    {
+      proto::FileGetContentsResponse::FileContents* contents = answer->mutable_filecontents();
+      *contents->mutable_fileid() = query.fileid();
+      contents->set_contents(mNode.getLedger().getFileContents(query.fileid()));
+    }
+
+    return grpc::Status::OK;
+  }
+
+private:
+  NodeState& mNode;
+};
+
+/**
+ * The mirror ConsensusService of the mirror node, streaming the messages of a topic as they reach consensus.
+ */
+class MirrorConsensusService : public com::hedera::mirror::api::proto::ConsensusService::Service
+{
+public:
+  explicit MirrorConsensusService(Ledger& ledger)
+    : mLedger(ledger)
+  {
+  }
+
+  grpc::Status subscribeTopic(
+    grpc::ServerContext* context,
+    const com::hedera::mirror::api::proto::ConsensusTopicQuery* request,
+    grpc::ServerWriter<com::hedera::mirror::api::proto::ConsensusTopicResponse>* writer) override
+  {
+    const std::optional<std::chrono::system_clock::time_point> startTime =
+      request->has_consensusstarttime()
+        ? std::optional(internal::TimestampConverter::fromProtobuf(request->consensusstarttime()))
+        : std::nullopt;
+    const std::optional<std::chrono::system_clock::time_point> endTime =
+      request->has_consensusendtime()
+        ? std::optional(internal::TimestampConverter::fromProtobuf(request->consensusendtime()))
+        : std::nullopt;
+
+    std::uint64_t sequenceNumber = 1ULL;
+    std::uint64_t sent = 0ULL;
+    while (!context->IsCancelled() && !mLedger.isClosed())
+    {
+      for (const com::hedera::mirror::api::proto::ConsensusTopicResponse& message :
+           mLedger.waitForTopicMessages(request->topicid().topicnum(), sequenceNumber))
+      {
+        ++sequenceNumber;
+        const std::chrono::system_clock::time_point consensusTime =
+          internal::TimestampConverter::fromProtobuf(message.consensustimestamp());
+        if (startTime.has_value() && consensusTime < *startTime)
+        {
+          continue;
+        }
+
+        if ((endTime.has_value() && consensusTime >= *endTime) || !writer->Write(message))
+        {
+          return grpc::Status::OK;
+        }
+
+        if (++sent == request->limit())
+        {
+          return grpc::Status::OK;
+        }
+      }
+    }
+
+    return grpc::Status::OK;
+  }
+
+private:
+  Ledger& mLedger;
+};
+
+/**
+ * The mirror NetworkService of the mirror node, streaming the address book of the consensus nodes.
+ */
+class MirrorNetworkService : public com::hedera::mirror::api::proto::NetworkService::Service
+{
+public:
+  explicit MirrorNetworkService(std::vector<std::pair<AccountId, int>> nodes)
+    : mNodes(std::move(nodes))
+  {
+  }
+
+  grpc::Status getNodes(grpc::ServerContext*,
+                        const com::hedera::mirror::api::proto::AddressBookQuery* request,
+                        grpc::ServerWriter<proto::NodeAddress>* writer) override
+  {
+    for (std::size_t i = 0ULL; i < mNodes.size(); ++i)
+    {
+      if (request->limit() > 0 && i >= static_cast<std::size_t>(request->limit()))
+      {
+        break;
+      }
+
+      proto::NodeAddress address;
+      address.set_nodeid(static_cast<std::int64_t>(i));
+      address.set_allocated_nodeaccountid(mNodes.at(i).first.toProtobuf().release());
+      proto::ServiceEndpoint* endpoint = address.add_serviceendpoint();
+      endpoint->set_ipaddressv4(std::string{ '\x7f', '\0', '\0', '\x01' });
+      endpoint->set_port(mNodes.at(i).second);
+      writer->Write(address);
+    }
+
+    return grpc::Status::OK;
+  }
+
+private:
+  // The account IDs and ports of the consensus nodes.
+  const std::vector<std::pair<AccountId, int>> mNodes;
+};
+
+/**
+ * A consensus node: its state, its services and the server serving them.
+ */
+struct ConsensusNode
+{
+  ConsensusNode(const MockNetwork::Behavior& behavior, std::uint64_t seed, Ledger& ledger, Counters& counters)
+    : mState(behavior, seed, ledger, counters)
+    , mCryptoService(mState)
+    , mTokenService(mState)
+    , mConsensusService(mState)
+    , mFileService(mState)
+  {
+  }
+
+  NodeState mState;
+  CryptoService mCryptoService;
+  TokenService mTokenService;
+  ConsensusService mConsensusService;
+  FileService mFileService;
+  std::unique_ptr<grpc::Server> mServer;
+  int mPort = 0;
+};
+
+//-----
+std::unique_ptr<grpc::Server> startServer(const std::vector<grpc::Service*>& services, int& port)
+{
+  grpc::ServerBuilder builder;
+  builder.AddListeningPort(std::string(LOOPBACK_ADDRESS) + ":0", grpc::InsecureServerCredentials(), &port);
+  for (grpc::Service* service : services)
+  {
+    builder.RegisterService(service);
+  }
+
+  std::unique_ptr<grpc::Server> server = builder.BuildAndStart();
+  if (!server || port == 0)
+  {
+    throw std::runtime_error("Unable to start a MockNetwork node on the loopback interface");
+  }
+
+  return server;
+}
+
+} // namespace
+
+//-----
+struct MockNetwork::MockNetworkImpl
+{
+  explicit MockNetworkImpl(std::vector<Behavior> behaviors)
+    : mBehaviors(std::move(behaviors))
+    , mLedger(mBehaviors.front())
+  {
+  }
+
+  // The behavior of each consensus node.
+  const std::vector<Behavior> mBehaviors;
+
+  // The ledger shared by the nodes.
+  Ledger mLedger;
+
+  // The counters of the requests answered by the nodes.
+  Counters mCounters;
+
+  // The consensus nodes.
+  std::vector<std::unique_ptr<ConsensusNode>> mNodes;
+
+  // The services of the mirror node, and the server serving them.
+  std::unique_ptr<MirrorConsensusService> mMirrorConsensusService;
+  std::unique_ptr<MirrorNetworkService> mMirrorNetworkService;
+  std::unique_ptr<grpc::Server> mMirrorServer;
+  int mMirrorPort = 0;
+};
+
+//-----
+MockNetwork::LatencyDistribution MockNetwork::constantLatency(const std::chrono::nanoseconds& latency)
+{
+  return [latency](std::mt19937_64&) { return latency; };
+}
+
+//-----
+MockNetwork::LatencyDistribution MockNetwork::uniformLatency(const std::chrono::nanoseconds& min,
+                                                             const std::chrono::nanoseconds& max)
+{
+  return [min, max](std::mt19937_64& random)
+  { return std::chrono::nanoseconds(std::uniform_int_distribution<std::int64_t>(min.count(), max.count())(random)); };
+}
+
+//-----
+MockNetwork::LatencyDistribution MockNetwork::logNormalLatency(const std::chrono::nanoseconds& median, double sigma)
+{
+  return [median, sigma](std::mt19937_64& random)
+  {
+    return std::chrono::nanoseconds(static_cast<std::int64_t>(
+      std::lognormal_distribution<double>(std::log(static_cast<double>(median.count())), sigma)(random)));
+  };
+}
+
+//-----
+MockNetwork::MockNetwork(unsigned int nodes)
+  : MockNetwork(nodes, Behavior())
+{
+}
+
+//-----
+MockNetwork::MockNetwork(unsigned int nodes, Behavior behavior)
+  : MockNetwork(std::vector<Behavior>(nodes, behavior))
+{
+}
+
+//-----
+MockNetwork::MockNetwork(std::vector<Behavior> behaviors)
+{
+  if (behaviors.empty())
+  {
+    throw std::invalid_argument("A MockNetwork needs at least one consensus node");
+  }
+
+  mImpl = std::make_unique<MockNetworkImpl>(std::move(behaviors));
+
+  std::vector<std::pair<AccountId, int>> addresses;
+  for (unsigned int i = 0U; i < mImpl->mBehaviors.size(); ++i)
+  {
+    const Behavior& behavior = mImpl->mBehaviors.at(i);
+    std::unique_ptr<ConsensusNode>& node = mImpl->mNodes.emplace_back(
+      std::make_unique<ConsensusNode>(behavior, behavior.mSeed + i, mImpl->mLedger, mImpl->mCounters));
+    node->mServer = startServer(
+      { &node->mCryptoService, &node->mTokenService, &node->mConsensusService, &node->mFileService }, node->mPort);
+    addresses.emplace_back(AccountId(3ULL + i), node->mPort);
+  }
+
+  mImpl->mMirrorConsensusService = std::make_unique<MirrorConsensusService>(mImpl->mLedger);
+  mImpl->mMirrorNetworkService = std::make_unique<MirrorNetworkService>(std::move(addresses));
+  mImpl->mMirrorServer =
+    startServer({ mImpl->mMirrorConsensusService.get(), mImpl->mMirrorNetworkService.get() }, mImpl->mMirrorPort);
+}
+
+//-----
+MockNetwork::~MockNetwork()
+{
+  // End the topic subscriptions first, as they only return once they notice.
+  mImpl->mLedger.close();
+
+  const std::chrono::system_clock::time_point deadline = std::chrono::system_clock::now() + SHUTDOWN_GRACE_PERIOD;
+  mImpl->mMirrorServer->Shutdown(deadline);
+  for (const std::unique_ptr<ConsensusNode>& node : mImpl->mNodes)
+  {
+    node->mServer->Shutdown(deadline);
+  }
+}
+
+//-----
+Client MockNetwork::createClient() const
+{
+  Client client = Client::forNetwork(getNetwork());
+  client.setMirrorNetwork({ getMirrorNetworkAddress() });
+  return client;
+}
+
+//-----
+std::unordered_map<std::string, AccountId> MockNetwork::getNetwork() const
+{
+  std::unordered_map<std::string, AccountId> network;
+  for (unsigned int i = 0U; i < mImpl->mNodes.size(); ++i)
+  {
+    network.try_emplace(std::string(LOOPBACK_ADDRESS) + ':' + std::to_string(mImpl->mNodes.at(i)->mPort),
+                        AccountId(3ULL + i));
+  }
+
+  return network;
+}
+
+//-----
+std::string MockNetwork::getMirrorNetworkAddress() const
+{
+  return std::string(LOOPBACK_ADDRESS) + ':' + std::to_string(mImpl->mMirrorPort);
+}
+
+//-----
+MockNetwork::Statistics MockNetwork::getStatistics() const
+{
+  Statistics statistics;
+  statistics.mTransactions = mImpl->mCounters.mTransactions.load(std::memory_order_relaxed);
+  statistics.mQueries = mImpl->mCounters.mQueries.load(std::memory_order_relaxed);
+  statistics.mBusy = mImpl->mCounters.mBusy.load(std::memory_order_relaxed);
+  statistics.mPlatformNotActive = mImpl->mCounters.mPlatformNotActive.load(std::memory_order_relaxed);
+  return statistics;
+}
+
+} // namespace Hiero
@@ -0,0 +1,210 @@
+// SPDX-License-Identifier: Apache-2.0
+#ifndef HIERO_SDK_CPP_MOCK_NETWORK_H_
+#define HIERO_SDK_CPP_MOCK_NETWORK_H_
+
+#include "AccountId.h"
+#include "Client.h"
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Hiero
+{
+/**
+ * An in-process stand-in for a network, to load test a Client without a live network. Its consensus nodes serve the
+ * Crypto, Token, Consensus and File services and its mirror node serves the mirror Consensus and Network services, all
+ * on the loopback interface. The consensus nodes share a ledger: transactions get a SUCCESS receipt (and a new entity
+ * ID, if they create one) once the receipt delay has passed, file contents are appended in the order in which the
+ * appends reach consensus, and messages submitted to a topic are streamed to the subscribers of the topic from the
+ * mirror node.
+ *
+ * Every transaction and query is answered after a latency sampled from a distribution, and can be answered BUSY or
+ * PLATFORM_NOT_ACTIVE with a given probability. The random number generator of each node is seeded from the seed of
+ * the Behavior, so that a single-threaded Client sees the same sequence of latencies and failures on every run.
+ */
+class MockNetwork
+{
+public:
+  /**
+   * A distribution of latencies, sampled with the random number generator of a node.
+   */
+  using LatencyDistribution = std::function<std::chrono::nanoseconds(std::mt19937_64&)>;
+
+  /**
+   * The behavior of the consensus nodes of a MockNetwork.
+   */
+  struct Behavior
+  {
+    /**
+     * The distribution of the latency with which each transaction and query is answered.
+     */
+    LatencyDistribution mLatency = constantLatency(std::chrono::nanoseconds(0));
+
+    /**
+     * The probability with which a transaction or query is answered with BUSY.
+     */
+    double mBusyProbability = 0.0;
+
+    /**
+     * The probability with which a transaction or query is answered with PLATFORM_NOT_ACTIVE.
+     */
+    double mPlatformNotActiveProbability = 0.0;
+
+    /**
+     * The time from the submission of a transaction until its receipt and record are available.
+     */
+    std::chrono::nanoseconds mReceiptDelay = std::chrono::nanoseconds(0);
+
+    /**
+     * The maximum random time added to the receipt delay of each transaction. Transactions submitted close together
+     * may then reach consensus in another order than they were submitted in.
+     */
+    std::chrono::nanoseconds mConsensusJitter = std::chrono::nanoseconds(0);
+
+    /**
+     * The cost of paid queries, in tinybars. A paid query whose payment is less is answered with INSUFFICIENT_TX_FEE.
+     */
+    std::uint64_t mQueryCost = 100ULL;
+
+    /**
+     * The seed of the random number generators of the nodes.
+     */
+    std::uint64_t mSeed = 0ULL;
+  };
+
+  /**
+   * The number of requests a MockNetwork has answered.
+   */
+  struct Statistics
+  {
+    /**
+     * The number of transactions submitted to the consensus nodes.
+     */
+    std::uint64_t mTransactions = 0ULL;
+
+    /**
+     * The number of queries submitted to the consensus nodes.
+     */
+    std::uint64_t mQueries = 0ULL;
+
+    /**
+     * The number of transactions and queries answered with BUSY.
+     */
+    std::uint64_t mBusy = 0ULL;
+
+    /**
+     * The number of transactions and queries answered with PLATFORM_NOT_ACTIVE.
+     */
+    std::uint64_t mPlatformNotActive = 0ULL;
+  };
+
+  /**
+   * Get a distribution that always returns the same latency.
+   *
+   * @param latency The latency to return.
+   * @return The distribution.
+   */
+  [[nodiscard]] static LatencyDistribution constantLatency(const std::chrono::nanoseconds& latency);
+
+  /**
+   * Get a distribution of latencies uniformly spread over a range.
+   *
+   * @param min The minimum latency.
+   * @param max The maximum latency.
+   * @return The distribution.
+   */
+  [[nodiscard]] static LatencyDistribution uniformLatency(const std::chrono::nanoseconds& min,
+                                                          const std::chrono::nanoseconds& max);
+
+  /**
+   * Get a log-normal distribution of latencies, which has the long tail of the latencies of a real network.
+   *
+   * @param median The median latency.
+   * @param sigma  The standard deviation of the logarithm of the latency. The 99th percentile is about
+   *               median * e^(2.33 * sigma).
+   * @return The distribution.
+   */
+  [[nodiscard]] static LatencyDistribution logNormalLatency(const std::chrono::nanoseconds& median, double sigma);
+
+  /**
+   * Start a MockNetwork whose consensus nodes answer immediately and never fail. The nodes listen on ports chosen by
+   * the operating system.
+   *
+   * @param nodes The number of consensus nodes, with the account IDs 0.0.3, 0.0.4, etc.
+   */
+  explicit MockNetwork(unsigned int nodes);
+
+  /**
+   * Start a MockNetwork. The nodes listen on ports chosen by the operating system.
+   *
+   * @param nodes    The number of consensus nodes, with the account IDs 0.0.3, 0.0.4, etc.
+   * @param behavior The behavior of the consensus nodes.
+   * @throws std::invalid_argument If there are no nodes.
+   */
+  MockNetwork(unsigned int nodes, Behavior behavior);
+
+  /**
+   * Start a MockNetwork whose consensus nodes each behave differently. The nodes listen on ports chosen by the
+   * operating system. The receipt delay and consensus jitter of the first behavior apply to all the nodes, as they
+   * share a ledger.
+   *
+   * @param behaviors The behavior of each consensus node. The nodes have the account IDs 0.0.3, 0.0.4, etc., in order.
+   * @throws std::invalid_argument If no behaviors are given.
+   */
+  explicit MockNetwork(std::vector<Behavior> behaviors);
+
+  /**
+   * Shut down the nodes, cancelling the requests in progress.
+   */
+  ~MockNetwork();
+
+  MockNetwork(const MockNetwork&) = delete;
+  MockNetwork& operator=(const MockNetwork&) = delete;
+  MockNetwork(MockNetwork&&) = delete;
+  MockNetwork& operator=(MockNetwork&&) = delete;
+
+  /**
+   * Create a Client connected to the nodes of this MockNetwork. The Client has no operator.
+   *
+   * @return A Client connected to the nodes of this MockNetwork.
+   */
+  [[nodiscard]] Client createClient() const;
+
+  /**
+   * Get the consensus nodes of this MockNetwork.
+   *
+   * @return A map of the addresses of the consensus nodes to their account IDs.
+   */
+  [[nodiscard]] std::unordered_map<std::string, AccountId> getNetwork() const;
+
+  /**
+   * Get the address of the mirror node of this MockNetwork.
+   *
+   * @return The address of the mirror node.
+   */
+  [[nodiscard]] std::string getMirrorNetworkAddress() const;
+
+  /**
+   * Get the number of requests this MockNetwork has answered so far.
+   *
+   * @return The number of requests this MockNetwork has answered so far.
+   */
+  [[nodiscard]] Statistics getStatistics() const;
+
+private:
+  /**
+   * Implementation object used to hide implementation details and the gRPC services.
+   */
+  struct MockNetworkImpl;
+  std::unique_ptr<MockNetworkImpl> mImpl;
+};
+
+} // namespace Hiero
+
+#endif // HIERO_SDK_CPP_MOCK_NETWORK_H_
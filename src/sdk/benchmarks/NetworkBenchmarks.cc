@@ -0,0 +1,84 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "AccountId.h"
+#include "Client.h"
+#include "impl/Network.h"
+#include "impl/Node.h"
+
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace Hiero;
+
+namespace
+{
+// The number of nodes on the benchmarked network.
+constexpr auto NUMBER_OF_NODES = 28ULL;
+
+//-----
+Client& getClient()
+{
+  // Every thread of a benchmark uses the same Client. No requests are sent, so the nodes don't have to be reachable.
+  static Client client = []()
+  {
+    std::unordered_map<std::string, AccountId> network;
+    for (auto i = 0ULL; i < NUMBER_OF_NODES; ++i)
+    {
+      network.try_emplace("127.0.0.1:" + std::to_string(50211ULL + i), AccountId(3ULL + i));
+    }
+
+    return Client::forNetwork(network);
+  }();
+
+  return client;
+}
+
+} // namespace
+
+//-----
+static void BM_NodeSelection(benchmark::State& state)
+{
+  const std::shared_ptr<internal::Network> network = getClient().getClientNetwork();
+
+  for (auto _ : state)
+  {
+    // Select nodes the way an execution does, and record a successful response from the first usable proxy.
+    for (const AccountId& accountId : network->getNodeAccountIdsForExecute())
+    {
+      for (const std::shared_ptr<internal::Node>& node : network->getNodeProxies(accountId))
+      {
+        if (node->isHealthy())
+        {
+          node->decreaseBackoff();
+          break;
+        }
+
+        benchmark::DoNotOptimize(node->getRemainingTimeForBackoff());
+      }
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_NodeSelection)->ThreadRange(1, 64)->UseRealTime();
+
+//-----
+static void BM_NodeHealthCheck(benchmark::State& state)
+{
+  const std::shared_ptr<internal::Network> network = getClient().getClientNetwork();
+  const std::vector<std::shared_ptr<internal::Node>> proxies = network->getNodeProxies(AccountId(3ULL));
+
+  for (auto _ : state)
+  {
+    for (const std::shared_ptr<internal::Node>& node : proxies)
+    {
+      benchmark::DoNotOptimize(node->isHealthy());
+      benchmark::DoNotOptimize(node->getBadGrpcStatusCount());
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_NodeHealthCheck)->Threads(64)->UseRealTime();
@@ -0,0 +1,207 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "AccountId.h"
+#include "Client.h"
+#include "Defaults.h"
+#include "ECDSAsecp256k1PrivateKey.h"
+#include "ED25519PrivateKey.h"
+#include "FileAppendTransaction.h"
+#include "FileId.h"
+#include "Hbar.h"
+#include "PrivateKey.h"
+#include "TransactionBatchBuilder.h"
+#include "TransactionId.h"
+#include "TransferTransaction.h"
+#include "WrappedTransaction.h"
+
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace Hiero;
+
+namespace
+{
+// The number of nodes on the network of the benchmarked Client.
+constexpr auto NUMBER_OF_NODES = 30ULL;
+
+//-----
+std::shared_ptr<PrivateKey> getOperatorKey()
+{
+  static const std::shared_ptr<PrivateKey> key = ED25519PrivateKey::generatePrivateKey();
+  return key;
+}
+
+//-----
+const Client& getClient()
+{
+  // No requests are sent, so the nodes don't have to be reachable.
+  static const Client client = []()
+  {
+    std::unordered_map<std::string, AccountId> network;
+    for (auto i = 0ULL; i < NUMBER_OF_NODES; ++i)
+    {
+      network.try_emplace("127.0.0.1:" + std::to_string(50211ULL + i), AccountId(3ULL + i));
+    }
+
+    Client client = Client::forNetwork(network);
+    client.setOperator(AccountId(2ULL), getOperatorKey());
+    return client;
+  }();
+
+  return client;
+}
+
+//-----
+std::vector<AccountId> getNodeAccountIds(unsigned long long nodes)
+{
+  std::vector<AccountId> nodeAccountIds;
+  for (auto i = 0ULL; i < nodes; ++i)
+  {
+    nodeAccountIds.emplace_back(3ULL + i);
+  }
+
+  return nodeAccountIds;
+}
+
+//-----
+TransferTransaction getTransferTransaction(unsigned long long nodes)
+{
+  TransferTransaction transaction;
+  transaction.setNodeAccountIds(getNodeAccountIds(nodes))
+    .setTransactionId(TransactionId::withValidStart(AccountId(2ULL), std::chrono::system_clock::now()))
+    .addHbarTransfer(AccountId(2ULL), Hbar(-1LL))
+    .addHbarTransfer(AccountId(1000ULL), Hbar(1LL));
+  return transaction;
+}
+
+//-----
+void freezeAndSign(benchmark::State& state, const std::shared_ptr<PrivateKey>& key)
+{
+  for (auto _ : state)
+  {
+    TransferTransaction transaction;
+    transaction.addHbarTransfer(AccountId(2ULL), Hbar(-1LL)).addHbarTransfer(AccountId(1000ULL), Hbar(1LL));
+    transaction.freezeWith(&getClient()).sign(key);
+    benchmark::DoNotOptimize(transaction.getSignatures());
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+} // namespace
+
+//-----
+static void BM_TransactionToBytes(benchmark::State& state)
+{
+  TransferTransaction transaction = getTransferTransaction(static_cast<unsigned long long>(state.range(0)));
+  transaction.freeze().sign(getOperatorKey());
+
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(transaction.toBytes());
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TransactionToBytes)->Arg(1)->Arg(10)->Arg(30);
+
+//-----
+static void BM_TransactionFromBytes(benchmark::State& state)
+{
+  TransferTransaction transaction = getTransferTransaction(static_cast<unsigned long long>(state.range(0)));
+  const std::vector<std::byte> bytes = transaction.freeze().sign(getOperatorKey()).toBytes();
+
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(Transaction<TransferTransaction>::fromBytes(bytes));
+  }
+
+  state.SetItemsProcessed(state.iterations());
+  state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(bytes.size()));
+}
+BENCHMARK(BM_TransactionFromBytes)->Arg(1)->Arg(10)->Arg(30);
+
+//-----
+static void BM_FreezeWithAndSignED25519(benchmark::State& state)
+{
+  freezeAndSign(state, ED25519PrivateKey::generatePrivateKey());
+}
+BENCHMARK(BM_FreezeWithAndSignED25519);
+
+//-----
+static void BM_FreezeWithAndSignECDSAsecp256k1(benchmark::State& state)
+{
+  freezeAndSign(state, ECDSAsecp256k1PrivateKey::generatePrivateKey());
+}
+BENCHMARK(BM_FreezeWithAndSignECDSAsecp256k1);
+
+//-----
+static void BM_BuildAllTransactions(benchmark::State& state)
+{
+  const auto nodes = static_cast<unsigned long long>(state.range(0));
+
+  for (auto _ : state)
+  {
+    // Serializing a frozen Transaction builds (and signs) the Transaction protobuf objects for all of its nodes.
+    TransferTransaction transaction = getTransferTransaction(nodes);
+    transaction.freeze().sign(getOperatorKey());
+    benchmark::DoNotOptimize(transaction.toBytes());
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_BuildAllTransactions)->Arg(1)->Arg(10)->Arg(30);
+
+//-----
+static void BM_BuildAllChunkedTransactions(benchmark::State& state)
+{
+  // As many chunks as a FileAppendTransaction allows by default.
+  const std::string contents(DEFAULT_MAX_CHUNKS * FileAppendTransaction::DEFAULT_CHUNK_SIZE, 'a');
+  const std::vector<AccountId> nodeAccountIds = getNodeAccountIds(static_cast<unsigned long long>(state.range(0)));
+
+  for (auto _ : state)
+  {
+    FileAppendTransaction transaction;
+    transaction.setNodeAccountIds(nodeAccountIds)
+      .setTransactionId(TransactionId::withValidStart(AccountId(2ULL), std::chrono::system_clock::now()))
+      .setFileId(FileId(1000ULL))
+      .setContents(contents);
+    transaction.freeze();
+    benchmark::DoNotOptimize(transaction.toBytes());
+  }
+
+  state.SetItemsProcessed(state.iterations() * DEFAULT_MAX_CHUNKS * state.range(0));
+}
+BENCHMARK(BM_BuildAllChunkedTransactions)->Arg(1)->Arg(10)->Arg(30);
+
+//-----
+static void BM_BuildTransferBatch(benchmark::State& state)
+{
+  // A payout of distinct amounts to distinct accounts.
+  constexpr auto transfers = 1000ULL;
+  TransferTransaction prototype;
+  prototype.setNodeAccountIds(getNodeAccountIds(static_cast<unsigned long long>(state.range(0))));
+
+  std::vector<AccountId> recipients;
+  std::vector<Hbar> amounts;
+  for (auto i = 0ULL; i < transfers; ++i)
+  {
+    recipients.emplace_back(1000ULL + i);
+    amounts.push_back(Hbar::fromTinybars(static_cast<int64_t>(i) + 1LL));
+  }
+
+  TransactionBatchBuilder builder(prototype);
+  builder.setRecipients(recipients).setAmounts(amounts);
+
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(builder.build(getClient()));
+  }
+
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(transfers));
+}
+BENCHMARK(BM_BuildTransferBatch)->Arg(1)->Arg(10)->UseRealTime();
@@ -9,8 +9,10 @@
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <exception>
 #include <functional>
 #include <future>
+#include <memory>
 #include <stdexcept>
 #include <string_view>
 #include <unordered_map>
@@ -61,18 +63,19 @@ public:
   TransactionResponse execute(const Client& client, const std::chrono::system_clock::duration& timeout) override;
 
   /**
-   * Derived from Executable. Execute this ChunkedTransaction asynchronously with a specific timeout.
+   * Derived from Executable. Start the asynchronous execution of all chunks of this ChunkedTransaction. The chunks are
+   * submitted one after another without blocking a thread, and the response callback is called with the response of
+   * the first chunk. Use `executeAllAsync()` to get the responses of all chunks.
    *
-   * @param client  The Client to use to submit this ChunkedTransaction.
-   * @param timeout The desired timeout for the execution of this ChunkedTransaction.
-   * @return The future TransactionResponse object sent from the Hiero network that contains the result of the request.
-   * @throws MaxAttemptsExceededException If this ChunkedTransaction attempts to execute past the number of allowable
-   *                                      attempts.
-   * @throws PrecheckStatusException      If this ChunkedTransaction fails its pre-check.
-   * @throws UninitializedException       If the input Client has not yet been initialized.
+   * @param client            The Client to use to submit this ChunkedTransaction.
+   * @param timeout           The desired timeout for the execution of each chunk of this ChunkedTransaction.
+   * @param responseCallback  The callback to call with the response of the first chunk if the execution succeeds.
+   * @param exceptionCallback The callback to call with the exception if the execution fails.
    */
-  std::future<TransactionResponse> executeAsync(const Client& client,
-                                                const std::chrono::system_clock::duration& timeout) override;
+  void executeAsyncInternal(const Client& client,
+                            const std::chrono::system_clock::duration& timeout,
+                            const std::function<void(const TransactionResponse&)>& responseCallback,
+                            const std::function<void(const std::exception_ptr&)>& exceptionCallback) override;
 
   /**
    * Execute all chunks of this ChunkedTransaction.
@@ -127,7 +130,8 @@ public:
 
   /**
    * Execute all chunks of this ChunkedTransaction asynchronously and consume the response and/or exception with a
-   * callback.
+   * callback. This returns immediately, and the callback is run on one of the input Client's CompletionQueueDriver
+   * threads.
    *
    * @param client   The Client to use to submit this ChunkedTransaction.
    * @param callback The callback that should consume the response/exception.
@@ -138,7 +142,8 @@ public:
 
   /**
    * Execute all chunks of this ChunkedTransaction asynchronously with a specified timeout and consume the response
-   * and/or exception with a callback.
+   * and/or exception with a callback. This returns immediately, and the callback is run on one of the input Client's
+   * CompletionQueueDriver threads.
    *
    * @param client   The Client to use to submit this ChunkedTransaction.
    * @param timeout  The desired timeout for the execution of this ChunkedTransaction.
@@ -151,7 +156,8 @@ public:
 
   /**
    * Execute all chunks of this ChunkedTransaction asynchronously and consume the response and/or exception with
-   * separate callbacks.
+   * separate callbacks. This returns immediately, and the callbacks are run on one of the input Client's
+   * CompletionQueueDriver threads.
    *
    * @param client            The Client to use to submit this Executable.
    * @param responseCallback  The callback that should consume the response.
@@ -163,7 +169,8 @@ public:
 
   /**
    * Execute all chunks of this ChunkedTransaction asynchronously with a specific timeout and consume the response
-   * and/or exception with separate callbacks.
+   * and/or exception with separate callbacks. This returns immediately, and the callbacks are run on one of the input
+   * Client's CompletionQueueDriver threads.
    *
    * @param client            The Client to use to submit this Executable.
    * @param timeout           The desired timeout for the execution of this Executable.
@@ -248,6 +255,20 @@ public:
    */
   SdkRequestType& setChunkSize(unsigned int size);
 
+  /**
+   * Set the maximum number of chunks of this ChunkedTransaction that can be in flight at once. A chunk is in flight
+   * from its submission until its receipt is retrieved, or until it is accepted by a node if no receipt is required.
+   * With 1, each chunk is only submitted once the previous one is done. With more, chunks are pipelined: receipts are
+   * retrieved in bulk while later chunks are being submitted. Note that when a pipelined chunk fails to reach
+   * consensus, chunks after it may already have been submitted. Chunks whose order matters (e.g. the chunks of a
+   * FileAppendTransaction) are never pipelined, and are always submitted one at a time regardless of this setting.
+   *
+   * @param chunks The maximum number of chunks that can be in flight at once.
+   * @return A reference to this derived ChunkedTransaction object with the newly-set maximum chunks in flight.
+   * @throws std::invalid_argument If the number of chunks is 0.
+   */
+  SdkRequestType& setMaxChunksInFlight(unsigned int chunks);
+
   /**
    * Get the maximum number of chunks for this ChunkedTransaction.
    *
@@ -262,6 +283,13 @@ public:
    */
   [[nodiscard]] unsigned int getChunkSize() const;
 
+  /**
+   * Get the maximum number of chunks of this ChunkedTransaction that can be in flight at once.
+   *
+   * @return The maximum number of chunks that can be in flight at once.
+   */
+  [[nodiscard]] unsigned int getMaxChunksInFlight() const;
+
 protected:
   ChunkedTransaction();
   ~ChunkedTransaction();
@@ -328,6 +356,15 @@ protected:
    */
   [[nodiscard]] bool getShouldGetReceipt() const;
 
+  /**
+   * Should the chunks of this ChunkedTransaction be pipelined, instead of being submitted one at a time?
+   *
+   * @param requiredChunks The number of chunks required to send this whole ChunkedTransaction.
+   * @return \c TRUE if more than one chunk can be in flight at once and the order of the chunks doesn't matter,
+   *         otherwise \c FALSE.
+   */
+  [[nodiscard]] bool shouldPipelineChunks(unsigned int requiredChunks) const;
+
 private:
   /**
    * Build and add the derived ChunkedTransaction's chunked protobuf representation to the TransactionBody protobuf
@@ -339,16 +376,32 @@ private:
    */
   virtual void addToChunk(uint32_t chunk, [[maybe_unused]] uint32_t total, proto::TransactionBody& body) const = 0;
 
+  /**
+   * Must the chunks of this ChunkedTransaction reach consensus in order? Chunks whose order matters are never
+   * pipelined.
+   *
+   * @return \c TRUE if the chunks must reach consensus in order, otherwise \c FALSE.
+   */
+  [[nodiscard]] virtual bool isChunkOrderSensitive() const;
+
+  /**
+   * Derived from Transaction. Each chunk after the first uses the valid start time one tick after that of the previous
+   * chunk, so a valid start time is reserved for every chunk.
+   *
+   * @return The number of chunks required to send this ChunkedTransaction's data.
+   */
+  [[nodiscard]] unsigned int getRequiredValidStarts() const override;
+
   /**
    * Derived from Executable. Construct a Transaction protobuf object from this ChunkedTransaction, based on the attempt
    * number. This will take into account the current chunk of this ChunkedTransaction trying to be sent.
    *
    * @param index The index of the node account ID that's associated with the Node being used to execute this
    *              ChunkedTransaction.
-   * @return A Transaction protobuf object filled with this ChunkedTransaction's data, based on the node account ID at
-   *         the given index.
+   * @return A reference to the Transaction protobuf object filled with this ChunkedTransaction's data, based on the
+   *         node account ID at the given index.
    */
-  [[nodiscard]] proto::Transaction makeRequest(unsigned int index) const override;
+  [[nodiscard]] const proto::Transaction& makeRequest(unsigned int index) const override;
 
   /**
    * Derived from Transaction. Regenerate the SignedTransaction protobuf objects for this ChunkedTransaction.
@@ -377,6 +430,79 @@ private:
    */
   [[nodiscard]] unsigned int getNumberOfChunksRequired() const;
 
+  /**
+   * Start the asynchronous execution of all chunks of this ChunkedTransaction, starting from the first chunk.
+   *
+   * @param client            The Client to use to submit this ChunkedTransaction.
+   * @param timeout           The desired timeout for the execution of each chunk of this ChunkedTransaction.
+   * @param responseCallback  The callback to call with the responses of all chunks if the execution succeeds.
+   * @param exceptionCallback The callback to call with the exception if the execution fails.
+   */
+  void executeAllAsyncInternal(const Client& client,
+                               const std::chrono::system_clock::duration& timeout,
+                               const std::function<void(const std::vector<TransactionResponse>&)>& responseCallback,
+                               const std::function<void(const std::exception_ptr&)>& exceptionCallback);
+
+  /**
+   * Asynchronously execute the current chunk of this ChunkedTransaction, and continue with the next chunk once it has
+   * been executed (and its receipt retrieved, if required).
+   *
+   * @param client            The Client to use to submit this ChunkedTransaction.
+   * @param timeout           The desired timeout for the execution of each chunk of this ChunkedTransaction.
+   * @param responses         The responses of the chunks executed so far.
+   * @param responseCallback  The callback to call with the responses of all chunks once the last chunk is executed.
+   * @param exceptionCallback The callback to call with the exception if the execution fails.
+   */
+  void executeNextChunkAsync(const Client& client,
+                             const std::chrono::system_clock::duration& timeout,
+                             const std::shared_ptr<std::vector<TransactionResponse>>& responses,
+                             const std::function<void(const std::vector<TransactionResponse>&)>& responseCallback,
+                             const std::function<void(const std::exception_ptr&)>& exceptionCallback);
+
+  /**
+   * The state of a pipelined execution of the chunks of this ChunkedTransaction.
+   */
+  struct PipelinedExecution;
+
+  /**
+   * Start the pipelined execution of all chunks of this ChunkedTransaction.
+   *
+   * @param client            The Client to use to submit this ChunkedTransaction.
+   * @param timeout           The desired timeout for the execution of each chunk of this ChunkedTransaction.
+   * @param responseCallback  The callback to call with the responses of all chunks if the execution succeeds.
+   * @param exceptionCallback The callback to call with the exception if the execution fails.
+   */
+  void executeAllPipelinedAsync(const Client& client,
+                                const std::chrono::system_clock::duration& timeout,
+                                const std::function<void(const std::vector<TransactionResponse>&)>& responseCallback,
+                                const std::function<void(const std::exception_ptr&)>& exceptionCallback);
+
+  /**
+   * Submit as many of the remaining chunks of a pipelined execution as its window allows.
+   *
+   * @param execution The pipelined execution.
+   */
+  void submitPipelinedChunks(const std::shared_ptr<PipelinedExecution>& execution);
+
+  /**
+   * Submit a chunk of a pipelined execution. The chunk is submitted by a copy of this ChunkedTransaction, so that
+   * multiple chunks can be submitted at once.
+   *
+   * @param execution The pipelined execution.
+   * @param chunk     The chunk to submit.
+   */
+  void submitPipelinedChunk(const std::shared_ptr<PipelinedExecution>& execution, unsigned int chunk);
+
+  /**
+   * Handle a chunk of a pipelined execution that is no longer in flight, and finish the execution if it was the last
+   * one or if it failed.
+   *
+   * @param execution The pipelined execution.
+   * @param exception The exception with which the chunk failed, or nullptr if it succeeded.
+   */
+  void completePipelinedChunk(const std::shared_ptr<PipelinedExecution>& execution,
+                              const std::exception_ptr& exception);
+
   /**
    * Implementation object used to hide implementation details and internal headers.
    */
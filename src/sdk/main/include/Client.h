@@ -17,17 +17,26 @@ namespace Hiero
 {
 namespace internal
 {
+class CompletionQueueDriver;
+class MetricsRegistry;
 class MirrorNetwork;
 class Network;
+class PaymentTransactionPool;
+class QueryCostCache;
+class SubscriptionReactor;
 }
 class AccountId;
 class Hbar;
 class LedgerId;
 class Logger;
+class MetricsSnapshot;
 class NodeAddressBook;
 class PrivateKey;
 class PublicKey;
+class ReceiptPoller;
 class SubscriptionHandle;
+enum class HedgingPolicy;
+enum class NodeSelectionPolicy;
 }
 
 namespace Hiero
@@ -220,6 +229,22 @@ public:
   void pingAllAsync(const std::chrono::system_clock::duration& timeout,
                     const std::function<void(const std::exception&)>& callback) const;
 
+  /**
+   * Connect to all consensus nodes on this Client's network ahead of time, so that the first requests submitted to them
+   * don't have to wait for their connections to be established. All connections are made in parallel.
+   *
+   * @return \c TRUE if every connection was established within this Client's request timeout, otherwise \c FALSE.
+   */
+  bool warmUp() const;
+
+  /**
+   * Connect to all consensus nodes on this Client's network ahead of time with a specified timeout.
+   *
+   * @param timeout The maximum amount of time to wait for the connections to be established.
+   * @return \c TRUE if every connection was established within the timeout, otherwise \c FALSE.
+   */
+  bool warmUp(const std::chrono::system_clock::duration& timeout) const;
+
   /**
    * Set the account that will, by default, be paying for requests submitted by this Client. The operator account ID is
    * used to generate the default transaction ID for all transactions executed with this Client. The operator private
@@ -329,6 +354,25 @@ public:
    */
   [[nodiscard]] std::optional<bool> getTransactionIdRegenerationPolicy() const;
 
+  /**
+   * Set the amount of time by which the valid start times of the transaction IDs generated for transactions and query
+   * payments made with this Client are moved into the past. Backdating absorbs clock skew between this machine and the
+   * network, which otherwise rejects transactions whose valid start time is in its future.
+   *
+   * @param backdate The desired amount of time by which to backdate generated transaction IDs.
+   * @return A reference to this Client object with the newly-set transaction ID backdate.
+   * @throws std::invalid_argument If the backdate is negative.
+   */
+  Client& setTransactionIdBackdate(const std::chrono::system_clock::duration& backdate);
+
+  /**
+   * Get the amount of time by which the valid start times of the transaction IDs generated by this Client are moved
+   * into the past.
+   *
+   * @return The amount of time by which generated transaction IDs are backdated.
+   */
+  [[nodiscard]] std::chrono::system_clock::duration getTransactionIdBackdate() const;
+
   /**
    * Set the automatic entity checksum validation policy.
    *
@@ -608,6 +652,61 @@ public:
    */
   [[nodiscard]] std::chrono::system_clock::duration getNodeMaxBackoff() const;
 
+  /**
+   * Set the policy with which this Client chooses between healthy consensus nodes, both when it selects the nodes for a
+   * request and when it picks the node to which a request is first submitted. Each node tracks the response times,
+   * error rate, and number of in-flight requests of the requests submitted to it, which the policies use to prefer
+   * faster and less loaded nodes. The policy also applies to any network this Client is later given.
+   *
+   * @param policy The desired NodeSelectionPolicy.
+   * @return A reference to this Client with the newly-set NodeSelectionPolicy.
+   */
+  Client& setNodeSelectionPolicy(NodeSelectionPolicy policy);
+
+  /**
+   * Get the policy with which this Client chooses between healthy consensus nodes. Defaults to RANDOM.
+   *
+   * @return The NodeSelectionPolicy of this Client.
+   */
+  [[nodiscard]] NodeSelectionPolicy getNodeSelectionPolicy() const;
+
+  /**
+   * Set the number of gRPC channels to open to each consensus node in this Client's network. Requests to a node are
+   * spread over its channels, and each channel uses its own connection, which lifts the limit on the number of
+   * concurrent requests a single connection allows.
+   *
+   * @param size The desired number of channels to open to each node.
+   * @return A reference to this Client with the newly-set node channel pool size.
+   * @throws std::invalid_argument If the size is 0.
+   */
+  Client& setNodeChannelPoolSize(unsigned int size);
+
+  /**
+   * Get the number of gRPC channels to open to each consensus node in this Client's network.
+   *
+   * @return The number of gRPC channels to open to each consensus node in this Client's network.
+   */
+  [[nodiscard]] unsigned int getNodeChannelPoolSize() const;
+
+  /**
+   * Set the maximum number of blocking requests this Client has in flight to each consensus node at once. Requests to
+   * a node are submitted concurrently up to this number; beyond it, they wait for a request in flight to the node to
+   * complete. Asynchronous requests (i.e. those of executeAsync() and the ReceiptPoller) are never made to wait on the
+   * threads that complete them, so they are not bounded by this maximum and don't count towards it.
+   *
+   * @param max The desired maximum number of blocking requests in flight to each node.
+   * @return A reference to this Client with the newly-set maximum number of requests in flight per node.
+   * @throws std::invalid_argument If the maximum is 0.
+   */
+  Client& setMaxRequestsInFlightPerNode(unsigned int max);
+
+  /**
+   * Get the maximum number of blocking requests this Client has in flight to each consensus node at once.
+   *
+   * @return The maximum number of blocking requests this Client has in flight to each consensus node at once.
+   */
+  [[nodiscard]] unsigned int getMaxRequestsInFlightPerNode() const;
+
   /**
    * Set the minimum amount of time for a node to wait after it receives a bad gRPC status for it to be deemed
    * "healthy".
@@ -659,6 +758,152 @@ public:
    */
   [[nodiscard]] unsigned int getMaxNodesPerTransaction() const;
 
+  /**
+   * Set the number of threads this Client uses to drive asynchronous requests. All asynchronous requests submitted with
+   * this Client share these threads, no matter how many are in flight. This only takes effect the next time the
+   * threads are started, i.e. before the first asynchronous request or after this Client is closed.
+   *
+   * @param threads The desired number of threads.
+   * @return A reference to this Client with the newly-set number of threads.
+   * @throws std::invalid_argument If the number of threads is 0.
+   */
+  Client& setCompletionQueueThreads(unsigned int threads);
+
+  /**
+   * Get the number of threads this Client uses to drive asynchronous requests.
+   *
+   * @return The number of threads this Client uses to drive asynchronous requests.
+   */
+  [[nodiscard]] unsigned int getCompletionQueueThreads() const;
+
+  /**
+   * Set the number of threads this Client uses to drive topic subscriptions. Each thread drains its own completion
+   * queue, and all subscriptions made with this Client are spread across them, no matter how many there are. This only
+   * takes effect the next time the threads are started, i.e. before the first subscription or after this Client is
+   * closed.
+   *
+   * @param threads The desired number of threads.
+   * @return A reference to this Client with the newly-set number of threads.
+   * @throws std::invalid_argument If the number of threads is 0.
+   */
+  Client& setSubscriptionThreads(unsigned int threads);
+
+  /**
+   * Get the number of threads this Client uses to drive topic subscriptions.
+   *
+   * @return The number of threads this Client uses to drive topic subscriptions.
+   */
+  [[nodiscard]] unsigned int getSubscriptionThreads() const;
+
+  /**
+   * Set the HedgingPolicy of the queries submitted with this Client. A hedged query that gets no response from the node
+   * to which it was submitted within the hedging percentile of that node's recent response times is also submitted to
+   * the next node, and the first response wins. Every query submitted with this Client will use this policy if and
+   * only if it has not been set manually in the query itself.
+   *
+   * @param policy The desired HedgingPolicy.
+   * @return A reference to this Client with the newly-set HedgingPolicy.
+   */
+  Client& setHedgingPolicy(HedgingPolicy policy);
+
+  /**
+   * Get the HedgingPolicy of the queries submitted with this Client.
+   *
+   * @return The HedgingPolicy of the queries submitted with this Client.
+   */
+  [[nodiscard]] HedgingPolicy getHedgingPolicy() const;
+
+  /**
+   * Set the percentile of a node's recent response times after which a hedged query submitted to it is also submitted
+   * to the next node. Lower percentiles cut tail latency further, at the cost of more duplicate requests.
+   *
+   * @param percentile The desired hedging percentile.
+   * @return A reference to this Client with the newly-set hedging percentile.
+   * @throws std::invalid_argument If the percentile is not greater than 0 and at most 100.
+   */
+  Client& setHedgingPercentile(double percentile);
+
+  /**
+   * Get the percentile of a node's recent response times after which a hedged query submitted to it is also submitted
+   * to the next node.
+   *
+   * @return The hedging percentile of this Client.
+   */
+  [[nodiscard]] double getHedgingPercentile() const;
+
+  /**
+   * Set the number of query payments this Client keeps built and signed ahead of time for each node and amount. Paid
+   * queries then take a payment that's already signed instead of waiting for the operator to sign one, and a background
+   * thread signs a replacement. Payments are dropped unused before they expire. 0 signs every payment when its query is
+   * submitted.
+   *
+   * @param size The desired number of query payments to keep signed ahead of time.
+   * @return A reference to this Client with the newly-set query payment pool size.
+   */
+  Client& setQueryPaymentPoolSize(unsigned int size);
+
+  /**
+   * Get the number of query payments this Client keeps built and signed ahead of time for each node and amount.
+   *
+   * @return The number of query payments this Client keeps signed ahead of time.
+   */
+  [[nodiscard]] unsigned int getQueryPaymentPoolSize() const;
+
+  /**
+   * Set the period of time for which this Client remembers the cost of a paid query it executed. A paid query whose
+   * cost is remembered is paid for with that cost plus the query cost margin (up to its maximum query payment) without
+   * first asking the network for its cost, so it takes one round trip instead of two. If the network finds the payment
+   * insufficient, the query is paid again with its exact cost. 0 asks the network for the cost of every paid query.
+   * Setting this forgets all remembered costs.
+   *
+   * @param duration The desired period of time for which to remember query costs.
+   * @return A reference to this Client with the newly-set query cost cache duration.
+   * @throws std::invalid_argument If the duration is negative.
+   */
+  Client& setQueryCostCacheDuration(const std::chrono::system_clock::duration& duration);
+
+  /**
+   * Get the period of time for which this Client remembers the cost of a paid query it executed.
+   *
+   * @return The period of time for which this Client remembers query costs.
+   */
+  [[nodiscard]] std::chrono::system_clock::duration getQueryCostCacheDuration() const;
+
+  /**
+   * Set the fraction by which a remembered query cost is increased when paying for a query with it, to absorb small fee
+   * changes. For example, 0.1 pays 10% more than the remembered cost.
+   *
+   * @param margin The desired query cost margin.
+   * @return A reference to this Client with the newly-set query cost margin.
+   * @throws std::invalid_argument If the margin is negative.
+   */
+  Client& setQueryCostMargin(double margin);
+
+  /**
+   * Get the fraction by which a remembered query cost is increased when paying for a query with it.
+   *
+   * @return The query cost margin of this Client.
+   */
+  [[nodiscard]] double getQueryCostMargin() const;
+
+  /**
+   * Get a snapshot of the metrics this Client has recorded about the requests it has submitted: the outcomes and
+   * end-to-end latencies of their executions, and the attempts, gRPC and precheck statuses, retries, backoffs and
+   * latencies at each node. The snapshot can be written for Prometheus with MetricsSnapshot::toPrometheus().
+   *
+   * @return A snapshot of the metrics of this Client.
+   */
+  [[nodiscard]] MetricsSnapshot getMetrics() const;
+
+  /**
+   * Get the ReceiptPoller this Client uses to wait for many TransactionReceipts at once. It is created the first time
+   * this is called, using this Client's settings at that time, and it is closed when this Client is closed.
+   *
+   * @return A pointer to the ReceiptPoller of this Client.
+   * @throws UninitializedException If this Client has not yet been initialized with a network.
+   */
+  [[nodiscard]] std::shared_ptr<ReceiptPoller> getReceiptPoller() const;
+
   /**
    * Add a subscription for this Client to track.
    *
@@ -687,7 +932,51 @@ public:
    */
   [[nodiscard]] std::shared_ptr<internal::MirrorNetwork> getClientMirrorNetwork() const;
 
+  /**
+   * Get a pointer to the CompletionQueueDriver this Client uses to drive asynchronous requests. The driver is started
+   * the first time this is called, and again the first time this is called after this Client is closed.
+   *
+   * @return A pointer to the CompletionQueueDriver this Client uses to drive asynchronous requests.
+   */
+  [[nodiscard]] std::shared_ptr<internal::CompletionQueueDriver> getCompletionQueueDriver() const;
+
+  /**
+   * Get a pointer to the SubscriptionReactor this Client uses to drive topic subscriptions. The reactor is started the
+   * first time this is called, and again the first time this is called after this Client is closed.
+   *
+   * @return A pointer to the SubscriptionReactor this Client uses to drive topic subscriptions.
+   */
+  [[nodiscard]] std::shared_ptr<internal::SubscriptionReactor> getSubscriptionReactor() const;
+
+  /**
+   * Get a pointer to the PaymentTransactionPool this Client uses to pay for queries. The pool is started the first time
+   * this is called, and again the first time this is called after this Client is closed or its operator changes.
+   *
+   * @return A pointer to the PaymentTransactionPool this Client uses to pay for queries. nullptr if this Client signs
+   *         every payment when its query is submitted.
+   */
+  [[nodiscard]] std::shared_ptr<internal::PaymentTransactionPool> getPaymentTransactionPool() const;
+
+  /**
+   * Get a pointer to the QueryCostCache in which this Client remembers the costs of the paid queries it executes.
+   *
+   * @return A pointer to the QueryCostCache of this Client. nullptr if this Client doesn't remember query costs.
+   */
+  [[nodiscard]] std::shared_ptr<internal::QueryCostCache> getQueryCostCache() const;
+
+  /**
+   * Get a pointer to the MetricsRegistry in which this Client records the metrics of the requests it submits.
+   *
+   * @return A pointer to the MetricsRegistry of this Client.
+   */
+  [[nodiscard]] std::shared_ptr<internal::MetricsRegistry> getMetricsRegistry() const;
+
 private:
+  /**
+   * Give the network this Client just created the metrics registry and the node settings of this Client.
+   */
+  void initializeNetwork();
+
   /**
    * Replace the network being used by this Client with nodes contained in an address book.
    *
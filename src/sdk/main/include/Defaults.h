@@ -41,10 +41,41 @@ constexpr auto DEFAULT_MIN_NODE_BACKOFF = std::chrono::seconds(8);
  * The default maximum duration of time to wait before retrying to submit a previously-failed request to the same node.
  */
 constexpr auto DEFAULT_MAX_NODE_BACKOFF = std::chrono::hours(1);
+/**
+ * The default number of gRPC channels (and so connections) to open to each consensus node.
+ */
+constexpr auto DEFAULT_NODE_CHANNEL_POOL_SIZE = 1U;
+/**
+ * The default maximum number of blocking requests in flight to each consensus node. Further requests to the node wait
+ * for one of them to complete.
+ */
+constexpr auto DEFAULT_MAX_REQUESTS_IN_FLIGHT_PER_NODE = 64U;
+/**
+ * The default percentile of a node's recent response times after which a hedged query is also submitted to another
+ * node.
+ */
+constexpr auto DEFAULT_HEDGING_PERCENTILE = 95.0;
+/**
+ * The minimum amount of time to wait for a response from a node before hedging a query to another node.
+ */
+constexpr auto DEFAULT_MIN_HEDGING_DELAY = std::chrono::milliseconds(10);
 /**
  * The default amount of time to allow a node to gracefully close a gRPC connection before forcibly terminating it.
  */
 constexpr auto DEFAULT_CLOSE_TIMEOUT = std::chrono::seconds(30);
+/**
+ * The default amount of time by which the valid start times of generated transaction IDs are moved into the past.
+ */
+constexpr auto DEFAULT_TRANSACTION_ID_BACKDATE = std::chrono::seconds(0);
+/**
+ * The default number of query payments to keep signed ahead of time for each node and amount. 0 signs every payment
+ * when its query is submitted.
+ */
+constexpr auto DEFAULT_QUERY_PAYMENT_POOL_SIZE = 0U;
+/**
+ * The amount of time before the end of its valid duration that a query payment signed ahead of time is dropped.
+ */
+constexpr auto DEFAULT_PAYMENT_TRANSACTION_EXPIRY_MARGIN = std::chrono::seconds(15);
 /**
  * The default maximum transaction fee.
  */
@@ -53,6 +84,20 @@ constexpr auto DEFAULT_MAX_TRANSACTION_FEE = Hbar(2LL);
  * The default maximum query payment
  */
 constexpr auto DEFAULT_MAX_QUERY_PAYMENT = Hbar(1LL);
+/**
+ * The default period of time for which the observed cost of a query is used to pay for the same query without asking
+ * the network for its cost. 0 asks the network for the cost of every paid query.
+ */
+constexpr auto DEFAULT_QUERY_COST_CACHE_DURATION = std::chrono::seconds(0);
+/**
+ * The default fraction by which a remembered query cost is increased when paying for a query, to absorb small fee
+ * changes.
+ */
+constexpr auto DEFAULT_QUERY_COST_MARGIN = 0.1;
+/**
+ * The default maximum number of query costs a Client remembers.
+ */
+constexpr auto DEFAULT_QUERY_COST_CACHE_ENTRIES = 1024U;
 /**
  * The default auto-renew period.
  */
@@ -73,6 +118,21 @@ constexpr auto DEFAULT_CHUNK_SIZE = 1024U;
  * The default number of chunks for a ChunkedTransaction.
  */
 constexpr auto DEFAULT_MAX_CHUNKS = 20U;
+/**
+ * The default maximum number of chunks of a ChunkedTransaction that can be in flight at once. 1 submits the chunks
+ * strictly one after another.
+ */
+constexpr auto DEFAULT_MAX_CHUNKS_IN_FLIGHT = 1U;
+/**
+ * The default maximum number of bytes of received chunks a topic subscription keeps for chunked messages that are not
+ * complete yet.
+ */
+constexpr auto DEFAULT_MAX_PENDING_CHUNK_BYTES = 8U * 1024U * 1024U;
+/**
+ * The default amount of time a topic subscription waits for the rest of a chunked message after its first chunk
+ * arrives.
+ */
+constexpr auto DEFAULT_CHUNK_REASSEMBLY_TIMEOUT = std::chrono::minutes(5);
 /**
  * The default amount of time to wait after a network update to update again.
  */
@@ -81,6 +141,38 @@ constexpr auto DEFAULT_NETWORK_UPDATE_PERIOD = std::chrono::hours(24);
  * The default amount of time to wait after Client creation to update the network for the first time.
  */
 constexpr auto DEFAULT_NETWORK_UPDATE_INITIAL_DELAY = std::chrono::seconds(10);
+/**
+ * The default number of threads a Client uses to drive asynchronous requests.
+ */
+constexpr auto DEFAULT_COMPLETION_QUEUE_THREADS = 2U;
+/**
+ * The default number of threads (each with its own completion queue) a Client uses to drive topic subscriptions.
+ */
+constexpr auto DEFAULT_SUBSCRIPTION_THREADS = 2U;
+/**
+ * The default interval at which a ReceiptPoller checks for receipts that are due to be polled again.
+ */
+constexpr auto DEFAULT_RECEIPT_POLL_INTERVAL = std::chrono::milliseconds(100);
+/**
+ * The default maximum number of receipt requests a ReceiptPoller has in flight to a single node.
+ */
+constexpr auto DEFAULT_MAX_RECEIPT_POLLS_IN_FLIGHT_PER_NODE = 32U;
+/**
+ * The default maximum number of keep-alive connections to open to each mirror node REST endpoint.
+ */
+constexpr auto DEFAULT_HTTP_MAX_CONNECTIONS_PER_HOST = 8U;
+/**
+ * The default maximum amount of time to wait to establish a connection to a mirror node REST endpoint.
+ */
+constexpr auto DEFAULT_HTTP_CONNECT_TIMEOUT = std::chrono::seconds(10);
+/**
+ * The default maximum amount of time to wait to send a request to a mirror node REST endpoint or to read its response.
+ */
+constexpr auto DEFAULT_HTTP_REQUEST_TIMEOUT = std::chrono::seconds(30);
+/**
+ * The default maximum amount of time to wait for a local mirror node to have ingested the data of a query.
+ */
+constexpr auto DEFAULT_MIRROR_NODE_READINESS_TIMEOUT = std::chrono::seconds(3);
 /**
  * The default name of Logger types.
  */
@@ -5,20 +5,24 @@
 #include "AccountId.h"
 #include "Defaults.h"
 #include "Logger.h"
+#include "NodeSelectionPolicy.h"
 
 #include <chrono>
+#include <exception>
 #include <functional>
 #include <future>
 #include <memory>
 #include <mutex>
 #include <optional>
 #include <stdexcept>
+#include <string>
 #include <vector>
 
 namespace Hiero
 {
 namespace internal
 {
+class CompletionQueueDriver;
 class Node;
 }
 class Client;
@@ -28,6 +32,7 @@ enum class Status;
 
 namespace grpc
 {
+class ClientContext;
 class Status;
 }
 
@@ -57,7 +62,9 @@ public:
   virtual SdkResponseType execute(const Client& client);
 
   /**
-   * Submit this Executable to a Hiero network with a specific timeout.
+   * Submit this Executable to a Hiero network with a specific timeout. If this Executable is hedged, it is executed
+   * asynchronously and this waits for the result. Waiting on a CompletionQueueDriver thread (i.e. from the callback of
+   * an asynchronous execution) could deadlock, so this Executable is executed without hedging there.
    *
    * @param client  The Client to use to submit this Executable.
    * @param timeout The desired timeout for the execution of this Executable.
@@ -69,7 +76,9 @@ public:
   virtual SdkResponseType execute(const Client& client, const std::chrono::system_clock::duration& timeout);
 
   /**
-   * Submit this Executable to a Hiero network asynchronously.
+   * Submit this Executable to a Hiero network asynchronously. The request is driven by the input Client's
+   * CompletionQueueDriver, so no thread is blocked while it is in flight. This Executable and the input Client must
+   * outlive the execution.
    *
    * @param client The Client to use to submit this Executable.
    * @return The future SdkResponseType object sent from the Hiero network that contains the result of the request.
@@ -80,7 +89,9 @@ public:
   std::future<SdkResponseType> executeAsync(const Client& client);
 
   /**
-   * Submit this Executable to a Hiero network asynchronously with a specific timeout.
+   * Submit this Executable to a Hiero network asynchronously with a specific timeout. The request is driven by the input
+   * Client's CompletionQueueDriver, so no thread is blocked while it is in flight. This Executable and the input Client
+   * must outlive the execution.
    *
    * @param client  The Client to use to submit this Executable.
    * @param timeout The desired timeout for the execution of this Executable.
@@ -94,7 +105,8 @@ public:
 
   /**
    * Submit this Executable to a Hiero network asynchronously and consume the response and/or exception with a
-   * callback.
+   * callback. This returns immediately, and the callback is run on one of the input Client's CompletionQueueDriver
+   * threads. This Executable and the input Client must outlive the execution.
    *
    * @param client   The Client to use to submit this Executable.
    * @param callback The callback that should consume the response/exception.
@@ -104,7 +116,8 @@ public:
 
   /**
    * Submit this Executable to a Hiero network asynchronously with a specific timeout and consume the response and/or
-   * exception with a callback.
+   * exception with a callback. This returns immediately, and the callback is run on one of the input Client's
+   * CompletionQueueDriver threads. This Executable and the input Client must outlive the execution.
    *
    * @param client   The Client to use to submit this Executable.
    * @param timeout  The desired timeout for the execution of this Executable.
@@ -116,7 +129,8 @@ public:
 
   /**
    * Submit this Executable to a Hiero network asynchronously and consume the response and/or exception with separate
-   * callbacks.
+   * callbacks. This returns immediately, and the callbacks are run on one of the input Client's CompletionQueueDriver
+   * threads. This Executable and the input Client must outlive the execution.
    *
    * @param client            The Client to use to submit this Executable.
    * @param responseCallback  The callback that should consume the response.
@@ -128,7 +142,8 @@ public:
 
   /**
    * Submit this Executable to a Hiero network asynchronously with a specific timeout and consume the response and/or
-   * exception with separate callbacks.
+   * exception with separate callbacks. This returns immediately, and the callbacks are run on one of the input
+   * Client's CompletionQueueDriver threads. This Executable and the input Client must outlive the execution.
    *
    * @param client            The Client to use to submit this Executable.
    * @param timeout           The desired timeout for the execution of this Executable.
@@ -140,6 +155,22 @@ public:
                     const std::function<void(const SdkResponseType&)>& responseCallback,
                     const std::function<void(const std::exception&)>& exceptionCallback);
 
+  /**
+   * Start the asynchronous execution of this Executable. This runs the same retry and backoff logic as execute(), but
+   * as continuations on the input Client's CompletionQueueDriver instead of on a blocked thread. Exactly one of the
+   * callbacks is called once the execution completes, and failures keep their original exception type. This Executable
+   * and the input Client must outlive the execution.
+   *
+   * @param client            The Client to use to submit this Executable.
+   * @param timeout           The desired timeout for the execution of this Executable.
+   * @param responseCallback  The callback to call with the response if the execution succeeds.
+   * @param exceptionCallback The callback to call with the exception if the execution fails.
+   */
+  virtual void executeAsyncInternal(const Client& client,
+                                    const std::chrono::system_clock::duration& timeout,
+                                    const std::function<void(const SdkResponseType&)>& responseCallback,
+                                    const std::function<void(const std::exception_ptr&)>& exceptionCallback);
+
   /**
    * Set the desired account IDs of nodes to which this request will be submitted.
    *
@@ -307,6 +338,22 @@ protected:
                                                         [[maybe_unused]] const Client& client,
                                                         [[maybe_unused]] const ProtoResponseType& response);
 
+  /**
+   * Determine the ExecutionStatus of this Executable after being submitted asynchronously, and pass it to a callback.
+   * By default, the callback is run right away with the status from determineStatus(). An Executable that has to make
+   * another request to the network to determine its status makes it asynchronously instead, so that it doesn't block a
+   * thread of the Client's CompletionQueueDriver, and runs the callback once that request has completed.
+   *
+   * @param status   The response status from the network.
+   * @param client   The Client that submitted this Executable.
+   * @param response The ProtoResponseType received from the network in response to submitting this Executable.
+   * @param callback The callback to run with the status of the submitted Executable and the response.
+   */
+  virtual void determineStatusAsync(Status status,
+                                    const Client& client,
+                                    const ProtoResponseType& response,
+                                    const std::function<void(ExecutionStatus, const ProtoResponseType&)>& callback);
+
   /**
    * Gets the mirror node resolution for the query.
    *
@@ -317,16 +364,35 @@ protected:
    */
   [[nodiscard]] std::string getMirrorNodeResolution() const { return mMirrorNodeIds[0]; }
 
+  /**
+   * Get the Logger used by this Executable.
+   *
+   * @return The Logger used by this Executable.
+   */
+  [[nodiscard]] inline const Logger& getLogger() const { return mLogger; }
+
 private:
   /**
-   * Construct a ProtoRequestType object from this Executable, based on the node account ID at the given index.
+   * The state of an asynchronous execution of this Executable.
+   */
+  struct AsyncExecution;
+
+  /**
+   * The state of a hedged attempt of an asynchronous execution of this Executable.
+   */
+  struct HedgedAttempt;
+
+  /**
+   * Construct a ProtoRequestType object from this Executable, based on the node account ID at the given index. The
+   * object is kept by this Executable, so that it's submitted without being copied (which matters for requests with
+   * large payloads, that are submitted on every attempt).
    *
    * @param index The index of the node account ID that's associated with the Node being used to execute this
    *              Executable.
-   * @return A ProtoRequestType object filled with this Executable's data, based on the node account ID at the given
-   *         index.
+   * @return A reference to a ProtoRequestType object filled with this Executable's data, based on the node account ID
+   *         at the given index. It's valid until the next call to makeRequest() or until this Executable is modified.
    */
-  [[nodiscard]] virtual ProtoRequestType makeRequest(unsigned int index) const = 0;
+  [[nodiscard]] virtual const ProtoRequestType& makeRequest(unsigned int index) const = 0;
 
   /**
    * Construct an SdkResponseType from a ProtoResponseType object.
@@ -359,6 +425,25 @@ private:
                                                    const std::chrono::system_clock::time_point& deadline,
                                                    ProtoResponseType* response) const = 0;
 
+  /**
+   * Submit a ProtoRequestType object which contains this Executable's data to a Node without blocking.
+   *
+   * @param request  The ProtoRequestType object to submit.
+   * @param node     The Node to which to submit the request.
+   * @param deadline The deadline for submitting the request.
+   * @param driver   The CompletionQueueDriver with which to register the submission.
+   * @param callback The callback to run with the gRPC status and the ProtoResponseType object of the submission.
+   * @param context  The ClientContext with which to make the submission, through which it can be cancelled. If this is
+   *                 nullptr, a ClientContext is created for the submission.
+   * @return \c TRUE if the submission was started, \c FALSE if the CompletionQueueDriver has been shut down.
+   */
+  virtual bool submitRequestAsync(const ProtoRequestType& request,
+                                  const std::shared_ptr<internal::Node>& node,
+                                  const std::chrono::system_clock::time_point& deadline,
+                                  internal::CompletionQueueDriver& driver,
+                                  const std::function<void(const grpc::Status&, const ProtoResponseType&)>& callback,
+                                  const std::shared_ptr<grpc::ClientContext>& context) const = 0;
+
   /**
    * Perform any needed actions for this Executable when it is being submitted.
    *
@@ -374,6 +459,24 @@ private:
    */
   [[nodiscard]] virtual std::optional<TransactionId> getTransactionIdInternal() const = 0;
 
+  /**
+   * Get the type of the request of this Executable, under which the metrics of its executions are recorded. This is the
+   * name of the field of the protobuf body of the request, e.g. "cryptoTransfer".
+   *
+   * @return The type of the request of this Executable.
+   */
+  [[nodiscard]] virtual std::string getRequestType() const = 0;
+
+  /**
+   * Should the submissions of this Executable be hedged when submitted with the input Client? A hedged submission that
+   * gets no response from its Node in time is also submitted to the next Node, and the first response wins. This
+   * defaults to \c FALSE, as only requests that can safely be answered by several Nodes can be hedged.
+   *
+   * @param client The Client being used to submit this Executable.
+   * @return \c TRUE if the submissions of this Executable should be hedged, otherwise \c FALSE.
+   */
+  [[nodiscard]] virtual bool isHedgingAllowed([[maybe_unused]] const Client& client) const;
+
   /**
    * Set the execution parameters to be used to submit this Executable. If any of mMaxAttempts, mMinBackoff, or
    * mMaxBackoff have been set with setMaxAttempts(), setMinBackoff(), or setMaxBackoff() respectively, these values
@@ -396,7 +499,8 @@ private:
 
   /**
    * Get the index of a Node from a list of Nodes to which to try and send this Executable. This will prioritize getting
-   * "healthy" Nodes first in order to ensure as little wait time to submit as possible.
+   * "healthy" Nodes first in order to ensure as little wait time to submit as possible. The first attempt chooses
+   * between the healthy Nodes with the current NodeSelectionPolicy, later attempts go through the Nodes in order.
    *
    * @param nodes   The list of Nodes from which to select a Node.
    * @param attempt The attempt number of trying to submit this Executable.
@@ -405,6 +509,113 @@ private:
   [[nodiscard]] unsigned int getNodeIndexForExecute(const std::vector<std::shared_ptr<internal::Node>>& nodes,
                                                     unsigned int attempt) const;
 
+  /**
+   * Get the request to submit to the Node at the given index. If there's a request listener, the request is copied for
+   * it to modify; otherwise, the request made by makeRequest() is submitted as is.
+   *
+   * @param index    The index of the node account ID that's associated with the Node to which to submit the request.
+   * @param listened The ProtoRequestType object in which to hold the request returned by the request listener.
+   * @return A reference to the request to submit.
+   */
+  [[nodiscard]] const ProtoRequestType& getRequest(unsigned int index, ProtoRequestType& listened) const;
+
+  /**
+   * Start the next attempt of an asynchronous execution of this Executable.
+   *
+   * @param execution The asynchronous execution.
+   */
+  void startAsyncAttempt(const std::shared_ptr<AsyncExecution>& execution);
+
+  /**
+   * Submit the current attempt of an asynchronous execution of this Executable to a Node.
+   *
+   * @param execution The asynchronous execution.
+   * @param nodeIndex The index of the Node to which to submit.
+   */
+  void submitAsyncAttempt(const std::shared_ptr<AsyncExecution>& execution, unsigned int nodeIndex);
+
+  /**
+   * Submit a hedged attempt of an asynchronous execution of this Executable to a Node. The lock of the attempt must be
+   * held.
+   *
+   * @param execution The asynchronous execution.
+   * @param attempt   The hedged attempt.
+   * @param nodeIndex The index of the Node to which to submit.
+   * @throws IllegalStateException If the Client's CompletionQueueDriver has been shut down.
+   */
+  void submitHedgedAttempt(const std::shared_ptr<AsyncExecution>& execution,
+                           const std::shared_ptr<HedgedAttempt>& attempt,
+                           unsigned int nodeIndex);
+
+  /**
+   * Submit a hedged attempt of an asynchronous execution of this Executable to the next healthy Node it hasn't been
+   * submitted to yet, if no response to the attempt has been received.
+   *
+   * @param execution The asynchronous execution.
+   * @param attempt   The hedged attempt.
+   */
+  void hedgeAsyncAttempt(const std::shared_ptr<AsyncExecution>& execution,
+                         const std::shared_ptr<HedgedAttempt>& attempt);
+
+  /**
+   * Handle the response of one of the submissions of a hedged attempt of an asynchronous execution of this Executable.
+   * The first submission to get a response from its Node, or the last one to fail, decides the attempt, and the other
+   * submissions are cancelled.
+   *
+   * @param execution The asynchronous execution.
+   * @param attempt   The hedged attempt.
+   * @param node      The Node to which the submission was made.
+   * @param status    The gRPC status of the submission.
+   * @param response  The ProtoResponseType object received from the Node.
+   */
+  void handleHedgedResponse(const std::shared_ptr<AsyncExecution>& execution,
+                            const std::shared_ptr<HedgedAttempt>& attempt,
+                            const std::shared_ptr<internal::Node>& node,
+                            const grpc::Status& status,
+                            const ProtoResponseType& response);
+
+  /**
+   * Handle the response of the current attempt of an asynchronous execution of this Executable, and either complete the
+   * execution or start another attempt.
+   *
+   * @param execution The asynchronous execution.
+   * @param node      The Node to which the attempt was submitted.
+   * @param status    The gRPC status of the submission.
+   * @param response  The ProtoResponseType object received from the Node.
+   */
+  void handleAsyncResponse(const std::shared_ptr<AsyncExecution>& execution,
+                           const std::shared_ptr<internal::Node>& node,
+                           const grpc::Status& status,
+                           const ProtoResponseType& response);
+
+  /**
+   * Continue an asynchronous execution of this Executable once the ExecutionStatus of its current attempt is known, and
+   * either complete the execution or start another attempt.
+   *
+   * @param execution       The asynchronous execution.
+   * @param node            The Node to which the attempt was submitted.
+   * @param responseStatus  The response status of the attempt.
+   * @param executionStatus The ExecutionStatus of the attempt.
+   * @param response        The ProtoResponseType object received from the Node.
+   */
+  void continueAsyncExecution(const std::shared_ptr<AsyncExecution>& execution,
+                              const std::shared_ptr<internal::Node>& node,
+                              Status responseStatus,
+                              ExecutionStatus executionStatus,
+                              const ProtoResponseType& response);
+
+  /**
+   * Continue an asynchronous execution of this Executable at a later time, without blocking a thread in the meantime.
+   *
+   * @param execution    The asynchronous execution.
+   * @param time         The time at which to continue.
+   * @param continuation The continuation to run.
+   * @throws IllegalStateException If the Client's CompletionQueueDriver has been shut down.
+   */
+  void continueAsyncAt(const std::shared_ptr<AsyncExecution>& execution,
+                       const std::chrono::system_clock::time_point& time,
+                       const std::function<void()>& continuation);
+
   /**
    * The Logger to be used by this Executable.
    */
@@ -488,6 +699,11 @@ private:
    * Client's set gRPC deadline, or DEFAULT_GRPC_DEADLINE.
    */
   std::chrono::system_clock::duration mCurrentGrpcDeadline = DEFAULT_GRPC_DEADLINE;
+
+  /**
+   * The NodeSelectionPolicy being used for the current execution. This is the Client's NodeSelectionPolicy.
+   */
+  NodeSelectionPolicy mCurrentNodeSelectionPolicy = NodeSelectionPolicy::RANDOM;
 };
 
 } // namespace Hiero
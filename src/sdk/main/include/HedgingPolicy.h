@@ -0,0 +1,43 @@
+// SPDX-License-Identifier: Apache-2.0
+#ifndef HIERO_SDK_CPP_HEDGING_POLICY_H_
+#define HIERO_SDK_CPP_HEDGING_POLICY_H_
+
+#include <string>
+#include <unordered_map>
+
+namespace Hiero
+{
+/**
+ * An enumeration that describes which queries are hedged. When a hedged query gets no response from the node to which
+ * it was submitted within a percentile of that node's recent response times, the same query is also submitted to the
+ * next node. The first response wins, and the other submission is cancelled.
+ */
+enum class HedgingPolicy
+{
+  /**
+   * Don't hedge any queries.
+   */
+  NONE,
+  /**
+   * Only hedge queries that don't require a payment, including the queries that get the cost of another query.
+   */
+  FREE_QUERIES,
+  /**
+   * Hedge all queries. Each submission of a paid query carries its own payment transaction to the node to which it is
+   * submitted, so a hedged paid query may be paid for more than once.
+   */
+  ALL_QUERIES
+};
+
+/**
+ * Map of HedgingPolicy to its corresponding string.
+ */
+const std::unordered_map<HedgingPolicy, std::string> gHedgingPolicyToString = {
+  {HedgingPolicy::NONE,          "NONE"        },
+  { HedgingPolicy::FREE_QUERIES, "FREE_QUERIES"},
+  { HedgingPolicy::ALL_QUERIES,  "ALL_QUERIES" }
+};
+
+} // namespace Hiero
+
+#endif // HIERO_SDK_CPP_HEDGING_POLICY_H_
@@ -7,12 +7,15 @@
 #include <log4cxx/logger.h>
 #include <memory>
 #include <string_view>
+#include <type_traits>
 
 namespace Hiero
 {
 /**
  * Logger class used by the Hiero C++ SDK. In essence, it's a wrapper for a log4cxx logger instance and provides easier
- * usage.
+ * usage. Each level can be logged with a message, or with a function that builds the message, which is only called if
+ * the level is enabled. Messages that are expensive to build should be passed as functions, so that nothing is built
+ * when they wouldn't be logged.
  */
 class Logger
 {
@@ -74,6 +77,89 @@ public:
    */
   void error(std::string_view message) const;
 
+  /**
+   * Log a trace-level message, built only if trace-level messages are logged.
+   *
+   * @tparam MessageBuilder The type of function that builds the message.
+   * @param builder The function that builds the trace-level message to log.
+   */
+  template<typename MessageBuilder, typename = std::enable_if_t<std::is_invocable_v<const MessageBuilder&>>>
+  void trace(const MessageBuilder& builder) const
+  {
+    if (isEnabled(LoggingLevel::TRACE))
+    {
+      trace(std::string_view(builder()));
+    }
+  }
+
+  /**
+   * Log a debug-level message, built only if debug-level messages are logged.
+   *
+   * @tparam MessageBuilder The type of function that builds the message.
+   * @param builder The function that builds the debug-level message to log.
+   */
+  template<typename MessageBuilder, typename = std::enable_if_t<std::is_invocable_v<const MessageBuilder&>>>
+  void debug(const MessageBuilder& builder) const
+  {
+    if (isEnabled(LoggingLevel::DEBUG))
+    {
+      debug(std::string_view(builder()));
+    }
+  }
+
+  /**
+   * Log an info-level message, built only if info-level messages are logged.
+   *
+   * @tparam MessageBuilder The type of function that builds the message.
+   * @param builder The function that builds the info-level message to log.
+   */
+  template<typename MessageBuilder, typename = std::enable_if_t<std::is_invocable_v<const MessageBuilder&>>>
+  void info(const MessageBuilder& builder) const
+  {
+    if (isEnabled(LoggingLevel::INFO))
+    {
+      info(std::string_view(builder()));
+    }
+  }
+
+  /**
+   * Log a warn-level message, built only if warn-level messages are logged.
+   *
+   * @tparam MessageBuilder The type of function that builds the message.
+   * @param builder The function that builds the warn-level message to log.
+   */
+  template<typename MessageBuilder, typename = std::enable_if_t<std::is_invocable_v<const MessageBuilder&>>>
+  void warn(const MessageBuilder& builder) const
+  {
+    if (isEnabled(LoggingLevel::WARN))
+    {
+      warn(std::string_view(builder()));
+    }
+  }
+
+  /**
+   * Log an error-level message, built only if error-level messages are logged.
+   *
+   * @tparam MessageBuilder The type of function that builds the message.
+   * @param builder The function that builds the error-level message to log.
+   */
+  template<typename MessageBuilder, typename = std::enable_if_t<std::is_invocable_v<const MessageBuilder&>>>
+  void error(const MessageBuilder& builder) const
+  {
+    if (isEnabled(LoggingLevel::ERROR))
+    {
+      error(std::string_view(builder()));
+    }
+  }
+
+  /**
+   * Would a message of a logging level be logged by this Logger? This is cheap enough to check before every message.
+   *
+   * @param level The logging level to check.
+   * @return \c TRUE if messages of the logging level would be logged, otherwise \c FALSE.
+   */
+  [[nodiscard]] bool isEnabled(LoggingLevel level) const;
+
   /**
    * Set the log4cxx logger this Logger should use.
    *
@@ -0,0 +1,159 @@
+// SPDX-License-Identifier: Apache-2.0
+#ifndef HIERO_SDK_CPP_METRICS_SNAPSHOT_H_
+#define HIERO_SDK_CPP_METRICS_SNAPSHOT_H_
+
+#include "Status.h"
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Hiero
+{
+/**
+ * A snapshot of the metrics a Client has recorded about the requests it has submitted, taken with
+ * Client::getMetrics(). Request types are named after the field of the request's protobuf body, e.g. "cryptoTransfer"
+ * or "cryptogetAccountBalance", and topic subscriptions are recorded under the request type "subscribeTopic".
+ */
+class MetricsSnapshot
+{
+public:
+  /**
+   * A snapshot of a histogram of durations. Each power of two is split into four buckets, so that the percentiles read
+   * from the histogram are accurate to within 25%.
+   */
+  struct Histogram
+  {
+    /**
+     * Get an approximate percentile of the recorded durations. The returned value is the upper bound of the bucket
+     * holding the percentile.
+     *
+     * @param percentile The percentile to get, between 0 and 100.
+     * @return The approximate percentile of the recorded durations, or 0 if no duration has been recorded.
+     */
+    [[nodiscard]] std::chrono::nanoseconds getPercentile(double percentile) const;
+
+    /**
+     * The non-empty buckets of the histogram in ascending order, as pairs of the (exclusive) upper bound of a bucket
+     * and the number of durations in it.
+     */
+    std::vector<std::pair<std::chrono::nanoseconds, std::uint64_t>> mBuckets;
+
+    /**
+     * The number of recorded durations.
+     */
+    std::uint64_t mCount = 0ULL;
+
+    /**
+     * The sum of the recorded durations.
+     */
+    std::chrono::nanoseconds mSum = std::chrono::nanoseconds(0);
+  };
+
+  /**
+   * The metrics of the executions of a type of request.
+   */
+  struct RequestMetrics
+  {
+    /**
+     * The type of request.
+     */
+    std::string mRequestType;
+
+    /**
+     * The number of executions that returned a response.
+     */
+    std::uint64_t mSucceeded = 0ULL;
+
+    /**
+     * The number of executions that threw an exception.
+     */
+    std::uint64_t mFailed = 0ULL;
+
+    /**
+     * The end-to-end latencies of the executions, from the call to execute() until the response or exception.
+     */
+    Histogram mLatency;
+  };
+
+  /**
+   * The metrics of the attempts of a type of request at a node.
+   */
+  struct NodeRequestMetrics
+  {
+    /**
+     * The type of request.
+     */
+    std::string mRequestType;
+
+    /**
+     * The node: the account ID of a consensus node, or the address of a mirror node.
+     */
+    std::string mNode;
+
+    /**
+     * The number of attempts submitted to the node.
+     */
+    std::uint64_t mAttempts = 0ULL;
+
+    /**
+     * The number of attempts that ended with each gRPC status code, by the name of the code (e.g. "UNAVAILABLE").
+     */
+    std::map<std::string, std::uint64_t> mGrpcStatuses;
+
+    /**
+     * The number of responses from the node with each precheck status.
+     */
+    std::map<Status, std::uint64_t> mPrecheckStatuses;
+
+    /**
+     * The number of attempts after which the request was retried.
+     */
+    std::uint64_t mRetries = 0ULL;
+
+    /**
+     * The number of times the request slept before being submitted again.
+     */
+    std::uint64_t mBackoffs = 0ULL;
+
+    /**
+     * The total time the request slept before being submitted again.
+     */
+    std::chrono::nanoseconds mBackoffTime = std::chrono::nanoseconds(0);
+
+    /**
+     * The latencies of the attempts that got an answer from the node, from submission until the answer.
+     */
+    Histogram mLatency;
+  };
+
+  /**
+   * Write this MetricsSnapshot in the Prometheus text exposition format. Durations are exported in seconds, and
+   * histograms are exported with a bucket for each power of two.
+   *
+   * @return This MetricsSnapshot in the Prometheus text exposition format.
+   */
+  [[nodiscard]] std::string toPrometheus() const;
+
+  /**
+   * The metrics of the executions of each type of request, ordered by request type.
+   */
+  std::vector<RequestMetrics> mRequests;
+
+  /**
+   * The metrics of the attempts of each type of request at each node, ordered by request type and node.
+   */
+  std::vector<NodeRequestMetrics> mNodeRequests;
+
+  /**
+   * The number of times each consensus node was backed off from, by the account ID of the node.
+   */
+  std::map<std::string, std::uint64_t> mNodeBackoffs;
+};
+
+} // namespace Hiero
+
+#endif // HIERO_SDK_CPP_METRICS_SNAPSHOT_H_
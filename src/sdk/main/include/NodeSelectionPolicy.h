@@ -0,0 +1,49 @@
+// SPDX-License-Identifier: Apache-2.0
+#ifndef HIERO_SDK_CPP_NODE_SELECTION_POLICY_H_
+#define HIERO_SDK_CPP_NODE_SELECTION_POLICY_H_
+
+#include <string>
+#include <unordered_map>
+
+namespace Hiero
+{
+/**
+ * An enumeration that describes how a Client chooses between healthy consensus nodes when it selects the nodes for a
+ * request and the node to which a request is first submitted. Nodes in backoff are never chosen while healthy nodes are
+ * available, regardless of the policy.
+ */
+enum class NodeSelectionPolicy
+{
+  /**
+   * Choose uniformly at random between the healthy nodes.
+   */
+  RANDOM,
+  /**
+   * Pick two healthy nodes at random, and choose the one with the lower expected cost. The expected cost of a node
+   * grows with its average response time, its number of outstanding requests, and its error rate.
+   */
+  POWER_OF_TWO_CHOICES,
+  /**
+   * Choose the healthy node with the fewest requests currently in flight.
+   */
+  LEAST_OUTSTANDING_REQUESTS,
+  /**
+   * Choose at random between the healthy nodes, weighting each node by the inverse of its expected cost, so that slower
+   * or more error-prone nodes receive proportionally less traffic.
+   */
+  LATENCY_WEIGHTED
+};
+
+/**
+ * Map of NodeSelectionPolicy to its corresponding string.
+ */
+const std::unordered_map<NodeSelectionPolicy, std::string> gNodeSelectionPolicyToString = {
+  {NodeSelectionPolicy::RANDOM,                      "RANDOM"                    },
+  { NodeSelectionPolicy::POWER_OF_TWO_CHOICES,       "POWER_OF_TWO_CHOICES"      },
+  { NodeSelectionPolicy::LEAST_OUTSTANDING_REQUESTS, "LEAST_OUTSTANDING_REQUESTS"},
+  { NodeSelectionPolicy::LATENCY_WEIGHTED,           "LATENCY_WEIGHTED"          }
+};
+
+} // namespace Hiero
+
+#endif // HIERO_SDK_CPP_NODE_SELECTION_POLICY_H_
@@ -3,6 +3,7 @@
 #define HIERO_SDK_CPP_QUERY_H_
 
 #include "Executable.h"
+#include "HedgingPolicy.h"
 
 #include <chrono>
 #include <functional>
@@ -154,6 +155,21 @@ public:
    */
   [[nodiscard]] std::optional<TransactionId> getPaymentTransactionId() const;
 
+  /**
+   * Set the HedgingPolicy of this Query. This overrides the HedgingPolicy of the Client used to submit this Query.
+   *
+   * @param policy The HedgingPolicy to set.
+   * @return A reference to this derived Query with the newly-set HedgingPolicy.
+   */
+  SdkRequestType& setHedgingPolicy(HedgingPolicy policy);
+
+  /**
+   * Get the HedgingPolicy of this Query.
+   *
+   * @return The HedgingPolicy of this Query. Uninitialized if no HedgingPolicy has been set.
+   */
+  [[nodiscard]] std::optional<HedgingPolicy> getHedgingPolicy() const;
+
 protected:
   /**
    * Prevent public copying and moving to prevent slicing. Use the 'clone()' virtual method instead.
@@ -180,6 +196,36 @@ protected:
    */
   [[nodiscard]] bool isCostQuery() const;
 
+  /**
+   * Derived from Executable. Determine the ExecutionStatus of this Query after being submitted. If this Query was paid
+   * for with a remembered cost that the network found insufficient, it's retried with its exact cost.
+   *
+   * @param status   The response status of the previous attempt.
+   * @param client   The Client that attempted to submit this Query.
+   * @param response The Response protobuf object received from the network in response to submitting this Query.
+   * @return The status of the submitted Query.
+   */
+  [[nodiscard]] typename Executable<SdkRequestType, proto::Query, proto::Response, SdkResponseType>::ExecutionStatus
+  determineStatus(Status status, const Client& client, const proto::Response& response) override;
+
+  /**
+   * Derived from Executable. Determine the ExecutionStatus of this Query after being submitted asynchronously. If this
+   * Query was paid for with a remembered cost that the network found insufficient without giving the exact cost, the
+   * exact cost is asked for asynchronously, and the callback is run once it's known.
+   *
+   * @param status   The response status of the previous attempt.
+   * @param client   The Client that attempted to submit this Query.
+   * @param response The Response protobuf object received from the network in response to submitting this Query.
+   * @param callback The callback to run with the status of the submitted Query and the response.
+   */
+  void determineStatusAsync(
+    Status status,
+    const Client& client,
+    const proto::Response& response,
+    const std::function<
+      void(typename Executable<SdkRequestType, proto::Query, proto::Response, SdkResponseType>::ExecutionStatus,
+           const proto::Response&)>& callback) override;
+
 private:
   /**
    * Build a Query protobuf object with this Query's data, with the input QueryHeader protobuf object.
@@ -210,9 +256,10 @@ private:
    * given index.
    *
    * @param index The index of the node account ID that's associated with the Node being used to execute this Query.
-   * @return A Query protobuf object filled with this Query's data, based on the node account ID at the given index.
+   * @return A reference to a Query protobuf object filled with this Query's data, based on the node account ID at the
+   *         given index. It's valid until the next call to makeRequest().
    */
-  [[nodiscard]] proto::Query makeRequest(unsigned int index) const override;
+  [[nodiscard]] const proto::Query& makeRequest(unsigned int index) const override;
 
   /**
    * Derived from Executable. Get the status response code from a Response protobuf object.
@@ -229,6 +276,26 @@ private:
    */
   void onExecute(const Client& client) override;
 
+  /**
+   * Derived from Executable. Submit a Query protobuf object which contains this Query's data to a Node without
+   * blocking. The gRPC function to call is determined by the case of the Query protobuf object.
+   *
+   * @param request  The Query protobuf object to submit.
+   * @param node     The Node to which to submit the request.
+   * @param deadline The deadline for submitting the request.
+   * @param driver   The CompletionQueueDriver with which to register the submission.
+   * @param callback The callback to run with the gRPC status and the Response protobuf object of the submission.
+   * @param context  The ClientContext with which to make the submission, through which it can be cancelled. If this is
+   *                 nullptr, a ClientContext is created for the submission.
+   * @return \c TRUE if the submission was started, \c FALSE if the CompletionQueueDriver has been shut down.
+   */
+  bool submitRequestAsync(const proto::Query& request,
+                          const std::shared_ptr<internal::Node>& node,
+                          const std::chrono::system_clock::time_point& deadline,
+                          internal::CompletionQueueDriver& driver,
+                          const std::function<void(const grpc::Status&, const proto::Response&)>& callback,
+                          const std::shared_ptr<grpc::ClientContext>& context) const override;
+
   /**
    * Derived from Executable. Get the ID of the payment transaction for this Query.
    *
@@ -236,6 +303,32 @@ private:
    */
   [[nodiscard]] std::optional<TransactionId> getTransactionIdInternal() const override;
 
+  /**
+   * Derived from Executable. Get the type of this Query, i.e. the name of the field of its Query protobuf object.
+   *
+   * @return The type of this Query.
+   */
+  [[nodiscard]] std::string getRequestType() const override;
+
+  /**
+   * Derived from Executable. Should the submissions of this Query be hedged when submitted with the input Client? This
+   * is decided by this Query's HedgingPolicy, or the Client's if this Query doesn't have one.
+   *
+   * @param client The Client being used to submit this Query.
+   * @return \c TRUE if the submissions of this Query should be hedged, otherwise \c FALSE.
+   */
+  [[nodiscard]] bool isHedgingAllowed(const Client& client) const override;
+
+  /**
+   * Pay the exact cost of this Query from now on, after the remembered cost it was paid for was found insufficient.
+   *
+   * @param cost   The exact cost of this Query.
+   * @param client The Client that attempted to submit this Query.
+   * @return RETRY if the exact cost is willing to be paid, otherwise REQUEST_ERROR.
+   */
+  [[nodiscard]] typename Executable<SdkRequestType, proto::Query, proto::Response, SdkResponseType>::ExecutionStatus
+  updateCost(const Hbar& cost, const Client& client);
+
   /**
    * Does this Query require payment? Default to \c TRUE, as most Queries do.
    *
@@ -0,0 +1,155 @@
+// SPDX-License-Identifier: Apache-2.0
+#ifndef HIERO_SDK_CPP_RECEIPT_POLLER_H_
+#define HIERO_SDK_CPP_RECEIPT_POLLER_H_
+
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <vector>
+
+namespace Hiero
+{
+class AccountId;
+class Client;
+class TransactionId;
+class TransactionReceipt;
+class TransactionResponse;
+}
+
+namespace Hiero
+{
+/**
+ * Waits for the receipts of many Transactions at once without dedicating a thread or a retry loop to each one.
+ * Pending receipts are kept on a shared timer wheel that is advanced by a single timer, polls that come due are
+ * coalesced per node and sent with at most a fixed number of receipt requests in flight to each node, and every
+ * request is driven by the completion queue of the Client this ReceiptPoller was created from. Receipts are delivered
+ * through futures or callbacks, which are run on one of the Client's completion queue threads.
+ *
+ * A ReceiptPoller follows the same retry rules as a TransactionReceiptQuery: a receipt is polled again (with an
+ * exponentially increasing backoff) while it is not yet available, and its wait fails once the maximum number of
+ * attempts has been made.
+ */
+class ReceiptPoller
+{
+public:
+  /**
+   * Construct a ReceiptPoller that polls the network of the input Client using its completion queue, maximum attempts,
+   * backoff, and gRPC deadline settings, as they are at the time of construction.
+   *
+   * @param client The Client whose network to poll.
+   */
+  explicit ReceiptPoller(const Client& client);
+
+  /**
+   * Close this ReceiptPoller. See close().
+   */
+  ~ReceiptPoller();
+
+  ReceiptPoller(const ReceiptPoller&) = delete;
+  ReceiptPoller& operator=(const ReceiptPoller&) = delete;
+  ReceiptPoller(ReceiptPoller&&) = delete;
+  ReceiptPoller& operator=(ReceiptPoller&&) = delete;
+
+  /**
+   * Wait for the receipt of the Transaction that generated a TransactionResponse. The receipt is polled from the node
+   * to which the Transaction was submitted, and it is validated if the TransactionResponse's validation policy says so.
+   *
+   * @param response The TransactionResponse of the Transaction whose receipt to wait for.
+   * @return The future TransactionReceipt.
+   */
+  [[nodiscard]] std::future<TransactionReceipt> poll(const TransactionResponse& response);
+
+  /**
+   * Wait for the receipt of a Transaction.
+   *
+   * @param transactionId  The ID of the Transaction whose receipt to wait for.
+   * @param nodeAccountId  The account ID of the node from which to poll the receipt.
+   * @param validateStatus \c TRUE if the future should hold a ReceiptStatusException instead of a receipt without a
+   *                       successful status, otherwise \c FALSE.
+   * @return The future TransactionReceipt.
+   */
+  [[nodiscard]] std::future<TransactionReceipt> poll(const TransactionId& transactionId,
+                                                     const AccountId& nodeAccountId,
+                                                     bool validateStatus = true);
+
+  /**
+   * Wait for the receipt of the Transaction that generated a TransactionResponse and consume it with callbacks.
+   *
+   * @param response          The TransactionResponse of the Transaction whose receipt to wait for.
+   * @param responseCallback  The callback that should consume the TransactionReceipt.
+   * @param exceptionCallback The callback that should consume the exception if the receipt could not be retrieved.
+   */
+  void poll(const TransactionResponse& response,
+            const std::function<void(const TransactionReceipt&)>& responseCallback,
+            const std::function<void(const std::exception_ptr&)>& exceptionCallback);
+
+  /**
+   * Wait for the receipts of the Transactions that generated multiple TransactionResponses.
+   *
+   * @param responses The TransactionResponses of the Transactions whose receipts to wait for.
+   * @return The future TransactionReceipts, in the same order as the input TransactionResponses.
+   */
+  [[nodiscard]] std::vector<std::future<TransactionReceipt>> pollAll(const std::vector<TransactionResponse>& responses);
+
+  /**
+   * Close this ReceiptPoller. No new receipts can be waited on, and receipts that are not being requested right now
+   * fail with an IllegalStateException. Receipts that are being requested fail the same way once their request
+   * completes, unless the request returns their receipt.
+   */
+  void close();
+
+  /**
+   * Set the interval at which this ReceiptPoller's timer wheel advances. Retries are rounded up to the next multiple of
+   * this interval, so a shorter interval gives more precise retry times at the cost of more frequent wakeups.
+   *
+   * @param interval The desired poll interval.
+   * @return A reference to this ReceiptPoller with the newly-set poll interval.
+   * @throws std::invalid_argument If the interval is not positive.
+   */
+  ReceiptPoller& setPollInterval(const std::chrono::system_clock::duration& interval);
+
+  /**
+   * Set the maximum number of receipt requests this ReceiptPoller can have in flight to a single node.
+   *
+   * @param max The desired maximum number of receipt requests in flight to a single node.
+   * @return A reference to this ReceiptPoller with the newly-set maximum number of requests in flight per node.
+   * @throws std::invalid_argument If the maximum is 0.
+   */
+  ReceiptPoller& setMaxInFlightPerNode(unsigned int max);
+
+  /**
+   * Get the interval at which this ReceiptPoller's timer wheel advances.
+   *
+   * @return The interval at which this ReceiptPoller's timer wheel advances.
+   */
+  [[nodiscard]] std::chrono::system_clock::duration getPollInterval() const;
+
+  /**
+   * Get the maximum number of receipt requests this ReceiptPoller can have in flight to a single node.
+   *
+   * @return The maximum number of receipt requests this ReceiptPoller can have in flight to a single node.
+   */
+  [[nodiscard]] unsigned int getMaxInFlightPerNode() const;
+
+  /**
+   * Get the number of receipts this ReceiptPoller is still waiting on.
+   *
+   * @return The number of receipts this ReceiptPoller is still waiting on.
+   */
+  [[nodiscard]] std::size_t getPendingCount() const;
+
+private:
+  /**
+   * Implementation object used to hide implementation details and internal headers. It is shared with the callbacks of
+   * in-flight requests and timers, so that it outlives them.
+   */
+  struct ReceiptPollerImpl;
+  std::shared_ptr<ReceiptPollerImpl> mImpl;
+};
+
+} // namespace Hiero
+
+#endif // HIERO_SDK_CPP_RECEIPT_POLLER_H_
@@ -3,6 +3,8 @@
 #define HIERO_SDK_CPP_TOPIC_MESSAGE_QUERY_H_
 
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <memory>
 
@@ -28,6 +30,40 @@ namespace Hiero
 class TopicMessageQuery
 {
 public:
+  /**
+   * The counters of the reassembly of chunked messages, summed over the subscriptions started from a
+   * TopicMessageQuery.
+   */
+  struct ChunkStatistics
+  {
+    /**
+     * The number of messages completed, including messages of a single chunk.
+     */
+    uint64_t mCompletedMessages = 0ULL;
+
+    /**
+     * The number of chunks dropped because the same chunk of the same message was already received, or because their
+     * message was already completed.
+     */
+    uint64_t mDuplicateChunks = 0ULL;
+
+    /**
+     * The number of chunks dropped because their chunk number doesn't fit the total number of chunks of their message.
+     */
+    uint64_t mInvalidChunks = 0ULL;
+
+    /**
+     * The number of incomplete messages dropped because their first chunk arrived longer ago than the chunk reassembly
+     * timeout.
+     */
+    uint64_t mExpiredMessages = 0ULL;
+
+    /**
+     * The number of incomplete messages dropped to stay within the maximum number of pending chunk bytes.
+     */
+    uint64_t mEvictedMessages = 0ULL;
+  };
+
   TopicMessageQuery();
   ~TopicMessageQuery();
 
@@ -97,6 +133,24 @@ public:
    */
   TopicMessageQuery& setMaxBackoff(const std::chrono::system_clock::duration& backoff);
 
+  /**
+   * Set the maximum number of bytes of received chunks to keep for chunked messages that are not complete yet. Once the
+   * chunks of incomplete messages take more than this, the oldest incomplete messages are dropped.
+   *
+   * @param bytes The maximum number of bytes of chunks to keep for incomplete messages.
+   * @return A reference to this TopicMessageQuery object with the newly-set maximum number of pending chunk bytes.
+   */
+  TopicMessageQuery& setMaxPendingChunkBytes(std::size_t bytes);
+
+  /**
+   * Set the amount of time to wait for the rest of a chunked message after its first chunk arrives. Incomplete messages
+   * older than this are dropped.
+   *
+   * @param timeout The amount of time to wait for the rest of a chunked message.
+   * @return A reference to this TopicMessageQuery object with the newly-set chunk reassembly timeout.
+   */
+  TopicMessageQuery& setChunkReassemblyTimeout(const std::chrono::system_clock::duration& timeout);
+
   /**
    * Set the function to run if there's an error with gRPC communication.
    *
@@ -163,6 +217,28 @@ public:
    */
   [[nodiscard]] std::chrono::system_clock::duration getMaxBackoff() const;
 
+  /**
+   * Get the maximum number of bytes of received chunks to keep for chunked messages that are not complete yet.
+   *
+   * @return The maximum number of bytes of chunks to keep for incomplete messages.
+   */
+  [[nodiscard]] std::size_t getMaxPendingChunkBytes() const;
+
+  /**
+   * Get the amount of time to wait for the rest of a chunked message after its first chunk arrives.
+   *
+   * @return The amount of time to wait for the rest of a chunked message.
+   */
+  [[nodiscard]] std::chrono::system_clock::duration getChunkReassemblyTimeout() const;
+
+  /**
+   * Get the counters of the reassembly of chunked messages, summed over the subscriptions started from this
+   * TopicMessageQuery so far. Copies of this TopicMessageQuery start with their own counters.
+   *
+   * @return The counters of the reassembly of chunked messages.
+   */
+  [[nodiscard]] ChunkStatistics getChunkStatistics() const;
+
 private:
   /**
    * Implementation object used to hide implementation details and internal headers.
@@ -128,6 +128,14 @@ private:
    */
   void addToChunk(uint32_t chunk, uint32_t total, proto::TransactionBody& body) const override;
 
+  /**
+   * Derived from ChunkedTransaction. The chunks of a topic message are reassembled by their chunk number, so they don't
+   * have to reach consensus in order.
+   *
+   * @return \c FALSE.
+   */
+  [[nodiscard]] bool isChunkOrderSensitive() const override;
+
   /**
    * Initialize this TopicMessageSubmitTransaction from its source TransactionBody protobuf object.
    */
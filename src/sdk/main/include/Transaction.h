@@ -21,6 +21,7 @@ namespace Hiero
 class PrivateKey;
 class TransactionResponse;
 class ScheduleCreateTransaction;
+class TransactionBatchBuilder;
 class WrappedTransaction;
 }
 
@@ -242,6 +243,18 @@ public:
    */
   SdkRequestType& setRegenerateTransactionIdPolicy(bool regenerate);
 
+  /**
+   * Set the signing mode of this Transaction. In parallel mode, the signatures for every node and signer are generated
+   * concurrently on a shared pool of threads, each distinct body is only signed once per signer, and a signer that
+   * has already signed a body is not asked to sign it again. Signature pairs are still added to each SignatureMap in
+   * the same order as in sequential mode. All signer functions of this Transaction must be safe to call concurrently
+   * for parallel mode to be used.
+   *
+   * @param parallel \c TRUE to generate signatures in parallel, \c FALSE to generate them sequentially.
+   * @return A reference to this derived Transaction object with the newly-set signing mode.
+   */
+  SdkRequestType& setParallelSigning(bool parallel);
+
   /**
    * Get the ID of this Transaction.
    *
@@ -290,6 +303,13 @@ public:
    */
   [[nodiscard]] std::optional<bool> getRegenerateTransactionIdPolicy() const;
 
+  /**
+   * Get the signing mode of this Transaction.
+   *
+   * @return \c TRUE if this Transaction generates its signatures in parallel, otherwise \c FALSE.
+   */
+  [[nodiscard]] bool getParallelSigning() const;
+
 protected:
   /**
    * Dummy transaction and account IDs used to assist in deserializing incomplete Transactions.
@@ -328,10 +348,10 @@ protected:
    *
    * @param index The index of the node account ID that's associated with the Node being used to execute this
    *              Transaction.
-   * @return A Transaction protobuf object filled with this Transaction's data, based on the node account ID at the
-   *         given index.
+   * @return A reference to the Transaction protobuf object filled with this Transaction's data, based on the node
+   *         account ID at the given index. It's built (and signed) once, and reused for every attempt.
    */
-  [[nodiscard]] proto::Transaction makeRequest(unsigned int index) const override;
+  [[nodiscard]] const proto::Transaction& makeRequest(unsigned int index) const override;
 
   /**
    * Build all Transaction protobuf objects for this Transaction, each going to a different previously-selected node.
@@ -372,7 +392,7 @@ protected:
    * @param transaction The TransactionBody protobuf object from which to construct the SignedTransaction protobuf
    *                    objects.
    */
-  void addSignedTransactionForEachNode(proto::TransactionBody transactionBody) const;
+  void addSignedTransactionForEachNode(const proto::TransactionBody& transactionBody) const;
 
   /**
    * Clear the SignedTransaction and Transaction protobuf objects held by this Transaction.
@@ -413,16 +433,26 @@ protected:
    * Get the Transaction protobuf object located at the given index in the Transaction protobuf object list.
    *
    * @param index The index at which to get the Transaction protobuf object.
-   * @return The Transaction protobuf object located at the given index.
+   * @return A reference to the Transaction protobuf object located at the given index.
    */
-  [[nodiscard]] proto::Transaction getTransactionProtobufObject(unsigned int index) const;
+  [[nodiscard]] const proto::Transaction& getTransactionProtobufObject(unsigned int index) const;
+
+  /**
+   * Get the SHA384 hash of the Transaction protobuf object located at the given index in the Transaction protobuf
+   * object list. The hash is computed once, when the Transaction protobuf object is built, so the Transaction protobuf
+   * object must have been built.
+   *
+   * @param index The index of the Transaction protobuf object of which to get the hash.
+   * @return A reference to the hash of the Transaction protobuf object located at the given index.
+   */
+  [[nodiscard]] const std::vector<std::byte>& getTransactionProtobufObjectHash(unsigned int index) const;
 
   /**
    * Get the source TransactionBody protobuf object from which this Transaction constructed itself.
    *
-   * @return The source TransactionBody protobuf object from which this Transaction constructed itself.
+   * @return A reference to the source TransactionBody protobuf object from which this Transaction constructed itself.
    */
-  [[nodiscard]] proto::TransactionBody getSourceTransactionBody() const;
+  [[nodiscard]] const proto::TransactionBody& getSourceTransactionBody() const;
 
   /**
    * Get the ID of this Transaction.
@@ -433,6 +463,7 @@ protected:
 
 private:
   friend class PrivateKey;
+  friend class TransactionBatchBuilder;
 
   /**
    * Build and add the derived Transaction's protobuf representation to the Transaction protobuf object.
@@ -449,6 +480,21 @@ private:
    */
   virtual void validateChecksums(const Client& client) const = 0;
 
+  /**
+   * Get the number of consecutive valid start times to reserve when generating the TransactionId of this Transaction.
+   *
+   * @return The number of consecutive valid start times this Transaction uses.
+   */
+  [[nodiscard]] virtual unsigned int getRequiredValidStarts() const;
+
+  /**
+   * Is the maximum transaction fee of this Transaction explicitly set? If not, the maximum transaction fee of the
+   * Client with which it is frozen is used, or the default maximum transaction fee if that Client has none.
+   *
+   * @return \c TRUE if the maximum transaction fee of this Transaction is explicitly set, otherwise \c FALSE.
+   */
+  [[nodiscard]] bool isMaxTransactionFeeSet() const;
+
   /**
    * Derived from Executable. Construct a TransactionResponse object from a TransactionResponse protobuf object.
    *
@@ -490,6 +536,27 @@ private:
    */
   void onExecute(const Client& client) override;
 
+  /**
+   * Derived from Executable. Submit a Transaction protobuf object which contains this Transaction's data to a Node
+   * without blocking. The gRPC function to call is determined by the data of this Transaction's body.
+   *
+   * @param request  The Transaction protobuf object to submit.
+   * @param node     The Node to which to submit the request.
+   * @param deadline The deadline for submitting the request.
+   * @param driver   The CompletionQueueDriver with which to register the submission.
+   * @param callback The callback to run with the gRPC status and the TransactionResponse protobuf object of the
+   *                 submission.
+   * @param context  The ClientContext with which to make the submission, through which it can be cancelled. If this is
+   *                 nullptr, a ClientContext is created for the submission.
+   * @return \c TRUE if the submission was started, \c FALSE if the CompletionQueueDriver has been shut down.
+   */
+  bool submitRequestAsync(const proto::Transaction& request,
+                          const std::shared_ptr<internal::Node>& node,
+                          const std::chrono::system_clock::time_point& deadline,
+                          internal::CompletionQueueDriver& driver,
+                          const std::function<void(const grpc::Status&, const proto::TransactionResponse&)>& callback,
+                          const std::shared_ptr<grpc::ClientContext>& context) const override;
+
   /**
    * Derived from Executable. Get the ID of this Transaction.
    *
@@ -497,6 +564,13 @@ private:
    */
   [[nodiscard]] std::optional<TransactionId> getTransactionIdInternal() const override;
 
+  /**
+   * Derived from Executable. Get the type of this Transaction, i.e. the name of the field of its TransactionBody.
+   *
+   * @return The type of this Transaction.
+   */
+  [[nodiscard]] std::string getRequestType() const override;
+
   /**
    * Build a Transaction protobuf object from the SignedTransaction protobuf object at the specified index.
    *
@@ -505,6 +579,14 @@ private:
    */
   void buildTransaction(unsigned int index) const;
 
+  /**
+   * Build the Transaction protobuf objects at the specified indices, generating all of their signatures in parallel.
+   *
+   * @param indices The indices in the Transaction's SignedTransaction list from which the Transaction protobuf objects
+   *                should be built.
+   */
+  void buildTransactionsInParallel(const std::vector<unsigned int>& indices) const;
+
   /**
    * Determine if a PublicKey has already signed this Transaction.
    *
@@ -0,0 +1,182 @@
+// SPDX-License-Identifier: Apache-2.0
+#ifndef HIERO_SDK_CPP_TRANSACTION_BATCH_BUILDER_H_
+#define HIERO_SDK_CPP_TRANSACTION_BATCH_BUILDER_H_
+
+#include "AccountId.h"
+#include "Hbar.h"
+#include "TransactionId.h"
+#include "TransferTransaction.h"
+
+#include <optional>
+#include <string>
+#include <transaction.pb.h>
+#include <vector>
+
+namespace Hiero
+{
+class Client;
+}
+
+namespace Hiero
+{
+/**
+ * Builds and signs large batches of near-identical Hbar transfers, without going through the freeze and sign pipeline
+ * of a TransferTransaction for each one. The settings shared by the transfers (the maximum transaction fee, valid
+ * duration, memo, node account IDs, and any transfers every transaction should carry) are taken from a prototype
+ * TransferTransaction, and the fields that vary between transfers (the recipient, the amount, and optionally the memo)
+ * are given as columns, one entry per transfer.
+ *
+ * Each transfer moves its amount from the sender to its recipient, and is paid for and signed by the operator of the
+ * Client used to build the batch. If the prototype already transfers Hbar to or from the sender or a recipient, the
+ * amounts are merged per account, as a TransferTransaction merges them. The TransactionIds of a batch are reserved all
+ * at once, the TransactionBody of each transfer is serialized once for all of its nodes, and the transfers are built
+ * and signed in parallel on the thread pool the SDK uses for signing.
+ */
+class TransactionBatchBuilder
+{
+public:
+  /**
+   * A signed transfer of a batch.
+   */
+  struct SignedTransfer
+  {
+    /**
+     * The ID of the transfer.
+     */
+    TransactionId mTransactionId;
+
+    /**
+     * The signed Transaction protobuf objects of the transfer, one for each node account ID of the batch, in order.
+     */
+    std::vector<proto::Transaction> mTransactions;
+  };
+
+  /**
+   * A batch of signed transfers. A transfer can be submitted by constructing a TransferTransaction from its
+   * Transaction protobuf objects and executing it.
+   */
+  struct Batch
+  {
+    /**
+     * The account IDs of the nodes to which the transfers of the batch can be submitted.
+     */
+    std::vector<AccountId> mNodeAccountIds;
+
+    /**
+     * The signed transfers, in the order of the columns from which they were built.
+     */
+    std::vector<SignedTransfer> mTransfers;
+  };
+
+  /**
+   * Construct with the prototype of the transfers to build. Its TransactionId, if any, is ignored.
+   *
+   * @param prototype The TransferTransaction from which to take the settings shared by the transfers.
+   */
+  explicit TransactionBatchBuilder(TransferTransaction prototype);
+
+  /**
+   * Set the account from which the transfers are sent. Defaults to the operator account of the Client used to build
+   * the batch.
+   *
+   * @param sender The ID of the account from which to send the transfers.
+   * @return A reference to this TransactionBatchBuilder with the newly-set sender.
+   */
+  TransactionBatchBuilder& setSender(const AccountId& sender);
+
+  /**
+   * Set the recipients of the transfers, one per transfer.
+   *
+   * @param recipients The IDs of the accounts to which to send the transfers.
+   * @return A reference to this TransactionBatchBuilder with the newly-set recipients.
+   */
+  TransactionBatchBuilder& setRecipients(std::vector<AccountId> recipients);
+
+  /**
+   * Set the amounts of the transfers, one per transfer.
+   *
+   * @param amounts The amounts of Hbar to transfer.
+   * @return A reference to this TransactionBatchBuilder with the newly-set amounts.
+   */
+  TransactionBatchBuilder& setAmounts(std::vector<Hbar> amounts);
+
+  /**
+   * Set the memos of the transfers, one per transfer. If no memos are set, every transfer has the memo of the
+   * prototype.
+   *
+   * @param memos The memos of the transfers.
+   * @return A reference to this TransactionBatchBuilder with the newly-set memos.
+   */
+  TransactionBatchBuilder& setMemos(std::vector<std::string> memos);
+
+  /**
+   * Build and sign the transfers. If the prototype has no node account IDs, the transfers are built for nodes chosen
+   * from the network of the Client. If the prototype has no maximum transaction fee, that of the Client is used, if
+   * set.
+   *
+   * @param client The Client whose operator pays for and signs the transfers.
+   * @return The batch of signed transfers.
+   * @throws std::invalid_argument  If the columns don't all have one entry per transfer, or a recipient is the sender.
+   * @throws UninitializedException If the Client has no operator, or no network to choose nodes from.
+   */
+  [[nodiscard]] Batch build(const Client& client) const;
+
+  /**
+   * Get the account from which the transfers are sent.
+   *
+   * @return The ID of the account from which the transfers are sent. Uninitialized if the operator account of the
+   *         Client used to build the batch sends them.
+   */
+  [[nodiscard]] inline std::optional<AccountId> getSender() const { return mSender; }
+
+  /**
+   * Get the recipients of the transfers.
+   *
+   * @return The IDs of the accounts to which the transfers are sent.
+   */
+  [[nodiscard]] inline const std::vector<AccountId>& getRecipients() const { return mRecipients; }
+
+  /**
+   * Get the amounts of the transfers.
+   *
+   * @return The amounts of Hbar to transfer.
+   */
+  [[nodiscard]] inline const std::vector<Hbar>& getAmounts() const { return mAmounts; }
+
+  /**
+   * Get the memos of the transfers.
+   *
+   * @return The memos of the transfers.
+   */
+  [[nodiscard]] inline const std::vector<std::string>& getMemos() const { return mMemos; }
+
+private:
+  /**
+   * The prototype of the transfers.
+   */
+  TransferTransaction mPrototype;
+
+  /**
+   * The ID of the account from which the transfers are sent, if not the operator account.
+   */
+  std::optional<AccountId> mSender;
+
+  /**
+   * The IDs of the accounts to which the transfers are sent.
+   */
+  std::vector<AccountId> mRecipients;
+
+  /**
+   * The amounts of Hbar to transfer.
+   */
+  std::vector<Hbar> mAmounts;
+
+  /**
+   * The memos of the transfers.
+   */
+  std::vector<std::string> mMemos;
+};
+
+} // namespace Hiero
+
+#endif // HIERO_SDK_CPP_TRANSACTION_BATCH_BUILDER_H_
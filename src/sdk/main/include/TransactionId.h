@@ -59,7 +59,8 @@ public:
                                                     const std::chrono::system_clock::time_point& start);
 
   /**
-   * Generate a new TransactionId.
+   * Generate a new TransactionId. The valid start time is the current time, or later if needed to keep it unique among
+   * the TransactionIds generated for the same account.
    *
    * @param accountId The ID of the account to be charged for the execution of the transaction with which this ID will
    *                  be associated.
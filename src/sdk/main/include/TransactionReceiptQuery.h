@@ -75,6 +75,19 @@ public:
   [[nodiscard]] inline bool getIncludeDuplicates() const { return mIncludeDuplicates; }
 
 private:
+  friend class ReceiptPoller;
+
+  /**
+   * Determine the ExecutionStatus of a TransactionGetReceipt response. ReceiptPoller uses this as well, so that receipts
+   * it polls are retried on exactly the same statuses as this TransactionReceiptQuery.
+   *
+   * @param status   The precheck status of the response.
+   * @param response The Response protobuf object received from the network.
+   * @return The status of the TransactionGetReceipt request.
+   */
+  [[nodiscard]] static typename Executable<TransactionReceiptQuery, proto::Query, proto::Response, TransactionReceipt>::
+    ExecutionStatus determineReceiptStatus(Status status, const proto::Response& response);
+
   /**
    * Derived from Executable. Construct a TransactionReceipt object from a Response protobuf object.
    *
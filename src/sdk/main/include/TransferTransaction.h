@@ -23,6 +23,11 @@ class NftId;
 class TokenId;
 }
 
+namespace Hiero::internal
+{
+class PaymentTransactionPool;
+}
+
 namespace Hiero
 {
 /**
@@ -198,10 +203,12 @@ public:
 
 private:
   /**
-   * Allow Queries to create Transaction protobuf objects from TransferTransactions (to use as payments).
+   * Allow Queries and the PaymentTransactionPool to create Transaction protobuf objects from TransferTransactions (to
+   * use as payments).
    */
   template<typename SdkRequestType, typename SdkResponseType>
   friend class Query;
+  friend class internal::PaymentTransactionPool;
   friend class WrappedTransaction;
 
   /**
@@ -0,0 +1,161 @@
+// SPDX-License-Identifier: Apache-2.0
+#ifndef HIERO_SDK_CPP_IMPL_ARENA_POOL_H_
+#define HIERO_SDK_CPP_IMPL_ARENA_POOL_H_
+
+#include <cstddef>
+#include <google/protobuf/arena.h>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace Hiero::internal
+{
+/**
+ * Internal utility class that recycles the protobuf Arenas in which short-lived protobuf messages are built and parsed.
+ * A message on an Arena allocates its whole message tree from a few blocks of the Arena instead of from the heap, one
+ * allocation per nested message and string. Each pooled Arena owns an initial block which survives the Arena being
+ * reset, so that a recycled Arena serves the messages of a typical request without allocating at all.
+ *
+ * Only messages that don't outlive a single request are put on Arenas: the responses parsed by Executable and Node, and
+ * the scratch copy of a TransactionBody serialized by TransactionBodyTemplate. The source TransactionBody of a
+ * Transaction and the request of a Query are kept by their Transaction and Query, and are built from the heap-allocated
+ * messages of the toProtobuf() functions, so they stay on the heap.
+ */
+class ArenaPool
+{
+public:
+  /**
+   * An Arena taken from an ArenaPool, which is reset and given back to the ArenaPool when the Lease is destroyed. Any
+   * message allocated on the Arena must not be used past the Lease.
+   */
+  class Lease
+  {
+  public:
+    /**
+     * Give the Arena back to its ArenaPool.
+     */
+    ~Lease();
+
+    Lease(const Lease&) = delete;
+    Lease& operator=(const Lease&) = delete;
+    Lease(Lease&& other) noexcept;
+    Lease& operator=(Lease&&) = delete;
+
+    /**
+     * Get the leased Arena.
+     *
+     * @return A pointer to the leased Arena.
+     */
+    [[nodiscard]] google::protobuf::Arena* get() const;
+
+  private:
+    friend class ArenaPool;
+
+    /**
+     * An Arena, along with the initial block it owns.
+     */
+    struct PooledArena;
+
+    /**
+     * Construct with the ArenaPool from which the Arena was taken, and the Arena.
+     *
+     * @param pool  The ArenaPool from which the Arena was taken.
+     * @param arena The leased Arena.
+     */
+    Lease(ArenaPool* pool, std::unique_ptr<PooledArena> arena);
+
+    /**
+     * The ArenaPool from which the Arena was taken.
+     */
+    ArenaPool* mPool = nullptr;
+
+    /**
+     * The leased Arena.
+     */
+    std::unique_ptr<PooledArena> mArena;
+  };
+
+  /**
+   * The default size of the initial block of each pooled Arena. It fits the requests and responses of most
+   * transactions and queries.
+   */
+  static constexpr std::size_t DEFAULT_INITIAL_BLOCK_SIZE = 8192ULL;
+
+  /**
+   * The default maximum number of idle Arenas kept by an ArenaPool. Arenas given back beyond it are freed.
+   */
+  static constexpr std::size_t DEFAULT_MAX_IDLE_ARENAS = 256ULL;
+
+  /**
+   * Get the ArenaPool shared by the whole process.
+   *
+   * @return The ArenaPool shared by the whole process.
+   */
+  [[nodiscard]] static ArenaPool& getInstance();
+
+  /**
+   * Construct with the size of the initial block of each Arena and the maximum number of idle Arenas to keep.
+   *
+   * @param initialBlockSize The size of the initial block of each Arena.
+   * @param maxIdleArenas    The maximum number of idle Arenas to keep.
+   */
+  explicit ArenaPool(std::size_t initialBlockSize = DEFAULT_INITIAL_BLOCK_SIZE,
+                     std::size_t maxIdleArenas = DEFAULT_MAX_IDLE_ARENAS);
+
+  /**
+   * Free the idle Arenas. All Leases must have been destroyed.
+   */
+  ~ArenaPool();
+
+  ArenaPool(const ArenaPool&) = delete;
+  ArenaPool& operator=(const ArenaPool&) = delete;
+  ArenaPool(ArenaPool&&) = delete;
+  ArenaPool& operator=(ArenaPool&&) = delete;
+
+  /**
+   * Take an idle Arena, or create one if there is none.
+   *
+   * @return The Lease of the Arena.
+   */
+  [[nodiscard]] Lease acquire();
+
+  /**
+   * Get the number of idle Arenas this ArenaPool currently keeps.
+   *
+   * @return The number of idle Arenas this ArenaPool currently keeps.
+   */
+  [[nodiscard]] std::size_t getIdleArenas() const;
+
+private:
+  /**
+   * Reset an Arena and keep it for a later Lease, unless this ArenaPool already keeps the maximum number of idle
+   * Arenas.
+   *
+   * @param arena The Arena to give back.
+   */
+  void release(std::unique_ptr<Lease::PooledArena> arena);
+
+  /**
+   * The size of the initial block of each Arena.
+   */
+  std::size_t mInitialBlockSize;
+
+  /**
+   * The maximum number of idle Arenas to keep.
+   */
+  std::size_t mMaxIdleArenas;
+
+  /**
+   * The idle Arenas.
+   */
+  std::vector<std::unique_ptr<Lease::PooledArena>> mIdleArenas;
+
+  /**
+   * The mutex protecting the idle Arenas. It's only held to take or give back an Arena.
+   */
+  mutable std::mutex mMutex;
+};
+
+} // namespace Hiero::internal
+
+#endif // HIERO_SDK_CPP_IMPL_ARENA_POOL_H_
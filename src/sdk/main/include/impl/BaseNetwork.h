@@ -9,15 +9,20 @@
 #include "TLSBehavior.h"
 
 #include <chrono>
+#include <cstddef>
 #include <memory>
 #include <mutex>
 #include <string>
 #include <string_view>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 namespace Hiero::internal
 {
+class CompletionQueueDriver;
+class MetricsRegistry;
+
 template<typename NetworkType, typename KeyType, typename NodeType>
 class BaseNetwork
 {
@@ -33,7 +38,7 @@ public:
   NetworkType& setNetwork(const std::unordered_map<std::string, KeyType>& network);
 
   /**
-   * Increase the backoff of the input NodeType.
+   * Increase the backoff of the input NodeType, and record it in the MetricsRegistry of this BaseNetwork if it has one.
    *
    * @param node The NodeType of which to increase the backoff.
    */
@@ -117,6 +122,14 @@ public:
    */
   virtual NetworkType& setLedgerId(const LedgerId& ledgerId);
 
+  /**
+   * Set the MetricsRegistry in which this BaseNetwork records the backoffs of its NodeTypes.
+   *
+   * @param registry The MetricsRegistry in which to record backoffs. nullptr to not record them.
+   * @return A reference to this derived BaseNetwork object with the newly-set MetricsRegistry.
+   */
+  NetworkType& setMetricsRegistry(std::shared_ptr<MetricsRegistry> registry);
+
   /**
    * Get the transport security policy of this BaseNetwork.
    *
@@ -129,7 +142,7 @@ public:
    *
    * @return The maximum number of times to try to use a NodeType before removing it from this BaseNetwork.
    */
-  [[nodiscard]] inline unsigned int getMaxNodeAttempts() const { return mMaxNodeAttempts; }
+  [[nodiscard]] inline unsigned int getMaxNodeAttempts() const { return getNodeTable()->mMaxNodeAttempts; }
 
   /**
    * Get the minimum amount of time to backoff from a NodeType after a bad gRPC status is received.
@@ -157,7 +170,10 @@ public:
    *
    * @return The maximum amount of time to wait before readmitting NodeTypes as "healthy".
    */
-  [[nodiscard]] inline std::chrono::system_clock::duration getMaxNodeReadmitTime() const { return mMaxNodeReadmitTime; }
+  [[nodiscard]] inline std::chrono::system_clock::duration getMaxNodeReadmitTime() const
+  {
+    return getNodeTable()->mMaxNodeReadmitTime;
+  }
 
   /**
    * Get the amount of time to allow gRPC connections on this BaseNetwork to close gracefully before forcibly
@@ -176,13 +192,42 @@ public:
   [[nodiscard]] inline LedgerId getLedgerId() const { return mLedgerId; }
 
 protected:
+  /**
+   * An immutable snapshot of the NodeTypes on this BaseNetwork and the settings used to select them. A new NodeTable is
+   * published each time either changes, so that requests can select nodes without taking this BaseNetwork's mutex.
+   */
+  struct NodeTable
+  {
+    /**
+     * Map of node identifiers (KeyTypes) to their NodeTypes.
+     */
+    std::unordered_map<KeyType, std::vector<std::shared_ptr<NodeType>>> mNetwork;
+
+    /**
+     * The list of all nodes on the BaseNetwork.
+     */
+    std::vector<std::shared_ptr<NodeType>> mNodes;
+
+    /**
+     * The maximum number of bad gRPC statuses a NodeType can receive before it is removed from the BaseNetwork.
+     */
+    unsigned int mMaxNodeAttempts = DEFAULT_MAX_NODE_ATTEMPTS;
+
+    /**
+     * The maximum amount of time to wait for a NodeType to be readmitted as "healthy" before checking again.
+     */
+    std::chrono::system_clock::duration mMaxNodeReadmitTime = DEFAULT_MAX_NODE_BACKOFF;
+  };
+
   ~BaseNetwork() = default;
 
   /**
    * Get a number of the most healthy nodes on this BaseNetwork. "Healthy"-ness is determined by sort order; the lower
    * index nodes in the returned vector are considered the most healthy.
    *
-   * This will also remove any nodes which have hit or exceeded mMaxNodeAttempts permanently from the BaseNetwork.
+   * This will also remove any nodes which have hit or exceeded mMaxNodeAttempts permanently from the BaseNetwork. The
+   * mutex of this BaseNetwork must not be held: nodes are selected from the NodeTable without it, and it is only taken
+   * if a node has to be removed.
    *
    * @param count The number of nodes to get.
    * @return A list of pointers to the healthiest BaseNodes on this BaseNetwork.
@@ -226,6 +271,13 @@ protected:
    */
   [[nodiscard]] inline std::shared_ptr<std::mutex> getLock() const { return mMutex; }
 
+  /**
+   * Get the current NodeTable of this BaseNetwork. This doesn't require this BaseNetwork's mutex.
+   *
+   * @return A pointer to the current NodeTable of this BaseNetwork.
+   */
+  [[nodiscard]] inline std::shared_ptr<const NodeTable> getNodeTable() const { return std::atomic_load(&mNodeTable); }
+
 private:
   /**
    * Create a NodeType for this BaseNetwork based on a network entry.
@@ -239,11 +291,21 @@ private:
     [[maybe_unused]] const KeyType& key) const = 0;
 
   /**
-   * Readmit nodes from the mNodes list to the mHealthyNodes list when the time has passed the mEarliestReadmitTime.
-   * While readmitting nodes, mEarliestReadmitTime will be updated to a new value. This value is either the value of
-   * the node with the smallest readmission time from now, or mMinNodeReadmitTime or mMaxNodeReadmitTime.
+   * Choose one of the healthy candidates when selecting the most healthy nodes. By default, a candidate is chosen
+   * uniformly at random.
+   *
+   * @param candidates The candidates from which to choose. The healthy candidates are at the front of the list.
+   * @param healthy    The number of healthy candidates. This is always positive.
+   * @return The index of the chosen candidate.
+   */
+  [[nodiscard]] virtual std::size_t selectHealthyNode(const std::vector<std::shared_ptr<NodeType>>& candidates,
+                                                      std::size_t healthy) const;
+
+  /**
+   * Publish a new NodeTable built from the current nodes and settings of this BaseNetwork. The mutex of this
+   * BaseNetwork must be held.
    */
-  void readmitNodes();
+  void publishNodeTable();
 
   /**
    * Remove a BaseNode from this BaseNetwork.
@@ -262,11 +324,6 @@ private:
    */
   std::unordered_set<std::shared_ptr<NodeType>> mNodes;
 
-  /**
-   * The list of current healthy nodes on this BaseNetwork.
-   */
-  std::unordered_set<std::shared_ptr<NodeType>> mHealthyNodes;
-
   /**
    * The transport security policy of this BaseNetwork.
    */
@@ -299,11 +356,6 @@ private:
    */
   std::chrono::system_clock::duration mMaxNodeReadmitTime = DEFAULT_MAX_NODE_BACKOFF;
 
-  /**
-   * The earliest time that a node should be readmitted.
-   */
-  std::chrono::system_clock::time_point mEarliestReadmitTime = std::chrono::system_clock::now();
-
   /**
    * The timeout for closing either a single node when setting a new network, or closing the entire network.
    */
@@ -314,6 +366,24 @@ private:
    */
   LedgerId mLedgerId;
 
+  /**
+   * The current NodeTable of this BaseNetwork. It is only accessed with the std::atomic_load and std::atomic_store
+   * overloads for std::shared_ptr.
+   */
+  std::shared_ptr<const NodeTable> mNodeTable = std::make_shared<const NodeTable>();
+
+  /**
+   * The MetricsRegistry in which the backoffs of the NodeTypes are recorded. Like the NodeTable, it is only accessed
+   * with the std::atomic_load and std::atomic_store overloads for std::shared_ptr.
+   */
+  std::shared_ptr<MetricsRegistry> mMetricsRegistry = nullptr;
+
+  /**
+   * The CompletionQueueDriver on which the connectivity of the channels of the NodeTypes is watched. It is created with
+   * the first NodeType, and shut down when this BaseNetwork is closed.
+   */
+  std::shared_ptr<CompletionQueueDriver> mConnectivityDriver = nullptr;
+
   /**
    * The mutex for this BaseNetwork, kept inside a std::shared_ptr to keep BaseNetwork copyable/movable.
    */
@@ -5,12 +5,18 @@
 #include <basic_types.pb.h> // This is needed for Windows to build for some reason.
 
 #include "BaseNodeAddress.h"
+#include "ConnectivityWatcher.h"
 #include "Defaults.h"
+#include "NodeHealth.h"
 
+#include <atomic>
 #include <chrono>
+#include <cstddef>
 #include <grpcpp/channel.h>
 #include <grpcpp/security/credentials.h>
+#include <memory>
 #include <mutex>
+#include <vector>
 
 namespace Hiero::internal
 {
@@ -48,12 +54,65 @@ public:
   [[nodiscard]] bool isHealthy() const;
 
   /**
-   * Has this BaseNode failed to connect to its remote node?
+   * Has this BaseNode failed to connect to its remote node? If none of its channels are connected yet, this waits for
+   * one of them to connect. The mutex of this BaseNode is not held while waiting.
    *
    * @return \c TRUE if this BaseNode has failed to connect to its remote node, otherwise \c FALSE.
    */
   [[nodiscard]] bool channelFailedToConnect();
 
+  /**
+   * Is this BaseNode's remote node known to be unreachable? This never blocks: it checks the connectivity state of the
+   * channels as last observed in the background, and creates the channels (which starts connecting them) if they don't
+   * exist yet.
+   *
+   * @return \c TRUE if every channel of this BaseNode is in a transient failure, otherwise \c FALSE.
+   */
+  [[nodiscard]] bool isChannelUnreachable();
+
+  /**
+   * Start connecting this BaseNode to its remote node, if it isn't connected already. This doesn't wait for the
+   * connections to complete.
+   */
+  void connect();
+
+  /**
+   * Wait for all channels of this BaseNode to connect to its remote node. The channels are created if they don't exist
+   * yet. The mutex of this BaseNode is not held while waiting.
+   *
+   * @param deadline The time at which to stop waiting.
+   * @return \c TRUE if all channels of this BaseNode connected before the deadline, otherwise \c FALSE.
+   */
+  [[nodiscard]] bool waitForConnected(const std::chrono::system_clock::time_point& deadline);
+
+  /**
+   * Set the number of gRPC channels this BaseNode opens to its remote node. Requests are spread over the channels in a
+   * round-robin fashion, and each channel uses its own connection. This will close this BaseNode's current connections
+   * if the number changes.
+   *
+   * @param size The number of channels to open.
+   * @return A reference to this derived BaseNode object with the newly-set channel pool size.
+   * @throws std::invalid_argument If the size is 0.
+   */
+  NodeType& setChannelPoolSize(unsigned int size);
+
+  /**
+   * Get the number of gRPC channels this BaseNode opens to its remote node.
+   *
+   * @return The number of gRPC channels this BaseNode opens to its remote node.
+   */
+  [[nodiscard]] unsigned int getChannelPoolSize() const;
+
+  /**
+   * Set the CompletionQueueDriver on which the connectivity of this BaseNode's channels is watched. It applies to the
+   * channels opened from now on.
+   *
+   * @param driver The CompletionQueueDriver on which to watch the channels. nullptr to only check their connectivity
+   *               when it is asked for.
+   * @return A reference to this derived BaseNode object with the newly-set CompletionQueueDriver.
+   */
+  NodeType& setConnectivityDriver(std::shared_ptr<CompletionQueueDriver> driver);
+
   /**
    * Get the remaining amount of time this BaseNode has in its backoff.
    *
@@ -93,44 +152,28 @@ public:
    *
    * @return The minimum amount of time for this BaseNode to backoff after a bad gRPC status is received.
    */
-  [[nodiscard]] inline std::chrono::system_clock::duration getMinNodeBackoff() const
-  {
-    std::unique_lock lock(*mMutex);
-    return mMinNodeBackoff;
-  }
+  [[nodiscard]] inline std::chrono::system_clock::duration getMinNodeBackoff() const { return mHealth.getMinBackoff(); }
 
   /**
    * Get the maximum amount of time for this BaseNode to backoff after a bad gRPC status is received.
    *
    * @return The maximum amount of time for this BaseNode to backoff after a bad gRPC status is received.
    */
-  [[nodiscard]] inline std::chrono::system_clock::duration getMaxNodeBackoff() const
-  {
-    std::unique_lock lock(*mMutex);
-    return mMaxNodeBackoff;
-  }
+  [[nodiscard]] inline std::chrono::system_clock::duration getMaxNodeBackoff() const { return mHealth.getMaxBackoff(); }
 
   /**
    * Get the number of times this BaseNode has received a bad gRPC status when attempting to submit a request.
    *
    * @return The number of times this BaseNode has received a bad gRPC status.
    */
-  [[nodiscard]] inline unsigned int getBadGrpcStatusCount() const
-  {
-    std::unique_lock lock(*mMutex);
-    return mBadGrpcStatusCount;
-  }
+  [[nodiscard]] inline unsigned int getBadGrpcStatusCount() const { return mHealth.getBadGrpcStatusCount(); }
 
   /**
    * Get the time at which this BaseNode will be considered "healthy".
    *
    * @return The time at which this BaseNode will be considered "healthy".
    */
-  [[nodiscard]] inline std::chrono::system_clock::time_point getReadmitTime() const
-  {
-    std::unique_lock lock(*mMutex);
-    return mReadmitTime;
-  }
+  [[nodiscard]] inline std::chrono::system_clock::time_point getReadmitTime() const { return mHealth.getReadmitTime(); }
 
   /**
    * Get this BaseNode's mutex.
@@ -140,7 +183,10 @@ public:
   [[nodiscard]] inline std::shared_ptr<std::mutex> getLock() const { return mMutex; }
 
 protected:
-  ~BaseNode() = default;
+  /**
+   * Stop watching the connectivity of this BaseNode's channels.
+   */
+  ~BaseNode();
 
   /**
    * Construct with a BaseNodeAddress.
@@ -157,17 +203,35 @@ protected:
   NodeType& setAddress(const BaseNodeAddress& address);
 
   /**
-   * Get this BaseNode's gRPC channel. Creates and initializes a new channel if one isn't already created.
+   * Get this BaseNode's first gRPC channel. Creates and initializes the channels if they aren't already created. This
+   * BaseNode's mutex must be held.
    *
-   * @return A pointer to this BaseNode's gRPC channel.
+   * @return A pointer to this BaseNode's first gRPC channel.
    */
   [[nodiscard]] std::shared_ptr<grpc::Channel> getChannel();
 
+  /**
+   * Get all of this BaseNode's gRPC channels. Creates and initializes the channels if they aren't already created. This
+   * BaseNode's mutex must be held.
+   *
+   * @return The gRPC channels of this BaseNode.
+   */
+  [[nodiscard]] const std::vector<std::shared_ptr<grpc::Channel>>& getChannels();
+
+  /**
+   * Get the index of the channel to use for the next request, rotating through this BaseNode's channels. This doesn't
+   * require this BaseNode's mutex, so the channel count is that of the channels (or stubs) the caller is using.
+   *
+   * @param channels The number of channels to rotate through. Must be greater than 0.
+   * @return The index of the channel to use for the next request.
+   */
+  [[nodiscard]] std::size_t getNextChannelIndex(std::size_t channels);
+
 private:
   /**
-   * How often to query for the state of the channel when determining if this BaseNode has connected to its remote node.
+   * The ConnectivityWatchers of a BaseNode's channels, one per channel.
    */
-  static constexpr auto GET_STATE_INTERVAL = std::chrono::milliseconds(50);
+  using ConnectivityWatchers = std::vector<std::shared_ptr<ConnectivityWatcher>>;
 
   /**
    * How long to try and let the channel connect before calling the connection a failure.
@@ -182,7 +246,7 @@ private:
   [[nodiscard]] virtual std::shared_ptr<grpc::ChannelCredentials> getTlsChannelCredentials() const;
 
   /**
-   * Initialize the stubs in this derived BaseNode with this BaseNode's gRPC channel.
+   * Initialize the stubs in this derived BaseNode with this BaseNode's gRPC channels.
    */
   virtual void initializeStubs()
   { // Intentionally unimplemented, derived BaseNodes that don't use stubs require no functionality.
@@ -203,50 +267,55 @@ private:
   [[nodiscard]] virtual inline std::string getAuthority() const { return "127.0.0.1"; }
 
   /**
-   * Close this BaseNode's channel and any stubs using that channel.
+   * Create one of this BaseNode's gRPC channels.
+   *
+   * @param index The index of the channel in this BaseNode's channel pool.
+   * @return A pointer to the created gRPC channel.
    */
-  void closeChannel();
+  [[nodiscard]] std::shared_ptr<grpc::Channel> createChannel(unsigned int index) const;
 
   /**
-   * The address of this BaseNode.
+   * Close this BaseNode's channels and any stubs using those channels.
    */
-  BaseNodeAddress mAddress;
+  void closeChannel();
 
   /**
-   * Pointer to the gRPC channel used to communicate with the gRPC server living on the remote node.
+   * The address of this BaseNode.
    */
-  std::shared_ptr<grpc::Channel> mChannel = nullptr;
+  BaseNodeAddress mAddress;
 
   /**
-   * The minimum amount of time to wait to use this BaseNode after it has received a bad gRPC status.
+   * The gRPC channels used to communicate with the gRPC server living on the remote node.
    */
-  std::chrono::system_clock::duration mMinNodeBackoff = DEFAULT_MIN_NODE_BACKOFF;
+  std::vector<std::shared_ptr<grpc::Channel>> mChannels;
 
   /**
-   * The maximum amount of time to wait to use this BaseNode after it has received a bad gRPC status.
+   * The number of gRPC channels to open to the remote node.
    */
-  std::chrono::system_clock::duration mMaxNodeBackoff = DEFAULT_MAX_NODE_BACKOFF;
+  unsigned int mChannelPoolSize = DEFAULT_NODE_CHANNEL_POOL_SIZE;
 
   /**
-   * The current amount of time to wait to use this BaseNode after it has received a bad gRPC status. This will increase
-   * exponentially until mMaxNodeBackoff is reached.
+   * The index from which the channel to use for the next request is derived.
    */
-  std::chrono::system_clock::duration mCurrentBackoff = DEFAULT_MIN_NODE_BACKOFF;
+  std::atomic<std::size_t> mNextChannelIndex = 0ULL;
 
   /**
-   * The time at which this BaseNode will be considered "healthy".
+   * The health, backoff, and readmit state of this BaseNode. It is read and updated without taking this BaseNode's
+   * mutex, so checking the health of a node never waits on a request being submitted to it.
    */
-  std::chrono::system_clock::time_point mReadmitTime = std::chrono::system_clock::now();
+  NodeHealth mHealth = NodeHealth(DEFAULT_MIN_NODE_BACKOFF, DEFAULT_MAX_NODE_BACKOFF);
 
   /**
-   * The number of times this BaseNode has received a bad gRPC status.
+   * Track the connectivity state of each of mChannels in the background. They are replaced along with mChannels, and
+   * are only accessed with the std::atomic_load and std::atomic_store overloads for std::shared_ptr so that they can be
+   * read without this BaseNode's mutex.
    */
-  unsigned int mBadGrpcStatusCount = 0U;
+  std::shared_ptr<const ConnectivityWatchers> mConnectivityWatchers = nullptr;
 
   /**
-   * Is the gRPC channel being utilized by this BaseNode to communicate with its remote node initialized?
+   * The CompletionQueueDriver of the BaseNetwork of this BaseNode, on which the connectivity of mChannels is watched.
    */
-  bool mIsConnected = false;
+  std::shared_ptr<CompletionQueueDriver> mConnectivityDriver = nullptr;
 
   /**
    * The mutex for this BaseNode, kept inside a std::shared_ptr to keep BaseNetwork copyable/movable.
@@ -0,0 +1,223 @@
+// SPDX-License-Identifier: Apache-2.0
+#ifndef HIERO_SDK_CPP_IMPL_CHUNK_REASSEMBLER_H_
+#define HIERO_SDK_CPP_IMPL_CHUNK_REASSEMBLER_H_
+
+#include "Defaults.h"
+#include "TopicMessage.h"
+#include "TopicMessageQuery.h"
+#include "TransactionId.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <list>
+#include <memory>
+#include <mirror/consensus_service.pb.h>
+#include <optional>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace Hiero::internal
+{
+/**
+ * Internal utility class that reassembles chunked topic messages from the ConsensusTopicResponses of a subscription.
+ * The chunks of incomplete messages are kept up to a memory limit, beyond which the oldest incomplete messages are
+ * evicted, and incomplete messages whose first chunk arrived longer ago than a timeout are evicted as well. This class
+ * is not thread-safe, as the responses of a subscription are processed one at a time.
+ */
+class ChunkReassembler
+{
+public:
+  /**
+   * A snapshot of the counters of a ChunkReassembler.
+   */
+  using Statistics = TopicMessageQuery::ChunkStatistics;
+
+  /**
+   * The counters of one or more ChunkReassemblers. They can be shared by the ChunkReassemblers of several
+   * subscriptions, and read by other threads while they are being updated.
+   */
+  class Counters
+  {
+  public:
+    /**
+     * Get a snapshot of these Counters.
+     *
+     * @return A snapshot of these Counters.
+     */
+    [[nodiscard]] Statistics get() const;
+
+  private:
+    friend class ChunkReassembler;
+
+    std::atomic<uint64_t> mCompletedMessages = 0ULL;
+    std::atomic<uint64_t> mDuplicateChunks = 0ULL;
+    std::atomic<uint64_t> mInvalidChunks = 0ULL;
+    std::atomic<uint64_t> mExpiredMessages = 0ULL;
+    std::atomic<uint64_t> mEvictedMessages = 0ULL;
+  };
+
+  /**
+   * The maximum number of completed messages whose late duplicate chunks are recognized.
+   */
+  static constexpr std::size_t MAX_COMPLETED_MESSAGES = 1024U;
+
+  /**
+   * Construct with a memory limit and a timeout for incomplete messages.
+   *
+   * @param maxPendingBytes The maximum number of bytes of chunks to keep for incomplete messages.
+   * @param timeout         The amount of time after its first chunk arrives that an incomplete message is evicted.
+   *                        Late duplicate chunks of a completed message are recognized for as long.
+   * @param counters        The counters in which to count the messages and chunks of this ChunkReassembler.
+   */
+  explicit ChunkReassembler(std::size_t maxPendingBytes = DEFAULT_MAX_PENDING_CHUNK_BYTES,
+                            const std::chrono::system_clock::duration& timeout = DEFAULT_CHUNK_REASSEMBLY_TIMEOUT,
+                            std::shared_ptr<Counters> counters = std::make_shared<Counters>());
+
+  /**
+   * Add a received response. Incomplete messages that have timed out are evicted first.
+   *
+   * @param response The received response.
+   * @param now      The time at which the response was received.
+   * @return The TopicMessage the response completes, or an uninitialized optional if it doesn't complete one.
+   */
+  [[nodiscard]] std::optional<TopicMessage> add(
+    com::hedera::mirror::api::proto::ConsensusTopicResponse response,
+    const std::chrono::system_clock::time_point& now = std::chrono::system_clock::now());
+
+  /**
+   * Evict the incomplete messages whose first chunk arrived longer ago than the timeout, and forget the completed
+   * messages that were completed longer ago than the timeout.
+   *
+   * @param now The current time.
+   */
+  void evictExpired(const std::chrono::system_clock::time_point& now = std::chrono::system_clock::now());
+
+  /**
+   * Get a snapshot of the counters of this ChunkReassembler. If its counters are shared, they include the counts of
+   * the other ChunkReassemblers sharing them.
+   *
+   * @return A snapshot of the counters of this ChunkReassembler.
+   */
+  [[nodiscard]] inline Statistics getStatistics() const { return mCounters->get(); }
+
+  /**
+   * Get the number of incomplete messages being kept.
+   *
+   * @return The number of incomplete messages being kept.
+   */
+  [[nodiscard]] inline std::size_t getPendingMessages() const { return mGroups.size(); }
+
+  /**
+   * Get the number of bytes of chunks being kept for incomplete messages.
+   *
+   * @return The number of bytes of chunks being kept.
+   */
+  [[nodiscard]] inline std::size_t getPendingBytes() const { return mPendingBytes; }
+
+private:
+  /**
+   * The chunks received so far of an incomplete message.
+   */
+  struct ChunkGroup
+  {
+    /**
+     * The ID of the first transaction of the message.
+     */
+    TransactionId mTransactionId;
+
+    /**
+     * The time at which the first chunk of the message arrived.
+     */
+    std::chrono::system_clock::time_point mFirstChunkTime;
+
+    /**
+     * The chunks of the message, in order. Chunks that haven't arrived yet are default-constructed.
+     */
+    std::vector<com::hedera::mirror::api::proto::ConsensusTopicResponse> mChunks;
+
+    /**
+     * Which chunks of the message have arrived.
+     */
+    std::vector<bool> mReceived;
+
+    /**
+     * The number of chunks of the message that have arrived.
+     */
+    std::size_t mReceivedCount = 0U;
+
+    /**
+     * The number of bytes of the chunks that have arrived.
+     */
+    std::size_t mBytes = 0U;
+  };
+
+  /**
+   * Remember that a message has been completed, so that late duplicates of its chunks are dropped.
+   *
+   * @param transactionId The ID of the first transaction of the message.
+   * @param now           The time at which the message was completed.
+   */
+  void remember(const TransactionId& transactionId, const std::chrono::system_clock::time_point& now);
+
+  /**
+   * Evict the oldest incomplete messages until the chunks being kept fit within the memory limit.
+   */
+  void evictOverCapacity();
+
+  /**
+   * Remove an incomplete message.
+   *
+   * @param group The incomplete message to remove.
+   */
+  void erase(std::list<ChunkGroup>::iterator group);
+
+  /**
+   * The maximum number of bytes of chunks to keep for incomplete messages.
+   */
+  std::size_t mMaxPendingBytes;
+
+  /**
+   * The amount of time after its first chunk arrives that an incomplete message is evicted.
+   */
+  std::chrono::system_clock::duration mTimeout;
+
+  /**
+   * The incomplete messages, from oldest to newest first chunk. This is both their expiry and eviction order.
+   */
+  std::list<ChunkGroup> mGroups;
+
+  /**
+   * The incomplete messages, keyed by the ID of their first transaction.
+   */
+  std::unordered_map<TransactionId, std::list<ChunkGroup>::iterator> mGroupsByTransactionId;
+
+  /**
+   * The number of bytes of chunks being kept for incomplete messages.
+   */
+  std::size_t mPendingBytes = 0U;
+
+  /**
+   * The IDs of the first transactions of the recently completed messages, along with the time at which they were
+   * completed, from oldest to newest.
+   */
+  std::deque<std::pair<TransactionId, std::chrono::system_clock::time_point>> mCompleted;
+
+  /**
+   * The IDs of the first transactions of the recently completed messages.
+   */
+  std::unordered_set<TransactionId> mCompletedTransactionIds;
+
+  /**
+   * The counters of this ChunkReassembler.
+   */
+  std::shared_ptr<Counters> mCounters;
+};
+
+} // namespace Hiero::internal
+
+#endif // HIERO_SDK_CPP_IMPL_CHUNK_REASSEMBLER_H_
@@ -0,0 +1,152 @@
+// SPDX-License-Identifier: Apache-2.0
+#ifndef HIERO_SDK_CPP_IMPL_COMPLETION_QUEUE_DRIVER_H_
+#define HIERO_SDK_CPP_IMPL_COMPLETION_QUEUE_DRIVER_H_
+
+#include "Logger.h"
+
+#include <grpcpp/completion_queue.h>
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+
+namespace Hiero::internal
+{
+/**
+ * Internal utility class that owns a gRPC CompletionQueue and a small, fixed pool of threads that drain it. Every
+ * asynchronous RPC and timer used to drive requests without blocking a thread per request is registered with a
+ * CompletionQueueDriver, and its continuation is run on one of the driver's threads when the event completes.
+ */
+class CompletionQueueDriver
+{
+public:
+  /**
+   * An event registered with the CompletionQueue. The address of an Operation is used as the tag of the event, and the
+   * Operation is deleted by the driver once it has been processed.
+   */
+  class Operation
+  {
+  public:
+    virtual ~Operation() = default;
+
+    /**
+     * Run the continuation of this Operation.
+     *
+     * @param ok \c TRUE if the event completed successfully, \c FALSE if it was cancelled or the queue is shutting
+     *           down.
+     */
+    virtual void proceed(bool ok) = 0;
+  };
+
+  /**
+   * Construct with the number of threads to use to drain the CompletionQueue.
+   *
+   * @param threads The number of threads to use. At least one thread is always used.
+   * @param logger  The Logger with which to report exceptions that escape a continuation.
+   */
+  explicit CompletionQueueDriver(unsigned int threads, const Logger& logger = Logger(Logger::LoggingLevel::SILENT));
+
+  /**
+   * Shut down this CompletionQueueDriver and wait for its threads to finish. If this is run by one of the driver's
+   * threads (i.e. a continuation released the last reference to the driver), that thread finishes draining the
+   * CompletionQueue on its own after the driver is destroyed.
+   */
+  ~CompletionQueueDriver();
+
+  CompletionQueueDriver(const CompletionQueueDriver&) = delete;
+  CompletionQueueDriver& operator=(const CompletionQueueDriver&) = delete;
+  CompletionQueueDriver(CompletionQueueDriver&&) = delete;
+  CompletionQueueDriver& operator=(CompletionQueueDriver&&) = delete;
+
+  /**
+   * Register an event with the CompletionQueue. The input function is called with the CompletionQueue and must tag
+   * exactly one event with a heap-allocated Operation, which this driver takes ownership of.
+   *
+   * @param start The function that registers the event.
+   * @return \c TRUE if the function was called, \c FALSE if this driver has been shut down and the function was not
+   *         called.
+   */
+  bool start(const std::function<void(grpc::CompletionQueue*)>& start);
+
+  /**
+   * Run a callback on one of this driver's threads at a given time. If this driver is shut down before the time is
+   * reached, the callback is run immediately with \c FALSE.
+   *
+   * @param time     The time at which to run the callback.
+   * @param callback The callback to run. It is passed \c TRUE if the time was reached, otherwise \c FALSE.
+   * @return \c TRUE if the callback was scheduled, \c FALSE if this driver has been shut down and the callback will
+   *         never be run.
+   */
+  bool schedule(const std::chrono::system_clock::time_point& time, std::function<void(bool)> callback);
+
+  /**
+   * Shut down this CompletionQueueDriver. Pending timers are cancelled, outstanding events are drained, and the
+   * driver's threads are joined. No new events can be registered once this has been called. This can be called from a
+   * continuation run by this driver, in which case the calling thread is detached instead of joined, and drains the
+   * rest of the CompletionQueue once the continuation returns.
+   */
+  void shutdown();
+
+  /**
+   * Has this CompletionQueueDriver been shut down?
+   *
+   * @return \c TRUE if this driver has been shut down, otherwise \c FALSE.
+   */
+  [[nodiscard]] bool isShutdown() const;
+
+  /**
+   * Is the calling thread one of the threads of a CompletionQueueDriver? Continuations run on such threads must never
+   * block waiting for another event of a driver, as that event may need the very thread that is waiting for it.
+   *
+   * @return \c TRUE if the calling thread drains the CompletionQueue of a driver, otherwise \c FALSE.
+   */
+  [[nodiscard]] static bool isDriverThread();
+
+private:
+  /**
+   * Operation used for timers scheduled with schedule().
+   */
+  class TimerOperation;
+
+  /**
+   * The state shared by this driver and its threads. Each thread co-owns it, so that a thread that has been detached
+   * by a shutdown run from one of its own continuations can keep draining the CompletionQueue after the driver itself
+   * has been destroyed.
+   */
+  struct State;
+
+  /**
+   * Drain the CompletionQueue of a driver until it is shut down.
+   *
+   * @param state The state of the driver.
+   */
+  static void run(const std::shared_ptr<State>& state);
+
+  /**
+   * The state shared by this driver and its threads.
+   */
+  std::shared_ptr<State> mState;
+
+  /**
+   * The threads draining the CompletionQueue.
+   */
+  std::vector<std::thread> mThreads;
+
+  /**
+   * Events are registered under a shared lock, and the CompletionQueue is shut down under an exclusive lock, so that no
+   * event can ever be registered with a shut down CompletionQueue.
+   */
+  mutable std::shared_mutex mMutex;
+
+  /**
+   * Has this CompletionQueueDriver been shut down?
+   */
+  bool mIsShutdown = false;
+};
+
+} // namespace Hiero::internal
+
+#endif // HIERO_SDK_CPP_IMPL_COMPLETION_QUEUE_DRIVER_H_
@@ -0,0 +1,118 @@
+// SPDX-License-Identifier: Apache-2.0
+#ifndef HIERO_SDK_CPP_IMPL_CONNECTIVITY_WATCHER_H_
+#define HIERO_SDK_CPP_IMPL_CONNECTIVITY_WATCHER_H_
+
+#include <grpcpp/channel.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+
+namespace Hiero::internal
+{
+class CompletionQueueDriver;
+}
+
+namespace Hiero::internal
+{
+/**
+ * Internal utility class that tracks the connectivity state of a gRPC channel in the background. It asks the channel
+ * to connect as soon as it starts watching, and keeps the last observed state in an atomic, so that the state can be
+ * checked by any thread without blocking. State changes are delivered by grpc::Channel::NotifyOnStateChange on the
+ * CompletionQueueDriver of the network that owns the channel, only while the channel is on its way to a connection.
+ * Once the channel is READY or has gone IDLE, the watch is parked, and the state is observed again (without asking the
+ * channel to connect) only when it is checked.
+ */
+class ConnectivityWatcher : public std::enable_shared_from_this<ConnectivityWatcher>
+{
+public:
+  /**
+   * Start watching the connectivity state of a channel.
+   *
+   * @param channel The channel to watch.
+   * @param driver  The CompletionQueueDriver on which to deliver the state changes of the channel. If this is nullptr,
+   *                the state is only observed when it is checked.
+   * @return A pointer to the ConnectivityWatcher watching the channel.
+   */
+  [[nodiscard]] static std::shared_ptr<ConnectivityWatcher> watch(std::shared_ptr<grpc::Channel> channel,
+                                                                  std::shared_ptr<CompletionQueueDriver> driver);
+
+  /**
+   * Stop watching the channel. The channel is released once its pending state change notification completes.
+   */
+  void stop();
+
+  /**
+   * Get the connectivity state of the channel. If the watch is parked, the state is observed again first, and the watch
+   * is resumed if the channel is connecting again.
+   *
+   * @return The connectivity state of the channel.
+   */
+  [[nodiscard]] grpc_connectivity_state getState();
+
+  /**
+   * Is the channel known to be unable to reach its remote node? A channel that is still connecting is not considered
+   * unreachable, as requests sent to it wait for the connection to complete within their deadline.
+   *
+   * @return \c TRUE if the state of the channel is TRANSIENT_FAILURE or SHUTDOWN, otherwise \c FALSE.
+   */
+  [[nodiscard]] bool isUnreachable();
+
+private:
+  /**
+   * Operation used for the state change notifications of the channel.
+   */
+  class WatchOperation;
+
+  /**
+   * How long to wait for a state change before registering a new notification. This bounds how long a stopped
+   * ConnectivityWatcher keeps its channel alive.
+   */
+  static constexpr auto WATCH_INTERVAL = std::chrono::seconds(1);
+
+  /**
+   * Construct with the channel to watch and the CompletionQueueDriver on which to watch it.
+   *
+   * @param channel The channel to watch.
+   * @param driver  The CompletionQueueDriver on which to deliver the state changes of the channel.
+   */
+  ConnectivityWatcher(std::shared_ptr<grpc::Channel> channel, std::shared_ptr<CompletionQueueDriver> driver);
+
+  /**
+   * Observe the current state of the channel, and register for a notification of its next change while it is
+   * connecting. Parks the watch instead once the channel is READY, IDLE, or SHUTDOWN, or this ConnectivityWatcher has
+   * been stopped.
+   *
+   * @param tryToConnect \c TRUE to ask an IDLE channel to connect, which is only done when the watch starts.
+   */
+  void observe(bool tryToConnect);
+
+  /**
+   * The channel being watched.
+   */
+  std::shared_ptr<grpc::Channel> mChannel;
+
+  /**
+   * The CompletionQueueDriver on which the state changes of the channel are delivered.
+   */
+  std::shared_ptr<CompletionQueueDriver> mDriver;
+
+  /**
+   * The last observed connectivity state of the channel.
+   */
+  std::atomic<grpc_connectivity_state> mState = GRPC_CHANNEL_IDLE;
+
+  /**
+   * Is a state change notification pending for the channel? \c FALSE while the watch is parked.
+   */
+  std::atomic<bool> mIsWatching = true;
+
+  /**
+   * Has this ConnectivityWatcher been stopped?
+   */
+  std::atomic<bool> mIsStopped = false;
+};
+
+} // namespace Hiero::internal
+
+#endif // HIERO_SDK_CPP_IMPL_CONNECTIVITY_WATCHER_H_
@@ -2,12 +2,54 @@
 #ifndef HIERO_SDK_CPP_IMPL_HTTP_CLIENT_H_
 #define HIERO_SDK_CPP_IMPL_HTTP_CLIENT_H_
 
+#include "Defaults.h"
+
+#include <chrono>
 #include <httplib.h>
 #include <string>
 #include <string_view>
 
 namespace Hiero::internal::HttpClient
 {
+/**
+ * The options of the connections used to send HTTP requests. Connections are kept alive and reused, and are pooled per
+ * scheme, host, and port.
+ */
+struct ConnectionOptions
+{
+  /**
+   * The maximum number of connections to open to each scheme, host, and port. Requests wait for a free connection once
+   * this many are in use.
+   */
+  unsigned int mMaxConnectionsPerHost = DEFAULT_HTTP_MAX_CONNECTIONS_PER_HOST;
+
+  /**
+   * The maximum amount of time to wait to establish a connection.
+   */
+  std::chrono::system_clock::duration mConnectTimeout = DEFAULT_HTTP_CONNECT_TIMEOUT;
+
+  /**
+   * The maximum amount of time to wait to send a request or to read its response.
+   */
+  std::chrono::system_clock::duration mRequestTimeout = DEFAULT_HTTP_REQUEST_TIMEOUT;
+};
+
+/**
+ * The status code and body of an HTTP response.
+ */
+struct Response
+{
+  /**
+   * The HTTP status code of the response.
+   */
+  int mStatus = 0;
+
+  /**
+   * The body of the response.
+   */
+  std::string mBody;
+};
+
 /**
  * Fetches data from the specified URL using the provided RPC method.
  * @param url       The URL to fetch data from.
@@ -28,6 +70,36 @@ namespace Hiero::internal::HttpClient
                                      std::string_view httpMethod = "GET",
                                      std::string_view requestBody = "");
 
+/**
+ * Create a GET or POST request, and get the status code of the response along with its body.
+ * @param url         The URL to which to submit the request.
+ * @param httpMethod  The HTTP method.
+ * @param requestBody The HTTP request body.
+ * @return The status code and body of the response.
+ */
+[[nodiscard]] Response invokeRESTWithStatus(std::string_view url,
+                                            std::string_view httpMethod = "GET",
+                                            std::string_view requestBody = "");
+
+/**
+ * Set the options of the connections used to send HTTP requests. Idle connections are closed, and connections in use
+ * pick up the new options for their next request.
+ * @param options The options to set.
+ * @throws std::invalid_argument If the maximum number of connections per host is 0.
+ */
+void setConnectionOptions(const ConnectionOptions& options);
+
+/**
+ * Get the options of the connections used to send HTTP requests.
+ * @return The options of the connections used to send HTTP requests.
+ */
+[[nodiscard]] ConnectionOptions getConnectionOptions();
+
+/**
+ * Close all idle connections. Connections in use are closed once their request completes.
+ */
+void closeIdleConnections();
+
 } // namespace Hiero::internal
 
-#endif // HIERO_SDK_CPP_IMPL_HTTP_CLIENT_H_
\ No newline at end of file
+#endif // HIERO_SDK_CPP_IMPL_HTTP_CLIENT_H_
@@ -0,0 +1,122 @@
+// SPDX-License-Identifier: Apache-2.0
+#ifndef HIERO_SDK_CPP_IMPL_IN_FLIGHT_LIMITER_H_
+#define HIERO_SDK_CPP_IMPL_IN_FLIGHT_LIMITER_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+namespace Hiero::internal
+{
+/**
+ * Internal utility class that bounds the number of requests in flight to a node. Its mutex is only held to count the
+ * requests, never while a request is in flight, so up to the maximum number of requests proceed concurrently.
+ */
+class InFlightLimiter
+{
+public:
+  /**
+   * A slot of an InFlightLimiter, which is given back to the InFlightLimiter when the Permit is destroyed.
+   */
+  class Permit
+  {
+  public:
+    /**
+     * Construct with the InFlightLimiter from which the slot was taken.
+     *
+     * @param limiter The InFlightLimiter from which the slot was taken. If this is nullptr, the Permit holds no slot.
+     */
+    explicit Permit(InFlightLimiter* limiter);
+
+    /**
+     * Give the slot back to the InFlightLimiter.
+     */
+    ~Permit();
+
+    Permit(const Permit&) = delete;
+    Permit& operator=(const Permit&) = delete;
+    Permit(Permit&& other) noexcept;
+    Permit& operator=(Permit&&) = delete;
+
+    /**
+     * Does this Permit hold a slot of its InFlightLimiter?
+     *
+     * @return \c TRUE if this Permit holds a slot, otherwise \c FALSE.
+     */
+    [[nodiscard]] explicit operator bool() const { return mLimiter != nullptr; }
+
+  private:
+    /**
+     * The InFlightLimiter from which the slot was taken.
+     */
+    InFlightLimiter* mLimiter = nullptr;
+  };
+
+  /**
+   * Construct with the maximum number of requests in flight.
+   *
+   * @param max The maximum number of requests in flight.
+   * @throws std::invalid_argument If the maximum is 0.
+   */
+  explicit InFlightLimiter(unsigned int max);
+
+  /**
+   * Take a slot, waiting for one to free up if the maximum number of requests are in flight.
+   *
+   * @param deadline The time at which to stop waiting.
+   * @return A Permit holding the slot. It holds no slot if none freed up before the deadline.
+   */
+  [[nodiscard]] Permit acquire(const std::chrono::system_clock::time_point& deadline);
+
+  /**
+   * Set the maximum number of requests in flight. Lowering it doesn't affect requests already in flight.
+   *
+   * @param max The maximum number of requests in flight.
+   * @throws std::invalid_argument If the maximum is 0.
+   */
+  void setMax(unsigned int max);
+
+  /**
+   * Get the maximum number of requests in flight.
+   *
+   * @return The maximum number of requests in flight.
+   */
+  [[nodiscard]] unsigned int getMax() const;
+
+  /**
+   * Get the number of requests currently in flight.
+   *
+   * @return The number of requests currently in flight.
+   */
+  [[nodiscard]] unsigned int getInFlight() const;
+
+private:
+  /**
+   * Give back a slot and wake up a waiter.
+   */
+  void release();
+
+  /**
+   * The maximum number of requests in flight.
+   */
+  unsigned int mMax;
+
+  /**
+   * The number of requests in flight.
+   */
+  unsigned int mInFlight = 0U;
+
+  /**
+   * The mutex protecting the counts.
+   */
+  mutable std::mutex mMutex;
+
+  /**
+   * The condition variable notified when a slot frees up or the maximum is raised.
+   */
+  std::condition_variable mSlotFreed;
+};
+
+} // namespace Hiero::internal
+
+#endif // HIERO_SDK_CPP_IMPL_IN_FLIGHT_LIMITER_H_
@@ -0,0 +1,99 @@
+// SPDX-License-Identifier: Apache-2.0
+#ifndef HIERO_SDK_CPP_IMPL_LATENCY_HISTOGRAM_H_
+#define HIERO_SDK_CPP_IMPL_LATENCY_HISTOGRAM_H_
+
+#include "MetricsSnapshot.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace Hiero::internal
+{
+/**
+ * Internal utility class that counts durations in a histogram with logarithmic buckets, in the manner of an HDR
+ * histogram: each power of two is split into SUB_BUCKETS linear buckets, so that a percentile read from the histogram
+ * is accurate to within 1 / SUB_BUCKETS of its value, whatever its magnitude. Unlike the histogram of NodeStats, counts
+ * never decay. Everything is kept in atomics, so that durations can be recorded and read from any number of threads
+ * without a lock.
+ */
+class LatencyHistogram
+{
+public:
+  /**
+   * The power of two, in nanoseconds, below which all durations share the first bucket (about 1 microsecond).
+   */
+  static constexpr unsigned int MIN_EXPONENT = 10U;
+
+  /**
+   * The power of two, in nanoseconds, from which all durations share the last bucket (about 137 seconds).
+   */
+  static constexpr unsigned int MAX_EXPONENT = 37U;
+
+  /**
+   * The number of bits of a duration below its highest bit that select its bucket within its power of two.
+   */
+  static constexpr unsigned int SUB_BUCKET_BITS = 2U;
+
+  /**
+   * The number of buckets into which each power of two is split.
+   */
+  static constexpr std::size_t SUB_BUCKETS = 1ULL << SUB_BUCKET_BITS;
+
+  /**
+   * The number of buckets: one for each sub-bucket of each power of two, plus the first and last buckets.
+   */
+  static constexpr std::size_t BUCKETS = (MAX_EXPONENT - MIN_EXPONENT) * SUB_BUCKETS + 2ULL;
+
+  /**
+   * Record a duration.
+   *
+   * @param duration The duration to record. Negative durations are recorded as 0.
+   */
+  void record(const std::chrono::nanoseconds& duration);
+
+  /**
+   * Get a snapshot of this LatencyHistogram.
+   *
+   * @return A snapshot of this LatencyHistogram.
+   */
+  [[nodiscard]] MetricsSnapshot::Histogram getSnapshot() const;
+
+  /**
+   * Get the index of the bucket that holds a duration.
+   *
+   * @param duration The duration of which to get the bucket.
+   * @return The index of the bucket that holds the duration.
+   */
+  [[nodiscard]] static std::size_t getBucketIndex(const std::chrono::nanoseconds& duration);
+
+  /**
+   * Get the (exclusive) upper bound of a bucket.
+   *
+   * @param index The index of the bucket.
+   * @return The upper bound of the bucket. The upper bound of the last bucket is std::chrono::nanoseconds::max().
+   */
+  [[nodiscard]] static std::chrono::nanoseconds getBucketUpperBound(std::size_t index);
+
+private:
+  /**
+   * The number of durations in each bucket.
+   */
+  std::array<std::atomic<std::uint64_t>, BUCKETS> mBuckets = {};
+
+  /**
+   * The number of durations recorded.
+   */
+  std::atomic<std::uint64_t> mCount = 0ULL;
+
+  /**
+   * The sum of the durations recorded, in nanoseconds.
+   */
+  std::atomic<std::int64_t> mSum = 0LL;
+};
+
+} // namespace Hiero::internal
+
+#endif // HIERO_SDK_CPP_IMPL_LATENCY_HISTOGRAM_H_
@@ -0,0 +1,214 @@
+// SPDX-License-Identifier: Apache-2.0
+#ifndef HIERO_SDK_CPP_IMPL_METRICS_REGISTRY_H_
+#define HIERO_SDK_CPP_IMPL_METRICS_REGISTRY_H_
+
+#include "MetricsSnapshot.h"
+#include "Status.h"
+#include "impl/LatencyHistogram.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <grpcpp/impl/codegen/status.h>
+#include <map>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <utility>
+
+namespace Hiero::internal
+{
+/**
+ * Internal utility class that records the metrics of the requests submitted by a Client: per type of request, the
+ * outcome and end-to-end latency of its executions, and per type of request and node, the attempts, their gRPC and
+ * precheck statuses, retries, backoffs and latencies. The metrics of a type of request (at a node) are created the
+ * first time they're recorded and live as long as the MetricsRegistry, so they can be held on to while a request
+ * executes. Everything is recorded in atomics, the lock of the registry is only taken exclusively to create new
+ * metrics. This class is thread-safe.
+ */
+class MetricsRegistry
+{
+public:
+  /**
+   * The metrics of the attempts of a type of request at a node.
+   */
+  class NodeRequestMetrics
+  {
+  public:
+    /**
+     * Record an attempt submitted to the node.
+     */
+    void recordAttempt();
+
+    /**
+     * Record the gRPC status code with which an attempt ended.
+     *
+     * @param code The gRPC status code of the attempt.
+     */
+    void recordGrpcStatus(grpc::StatusCode code);
+
+    /**
+     * Record the precheck status of a response from the node.
+     *
+     * @param status The precheck status of the response.
+     */
+    void recordPrecheckStatus(Status status);
+
+    /**
+     * Record the latency of an attempt answered by the node.
+     *
+     * @param latency The time from the submission of the attempt until its answer.
+     */
+    void recordLatency(const std::chrono::nanoseconds& latency);
+
+    /**
+     * Record that the request was retried after an attempt.
+     */
+    void recordRetry();
+
+    /**
+     * Record that the request slept before being submitted again.
+     *
+     * @param backoff The amount of time the request slept.
+     */
+    void recordBackoff(const std::chrono::nanoseconds& backoff);
+
+    /**
+     * Get a snapshot of these metrics.
+     *
+     * @param requestType The type of request of these metrics.
+     * @param node        The node of these metrics.
+     * @return A snapshot of these metrics.
+     */
+    [[nodiscard]] MetricsSnapshot::NodeRequestMetrics getSnapshot(const std::string& requestType,
+                                                                  const std::string& node) const;
+
+  private:
+    /**
+     * The number of gRPC status codes, from OK to UNAUTHENTICATED.
+     */
+    static constexpr std::size_t GRPC_STATUS_CODES = 17ULL;
+
+    /**
+     * The number of precheck statuses. Statuses are numbered consecutively from OK, MISSING_EXPIRY_TIME is the last.
+     */
+    static constexpr std::size_t PRECHECK_STATUSES = static_cast<std::size_t>(Status::MISSING_EXPIRY_TIME) + 1ULL;
+
+    /**
+     * The number of attempts.
+     */
+    std::atomic<std::uint64_t> mAttempts = 0ULL;
+
+    /**
+     * The number of attempts that ended with each gRPC status code.
+     */
+    std::array<std::atomic<std::uint64_t>, GRPC_STATUS_CODES> mGrpcStatuses = {};
+
+    /**
+     * The number of responses with each precheck status.
+     */
+    std::array<std::atomic<std::uint64_t>, PRECHECK_STATUSES> mPrecheckStatuses = {};
+
+    /**
+     * The number of retries.
+     */
+    std::atomic<std::uint64_t> mRetries = 0ULL;
+
+    /**
+     * The number of backoffs.
+     */
+    std::atomic<std::uint64_t> mBackoffs = 0ULL;
+
+    /**
+     * The total time slept in backoffs, in nanoseconds.
+     */
+    std::atomic<std::int64_t> mBackoffTime = 0LL;
+
+    /**
+     * The latencies of the answered attempts.
+     */
+    LatencyHistogram mLatency;
+  };
+
+  /**
+   * Get the metrics of the attempts of a type of request at a node, creating them if they don't exist yet.
+   *
+   * @param requestType The type of request.
+   * @param node        The node.
+   * @return A reference to the metrics of the attempts of the type of request at the node. The reference is valid as
+   *         long as this MetricsRegistry.
+   */
+  [[nodiscard]] NodeRequestMetrics& getNodeRequestMetrics(const std::string& requestType, const std::string& node);
+
+  /**
+   * Record the end of an execution of a request.
+   *
+   * @param requestType The type of request.
+   * @param latency     The time from the call to execute() until the response or exception.
+   * @param succeeded   \c TRUE if the execution returned a response, \c FALSE if it threw an exception.
+   */
+  void recordExecution(const std::string& requestType, const std::chrono::nanoseconds& latency, bool succeeded);
+
+  /**
+   * Record that a node was backed off from.
+   *
+   * @param node The node.
+   */
+  void recordNodeBackoff(const std::string& node);
+
+  /**
+   * Get a snapshot of all the metrics recorded so far.
+   *
+   * @return A snapshot of all the metrics recorded so far.
+   */
+  [[nodiscard]] MetricsSnapshot getSnapshot() const;
+
+private:
+  /**
+   * The metrics of the executions of a type of request.
+   */
+  struct RequestMetrics
+  {
+    /**
+     * The number of executions that returned a response.
+     */
+    std::atomic<std::uint64_t> mSucceeded = 0ULL;
+
+    /**
+     * The number of executions that threw an exception.
+     */
+    std::atomic<std::uint64_t> mFailed = 0ULL;
+
+    /**
+     * The end-to-end latencies of the executions.
+     */
+    LatencyHistogram mLatency;
+  };
+
+  /**
+   * The metrics of the executions of each type of request.
+   */
+  std::map<std::string, std::unique_ptr<RequestMetrics>> mRequests;
+
+  /**
+   * The metrics of the attempts of each type of request at each node.
+   */
+  std::map<std::pair<std::string, std::string>, std::unique_ptr<NodeRequestMetrics>> mNodeRequests;
+
+  /**
+   * The number of times each node was backed off from.
+   */
+  std::map<std::string, std::unique_ptr<std::atomic<std::uint64_t>>> mNodeBackoffs;
+
+  /**
+   * The mutex protecting the maps of metrics. The metrics themselves are atomic, so it's only taken exclusively to add
+   * new metrics to the maps.
+   */
+  mutable std::shared_mutex mMutex;
+};
+
+} // namespace Hiero::internal
+
+#endif // HIERO_SDK_CPP_IMPL_METRICS_REGISTRY_H_
@@ -3,7 +3,11 @@
 #define HIERO_SDK_CPP_IMPL_NETWORK_H_
 
 #include "BaseNetwork.h"
+#include "NodeSelectionPolicy.h"
 
+#include <atomic>
+#include <chrono>
+#include <cstddef>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -102,6 +106,61 @@ public:
    */
   Network& setMaxNodesPerRequest(unsigned int max);
 
+  /**
+   * Set the policy with which this Network chooses between healthy Nodes.
+   *
+   * @param policy The NodeSelectionPolicy to set.
+   * @return A reference to this Network object with the newly-set NodeSelectionPolicy.
+   */
+  Network& setNodeSelectionPolicy(NodeSelectionPolicy policy);
+
+  /**
+   * Set the number of gRPC channels each Node on this Network opens to its remote node.
+   *
+   * @param size The number of channels each Node should open.
+   * @return A reference to this Network object with the newly-set channel pool size.
+   * @throws std::invalid_argument If the size is 0.
+   */
+  Network& setChannelPoolSize(unsigned int size);
+
+  /**
+   * Set the maximum number of blocking requests each Node on this Network has in flight at once.
+   *
+   * @param max The maximum number of blocking requests in flight per Node.
+   * @return A reference to this Network object with the newly-set maximum number of requests in flight per Node.
+   * @throws std::invalid_argument If the maximum is 0.
+   */
+  Network& setMaxRequestsInFlightPerNode(unsigned int max);
+
+  /**
+   * Start connecting every Node on this Network to its remote node, and wait for the connections to complete.
+   *
+   * @param deadline The time at which to stop waiting.
+   * @return \c TRUE if every channel of every Node connected before the deadline, otherwise \c FALSE.
+   */
+  [[nodiscard]] bool warmUp(const std::chrono::system_clock::time_point& deadline) const;
+
+  /**
+   * Get the number of gRPC channels each Node on this Network opens to its remote node.
+   *
+   * @return The number of gRPC channels each Node on this Network opens to its remote node.
+   */
+  [[nodiscard]] unsigned int getChannelPoolSize() const;
+
+  /**
+   * Get the maximum number of blocking requests each Node on this Network has in flight at once.
+   *
+   * @return The maximum number of blocking requests each Node on this Network has in flight at once.
+   */
+  [[nodiscard]] unsigned int getMaxRequestsInFlightPerNode() const;
+
+  /**
+   * Get the policy with which this Network chooses between healthy Nodes.
+   *
+   * @return The NodeSelectionPolicy of this Network.
+   */
+  [[nodiscard]] NodeSelectionPolicy getNodeSelectionPolicy() const;
+
   /**
    * Are certificates being verified?
    *
@@ -167,6 +226,16 @@ private:
   [[nodiscard]] std::shared_ptr<Node> createNodeFromNetworkEntry(std::string_view address,
                                                                  const AccountId& key) const override;
 
+  /**
+   * Derived from BaseNetwork. Choose one of the healthy candidates according to this Network's NodeSelectionPolicy.
+   *
+   * @param candidates The candidates from which to choose. The healthy candidates are at the front of the list.
+   * @param healthy    The number of healthy candidates.
+   * @return The index of the chosen candidate.
+   */
+  [[nodiscard]] std::size_t selectHealthyNode(const std::vector<std::shared_ptr<Node>>& candidates,
+                                              std::size_t healthy) const override;
+
   /**
    * Set the ledger ID of this Network. In addition, update the Nodes on this Network with their address book entry
    * contained in the input map.
@@ -177,14 +246,32 @@ private:
   Network& setLedgerIdInternal(const LedgerId& ledgerId, const NodeAddressBook& addressBook);
 
   /**
-   * The maximum number of nodes to be returned for each request.
+   * The maximum number of nodes to be returned for each request. It is read without the lock when selecting nodes, and
+   * kept inside a std::shared_ptr to keep Network copyable/movable.
    */
-  unsigned int mMaxNodesPerRequest = 0U;
+  std::shared_ptr<std::atomic<unsigned int>> mMaxNodesPerRequest = std::make_shared<std::atomic<unsigned int>>(0U);
+
+  /**
+   * The policy with which to choose between healthy Nodes. It is read without the lock when selecting nodes, and kept
+   * inside a std::shared_ptr to keep Network copyable/movable.
+   */
+  std::shared_ptr<std::atomic<NodeSelectionPolicy>> mNodeSelectionPolicy =
+    std::make_shared<std::atomic<NodeSelectionPolicy>>(NodeSelectionPolicy::RANDOM);
 
   /**
    * Should the Nodes on this Network verify remote node certificates?
    */
   bool mVerifyCertificates = true;
+
+  /**
+   * The number of gRPC channels each Node on this Network opens to its remote node.
+   */
+  unsigned int mChannelPoolSize = DEFAULT_NODE_CHANNEL_POOL_SIZE;
+
+  /**
+   * The maximum number of blocking requests each Node on this Network has in flight at once.
+   */
+  unsigned int mMaxRequestsInFlightPerNode = DEFAULT_MAX_REQUESTS_IN_FLIGHT_PER_NODE;
 };
 
 } // namespace Hiero::internal
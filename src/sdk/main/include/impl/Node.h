@@ -15,8 +15,13 @@
 
 #include "AccountId.h"
 #include "BaseNode.h"
+#include "Defaults.h"
+#include "InFlightLimiter.h"
+#include "NodeStats.h"
 
+#include <chrono>
 #include <cstddef>
+#include <functional>
 #include <memory>
 #include <string_view>
 #include <vector>
@@ -24,6 +29,7 @@
 namespace Hiero::internal
 {
 class BaseNodeAddress;
+class CompletionQueueDriver;
 }
 
 namespace Hiero::internal
@@ -51,13 +57,16 @@ public:
   explicit Node(const AccountId& accountId, std::string_view address);
 
   /**
-   * Submit a Query protobuf to the remote node with which this Node is communicating.
+   * Submit a Query protobuf to the remote node with which this Node is communicating. Any number of threads can submit
+   * to this Node at once, up to its maximum number of requests in flight; beyond that, submissions wait for a request
+   * in flight to complete.
    *
    * @param funcEnum The enumeration specifying which gRPC function to call for this specific Query.
    * @param query    The Query protobuf object to send.
    * @param deadline The deadline for submitting this Query.
    * @param response Pointer to the Response protobuf object to fill with the gRPC server's response.
-   * @return The gRPC status response of the function call from the gRPC server.
+   * @return The gRPC status response of the function call from the gRPC server, or DEADLINE_EXCEEDED if no request in
+   *         flight completed before the deadline.
    */
   grpc::Status submitQuery(proto::Query::QueryCase funcEnum,
                            const proto::Query& query,
@@ -65,19 +74,67 @@ public:
                            proto::Response* response);
 
   /**
-   * Submit a Transaction protobuf to the remote node with which this Node is communicating.
+   * Submit a Transaction protobuf to the remote node with which this Node is communicating. Any number of threads can
+   * submit to this Node at once, up to its maximum number of requests in flight; beyond that, submissions wait for a
+   * request in flight to complete.
    *
    * @param funcEnum    The enumeration specifying which gRPC function to call for this specific Transaction.
    * @param transaction The Transaction protobuf object to send.
    * @param deadline    The deadline for submitting this Transaction.
    * @param response    Pointer to the TransactionResponse protobuf object to fill with the gRPC server's response.
-   * @return The gRPC status response of the function call from the gRPC server.
+   * @return The gRPC status response of the function call from the gRPC server, or DEADLINE_EXCEEDED if no request in
+   *         flight completed before the deadline.
    */
   grpc::Status submitTransaction(proto::TransactionBody::DataCase funcEnum,
                                  const proto::Transaction& transaction,
                                  const std::chrono::system_clock::time_point& deadline,
                                  proto::TransactionResponse* response);
 
+  /**
+   * Submit a Query protobuf to the remote node with which this Node is communicating without blocking. The callback is
+   * run on one of the input CompletionQueueDriver's threads once the gRPC server responds or the deadline passes.
+   *
+   * @param funcEnum The enumeration specifying which gRPC function to call for this specific Query.
+   * @param query    The Query protobuf object to send.
+   * @param deadline The deadline for submitting this Query.
+   * @param driver   The CompletionQueueDriver with which to register the call.
+   * @param callback The callback to run with the gRPC status and the Response protobuf object of the call.
+   * @param context  The ClientContext with which to make the call, through which the caller can cancel it. If this is
+   *                 nullptr, a ClientContext is created for the call.
+   * @return \c TRUE if the call was started, \c FALSE if the CompletionQueueDriver has been shut down.
+   * @throws std::invalid_argument If the input function enumeration doesn't map to a gRPC function.
+   */
+  bool submitQueryAsync(proto::Query::QueryCase funcEnum,
+                        const proto::Query& query,
+                        const std::chrono::system_clock::time_point& deadline,
+                        CompletionQueueDriver& driver,
+                        const std::function<void(const grpc::Status&, const proto::Response&)>& callback,
+                        const std::shared_ptr<grpc::ClientContext>& context = nullptr);
+
+  /**
+   * Submit a Transaction protobuf to the remote node with which this Node is communicating without blocking. The
+   * callback is run on one of the input CompletionQueueDriver's threads once the gRPC server responds or the deadline
+   * passes.
+   *
+   * @param funcEnum    The enumeration specifying which gRPC function to call for this specific Transaction.
+   * @param transaction The Transaction protobuf object to send.
+   * @param deadline    The deadline for submitting this Transaction.
+   * @param driver      The CompletionQueueDriver with which to register the call.
+   * @param callback    The callback to run with the gRPC status and the TransactionResponse protobuf object of the
+   *                    call.
+   * @param context     The ClientContext with which to make the call, through which the caller can cancel it. If this
+   *                    is nullptr, a ClientContext is created for the call.
+   * @return \c TRUE if the call was started, \c FALSE if the CompletionQueueDriver has been shut down.
+   * @throws std::invalid_argument If the input function enumeration doesn't map to a gRPC function.
+   */
+  bool submitTransactionAsync(
+    proto::TransactionBody::DataCase funcEnum,
+    const proto::Transaction& transaction,
+    const std::chrono::system_clock::time_point& deadline,
+    CompletionQueueDriver& driver,
+    const std::function<void(const grpc::Status&, const proto::TransactionResponse&)>& callback,
+    const std::shared_ptr<grpc::ClientContext>& context = nullptr);
+
   /**
    * Construct an insecure version of this Node. This will close the Node's current connection.
    *
@@ -108,6 +165,16 @@ public:
    */
   Node& setVerifyCertificates(bool verify);
 
+  /**
+   * Set the maximum number of blocking requests (submitted with submitQuery() or submitTransaction()) this Node has in
+   * flight at once. Requests already in flight aren't affected.
+   *
+   * @param max The maximum number of blocking requests in flight.
+   * @return A reference to this Node with the newly-set maximum number of requests in flight.
+   * @throws std::invalid_argument If the maximum is 0.
+   */
+  Node& setMaxRequestsInFlight(unsigned int max);
+
   /**
    * Derived from BaseNode. Get this Node's key, which is its AccountId.
    *
@@ -148,7 +215,26 @@ public:
     return mVerifyCertificates;
   }
 
+  /**
+   * Get the response time and error rate statistics of the requests submitted to this Node.
+   *
+   * @return A reference to the request statistics of this Node.
+   */
+  [[nodiscard]] inline const NodeStats& getStats() const { return *mStats; }
+
+  /**
+   * Get the maximum number of blocking requests this Node has in flight at once.
+   *
+   * @return The maximum number of blocking requests this Node has in flight at once.
+   */
+  [[nodiscard]] inline unsigned int getMaxRequestsInFlight() const { return mInFlightLimiter->getMax(); }
+
 private:
+  /**
+   * The gRPC stubs used to communicate with the services living on the remote node through one of this Node's channels.
+   */
+  struct Stubs;
+
   /**
    * Construct from another Node and a BaseNodeAddress.
    *
@@ -165,7 +251,7 @@ private:
   [[nodiscard]] std::shared_ptr<grpc::ChannelCredentials> getTlsChannelCredentials() const override;
 
   /**
-   * Derived from BaseNode. Initialize the stubs in this Node with this Node's gRPC channel.
+   * Derived from BaseNode. Initialize a set of stubs in this Node for each of this Node's gRPC channels.
    */
   void initializeStubs() override;
 
@@ -175,54 +261,136 @@ private:
   void closeStubs() override;
 
   /**
-   * Pointer to the gRPC stub used to communicate with the consensus service living on the remote node.
-   */
-  std::unique_ptr<proto::ConsensusService::Stub> mConsensusStub = nullptr;
-
-  /**
-   * Pointer to the gRPC stub used to communicate with the cryptography service living on the remote node.
-   */
-  std::unique_ptr<proto::CryptoService::Stub> mCryptoStub = nullptr;
-
-  /**
-   * Pointer to the gRPC stub used to communicate with the file service living on the remote node.
-   */
-  std::unique_ptr<proto::FileService::Stub> mFileStub = nullptr;
-
-  /**
-   * Pointer to the gRPC stub used to communicate with the freeze service living on the remote node.
+   * Get the stubs to use for the next request, rotating through this Node's channels. Creates the channels and stubs
+   * if they aren't already created, which is the only time this Node's lock is taken. This Node's lock must not be
+   * held.
+   *
+   * @return A pointer to the stubs to use for the next request. It keeps the stubs alive if this Node's connection is
+   *         closed while they are used.
    */
-  std::unique_ptr<proto::FreezeService::Stub> mFreezeStub = nullptr;
+  [[nodiscard]] std::shared_ptr<const Stubs> getNextStubs();
 
   /**
-   * Pointer to the gRPC stub used to communicate with the network service living on the remote node.
+   * Call the gRPC function that handles a Query and wait for its response.
+   *
+   * @param funcEnum The enumeration specifying which gRPC function to call for this specific Query.
+   * @param query    The Query protobuf object to send.
+   * @param deadline The deadline for submitting this Query.
+   * @param response Pointer to the Response protobuf object to fill with the gRPC server's response.
+   * @return The gRPC status response of the function call from the gRPC server.
+   * @throws std::invalid_argument If the input function enumeration doesn't map to a gRPC function.
    */
-  std::unique_ptr<proto::NetworkService::Stub> mNetworkStub = nullptr;
+  grpc::Status callQuery(proto::Query::QueryCase funcEnum,
+                         const proto::Query& query,
+                         const std::chrono::system_clock::time_point& deadline,
+                         proto::Response* response);
 
   /**
-   * Pointer to the gRPC stub used to communicate with the schedule service living on the remote node.
+   * Call the gRPC function that handles a Transaction and wait for its response.
+   *
+   * @param funcEnum    The enumeration specifying which gRPC function to call for this specific Transaction.
+   * @param transaction The Transaction protobuf object to send.
+   * @param deadline    The deadline for submitting this Transaction.
+   * @param response    Pointer to the TransactionResponse protobuf object to fill with the gRPC server's response.
+   * @return The gRPC status response of the function call from the gRPC server.
+   * @throws std::invalid_argument If the input function enumeration doesn't map to a gRPC function.
    */
-  std::unique_ptr<proto::ScheduleService::Stub> mScheduleStub = nullptr;
+  grpc::Status callTransaction(proto::TransactionBody::DataCase funcEnum,
+                               const proto::Transaction& transaction,
+                               const std::chrono::system_clock::time_point& deadline,
+                               proto::TransactionResponse* response);
 
   /**
-   * Pointer to the gRPC stub used to communicate with the smart contract service living on the remote node.
+   * Prepare an asynchronous call of the gRPC function that handles a Query. This Node's lock must not be held.
+   *
+   * @param funcEnum The enumeration specifying which gRPC function to call for this specific Query.
+   * @param context  The ClientContext of the call.
+   * @param query    The Query protobuf object to send.
+   * @param queue    The CompletionQueue with which to register the call.
+   * @return The reader of the prepared call.
+   * @throws std::invalid_argument If the input function enumeration doesn't map to a gRPC function.
    */
-  std::unique_ptr<proto::SmartContractService::Stub> mSmartContractStub = nullptr;
+  [[nodiscard]] std::unique_ptr<grpc::ClientAsyncResponseReader<proto::Response>> prepareQuery(
+    proto::Query::QueryCase funcEnum,
+    grpc::ClientContext* context,
+    const proto::Query& query,
+    grpc::CompletionQueue* queue);
 
   /**
-   * Pointer to the gRPC stub used to communicate with the token service living on the remote node.
+   * Prepare an asynchronous call of the gRPC function that handles a Transaction. This Node's lock must not be held.
+   *
+   * @param funcEnum    The enumeration specifying which gRPC function to call for this specific Transaction.
+   * @param context     The ClientContext of the call.
+   * @param transaction The Transaction protobuf object to send.
+   * @param queue       The CompletionQueue with which to register the call.
+   * @return The reader of the prepared call.
+   * @throws std::invalid_argument If the input function enumeration doesn't map to a gRPC function.
    */
-  std::unique_ptr<proto::TokenService::Stub> mTokenStub = nullptr;
+  [[nodiscard]] std::unique_ptr<grpc::ClientAsyncResponseReader<proto::TransactionResponse>> prepareTransaction(
+    proto::TransactionBody::DataCase funcEnum,
+    grpc::ClientContext* context,
+    const proto::Transaction& transaction,
+    grpc::CompletionQueue* queue);
 
-  /**
-   * Pointer to the gRPC stub used to communicate with the utility service living on the remote node.
-   */
-  std::unique_ptr<proto::UtilService::Stub> mUtilStub = nullptr;
+  struct Stubs
+  {
+    /**
+     * Pointer to the gRPC stub used to communicate with the consensus service living on the remote node.
+     */
+    std::unique_ptr<proto::ConsensusService::Stub> mConsensusStub = nullptr;
+
+    /**
+     * Pointer to the gRPC stub used to communicate with the cryptography service living on the remote node.
+     */
+    std::unique_ptr<proto::CryptoService::Stub> mCryptoStub = nullptr;
+
+    /**
+     * Pointer to the gRPC stub used to communicate with the file service living on the remote node.
+     */
+    std::unique_ptr<proto::FileService::Stub> mFileStub = nullptr;
+
+    /**
+     * Pointer to the gRPC stub used to communicate with the freeze service living on the remote node.
+     */
+    std::unique_ptr<proto::FreezeService::Stub> mFreezeStub = nullptr;
+
+    /**
+     * Pointer to the gRPC stub used to communicate with the network service living on the remote node.
+     */
+    std::unique_ptr<proto::NetworkService::Stub> mNetworkStub = nullptr;
+
+    /**
+     * Pointer to the gRPC stub used to communicate with the schedule service living on the remote node.
+     */
+    std::unique_ptr<proto::ScheduleService::Stub> mScheduleStub = nullptr;
+
+    /**
+     * Pointer to the gRPC stub used to communicate with the smart contract service living on the remote node.
+     */
+    std::unique_ptr<proto::SmartContractService::Stub> mSmartContractStub = nullptr;
+
+    /**
+     * Pointer to the gRPC stub used to communicate with the token service living on the remote node.
+     */
+    std::unique_ptr<proto::TokenService::Stub> mTokenStub = nullptr;
+
+    /**
+     * Pointer to the gRPC stub used to communicate with the utility service living on the remote node.
+     */
+    std::unique_ptr<proto::UtilService::Stub> mUtilStub = nullptr;
+
+    /**
+     * Pointer to the gRPC stub used to communicate with the address book service living on the remote node.
+     */
+    std::unique_ptr<proto::AddressBookService::Stub> mAddressBookStub = nullptr;
+  };
 
   /**
-   * Pointer to the gRPC stub used to communicate with the address book service living on the remote node.
+   * The stubs of this Node, one set per channel of this Node. A set of stubs is never modified once published: it is
+   * replaced along with the channels, and is only accessed with the std::atomic_load and std::atomic_store overloads
+   * for std::shared_ptr, so that requests can use the stubs concurrently without this Node's lock.
    */
-  std::unique_ptr<proto::AddressBookService::Stub> mAddressBookStub = nullptr;
+  std::shared_ptr<const std::vector<Stubs>> mStubs = nullptr;
 
   /**
    * The AccountId that runs the remote node represented by this Node.
@@ -238,6 +406,19 @@ private:
    * Should this Node verify the certificates coming from the remote node?
    */
   bool mVerifyCertificates = false;
+
+  /**
+   * The statistics of the requests submitted to this Node. They are kept inside a std::shared_ptr so that asynchronous
+   * calls can record their completion even if this Node is destroyed before they complete.
+   */
+  std::shared_ptr<NodeStats> mStats = std::make_shared<NodeStats>();
+
+  /**
+   * Bounds the number of blocking requests in flight to this Node. It is kept inside a std::shared_ptr to keep Node
+   * copyable/movable.
+   */
+  std::shared_ptr<InFlightLimiter> mInFlightLimiter =
+    std::make_shared<InFlightLimiter>(DEFAULT_MAX_REQUESTS_IN_FLIGHT_PER_NODE);
 };
 
 } // namespace Hiero::internal
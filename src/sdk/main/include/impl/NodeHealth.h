@@ -0,0 +1,123 @@
+// SPDX-License-Identifier: Apache-2.0
+#ifndef HIERO_SDK_CPP_IMPL_NODE_HEALTH_H_
+#define HIERO_SDK_CPP_IMPL_NODE_HEALTH_H_
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+
+namespace Hiero::internal
+{
+/**
+ * The size of a cache line. Entries of a NodeHealth are aligned to it so that threads updating the health of one node
+ * don't invalidate the cache line holding the health of another.
+ */
+constexpr std::size_t CACHE_LINE_SIZE = 64ULL;
+
+/**
+ * Internal utility class that holds the health, backoff, and readmit state of a node in atomics, so that it can be
+ * read and updated from any number of threads without taking a lock.
+ */
+class alignas(CACHE_LINE_SIZE) NodeHealth
+{
+public:
+  /**
+   * Construct with a minimum and maximum backoff.
+   *
+   * @param minBackoff The minimum amount of time to backoff after a bad gRPC status is received.
+   * @param maxBackoff The maximum amount of time to backoff after a bad gRPC status is received.
+   */
+  NodeHealth(const std::chrono::system_clock::duration& minBackoff,
+             const std::chrono::system_clock::duration& maxBackoff);
+
+  /**
+   * Record a bad gRPC status. The node is unhealthy until its current backoff has passed, and its current backoff is
+   * doubled (up to the maximum backoff).
+   */
+  void increaseBackoff();
+
+  /**
+   * Record a good gRPC status. The current backoff is halved (down to the minimum backoff).
+   */
+  void decreaseBackoff();
+
+  /**
+   * Is the node healthy at a point in time?
+   *
+   * @param now The point in time at which to check.
+   * @return \c TRUE if the node's readmit time is before the input time, otherwise \c FALSE.
+   */
+  [[nodiscard]] bool isHealthy(const std::chrono::system_clock::time_point& now) const;
+
+  /**
+   * Get the time at which the node will be considered "healthy".
+   *
+   * @return The time at which the node will be considered "healthy".
+   */
+  [[nodiscard]] std::chrono::system_clock::time_point getReadmitTime() const;
+
+  /**
+   * Get the number of bad gRPC statuses the node has received.
+   *
+   * @return The number of bad gRPC statuses the node has received.
+   */
+  [[nodiscard]] unsigned int getBadGrpcStatusCount() const;
+
+  /**
+   * Set the minimum backoff. If the current backoff is at the minimum, it follows the new minimum.
+   *
+   * @param backoff The minimum amount of time to backoff after a bad gRPC status is received.
+   */
+  void setMinBackoff(const std::chrono::system_clock::duration& backoff);
+
+  /**
+   * Set the maximum backoff.
+   *
+   * @param backoff The maximum amount of time to backoff after a bad gRPC status is received.
+   */
+  void setMaxBackoff(const std::chrono::system_clock::duration& backoff);
+
+  /**
+   * Get the minimum backoff.
+   *
+   * @return The minimum amount of time to backoff after a bad gRPC status is received.
+   */
+  [[nodiscard]] std::chrono::system_clock::duration getMinBackoff() const;
+
+  /**
+   * Get the maximum backoff.
+   *
+   * @return The maximum amount of time to backoff after a bad gRPC status is received.
+   */
+  [[nodiscard]] std::chrono::system_clock::duration getMaxBackoff() const;
+
+private:
+  /**
+   * The time at which the node will be considered "healthy", in ticks of the system clock since its epoch.
+   */
+  std::atomic<std::chrono::system_clock::rep> mReadmitTime;
+
+  /**
+   * The current amount of time to backoff after a bad gRPC status is received, in ticks of the system clock.
+   */
+  std::atomic<std::chrono::system_clock::rep> mCurrentBackoff;
+
+  /**
+   * The minimum amount of time to backoff after a bad gRPC status is received, in ticks of the system clock.
+   */
+  std::atomic<std::chrono::system_clock::rep> mMinBackoff;
+
+  /**
+   * The maximum amount of time to backoff after a bad gRPC status is received, in ticks of the system clock.
+   */
+  std::atomic<std::chrono::system_clock::rep> mMaxBackoff;
+
+  /**
+   * The number of bad gRPC statuses the node has received.
+   */
+  std::atomic<unsigned int> mBadGrpcStatusCount = 0U;
+};
+
+} // namespace Hiero::internal
+
+#endif // HIERO_SDK_CPP_IMPL_NODE_HEALTH_H_
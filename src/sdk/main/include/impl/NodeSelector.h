@@ -0,0 +1,34 @@
+// SPDX-License-Identifier: Apache-2.0
+#ifndef HIERO_SDK_CPP_IMPL_NODE_SELECTOR_H_
+#define HIERO_SDK_CPP_IMPL_NODE_SELECTOR_H_
+
+#include "NodeSelectionPolicy.h"
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace Hiero::internal
+{
+class Node;
+}
+
+namespace Hiero::internal::NodeSelector
+{
+/**
+ * Choose one of the first nodes of a list according to a NodeSelectionPolicy, based on the request statistics of the
+ * nodes.
+ *
+ * @param policy The NodeSelectionPolicy with which to choose.
+ * @param nodes  The list of nodes from which to choose.
+ * @param count  The number of nodes at the front of the list that can be chosen. Must be positive and at most the size
+ *               of the list.
+ * @return The index of the chosen node.
+ */
+[[nodiscard]] std::size_t selectNode(NodeSelectionPolicy policy,
+                                     const std::vector<std::shared_ptr<Node>>& nodes,
+                                     std::size_t count);
+
+} // namespace Hiero::internal::NodeSelector
+
+#endif // HIERO_SDK_CPP_IMPL_NODE_SELECTOR_H_
@@ -0,0 +1,146 @@
+// SPDX-License-Identifier: Apache-2.0
+#ifndef HIERO_SDK_CPP_IMPL_NODE_STATS_H_
+#define HIERO_SDK_CPP_IMPL_NODE_STATS_H_
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace Hiero::internal
+{
+/**
+ * Internal utility class that tracks the response times and error rate of the requests submitted to a node. Response
+ * times and errors are tracked as exponentially weighted moving averages, so that recent requests weigh more than old
+ * ones, and response times are also kept in a decaying histogram from which percentiles can be read. Everything is kept
+ * in atomics, so that requests can be recorded and the statistics read from any number of threads without a lock.
+ */
+class NodeStats
+{
+public:
+  /**
+   * Record the start of a request.
+   *
+   * @return The time at which the request started, to pass to endRequest().
+   */
+  [[nodiscard]] std::chrono::steady_clock::time_point startRequest();
+
+  /**
+   * Record the end of a request.
+   *
+   * @param start  The time at which the request started, as returned by startRequest().
+   * @param failed \c TRUE if the request failed to get a response from the node, otherwise \c FALSE.
+   */
+  void endRequest(const std::chrono::steady_clock::time_point& start, bool failed);
+
+  /**
+   * Record the end of a request that was cancelled before the node responded. A cancelled request says nothing about
+   * the node, so only the number of requests in flight is updated.
+   */
+  void cancelRequest();
+
+  /**
+   * Get the moving average of the node's response time. Before any request completes, this is an initial estimate.
+   *
+   * @return The moving average of the node's response time.
+   */
+  [[nodiscard]] std::chrono::nanoseconds getAverageLatency() const;
+
+  /**
+   * Get an approximate percentile of the node's recent response times. The returned value is the upper bound of the
+   * histogram bucket holding the percentile, so it is accurate to within a factor of two.
+   *
+   * @param percentile The percentile to get, between 0 and 100.
+   * @return The approximate percentile of the node's response time, or 0 if no request has completed yet.
+   */
+  [[nodiscard]] std::chrono::nanoseconds getLatencyPercentile(double percentile) const;
+
+  /**
+   * Get the moving average of the fraction of requests that failed to get a response from the node.
+   *
+   * @return The error rate of the node, between 0 and 1.
+   */
+  [[nodiscard]] double getErrorRate() const;
+
+  /**
+   * Get the number of requests currently in flight to the node.
+   *
+   * @return The number of requests currently in flight to the node.
+   */
+  [[nodiscard]] unsigned int getOutstandingRequests() const;
+
+  /**
+   * Get the expected cost of sending a request to the node: its average response time, scaled by the number of requests
+   * already in flight to it and by the inverse of its success rate. Nodes with a lower expected cost should be
+   * preferred.
+   *
+   * @return The expected cost of sending a request to the node.
+   */
+  [[nodiscard]] double getExpectedCost() const;
+
+private:
+  /**
+   * The weight of a new sample in the moving averages.
+   */
+  static constexpr double EWMA_WEIGHT = 0.2;
+
+  /**
+   * The estimated response time of a node to which no request has completed yet.
+   */
+  static constexpr auto INITIAL_LATENCY = std::chrono::milliseconds(100);
+
+  /**
+   * The lowest success rate used when computing the expected cost, so that a node that only fails still has a finite
+   * cost.
+   */
+  static constexpr double MIN_SUCCESS_RATE = 0.05;
+
+  /**
+   * The number of histogram buckets. Bucket i holds the response times in [2^i, 2^(i+1)) microseconds, and the last
+   * bucket holds everything longer.
+   */
+  static constexpr std::size_t HISTOGRAM_BUCKETS = 32ULL;
+
+  /**
+   * The number of samples after which the histogram counts are halved, so that percentiles follow recent requests.
+   */
+  static constexpr std::uint64_t HISTOGRAM_DECAY_INTERVAL = 1024ULL;
+
+  /**
+   * Update a moving average with a new sample.
+   *
+   * @param average The moving average to update.
+   * @param sample  The new sample.
+   */
+  static void updateAverage(std::atomic<double>& average, double sample);
+
+  /**
+   * The moving average of the response time, in nanoseconds.
+   */
+  std::atomic<double> mAverageLatency = static_cast<double>(std::chrono::nanoseconds(INITIAL_LATENCY).count());
+
+  /**
+   * The moving average of the error rate.
+   */
+  std::atomic<double> mErrorRate = 0.0;
+
+  /**
+   * The number of requests currently in flight.
+   */
+  std::atomic<unsigned int> mOutstandingRequests = 0U;
+
+  /**
+   * The number of requests that have completed.
+   */
+  std::atomic<std::uint64_t> mCompletedRequests = 0ULL;
+
+  /**
+   * The histogram of recent response times.
+   */
+  std::array<std::atomic<std::uint64_t>, HISTOGRAM_BUCKETS> mHistogram = {};
+};
+
+} // namespace Hiero::internal
+
+#endif // HIERO_SDK_CPP_IMPL_NODE_STATS_H_
@@ -0,0 +1,279 @@
+// SPDX-License-Identifier: Apache-2.0
+#ifndef HIERO_SDK_CPP_IMPL_PAYMENT_TRANSACTION_POOL_H_
+#define HIERO_SDK_CPP_IMPL_PAYMENT_TRANSACTION_POOL_H_
+
+#include "AccountId.h"
+#include "Defaults.h"
+#include "Hbar.h"
+#include "PublicKey.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <transaction.pb.h>
+#include <tuple>
+#include <vector>
+
+namespace Hiero
+{
+class Client;
+}
+
+namespace Hiero::internal
+{
+/**
+ * Internal utility class that keeps query payment transactions built and signed ahead of time, so that a paid query
+ * doesn't have to wait for the operator to sign its payment. Payments are pooled per operator account, node account and
+ * amount. Each payment is handed out once, and payments are dropped before their valid duration runs out. Every time a
+ * payment is taken, a background thread tops the pool for that operator, node and amount back up to the pool size.
+ * When no payment is ready, one is built and signed on the spot.
+ */
+class PaymentTransactionPool
+{
+public:
+  /**
+   * The counters of a PaymentTransactionPool.
+   */
+  struct Statistics
+  {
+    /**
+     * The number of payments handed out that were built ahead of time.
+     */
+    uint64_t mHits = 0ULL;
+
+    /**
+     * The number of payments that had to be built on the spot.
+     */
+    uint64_t mMisses = 0ULL;
+
+    /**
+     * The number of payments dropped because they were too close to expiring.
+     */
+    uint64_t mExpired = 0ULL;
+  };
+
+  /**
+   * Construct with a pool size and start the background thread.
+   *
+   * @param size          The number of payments to keep ready for each operator, node and amount.
+   * @param validDuration The valid duration of the payments.
+   * @param expiryMargin  The amount of time before the end of its valid duration that a payment is dropped.
+   */
+  explicit PaymentTransactionPool(
+    unsigned int size,
+    const std::chrono::system_clock::duration& validDuration = DEFAULT_TRANSACTION_VALID_DURATION,
+    const std::chrono::system_clock::duration& expiryMargin = DEFAULT_PAYMENT_TRANSACTION_EXPIRY_MARGIN);
+
+  /**
+   * Stop the background thread.
+   */
+  ~PaymentTransactionPool();
+
+  /**
+   * Disallow copying and moving, as the background thread uses this PaymentTransactionPool.
+   */
+  PaymentTransactionPool(const PaymentTransactionPool&) = delete;
+  PaymentTransactionPool& operator=(const PaymentTransactionPool&) = delete;
+  PaymentTransactionPool(PaymentTransactionPool&&) = delete;
+  PaymentTransactionPool& operator=(PaymentTransactionPool&&) = delete;
+
+  /**
+   * Take a payment from the operator of a Client to a node.
+   *
+   * @param client        The Client whose operator makes the payment.
+   * @param nodeAccountId The ID of the account of the node to pay.
+   * @param amount        The amount to pay.
+   * @return The signed payment Transaction protobuf object.
+   * @throws UninitializedException If the Client has no operator.
+   */
+  [[nodiscard]] proto::Transaction take(const Client& client, const AccountId& nodeAccountId, const Hbar& amount);
+
+  /**
+   * Stop the background thread and drop all ready payments. Payments taken afterward are built on the spot.
+   */
+  void close();
+
+  /**
+   * Get the number of payments that are ready to be handed out.
+   *
+   * @return The number of payments that are ready to be handed out.
+   */
+  [[nodiscard]] std::size_t size() const;
+
+  /**
+   * Get the counters of this PaymentTransactionPool.
+   *
+   * @return The counters of this PaymentTransactionPool.
+   */
+  [[nodiscard]] Statistics getStatistics() const;
+
+private:
+  /**
+   * The operator, node account and amount of a set of payments, in that order. Accounts are identified by their shard,
+   * realm and account numbers.
+   */
+  using Key = std::tuple<uint64_t, uint64_t, uint64_t, uint64_t, uint64_t, uint64_t, int64_t>;
+
+  /**
+   * The operator of a Client, as needed to build and sign its payments without the Client.
+   */
+  struct Payer
+  {
+    /**
+     * The ID of the operator account.
+     */
+    AccountId mAccountId;
+
+    /**
+     * The public key of the operator.
+     */
+    std::shared_ptr<PublicKey> mPublicKey;
+
+    /**
+     * The function the operator signs with.
+     */
+    std::function<std::vector<std::byte>(const std::vector<std::byte>&)> mSigner;
+
+    /**
+     * The amount of time by which to backdate the transaction IDs of payments.
+     */
+    std::chrono::system_clock::duration mBackdate;
+  };
+
+  /**
+   * A signed payment and the time after which it must no longer be handed out.
+   */
+  struct Payment
+  {
+    /**
+     * The signed payment Transaction protobuf object.
+     */
+    proto::Transaction mTransaction;
+
+    /**
+     * The time after which the payment must no longer be handed out.
+     */
+    std::chrono::system_clock::time_point mExpiry;
+  };
+
+  /**
+   * The payments of one operator to one node of one amount.
+   */
+  struct Bucket
+  {
+    /**
+     * The operator that made the most recent request for these payments.
+     */
+    Payer mPayer;
+
+    /**
+     * The ID of the account of the node to pay.
+     */
+    AccountId mNodeAccountId;
+
+    /**
+     * The amount to pay.
+     */
+    Hbar mAmount;
+
+    /**
+     * The payments that are ready, from first to last to expire.
+     */
+    std::deque<Payment> mPayments;
+
+    /**
+     * The number of payments the background thread is building.
+     */
+    unsigned int mPending = 0U;
+
+    /**
+     * Is this Bucket waiting to be topped up by the background thread?
+     */
+    bool mIsQueued = false;
+  };
+
+  /**
+   * Build and sign a payment.
+   *
+   * @param payer         The operator that makes the payment.
+   * @param nodeAccountId The ID of the account of the node to pay.
+   * @param amount        The amount to pay.
+   * @return The signed payment.
+   */
+  [[nodiscard]] Payment build(const Payer& payer, const AccountId& nodeAccountId, const Hbar& amount) const;
+
+  /**
+   * Drop the payments of a Bucket that must no longer be handed out. This PaymentTransactionPool's mutex must be held.
+   *
+   * @param bucket The Bucket of which to drop the payments.
+   * @param now    The current time.
+   */
+  void dropExpired(Bucket& bucket, const std::chrono::system_clock::time_point& now);
+
+  /**
+   * The function run by the background thread, which tops up queued Buckets until this PaymentTransactionPool is
+   * closed.
+   */
+  void refill();
+
+  /**
+   * The number of payments to keep ready for each operator, node and amount.
+   */
+  const unsigned int mSize;
+
+  /**
+   * The valid duration of the payments.
+   */
+  const std::chrono::system_clock::duration mValidDuration;
+
+  /**
+   * The amount of time before the end of its valid duration that a payment is dropped.
+   */
+  const std::chrono::system_clock::duration mExpiryMargin;
+
+  /**
+   * The Buckets of payments, by operator, node and amount.
+   */
+  std::map<Key, Bucket> mBuckets;
+
+  /**
+   * The Buckets waiting to be topped up.
+   */
+  std::deque<Key> mQueue;
+
+  /**
+   * The counters of this PaymentTransactionPool.
+   */
+  Statistics mStatistics;
+
+  /**
+   * Has this PaymentTransactionPool been closed?
+   */
+  bool mIsClosed = false;
+
+  /**
+   * The mutex protecting this PaymentTransactionPool.
+   */
+  mutable std::mutex mMutex;
+
+  /**
+   * The condition variable on which the background thread waits for Buckets to top up.
+   */
+  std::condition_variable mCondition;
+
+  /**
+   * The background thread.
+   */
+  std::thread mThread;
+};
+
+} // namespace Hiero::internal
+
+#endif // HIERO_SDK_CPP_IMPL_PAYMENT_TRANSACTION_POOL_H_
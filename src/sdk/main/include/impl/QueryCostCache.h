@@ -0,0 +1,111 @@
+// SPDX-License-Identifier: Apache-2.0
+#ifndef HIERO_SDK_CPP_IMPL_QUERY_COST_CACHE_H_
+#define HIERO_SDK_CPP_IMPL_QUERY_COST_CACHE_H_
+
+#include "Defaults.h"
+#include "Hbar.h"
+
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+namespace Hiero::internal
+{
+/**
+ * Internal utility class that remembers the costs of recently executed queries, so that a paid query that's been
+ * executed recently can be paid for without first asking the network for its cost. Costs are keyed by the query
+ * itself, i.e. its type and everything that determines the size of its answer, and are forgotten after a period of
+ * time, as fees change with the exchange rate. This class is thread-safe.
+ */
+class QueryCostCache
+{
+public:
+  /**
+   * Construct with the period of time for which costs are remembered.
+   *
+   * @param duration   The period of time for which a cost is remembered after it's observed.
+   * @param maxEntries The maximum number of costs to remember.
+   */
+  explicit QueryCostCache(const std::chrono::system_clock::duration& duration,
+                          std::size_t maxEntries = DEFAULT_QUERY_COST_CACHE_ENTRIES);
+
+  /**
+   * Get the remembered cost of a query.
+   *
+   * @param key The key of the query.
+   * @param now The current time.
+   * @return The remembered cost of the query. Uninitialized if its cost isn't known or has been forgotten.
+   */
+  [[nodiscard]] std::optional<Hbar> get(
+    const std::string& key,
+    const std::chrono::system_clock::time_point& now = std::chrono::system_clock::now()) const;
+
+  /**
+   * Remember the observed cost of a query.
+   *
+   * @param key  The key of the query.
+   * @param cost The observed cost of the query.
+   * @param now  The time at which the cost was observed.
+   */
+  void put(const std::string& key,
+           const Hbar& cost,
+           const std::chrono::system_clock::time_point& now = std::chrono::system_clock::now());
+
+  /**
+   * Forget the cost of a query.
+   *
+   * @param key The key of the query.
+   */
+  void erase(const std::string& key);
+
+  /**
+   * Get the number of costs remembered, including those that have been forgotten but not yet dropped.
+   *
+   * @return The number of costs remembered.
+   */
+  [[nodiscard]] std::size_t size() const;
+
+private:
+  /**
+   * A remembered cost.
+   */
+  struct Entry
+  {
+    /**
+     * The observed cost.
+     */
+    Hbar mCost;
+
+    /**
+     * The time after which the cost is forgotten.
+     */
+    std::chrono::system_clock::time_point mExpiry;
+  };
+
+  /**
+   * The period of time for which a cost is remembered after it's observed.
+   */
+  const std::chrono::system_clock::duration mDuration;
+
+  /**
+   * The maximum number of costs to remember.
+   */
+  const std::size_t mMaxEntries;
+
+  /**
+   * The remembered costs, by query key.
+   */
+  std::unordered_map<std::string, Entry> mEntries;
+
+  /**
+   * The mutex protecting the remembered costs.
+   */
+  mutable std::mutex mMutex;
+};
+
+} // namespace Hiero::internal
+
+#endif // HIERO_SDK_CPP_IMPL_QUERY_COST_CACHE_H_
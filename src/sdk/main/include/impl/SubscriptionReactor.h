@@ -0,0 +1,116 @@
+// SPDX-License-Identifier: Apache-2.0
+#ifndef HIERO_SDK_CPP_IMPL_SUBSCRIPTION_REACTOR_H_
+#define HIERO_SDK_CPP_IMPL_SUBSCRIPTION_REACTOR_H_
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace Hiero::internal
+{
+class CompletionQueueDriver;
+
+/**
+ * Internal utility class that multiplexes long-lived streaming calls (e.g. topic subscriptions) over a small, fixed set
+ * of CompletionQueueDrivers, each drained by a single thread. Streams never complete on their own, so unlike unary
+ * requests they must be cancelled before their CompletionQueue can be shut down; the SubscriptionReactor keeps track of
+ * the running subscriptions so that it can do so.
+ */
+class SubscriptionReactor
+{
+public:
+  /**
+   * A streaming call run by a SubscriptionReactor.
+   */
+  class Subscription
+  {
+  public:
+    virtual ~Subscription() = default;
+
+    /**
+     * Cancel this Subscription. This must not block, and the Subscription must still remove itself from the
+     * SubscriptionReactor once its outstanding events have completed.
+     */
+    virtual void cancel() = 0;
+  };
+
+  /**
+   * Construct with the number of CompletionQueues to spread subscriptions across.
+   *
+   * @param queues The number of CompletionQueues to use, each with its own thread. At least one is always used.
+   */
+  explicit SubscriptionReactor(unsigned int queues);
+
+  /**
+   * Shut down this SubscriptionReactor and wait for its threads to finish.
+   */
+  ~SubscriptionReactor();
+
+  SubscriptionReactor(const SubscriptionReactor&) = delete;
+  SubscriptionReactor& operator=(const SubscriptionReactor&) = delete;
+  SubscriptionReactor(SubscriptionReactor&&) = delete;
+  SubscriptionReactor& operator=(SubscriptionReactor&&) = delete;
+
+  /**
+   * Add a Subscription to this SubscriptionReactor, and get the CompletionQueueDriver on which it should run.
+   * Subscriptions are assigned to the CompletionQueueDrivers in turn.
+   *
+   * @param subscription The Subscription to add.
+   * @return A pointer to the CompletionQueueDriver on which to run the Subscription, or nullptr if this
+   *         SubscriptionReactor has been shut down.
+   */
+  [[nodiscard]] std::shared_ptr<CompletionQueueDriver> add(const std::shared_ptr<Subscription>& subscription);
+
+  /**
+   * Remove a Subscription from this SubscriptionReactor. This should be called once the Subscription has ended.
+   *
+   * @param subscription The Subscription to remove.
+   */
+  void remove(const Subscription* subscription);
+
+  /**
+   * Shut down this SubscriptionReactor. Running subscriptions are cancelled, their outstanding events are drained, and
+   * the threads are joined. No new subscriptions can be added once this has been called.
+   */
+  void shutdown();
+
+  /**
+   * Get the number of subscriptions currently running on this SubscriptionReactor.
+   *
+   * @return The number of running subscriptions.
+   */
+  [[nodiscard]] std::size_t size() const;
+
+private:
+  /**
+   * The CompletionQueueDrivers running the subscriptions.
+   */
+  std::vector<std::shared_ptr<CompletionQueueDriver>> mDrivers;
+
+  /**
+   * The index of the CompletionQueueDriver to which to assign the next subscription.
+   */
+  std::atomic<std::size_t> mNextDriver = 0U;
+
+  /**
+   * The mutex protecting the running subscriptions.
+   */
+  mutable std::mutex mMutex;
+
+  /**
+   * Has this SubscriptionReactor been shut down?
+   */
+  bool mIsShutdown = false;
+
+  /**
+   * The running subscriptions. They are held weakly, as each one is kept alive by its own outstanding events.
+   */
+  std::unordered_map<const Subscription*, std::weak_ptr<Subscription>> mSubscriptions;
+};
+
+} // namespace Hiero::internal
+
+#endif // HIERO_SDK_CPP_IMPL_SUBSCRIPTION_REACTOR_H_
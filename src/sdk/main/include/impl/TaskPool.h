@@ -0,0 +1,107 @@
+// SPDX-License-Identifier: Apache-2.0
+#ifndef HIERO_SDK_CPP_IMPL_TASK_POOL_H_
+#define HIERO_SDK_CPP_IMPL_TASK_POOL_H_
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Hiero::internal
+{
+/**
+ * Internal utility class that owns a fixed pool of threads used to run CPU-bound batches of independent tasks (e.g.
+ * generating signatures) in parallel. Idle threads claim the next unclaimed task of the oldest pending batch, so a
+ * batch of uneven tasks stays balanced across threads, and the thread that submits a batch works on it as well, so a
+ * batch always makes progress even if every pool thread is busy.
+ */
+class TaskPool
+{
+public:
+  /**
+   * Construct with the number of threads to use to run tasks.
+   *
+   * @param threads The number of threads to use. This may be zero, in which case batches are run entirely by the
+   *                threads that submit them.
+   */
+  explicit TaskPool(unsigned int threads);
+
+  /**
+   * Stop this TaskPool and wait for its threads to finish.
+   */
+  ~TaskPool();
+
+  TaskPool(const TaskPool&) = delete;
+  TaskPool& operator=(const TaskPool&) = delete;
+  TaskPool(TaskPool&&) = delete;
+  TaskPool& operator=(TaskPool&&) = delete;
+
+  /**
+   * Get the process-wide TaskPool. It uses one thread fewer than the number of hardware threads, since the thread
+   * submitting a batch takes part in running it.
+   *
+   * @return A reference to the process-wide TaskPool.
+   */
+  [[nodiscard]] static TaskPool& getInstance();
+
+  /**
+   * Run a batch of tasks and wait for all of them to complete. Tasks may run concurrently and in any order, so they
+   * must be independent of each other.
+   *
+   * @param count The number of tasks in the batch.
+   * @param task  The function to run for each task. It is called once with each index in [0, count).
+   * @throws The first exception thrown by a task, once all tasks have completed.
+   */
+  void run(std::size_t count, const std::function<void(std::size_t)>& task);
+
+private:
+  /**
+   * A batch of tasks submitted with run().
+   */
+  struct Batch;
+
+  /**
+   * Run tasks of pending batches until this TaskPool is stopped.
+   */
+  void work();
+
+  /**
+   * Claim and run tasks from a batch until none are left to claim.
+   *
+   * @param batch The batch from which to claim tasks.
+   */
+  static void process(Batch& batch);
+
+  /**
+   * The threads running tasks.
+   */
+  std::vector<std::thread> mThreads;
+
+  /**
+   * The mutex protecting the pending batches and the stop flag.
+   */
+  std::mutex mMutex;
+
+  /**
+   * Condition variable used to wake the threads when a batch is submitted or this TaskPool is stopped.
+   */
+  std::condition_variable mCondition;
+
+  /**
+   * The batches that still have unclaimed tasks, oldest first.
+   */
+  std::deque<std::shared_ptr<Batch>> mBatches;
+
+  /**
+   * Has this TaskPool been stopped?
+   */
+  bool mIsStopped = false;
+};
+
+} // namespace Hiero::internal
+
+#endif // HIERO_SDK_CPP_IMPL_TASK_POOL_H_
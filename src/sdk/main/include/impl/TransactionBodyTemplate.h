@@ -0,0 +1,57 @@
+// SPDX-License-Identifier: Apache-2.0
+#ifndef HIERO_SDK_CPP_IMPL_TRANSACTION_BODY_TEMPLATE_H_
+#define HIERO_SDK_CPP_IMPL_TRANSACTION_BODY_TEMPLATE_H_
+
+#include <string>
+
+namespace Hiero
+{
+class AccountId;
+}
+
+namespace proto
+{
+class TransactionBody;
+}
+
+namespace Hiero::internal
+{
+/**
+ * Internal utility class that serializes a TransactionBody protobuf object for many nodes. Only the node account ID
+ * field of the body differs between nodes, so the fields before and after it are serialized once, and the bytes of the
+ * body for a node are those bytes with the node account ID field spliced in between. The bytes are the same as the
+ * ones the TransactionBody protobuf object itself would serialize to with the node account ID field set.
+ */
+class TransactionBodyTemplate
+{
+public:
+  /**
+   * Construct from the TransactionBody protobuf object to serialize. Its node account ID field, if set, is ignored.
+   *
+   * @param transactionBody The TransactionBody protobuf object to serialize.
+   */
+  explicit TransactionBodyTemplate(const proto::TransactionBody& transactionBody);
+
+  /**
+   * Get the bytes of the TransactionBody protobuf object with its node account ID field set to a node account ID.
+   *
+   * @param nodeAccountId The account ID of the node for which to get the TransactionBody bytes.
+   * @return The bytes of the TransactionBody protobuf object for the node.
+   */
+  [[nodiscard]] std::string getBodyBytes(const AccountId& nodeAccountId) const;
+
+private:
+  /**
+   * The bytes of the fields of the TransactionBody that come before its node account ID field.
+   */
+  std::string mPrefix;
+
+  /**
+   * The bytes of the fields of the TransactionBody that come after its node account ID field.
+   */
+  std::string mSuffix;
+};
+
+} // namespace Hiero::internal
+
+#endif // HIERO_SDK_CPP_IMPL_TRANSACTION_BODY_TEMPLATE_H_
@@ -0,0 +1,74 @@
+// SPDX-License-Identifier: Apache-2.0
+#ifndef HIERO_SDK_CPP_IMPL_TRANSACTION_ID_GENERATOR_H_
+#define HIERO_SDK_CPP_IMPL_TRANSACTION_ID_GENERATOR_H_
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace Hiero
+{
+class AccountId;
+}
+
+namespace Hiero::internal
+{
+/**
+ * Internal utility class that generates the valid start times of TransactionIds. The valid start times generated for
+ * the same account are strictly increasing, no matter how many threads generate them or how fast, so that two
+ * transactions paid for by the same account never get the same TransactionId. Each account maps to one of a fixed
+ * number of slots, each holding the last valid start time it handed out in an atomic, so generating a valid start time
+ * never takes a lock. Accounts that share a slot simply share its sequence.
+ */
+class TransactionIdGenerator
+{
+public:
+  /**
+   * Get the TransactionIdGenerator shared by the whole process.
+   *
+   * @return The TransactionIdGenerator shared by the whole process.
+   */
+  [[nodiscard]] static TransactionIdGenerator& getInstance();
+
+  /**
+   * Reserve consecutive valid start times for an account. The first is the current time minus the backdate, or one tick
+   * of the system clock after the last valid start time reserved for the account if that is later. The rest are each
+   * one tick after the previous.
+   *
+   * @param accountId The ID of the account that will pay for the transactions.
+   * @param count     The number of consecutive valid start times to reserve, e.g. one per chunk of a transaction.
+   * @param backdate  The amount of time to move the valid start times into the past, to absorb clock skew between this
+   *                  machine and the network.
+   * @return The first reserved valid start time.
+   */
+  [[nodiscard]] std::chrono::system_clock::time_point next(
+    const AccountId& accountId,
+    unsigned int count = 1U,
+    const std::chrono::system_clock::duration& backdate = std::chrono::system_clock::duration::zero());
+
+private:
+  /**
+   * The number of slots among which accounts are spread.
+   */
+  static constexpr std::size_t SLOTS = 64U;
+
+  /**
+   * The last valid start time handed out for the accounts of a slot, in ticks of the system clock since its epoch. Each
+   * slot has its own cache line, so that threads generating IDs for different accounts don't contend.
+   */
+  struct alignas(64) Slot
+  {
+    std::atomic<int64_t> mLast = 0;
+  };
+
+  /**
+   * The slots.
+   */
+  std::array<Slot, SLOTS> mSlots;
+};
+
+} // namespace Hiero::internal
+
+#endif // HIERO_SDK_CPP_IMPL_TRANSACTION_ID_GENERATOR_H_
@@ -0,0 +1,119 @@
+// SPDX-License-Identifier: Apache-2.0
+#ifndef HIERO_SDK_CPP_IMPL_OPENSSL_UTILS_CRYPTO_CONTEXT_H_
+#define HIERO_SDK_CPP_IMPL_OPENSSL_UTILS_CRYPTO_CONTEXT_H_
+
+#include "impl/openssl_utils/EVP_MD.h"
+#include "impl/openssl_utils/OSSL_LIB_CTX.h"
+
+#include <openssl/evp.h>
+#include <string>
+
+namespace Hiero::internal::OpenSSLUtils
+{
+/**
+ * Process-wide registry of the OpenSSL objects used by the key and hash paths of the SDK. Fetching a message digest
+ * (and creating the library context it is fetched from) is far more expensive than the digest operations themselves,
+ * so they are done once here and shared by every sign, verify, and hash call. The fetched objects are immutable after
+ * construction and are therefore safe to use from multiple threads at the same time.
+ */
+class CryptoContext
+{
+public:
+  /**
+   * A message digest context owned by the calling thread. It is reset when constructed and again when destroyed, so
+   * that no key or digest state outlives the operation it was used for. Only one MessageDigestContext can be alive
+   * per thread at a time, so it must not be held across calls to other functions that use one.
+   */
+  class MessageDigestContext
+  {
+  public:
+    /**
+     * Acquire the message digest context of the calling thread.
+     *
+     * @throws OpenSSLException If the message digest context of the calling thread could not be created.
+     */
+    MessageDigestContext();
+
+    /**
+     * Reset the message digest context of the calling thread.
+     */
+    ~MessageDigestContext();
+
+    MessageDigestContext(const MessageDigestContext&) = delete;
+    MessageDigestContext& operator=(const MessageDigestContext&) = delete;
+    MessageDigestContext(MessageDigestContext&&) = delete;
+    MessageDigestContext& operator=(MessageDigestContext&&) = delete;
+
+    /**
+     * Get the wrapped OpenSSL message digest context.
+     *
+     * @return A pointer to the message digest context of the calling thread.
+     */
+    [[nodiscard]] ::EVP_MD_CTX* get() const { return mContext; }
+
+  private:
+    /**
+     * The message digest context of the calling thread.
+     */
+    ::EVP_MD_CTX* mContext = nullptr;
+  };
+
+  /**
+   * Get the process-wide CryptoContext, creating it on first use.
+   *
+   * @return A reference to the process-wide CryptoContext.
+   * @throws OpenSSLException If the library context could not be created.
+   */
+  [[nodiscard]] static const CryptoContext& getInstance();
+
+  /**
+   * Get the KECCAK-256 message digest.
+   *
+   * @return A pointer to the KECCAK-256 message digest.
+   * @throws OpenSSLException If the KECCAK-256 message digest could not be fetched.
+   */
+  [[nodiscard]] const ::EVP_MD* getKECCAK256() const;
+
+  /**
+   * Get the SHA512 message digest.
+   *
+   * @return A pointer to the SHA512 message digest.
+   * @throws OpenSSLException If the SHA512 message digest could not be fetched.
+   */
+  [[nodiscard]] const ::EVP_MD* getSHA512() const;
+
+private:
+  /**
+   * Create the library context and fetch the message digests. A message digest that can't be fetched (e.g. KECCAK-256
+   * on OpenSSL versions older than 3.2) only fails the operations that use it, not the entire CryptoContext.
+   *
+   * @throws OpenSSLException If the library context could not be created.
+   */
+  CryptoContext();
+
+  /**
+   * The library context from which KECCAK-256 is fetched.
+   */
+  OSSL_LIB_CTX mLibraryContext;
+
+  /**
+   * The error messages to report if the KECCAK-256 or SHA512 message digests could not be fetched. These are declared
+   * before the message digests so that they are constructed before the message digests are fetched.
+   */
+  std::string mKECCAK256Error;
+  std::string mSHA512Error;
+
+  /**
+   * The KECCAK-256 message digest.
+   */
+  EVP_MD mKECCAK256;
+
+  /**
+   * The SHA512 message digest, fetched from the default library context.
+   */
+  EVP_MD mSHA512;
+};
+
+} // namespace Hiero::internal::OpenSSLUtils
+
+#endif // HIERO_SDK_CPP_IMPL_OPENSSL_UTILS_CRYPTO_CONTEXT_H_
@@ -45,6 +45,14 @@ constexpr const size_t ERROR_MSG_SIZE = 256ULL;
  */
 [[nodiscard]] std::vector<std::byte> computeSHA384(const std::vector<std::byte>& data);
 
+/**
+ * Compute the SHA384 hash of the bytes of a string, without copying them (i.e. serialized protobuf bytes).
+ *
+ * @param data The string of which to compute the hash.
+ * @return The SHA384 hash of the data.
+ */
+[[nodiscard]] std::vector<std::byte> computeSHA384(std::string_view data);
+
 /**
  * Compute the KECCAK256 hash of a byte array.
  *
@@ -150,7 +150,7 @@ void AccountAllowanceApproveTransaction::addToBody(proto::TransactionBody& body)
 //-----
 void AccountAllowanceApproveTransaction::initFromSourceTransactionBody()
 {
-  const proto::TransactionBody transactionBody = getSourceTransactionBody();
+  const proto::TransactionBody& transactionBody = getSourceTransactionBody();
 
   if (!transactionBody.has_cryptoapproveallowance())
   {
@@ -74,7 +74,7 @@ void AccountAllowanceDeleteTransaction::addToBody(proto::TransactionBody& body)
 //-----
 void AccountAllowanceDeleteTransaction::initFromSourceTransactionBody()
 {
-  const proto::TransactionBody transactionBody = getSourceTransactionBody();
+  const proto::TransactionBody& transactionBody = getSourceTransactionBody();
 
   if (!transactionBody.has_cryptodeleteallowance())
   {
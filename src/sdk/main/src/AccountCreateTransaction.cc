@@ -157,7 +157,7 @@ void AccountCreateTransaction::addToBody(proto::TransactionBody& body) const
 //-----
 void AccountCreateTransaction::initFromSourceTransactionBody()
 {
-  const proto::TransactionBody transactionBody = getSourceTransactionBody();
+  const proto::TransactionBody& transactionBody = getSourceTransactionBody();
 
   if (!transactionBody.has_cryptocreateaccount())
   {
@@ -74,7 +74,7 @@ void AccountDeleteTransaction::addToBody(proto::TransactionBody& body) const
 //-----
 void AccountDeleteTransaction::initFromSourceTransactionBody()
 {
-  const proto::TransactionBody transactionBody = getSourceTransactionBody();
+  const proto::TransactionBody& transactionBody = getSourceTransactionBody();
 
   if (!transactionBody.has_cryptodelete())
   {
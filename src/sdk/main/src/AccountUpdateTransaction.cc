@@ -175,7 +175,7 @@ void AccountUpdateTransaction::addToBody(proto::TransactionBody& body) const
 //-----
 void AccountUpdateTransaction::initFromSourceTransactionBody()
 {
-  const proto::TransactionBody transactionBody = getSourceTransactionBody();
+  const proto::TransactionBody& transactionBody = getSourceTransactionBody();
 
   if (!transactionBody.has_cryptoupdateaccount())
   {
@@ -2,17 +2,21 @@
 #include "ChunkedTransaction.h"
 #include "Client.h"
 #include "FileAppendTransaction.h"
+#include "ReceiptPoller.h"
 #include "TopicMessageSubmitTransaction.h"
 #include "TransactionReceipt.h"
+#include "TransactionReceiptQuery.h"
 #include "TransactionResponse.h"
 #include "exceptions/IllegalStateException.h"
+#include "impl/CompletionQueueDriver.h"
 #include "impl/TimestampConverter.h"
 #include "impl/Utilities.h"
-#include "impl/openssl_utils/OpenSSLUtils.h"
 
 #include <algorithm>
 #include <cmath>
 #include <iterator>
+#include <mutex>
+#include <optional>
 #include <transaction.pb.h>
 #include <transaction_contents.pb.h>
 
@@ -38,10 +42,48 @@ struct ChunkedTransaction<SdkRequestType>::ChunkedTransactionImpl
   // Should this ChunkedTransaction get a receipt for each submitted chunk?
   bool mShouldGetReceipt = false;
 
+  // The maximum number of chunks that can be in flight at once.
+  unsigned int mMaxChunksInFlight = DEFAULT_MAX_CHUNKS_IN_FLIGHT;
+
   // The current chunk attempting to be sent.
   unsigned int mCurrentChunk = 0U;
 };
 
+//-----
+template<typename SdkRequestType>
+struct ChunkedTransaction<SdkRequestType>::PipelinedExecution
+{
+  // The Client used to submit the chunks.
+  const Client* mClient = nullptr;
+
+  // The timeout for the execution of each chunk.
+  std::chrono::system_clock::duration mTimeout;
+
+  // The callback to call with the responses of all chunks.
+  std::function<void(const std::vector<TransactionResponse>&)> mResponseCallback;
+
+  // The callback to call with the exception if the execution fails.
+  std::function<void(const std::exception_ptr&)> mExceptionCallback;
+
+  // The mutex protecting the state of the execution.
+  std::mutex mMutex;
+
+  // The responses of the chunks, indexed by chunk.
+  std::vector<std::optional<TransactionResponse>> mResponses;
+
+  // The next chunk to submit.
+  unsigned int mNextChunk = 0U;
+
+  // The number of chunks that have been submitted but are not done yet.
+  unsigned int mInFlight = 0U;
+
+  // The number of chunks that are done.
+  unsigned int mCompleted = 0U;
+
+  // Has a chunk failed? No more chunks are submitted once one has.
+  bool mFailed = false;
+};
+
 //-----
 template<typename SdkRequestType>
 TransactionResponse ChunkedTransaction<SdkRequestType>::execute(const Client& client)
@@ -59,12 +101,17 @@ TransactionResponse ChunkedTransaction<SdkRequestType>::execute(const Client& cl
 
 //-----
 template<typename SdkRequestType>
-std::future<TransactionResponse> ChunkedTransaction<SdkRequestType>::executeAsync(
+void ChunkedTransaction<SdkRequestType>::executeAsyncInternal(
   const Client& client,
-  const std::chrono::system_clock::duration& timeout)
+  const std::chrono::system_clock::duration& timeout,
+  const std::function<void(const TransactionResponse&)>& responseCallback,
+  const std::function<void(const std::exception_ptr&)>& exceptionCallback)
 {
-  return std::async(std::launch::async,
-                    [this, &client, &timeout]() { return this->executeAll(client, timeout).at(0); });
+  executeAllAsyncInternal(
+    client,
+    timeout,
+    [responseCallback](const std::vector<TransactionResponse>& responses) { responseCallback(responses.at(0)); },
+    exceptionCallback);
 }
 
 //-----
@@ -89,6 +136,12 @@ std::vector<TransactionResponse> ChunkedTransaction<SdkRequestType>::executeAll(
                                 std::to_string(mImpl->mMaxChunks) + ". Try using setMaxChunks()");
   }
 
+  // Pipelined chunks complete on the Client's threads, so they can't be waited for on one of them.
+  if (shouldPipelineChunks(requiredChunks) && !internal::CompletionQueueDriver::isDriverThread())
+  {
+    return executeAllAsync(client, timeout).get();
+  }
+
   // Container to hold responses.
   std::vector<TransactionResponse> responses;
   responses.reserve(requiredChunks);
@@ -124,7 +177,16 @@ std::future<std::vector<TransactionResponse>> ChunkedTransaction<SdkRequestType>
   const Client& client,
   const std::chrono::system_clock::duration& timeout)
 {
-  return std::async(std::launch::async, [this, &client, &timeout]() { return this->executeAll(client, timeout); });
+  auto promise = std::make_shared<std::promise<std::vector<TransactionResponse>>>();
+  std::future<std::vector<TransactionResponse>> future = promise->get_future();
+
+  executeAllAsyncInternal(
+    client,
+    timeout,
+    [promise](const std::vector<TransactionResponse>& responses) { promise->set_value(responses); },
+    [promise](const std::exception_ptr& exception) { promise->set_exception(exception); });
+
+  return future;
 }
 
 //-----
@@ -143,17 +205,21 @@ void ChunkedTransaction<SdkRequestType>::executeAllAsync(
   const std::chrono::system_clock::duration& timeout,
   const std::function<void(const std::vector<TransactionResponse>&, const std::exception&)>& callback)
 {
-  std::future<std::vector<TransactionResponse>> future =
-    std::async(std::launch::async, [this, &client, &timeout]() { return this->executeAll(client, timeout); });
-
-  try
-  {
-    callback(future.get(), std::exception());
-  }
-  catch (const std::exception& exception)
-  {
-    callback({}, exception);
-  }
+  executeAllAsyncInternal(
+    client,
+    timeout,
+    [callback](const std::vector<TransactionResponse>& responses) { callback(responses, std::exception()); },
+    [callback](const std::exception_ptr& exception)
+    {
+      try
+      {
+        std::rethrow_exception(exception);
+      }
+      catch (const std::exception& ex)
+      {
+        callback({}, ex);
+      }
+    });
 }
 
 //-----
@@ -174,17 +240,20 @@ void ChunkedTransaction<SdkRequestType>::executeAllAsync(
   const std::function<void(const std::vector<TransactionResponse>&)>& responseCallback,
   const std::function<void(const std::exception&)>& exceptionCallback)
 {
-  std::future<std::vector<TransactionResponse>> future =
-    std::async(std::launch::async, [this, &client, &timeout]() { return this->executeAll(client, timeout); });
-
-  try
-  {
-    responseCallback(future.get());
-  }
-  catch (const std::exception& exception)
-  {
-    exceptionCallback(exception);
-  }
+  executeAllAsyncInternal(client,
+                          timeout,
+                          responseCallback,
+                          [exceptionCallback](const std::exception_ptr& exception)
+                          {
+                            try
+                            {
+                              std::rethrow_exception(exception);
+                            }
+                            catch (const std::exception& ex)
+                            {
+                              exceptionCallback(ex);
+                            }
+                          });
 }
 
 //-----
@@ -294,10 +363,8 @@ ChunkedTransaction<SdkRequestType>::getAllTransactionHashesPerNode() const
     for (unsigned int j = 0; j < nodeAccountIds.size(); ++j)
     {
       hashMap.emplace(nodeAccountIds.at(j),
-                      internal::OpenSSLUtils::computeSHA384(internal::Utilities::stringToByteVector(
-                        Transaction<SdkRequestType>::getTransactionProtobufObject(
-                          (i * static_cast<unsigned int>(nodeAccountIds.size())) + j)
-                          .signedtransactionbytes())));
+                      Transaction<SdkRequestType>::getTransactionProtobufObjectHash(
+                        (i * static_cast<unsigned int>(nodeAccountIds.size())) + j));
     }
 
     hashes.push_back(hashMap);
@@ -324,6 +391,19 @@ SdkRequestType& ChunkedTransaction<SdkRequestType>::setChunkSize(unsigned int si
   return static_cast<SdkRequestType&>(*this);
 }
 
+//-----
+template<typename SdkRequestType>
+SdkRequestType& ChunkedTransaction<SdkRequestType>::setMaxChunksInFlight(unsigned int chunks)
+{
+  if (chunks == 0U)
+  {
+    throw std::invalid_argument("Maximum number of chunks in flight must be greater than 0");
+  }
+
+  mImpl->mMaxChunksInFlight = chunks;
+  return static_cast<SdkRequestType&>(*this);
+}
+
 //-----
 template<typename SdkRequestType>
 unsigned int ChunkedTransaction<SdkRequestType>::getMaxChunks() const
@@ -338,6 +418,13 @@ unsigned int ChunkedTransaction<SdkRequestType>::getChunkSize() const
   return mImpl->mChunkSize;
 }
 
+//-----
+template<typename SdkRequestType>
+unsigned int ChunkedTransaction<SdkRequestType>::getMaxChunksInFlight() const
+{
+  return mImpl->mMaxChunksInFlight;
+}
+
 //-----
 template<typename SdkRequestType>
 ChunkedTransaction<SdkRequestType>::ChunkedTransaction()
@@ -487,7 +574,14 @@ bool ChunkedTransaction<SdkRequestType>::getShouldGetReceipt() const
 
 //-----
 template<typename SdkRequestType>
-proto::Transaction ChunkedTransaction<SdkRequestType>::makeRequest(unsigned int index) const
+bool ChunkedTransaction<SdkRequestType>::shouldPipelineChunks(unsigned int requiredChunks) const
+{
+  return mImpl->mMaxChunksInFlight > 1U && requiredChunks > 1U && !isChunkOrderSensitive();
+}
+
+//-----
+template<typename SdkRequestType>
+const proto::Transaction& ChunkedTransaction<SdkRequestType>::makeRequest(unsigned int index) const
 {
   // Adjust the index to account for the current chunk.
   return Transaction<SdkRequestType>::makeRequest(
@@ -499,6 +593,20 @@ proto::Transaction ChunkedTransaction<SdkRequestType>::makeRequest(unsigned int
     index);
 }
 
+//-----
+template<typename SdkRequestType>
+bool ChunkedTransaction<SdkRequestType>::isChunkOrderSensitive() const
+{
+  return true;
+}
+
+//-----
+template<typename SdkRequestType>
+unsigned int ChunkedTransaction<SdkRequestType>::getRequiredValidStarts() const
+{
+  return std::max(getNumberOfChunksRequired(), 1U);
+}
+
 //-----
 template<typename SdkRequestType>
 void ChunkedTransaction<SdkRequestType>::regenerateSignedTransactions(const Client* client) const
@@ -569,6 +677,245 @@ unsigned int ChunkedTransaction<SdkRequestType>::getNumberOfChunksRequired() con
     std::ceil(static_cast<double>(mImpl->mData.size()) / static_cast<double>(mImpl->mChunkSize)));
 }
 
+//-----
+template<typename SdkRequestType>
+void ChunkedTransaction<SdkRequestType>::executeAllAsyncInternal(
+  const Client& client,
+  const std::chrono::system_clock::duration& timeout,
+  const std::function<void(const std::vector<TransactionResponse>&)>& responseCallback,
+  const std::function<void(const std::exception_ptr&)>& exceptionCallback)
+{
+  // Determine how many chunks are going to be required to send this whole ChunkedTransaction and make sure it's within
+  // the set limit.
+  const unsigned int requiredChunks = getNumberOfChunksRequired();
+  if (requiredChunks > mImpl->mMaxChunks)
+  {
+    exceptionCallback(std::make_exception_ptr(
+      IllegalStateException("Transaction requires " + std::to_string(requiredChunks) + " but is only allotted " +
+                            std::to_string(mImpl->mMaxChunks) + ". Try using setMaxChunks()")));
+    return;
+  }
+
+  if (shouldPipelineChunks(requiredChunks))
+  {
+    executeAllPipelinedAsync(client, timeout, responseCallback, exceptionCallback);
+    return;
+  }
+
+  // Container to hold responses.
+  auto responses = std::make_shared<std::vector<TransactionResponse>>();
+  responses->reserve(requiredChunks);
+
+  executeNextChunkAsync(client, timeout, responses, responseCallback, exceptionCallback);
+}
+
+//-----
+template<typename SdkRequestType>
+void ChunkedTransaction<SdkRequestType>::executeNextChunkAsync(
+  const Client& client,
+  const std::chrono::system_clock::duration& timeout,
+  const std::shared_ptr<std::vector<TransactionResponse>>& responses,
+  const std::function<void(const std::vector<TransactionResponse>&)>& responseCallback,
+  const std::function<void(const std::exception_ptr&)>& exceptionCallback)
+{
+  if (mImpl->mCurrentChunk >= getNumberOfChunksRequired())
+  {
+    // Reset current chunk.
+    mImpl->mCurrentChunk = 0U;
+    responseCallback(*responses);
+    return;
+  }
+
+  // Each chunk is only submitted once the previous one has been handled, so that the chunks reach the network in order.
+  const auto nextChunk = [this, &client, timeout, responses, responseCallback, exceptionCallback]()
+  {
+    ++mImpl->mCurrentChunk;
+    executeNextChunkAsync(client, timeout, responses, responseCallback, exceptionCallback);
+  };
+
+  Executable<SdkRequestType, proto::Transaction, proto::TransactionResponse, TransactionResponse>::executeAsyncInternal(
+    client,
+    timeout,
+    [this, &client, timeout, responses, exceptionCallback, nextChunk](const TransactionResponse& response)
+    {
+      responses->push_back(response);
+
+      if (!mImpl->mShouldGetReceipt)
+      {
+        nextChunk();
+        return;
+      }
+
+      // The receipt query has to live until its own execution completes, which its callback guarantees.
+      auto receiptQuery = std::make_shared<TransactionReceiptQuery>(response.getReceiptQuery());
+      receiptQuery->executeAsyncInternal(
+        client,
+        timeout,
+        [receiptQuery, validate = response.getValidateStatus(), exceptionCallback, nextChunk](
+          const TransactionReceipt& receipt)
+        {
+          try
+          {
+            if (validate)
+            {
+              receipt.validateStatus();
+            }
+          }
+          catch (...)
+          {
+            exceptionCallback(std::current_exception());
+            return;
+          }
+
+          nextChunk();
+        },
+        exceptionCallback);
+    },
+    exceptionCallback);
+}
+
+//-----
+template<typename SdkRequestType>
+void ChunkedTransaction<SdkRequestType>::executeAllPipelinedAsync(
+  const Client& client,
+  const std::chrono::system_clock::duration& timeout,
+  const std::function<void(const std::vector<TransactionResponse>&)>& responseCallback,
+  const std::function<void(const std::exception_ptr&)>& exceptionCallback)
+{
+  // The chunks are submitted by copies of this ChunkedTransaction, which must all share its TransactionIds.
+  try
+  {
+    if (!Transaction<SdkRequestType>::isFrozen())
+    {
+      Transaction<SdkRequestType>::freezeWith(&client);
+    }
+  }
+  catch (...)
+  {
+    exceptionCallback(std::current_exception());
+    return;
+  }
+
+  auto execution = std::make_shared<PipelinedExecution>();
+  execution->mClient = &client;
+  execution->mTimeout = timeout;
+  execution->mResponseCallback = responseCallback;
+  execution->mExceptionCallback = exceptionCallback;
+  execution->mResponses.resize(getNumberOfChunksRequired());
+
+  submitPipelinedChunks(execution);
+}
+
+//-----
+template<typename SdkRequestType>
+void ChunkedTransaction<SdkRequestType>::submitPipelinedChunks(const std::shared_ptr<PipelinedExecution>& execution)
+{
+  std::vector<unsigned int> chunks;
+  {
+    std::unique_lock lock(execution->mMutex);
+    while (!execution->mFailed && execution->mNextChunk < execution->mResponses.size() &&
+           execution->mInFlight < mImpl->mMaxChunksInFlight)
+    {
+      chunks.push_back(execution->mNextChunk++);
+      ++execution->mInFlight;
+    }
+  }
+
+  for (const unsigned int chunk : chunks)
+  {
+    submitPipelinedChunk(execution, chunk);
+  }
+}
+
+//-----
+template<typename SdkRequestType>
+void ChunkedTransaction<SdkRequestType>::submitPipelinedChunk(const std::shared_ptr<PipelinedExecution>& execution,
+                                                              unsigned int chunk)
+{
+  auto transaction = std::make_shared<SdkRequestType>(static_cast<const SdkRequestType&>(*this));
+  static_cast<ChunkedTransaction<SdkRequestType>&>(*transaction).mImpl->mCurrentChunk = chunk;
+
+  transaction->Executable<SdkRequestType, proto::Transaction, proto::TransactionResponse, TransactionResponse>::
+    executeAsyncInternal(
+      *execution->mClient,
+      execution->mTimeout,
+      [this, execution, transaction, chunk](const TransactionResponse& response)
+      {
+        {
+          std::unique_lock lock(execution->mMutex);
+          execution->mResponses.at(chunk) = response;
+        }
+
+        if (!mImpl->mShouldGetReceipt)
+        {
+          completePipelinedChunk(execution, nullptr);
+          return;
+        }
+
+        // The receipts of the chunks are polled in bulk while the next chunks are being submitted.
+        try
+        {
+          execution->mClient->getReceiptPoller()->poll(
+            response,
+            [this, execution](const TransactionReceipt&) { completePipelinedChunk(execution, nullptr); },
+            [this, execution](const std::exception_ptr& exception) { completePipelinedChunk(execution, exception); });
+        }
+        catch (...)
+        {
+          completePipelinedChunk(execution, std::current_exception());
+          return;
+        }
+
+        submitPipelinedChunks(execution);
+      },
+      [this, execution, transaction](const std::exception_ptr& exception)
+      { completePipelinedChunk(execution, exception); });
+}
+
+//-----
+template<typename SdkRequestType>
+void ChunkedTransaction<SdkRequestType>::completePipelinedChunk(const std::shared_ptr<PipelinedExecution>& execution,
+                                                                const std::exception_ptr& exception)
+{
+  std::vector<TransactionResponse> responses;
+  {
+    std::unique_lock lock(execution->mMutex);
+    --execution->mInFlight;
+
+    // Only the first failure is reported.
+    if (execution->mFailed)
+    {
+      return;
+    }
+
+    if (exception)
+    {
+      execution->mFailed = true;
+    }
+    else if (++execution->mCompleted == execution->mResponses.size())
+    {
+      responses.reserve(execution->mResponses.size());
+      for (const std::optional<TransactionResponse>& response : execution->mResponses)
+      {
+        responses.push_back(response.value());
+      }
+    }
+  }
+
+  if (exception)
+  {
+    execution->mExceptionCallback(exception);
+  }
+  else if (!responses.empty())
+  {
+    execution->mResponseCallback(responses);
+  }
+  else
+  {
+    submitPipelinedChunks(execution);
+  }
+}
+
 /**
  * Explicit template instantiations.
  */
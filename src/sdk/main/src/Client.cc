@@ -7,15 +7,24 @@
 #include "Defaults.h"
 #include "FileId.h"
 #include "Hbar.h"
+#include "HedgingPolicy.h"
 #include "Logger.h"
+#include "MetricsSnapshot.h"
 #include "NodeAddressBook.h"
+#include "NodeSelectionPolicy.h"
 #include "PrivateKey.h"
 #include "PublicKey.h"
+#include "ReceiptPoller.h"
 #include "SubscriptionHandle.h"
 #include "exceptions/UninitializedException.h"
 #include "impl/BaseNodeAddress.h"
+#include "impl/CompletionQueueDriver.h"
+#include "impl/MetricsRegistry.h"
 #include "impl/MirrorNetwork.h"
 #include "impl/Network.h"
+#include "impl/PaymentTransactionPool.h"
+#include "impl/QueryCostCache.h"
+#include "impl/SubscriptionReactor.h"
 #include "impl/TLSBehavior.h"
 
 #include <condition_variable>
@@ -64,6 +73,9 @@ struct Client::ClientImpl
   // TRANSACTION_EXPIRED response from the network.
   std::optional<bool> mTransactionIdRegenerationPolicy;
 
+  // The amount of time by which the valid start times of generated transaction IDs are moved into the past.
+  std::chrono::system_clock::duration mTransactionIdBackdate = DEFAULT_TRANSACTION_ID_BACKDATE;
+
   // The maximum length of time this Client should wait to get a response after sending a request to the network.
   std::chrono::system_clock::duration mRequestTimeout = DEFAULT_REQUEST_TIMEOUT;
 
@@ -83,6 +95,55 @@ struct Client::ClientImpl
   // attempt. A manually-set gRPC deadline in the request will override this.
   std::optional<std::chrono::system_clock::duration> mGrpcDeadline;
 
+  // The driver used to run asynchronous requests submitted by this Client. This is started on first use.
+  std::shared_ptr<internal::CompletionQueueDriver> mCompletionQueueDriver = nullptr;
+
+  // The number of threads the CompletionQueueDriver should use.
+  unsigned int mCompletionQueueThreads = DEFAULT_COMPLETION_QUEUE_THREADS;
+
+  // The reactor used to run the topic subscriptions made with this Client. This is started on first use.
+  std::shared_ptr<internal::SubscriptionReactor> mSubscriptionReactor = nullptr;
+
+  // The number of threads the SubscriptionReactor should use.
+  unsigned int mSubscriptionThreads = DEFAULT_SUBSCRIPTION_THREADS;
+
+  // The HedgingPolicy of queries submitted by this Client. A manually-set HedgingPolicy in the query will override
+  // this.
+  HedgingPolicy mHedgingPolicy = HedgingPolicy::NONE;
+
+  // The percentile of a node's recent response times after which a hedged query is also submitted to another node.
+  double mHedgingPercentile = DEFAULT_HEDGING_PERCENTILE;
+
+  // The pool of query payments signed ahead of time. This is started on first use.
+  std::shared_ptr<internal::PaymentTransactionPool> mPaymentTransactionPool = nullptr;
+
+  // The number of query payments to keep signed ahead of time for each node and amount.
+  unsigned int mQueryPaymentPoolSize = DEFAULT_QUERY_PAYMENT_POOL_SIZE;
+
+  // The remembered costs of paid queries. This is created on first use.
+  std::shared_ptr<internal::QueryCostCache> mQueryCostCache = nullptr;
+
+  // The period of time for which the costs of paid queries are remembered.
+  std::chrono::system_clock::duration mQueryCostCacheDuration = DEFAULT_QUERY_COST_CACHE_DURATION;
+
+  // The fraction by which a remembered query cost is increased when paying for a query with it.
+  double mQueryCostMargin = DEFAULT_QUERY_COST_MARGIN;
+
+  // The number of gRPC channels to open to each consensus node.
+  unsigned int mNodeChannelPoolSize = DEFAULT_NODE_CHANNEL_POOL_SIZE;
+
+  // The maximum number of blocking requests in flight to each consensus node at once.
+  unsigned int mMaxRequestsInFlightPerNode = DEFAULT_MAX_REQUESTS_IN_FLIGHT_PER_NODE;
+
+  // The policy with which consensus nodes are chosen for requests.
+  NodeSelectionPolicy mNodeSelectionPolicy = NodeSelectionPolicy::RANDOM;
+
+  // The registry in which the metrics of the requests submitted by this Client are recorded.
+  std::shared_ptr<internal::MetricsRegistry> mMetricsRegistry = std::make_shared<internal::MetricsRegistry>();
+
+  // The ReceiptPoller this Client uses to wait for many receipts at once.
+  std::shared_ptr<ReceiptPoller> mReceiptPoller = nullptr;
+
   // The period of time to wait between network updates.
   std::chrono::system_clock::duration mNetworkUpdatePeriod = DEFAULT_NETWORK_UPDATE_PERIOD;
 
@@ -153,6 +214,7 @@ Client Client::forNetwork(const std::unordered_map<std::string, AccountId>& netw
 {
   Client client;
   client.mImpl->mNetwork = std::make_shared<internal::Network>(internal::Network::forNetwork(networkMap));
+  client.initializeNetwork();
   return client;
 }
 
@@ -164,6 +226,7 @@ Client Client::forMirrorNetwork(const std::vector<std::string>& mirrorNetwork)
   client.mImpl->mNetwork =
     std::make_shared<internal::Network>(internal::Network::forNetwork(internal::Network::getNetworkFromAddressBook(
       AddressBookQuery().setFileId(FileId::ADDRESS_BOOK).execute(client), internal::BaseNodeAddress::PORT_NODE_PLAIN)));
+  client.initializeNetwork();
 
   return client;
 }
@@ -184,6 +247,7 @@ Client Client::forMainnet()
 {
   Client client;
   client.mImpl->mNetwork = std::make_shared<internal::Network>(internal::Network::forMainnet());
+  client.initializeNetwork();
   client.mImpl->mMirrorNetwork = std::make_shared<internal::MirrorNetwork>(internal::MirrorNetwork::forMainnet());
   return client;
 }
@@ -193,6 +257,7 @@ Client Client::forTestnet()
 {
   Client client;
   client.mImpl->mNetwork = std::make_shared<internal::Network>(internal::Network::forTestnet());
+  client.initializeNetwork();
   client.mImpl->mMirrorNetwork = std::make_shared<internal::MirrorNetwork>(internal::MirrorNetwork::forTestnet());
   return client;
 }
@@ -202,6 +267,7 @@ Client Client::forPreviewnet()
 {
   Client client;
   client.mImpl->mNetwork = std::make_shared<internal::Network>(internal::Network::forPreviewnet());
+  client.initializeNetwork();
   client.mImpl->mMirrorNetwork = std::make_shared<internal::MirrorNetwork>(internal::MirrorNetwork::forPreviewnet());
   return client;
 }
@@ -512,6 +578,25 @@ void Client::pingAllAsync(const std::chrono::system_clock::duration& timeout,
   }
 }
 
+//-----
+bool Client::warmUp() const
+{
+  return warmUp(mImpl->mRequestTimeout);
+}
+
+//-----
+bool Client::warmUp(const std::chrono::system_clock::duration& timeout) const
+{
+  std::shared_ptr<internal::Network> network;
+  {
+    std::unique_lock lock(mImpl->mMutex);
+    network = mImpl->mNetwork;
+  }
+
+  // Waiting for the connections happens without the lock, so that this Client can keep being used.
+  return !network || network->warmUp(std::chrono::system_clock::now() + timeout);
+}
+
 //-----
 Client& Client::setOperator(const AccountId& accountId, const std::shared_ptr<PrivateKey>& privateKey)
 {
@@ -524,6 +609,16 @@ Client& Client::setOperator(const AccountId& accountId, const std::shared_ptr<Pr
   mImpl->mOperatorAccountId = accountId;
   mImpl->mOperatorPrivateKey = privateKey;
 
+  // Payments signed by the previous operator can no longer be handed out.
+  const std::shared_ptr<internal::PaymentTransactionPool> pool = std::move(mImpl->mPaymentTransactionPool);
+  mImpl->mPaymentTransactionPool = nullptr;
+  lock.unlock();
+
+  if (pool)
+  {
+    pool->close();
+  }
+
   return *this;
 }
 
@@ -542,6 +637,16 @@ Client& Client::setOperatorWith(const AccountId& accountId,
   mImpl->mOperatorPublicKey = publicKey;
   mImpl->mOperatorSigner = signer;
 
+  // Payments signed by the previous operator can no longer be handed out.
+  const std::shared_ptr<internal::PaymentTransactionPool> pool = std::move(mImpl->mPaymentTransactionPool);
+  mImpl->mPaymentTransactionPool = nullptr;
+  lock.unlock();
+
+  if (pool)
+  {
+    pool->close();
+  }
+
   return *this;
 }
 
@@ -564,9 +669,15 @@ std::shared_ptr<PublicKey> Client::getOperatorPublicKey() const
 std::optional<std::function<std::vector<std::byte>(const std::vector<std::byte>&)>> Client::getOperatorSigner() const
 {
   std::unique_lock lock(mImpl->mMutex);
-  return mImpl->mOperatorSigner.has_value() || !mImpl->mOperatorPrivateKey ? mImpl->mOperatorSigner
-                                                                           : [this](const std::vector<std::byte>& bytes)
-  { return this->mImpl->mOperatorPrivateKey->sign(bytes); };
+  if (mImpl->mOperatorSigner.has_value() || !mImpl->mOperatorPrivateKey)
+  {
+    return mImpl->mOperatorSigner;
+  }
+
+  // Hold the PrivateKey itself, as the signer may be called after this Client is moved (e.g. by a
+  // PaymentTransactionPool).
+  return [privateKey = mImpl->mOperatorPrivateKey](const std::vector<std::byte>& bytes)
+  { return privateKey->sign(bytes); };
 }
 
 void Client::close()
@@ -587,6 +698,38 @@ void Client::close()
   {
     mImpl->mMirrorNetwork->close();
   }
+
+  // Requests still in flight are failed by the driver's shutdown. Their callbacks may use this Client, so the driver
+  // must be shut down without holding the lock.
+  const std::shared_ptr<ReceiptPoller> receiptPoller = std::move(mImpl->mReceiptPoller);
+  mImpl->mReceiptPoller = nullptr;
+  const std::shared_ptr<internal::CompletionQueueDriver> driver = std::move(mImpl->mCompletionQueueDriver);
+  mImpl->mCompletionQueueDriver = nullptr;
+  const std::shared_ptr<internal::SubscriptionReactor> reactor = std::move(mImpl->mSubscriptionReactor);
+  mImpl->mSubscriptionReactor = nullptr;
+  const std::shared_ptr<internal::PaymentTransactionPool> paymentPool = std::move(mImpl->mPaymentTransactionPool);
+  mImpl->mPaymentTransactionPool = nullptr;
+  lock.unlock();
+
+  if (receiptPoller)
+  {
+    receiptPoller->close();
+  }
+
+  if (driver)
+  {
+    driver->shutdown();
+  }
+
+  if (reactor)
+  {
+    reactor->shutdown();
+  }
+
+  if (paymentPool)
+  {
+    paymentPool->close();
+  }
 }
 
 //-----
@@ -644,6 +787,26 @@ std::optional<bool> Client::getTransactionIdRegenerationPolicy() const
   return mImpl->mTransactionIdRegenerationPolicy;
 }
 
+//-----
+Client& Client::setTransactionIdBackdate(const std::chrono::system_clock::duration& backdate)
+{
+  if (backdate < std::chrono::system_clock::duration::zero())
+  {
+    throw std::invalid_argument("Transaction ID backdate must not be negative");
+  }
+
+  std::unique_lock lock(mImpl->mMutex);
+  mImpl->mTransactionIdBackdate = backdate;
+  return *this;
+}
+
+//-----
+std::chrono::system_clock::duration Client::getTransactionIdBackdate() const
+{
+  std::unique_lock lock(mImpl->mMutex);
+  return mImpl->mTransactionIdBackdate;
+}
+
 //-----
 Client& Client::setAutoValidateChecksums(bool validate)
 {
@@ -672,6 +835,7 @@ Client& Client::setNetwork(const std::unordered_map<std::string, AccountId>& net
 {
   std::unique_lock lock(mImpl->mMutex);
   mImpl->mNetwork = std::make_shared<internal::Network>(internal::Network::forNetwork(networkMap));
+  initializeNetwork();
   return *this;
 }
 
@@ -944,6 +1108,76 @@ std::chrono::system_clock::duration Client::getNodeMaxBackoff() const
   return mImpl->mNetwork ? mImpl->mNetwork->getMaxNodeBackoff() : std::chrono::system_clock::duration();
 }
 
+//-----
+Client& Client::setNodeSelectionPolicy(NodeSelectionPolicy policy)
+{
+  std::unique_lock lock(mImpl->mMutex);
+  mImpl->mNodeSelectionPolicy = policy;
+  if (mImpl->mNetwork)
+  {
+    mImpl->mNetwork->setNodeSelectionPolicy(policy);
+  }
+
+  return *this;
+}
+
+//-----
+NodeSelectionPolicy Client::getNodeSelectionPolicy() const
+{
+  std::unique_lock lock(mImpl->mMutex);
+  return mImpl->mNodeSelectionPolicy;
+}
+
+//-----
+Client& Client::setNodeChannelPoolSize(unsigned int size)
+{
+  if (size == 0U)
+  {
+    throw std::invalid_argument("Channel pool size must be greater than 0");
+  }
+
+  std::unique_lock lock(mImpl->mMutex);
+  mImpl->mNodeChannelPoolSize = size;
+  if (mImpl->mNetwork)
+  {
+    mImpl->mNetwork->setChannelPoolSize(size);
+  }
+
+  return *this;
+}
+
+//-----
+unsigned int Client::getNodeChannelPoolSize() const
+{
+  std::unique_lock lock(mImpl->mMutex);
+  return mImpl->mNodeChannelPoolSize;
+}
+
+//-----
+Client& Client::setMaxRequestsInFlightPerNode(unsigned int max)
+{
+  if (max == 0U)
+  {
+    throw std::invalid_argument("Maximum number of requests in flight must be greater than 0");
+  }
+
+  std::unique_lock lock(mImpl->mMutex);
+  mImpl->mMaxRequestsInFlightPerNode = max;
+  if (mImpl->mNetwork)
+  {
+    mImpl->mNetwork->setMaxRequestsInFlightPerNode(max);
+  }
+
+  return *this;
+}
+
+//-----
+unsigned int Client::getMaxRequestsInFlightPerNode() const
+{
+  std::unique_lock lock(mImpl->mMutex);
+  return mImpl->mMaxRequestsInFlightPerNode;
+}
+
 //-----
 Client& Client::setMinNodeReadmitTime(const std::chrono::system_clock::duration& time)
 {
@@ -1001,6 +1235,176 @@ unsigned int Client::getMaxNodesPerTransaction() const
   return mImpl->mNetwork ? mImpl->mNetwork->getMaxNodeAttempts() : 0U;
 }
 
+//-----
+Client& Client::setCompletionQueueThreads(unsigned int threads)
+{
+  if (threads == 0U)
+  {
+    throw std::invalid_argument("Number of completion queue threads must be greater than 0");
+  }
+
+  std::unique_lock lock(mImpl->mMutex);
+  mImpl->mCompletionQueueThreads = threads;
+  return *this;
+}
+
+//-----
+unsigned int Client::getCompletionQueueThreads() const
+{
+  std::unique_lock lock(mImpl->mMutex);
+  return mImpl->mCompletionQueueThreads;
+}
+
+//-----
+Client& Client::setSubscriptionThreads(unsigned int threads)
+{
+  if (threads == 0U)
+  {
+    throw std::invalid_argument("Number of subscription threads must be greater than 0");
+  }
+
+  std::unique_lock lock(mImpl->mMutex);
+  mImpl->mSubscriptionThreads = threads;
+  return *this;
+}
+
+//-----
+unsigned int Client::getSubscriptionThreads() const
+{
+  std::unique_lock lock(mImpl->mMutex);
+  return mImpl->mSubscriptionThreads;
+}
+
+//-----
+Client& Client::setHedgingPolicy(HedgingPolicy policy)
+{
+  std::unique_lock lock(mImpl->mMutex);
+  mImpl->mHedgingPolicy = policy;
+  return *this;
+}
+
+//-----
+HedgingPolicy Client::getHedgingPolicy() const
+{
+  std::unique_lock lock(mImpl->mMutex);
+  return mImpl->mHedgingPolicy;
+}
+
+//-----
+Client& Client::setHedgingPercentile(double percentile)
+{
+  if (!(percentile > 0.0 && percentile <= 100.0))
+  {
+    throw std::invalid_argument("Hedging percentile must be greater than 0 and at most 100");
+  }
+
+  std::unique_lock lock(mImpl->mMutex);
+  mImpl->mHedgingPercentile = percentile;
+  return *this;
+}
+
+//-----
+double Client::getHedgingPercentile() const
+{
+  std::unique_lock lock(mImpl->mMutex);
+  return mImpl->mHedgingPercentile;
+}
+
+//-----
+Client& Client::setQueryPaymentPoolSize(unsigned int size)
+{
+  std::unique_lock lock(mImpl->mMutex);
+  mImpl->mQueryPaymentPoolSize = size;
+
+  // The pool keeps the size it was started with, so it's restarted on next use.
+  const std::shared_ptr<internal::PaymentTransactionPool> pool = std::move(mImpl->mPaymentTransactionPool);
+  mImpl->mPaymentTransactionPool = nullptr;
+  lock.unlock();
+
+  if (pool)
+  {
+    pool->close();
+  }
+
+  return *this;
+}
+
+//-----
+unsigned int Client::getQueryPaymentPoolSize() const
+{
+  std::unique_lock lock(mImpl->mMutex);
+  return mImpl->mQueryPaymentPoolSize;
+}
+
+//-----
+Client& Client::setQueryCostCacheDuration(const std::chrono::system_clock::duration& duration)
+{
+  if (duration < std::chrono::system_clock::duration::zero())
+  {
+    throw std::invalid_argument("Query cost cache duration must not be negative");
+  }
+
+  std::unique_lock lock(mImpl->mMutex);
+  mImpl->mQueryCostCacheDuration = duration;
+  mImpl->mQueryCostCache = nullptr;
+  return *this;
+}
+
+//-----
+std::chrono::system_clock::duration Client::getQueryCostCacheDuration() const
+{
+  std::unique_lock lock(mImpl->mMutex);
+  return mImpl->mQueryCostCacheDuration;
+}
+
+//-----
+Client& Client::setQueryCostMargin(double margin)
+{
+  if (margin < 0.0)
+  {
+    throw std::invalid_argument("Query cost margin must not be negative");
+  }
+
+  std::unique_lock lock(mImpl->mMutex);
+  mImpl->mQueryCostMargin = margin;
+  return *this;
+}
+
+//-----
+double Client::getQueryCostMargin() const
+{
+  std::unique_lock lock(mImpl->mMutex);
+  return mImpl->mQueryCostMargin;
+}
+
+//-----
+MetricsSnapshot Client::getMetrics() const
+{
+  return getMetricsRegistry()->getSnapshot();
+}
+
+//-----
+std::shared_ptr<ReceiptPoller> Client::getReceiptPoller() const
+{
+  std::unique_lock lock(mImpl->mMutex);
+  if (mImpl->mReceiptPoller)
+  {
+    return mImpl->mReceiptPoller;
+  }
+
+  // The ReceiptPoller reads this Client's settings when it's constructed, so it must be constructed without the lock.
+  lock.unlock();
+  auto receiptPoller = std::make_shared<ReceiptPoller>(*this);
+
+  lock.lock();
+  if (!mImpl->mReceiptPoller)
+  {
+    mImpl->mReceiptPoller = std::move(receiptPoller);
+  }
+
+  return mImpl->mReceiptPoller;
+}
+
 //-----
 void Client::trackSubscription(const std::shared_ptr<SubscriptionHandle>& subscription) const
 {
@@ -1034,6 +1438,71 @@ std::shared_ptr<internal::MirrorNetwork> Client::getClientMirrorNetwork() const
   return mImpl->mMirrorNetwork;
 }
 
+//-----
+std::shared_ptr<internal::CompletionQueueDriver> Client::getCompletionQueueDriver() const
+{
+  std::unique_lock lock(mImpl->mMutex);
+  if (!mImpl->mCompletionQueueDriver)
+  {
+    mImpl->mCompletionQueueDriver =
+      std::make_shared<internal::CompletionQueueDriver>(mImpl->mCompletionQueueThreads, mImpl->mLogger);
+  }
+
+  return mImpl->mCompletionQueueDriver;
+}
+
+//-----
+std::shared_ptr<internal::SubscriptionReactor> Client::getSubscriptionReactor() const
+{
+  std::unique_lock lock(mImpl->mMutex);
+  if (!mImpl->mSubscriptionReactor)
+  {
+    mImpl->mSubscriptionReactor = std::make_shared<internal::SubscriptionReactor>(mImpl->mSubscriptionThreads);
+  }
+
+  return mImpl->mSubscriptionReactor;
+}
+
+//-----
+std::shared_ptr<internal::PaymentTransactionPool> Client::getPaymentTransactionPool() const
+{
+  std::unique_lock lock(mImpl->mMutex);
+  if (!mImpl->mPaymentTransactionPool && mImpl->mQueryPaymentPoolSize > 0U)
+  {
+    mImpl->mPaymentTransactionPool = std::make_shared<internal::PaymentTransactionPool>(mImpl->mQueryPaymentPoolSize);
+  }
+
+  return mImpl->mPaymentTransactionPool;
+}
+
+//-----
+std::shared_ptr<internal::QueryCostCache> Client::getQueryCostCache() const
+{
+  std::unique_lock lock(mImpl->mMutex);
+  if (!mImpl->mQueryCostCache && mImpl->mQueryCostCacheDuration > std::chrono::system_clock::duration::zero())
+  {
+    mImpl->mQueryCostCache = std::make_shared<internal::QueryCostCache>(mImpl->mQueryCostCacheDuration);
+  }
+
+  return mImpl->mQueryCostCache;
+}
+
+//-----
+std::shared_ptr<internal::MetricsRegistry> Client::getMetricsRegistry() const
+{
+  std::unique_lock lock(mImpl->mMutex);
+  return mImpl->mMetricsRegistry;
+}
+
+//-----
+void Client::initializeNetwork()
+{
+  mImpl->mNetwork->setMetricsRegistry(mImpl->mMetricsRegistry);
+  mImpl->mNetwork->setChannelPoolSize(mImpl->mNodeChannelPoolSize);
+  mImpl->mNetwork->setMaxRequestsInFlightPerNode(mImpl->mMaxRequestsInFlightPerNode);
+  mImpl->mNetwork->setNodeSelectionPolicy(mImpl->mNodeSelectionPolicy);
+}
+
 //-----
 void Client::setNetworkFromAddressBookInternal(const NodeAddressBook& addressBook)
 {
@@ -12,6 +12,7 @@
 #include "exceptions/UninitializedException.h"
 #include "impl/Utilities.h"
 
+
 namespace Hiero
 {
 //-----
@@ -47,7 +48,10 @@ TransactionResponse ContractCreateFlow::execute(const Client& client,
   if (!appendedByteCode.empty())
   {
     FileAppendTransaction fileAppendTransaction =
-      FileAppendTransaction().setFileId(fileId).setContents(appendedByteCode).setMaxChunks(mMaxChunks);
+      FileAppendTransaction()
+        .setFileId(fileId)
+        .setContents(appendedByteCode)
+        .setMaxChunks(mMaxChunks);
 
     if (!mNodeAccountIds.empty())
     {
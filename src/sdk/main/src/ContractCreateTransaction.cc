@@ -184,7 +184,7 @@ void ContractCreateTransaction::addToBody(proto::TransactionBody& body) const
 //-----
 void ContractCreateTransaction::initFromSourceTransactionBody()
 {
-  const proto::TransactionBody transactionBody = getSourceTransactionBody();
+  const proto::TransactionBody& transactionBody = getSourceTransactionBody();
 
   if (!transactionBody.has_contractcreateinstance())
   {
@@ -85,7 +85,7 @@ void ContractDeleteTransaction::addToBody(proto::TransactionBody& body) const
 //-----
 void ContractDeleteTransaction::initFromSourceTransactionBody()
 {
-  const proto::TransactionBody transactionBody = getSourceTransactionBody();
+  const proto::TransactionBody& transactionBody = getSourceTransactionBody();
 
   if (!transactionBody.has_contractdeleteinstance())
   {
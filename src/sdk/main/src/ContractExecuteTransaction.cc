@@ -91,7 +91,7 @@ void ContractExecuteTransaction::addToBody(proto::TransactionBody& body) const
 //-----
 void ContractExecuteTransaction::initFromSourceTransactionBody()
 {
-  const proto::TransactionBody transactionBody = getSourceTransactionBody();
+  const proto::TransactionBody& transactionBody = getSourceTransactionBody();
 
   if (!transactionBody.has_contractcall())
   {
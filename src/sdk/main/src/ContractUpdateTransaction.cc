@@ -151,7 +151,7 @@ void ContractUpdateTransaction::addToBody(proto::TransactionBody& body) const
 //-----
 void ContractUpdateTransaction::initFromSourceTransactionBody()
 {
-  const proto::TransactionBody transactionBody = getSourceTransactionBody();
+  const proto::TransactionBody& transactionBody = getSourceTransactionBody();
 
   if (!transactionBody.has_contractupdateinstance())
   {
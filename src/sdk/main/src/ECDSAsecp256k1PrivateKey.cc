@@ -10,10 +10,8 @@
 #include "impl/PrivateKeyImpl.h"
 #include "impl/Utilities.h"
 #include "impl/openssl_utils/BIGNUM.h"
+#include "impl/openssl_utils/CryptoContext.h"
 #include "impl/openssl_utils/ECDSA_SIG.h"
-#include "impl/openssl_utils/EVP_MD.h"
-#include "impl/openssl_utils/EVP_MD_CTX.h"
-#include "impl/openssl_utils/OSSL_LIB_CTX.h"
 #include "impl/openssl_utils/OpenSSLUtils.h"
 
 #include <basic_types.pb.h>
@@ -187,26 +185,12 @@ std::unique_ptr<PrivateKey> ECDSAsecp256k1PrivateKey::derive(uint32_t childIndex
 //-----
 std::vector<std::byte> ECDSAsecp256k1PrivateKey::sign(const std::vector<std::byte>& bytesToSign) const
 {
-  internal::OpenSSLUtils::OSSL_LIB_CTX libraryContext(OSSL_LIB_CTX_new());
-  if (!libraryContext)
-  {
-    throw OpenSSLException(internal::OpenSSLUtils::getErrorMessage("OSSL_LIB_CTX_new"));
-  }
-
-  const internal::OpenSSLUtils::EVP_MD messageDigest(EVP_MD_fetch(libraryContext.get(), "KECCAK-256", nullptr));
-  if (!messageDigest)
-  {
-    throw OpenSSLException(internal::OpenSSLUtils::getErrorMessage("EVP_MD_fetch"));
-  }
-
-  internal::OpenSSLUtils::EVP_MD_CTX messageDigestContext(EVP_MD_CTX_new());
-  if (!messageDigestContext)
-  {
-    throw OpenSSLException(internal::OpenSSLUtils::getErrorMessage("EVP_MD_CTX_new"));
-  }
-
-  if (EVP_DigestSignInit(messageDigestContext.get(), nullptr, messageDigest.get(), nullptr, getInternalKey().get()) <=
-      0)
+  const internal::OpenSSLUtils::CryptoContext::MessageDigestContext messageDigestContext;
+  if (EVP_DigestSignInit(messageDigestContext.get(),
+                         nullptr,
+                         internal::OpenSSLUtils::CryptoContext::getInstance().getKECCAK256(),
+                         nullptr,
+                         getInternalKey().get()) <= 0)
   {
     throw OpenSSLException(internal::OpenSSLUtils::getErrorMessage("EVP_DigestSignInit"));
   }
@@ -11,13 +11,11 @@
 #include "impl/Utilities.h"
 #include "impl/openssl_utils/BIGNUM.h"
 #include "impl/openssl_utils/BN_CTX.h"
+#include "impl/openssl_utils/CryptoContext.h"
 #include "impl/openssl_utils/ECDSA_SIG.h"
 #include "impl/openssl_utils/EC_GROUP.h"
 #include "impl/openssl_utils/EC_POINT.h"
-#include "impl/openssl_utils/EVP_MD.h"
-#include "impl/openssl_utils/EVP_MD_CTX.h"
 #include "impl/openssl_utils/OSSL_DECODER_CTX.h"
-#include "impl/openssl_utils/OSSL_LIB_CTX.h"
 #include "impl/openssl_utils/OpenSSLUtils.h"
 
 #include <basic_types.pb.h>
@@ -308,26 +306,12 @@ bool ECDSAsecp256k1PublicKey::verifySignature(const std::vector<std::byte>& sign
     throw OpenSSLException(internal::OpenSSLUtils::getErrorMessage("i2d_ECDSA_SIG"));
   }
 
-  internal::OpenSSLUtils::EVP_MD_CTX messageDigestContext(EVP_MD_CTX_new());
-  if (!messageDigestContext)
-  {
-    throw OpenSSLException(internal::OpenSSLUtils::getErrorMessage("EVP_MD_CTX_new"));
-  }
-
-  internal::OpenSSLUtils::OSSL_LIB_CTX libraryContext(OSSL_LIB_CTX_new());
-  if (!libraryContext)
-  {
-    throw OpenSSLException(internal::OpenSSLUtils::getErrorMessage("OSSL_LIB_CTX_new"));
-  }
-
-  const internal::OpenSSLUtils::EVP_MD messageDigest(EVP_MD_fetch(libraryContext.get(), "KECCAK-256", nullptr));
-  if (!messageDigest)
-  {
-    throw OpenSSLException(internal::OpenSSLUtils::getErrorMessage("EVP_MD_fetch"));
-  }
-
-  if (EVP_DigestVerifyInit(messageDigestContext.get(), nullptr, messageDigest.get(), nullptr, getInternalKey().get()) <=
-      0)
+  const internal::OpenSSLUtils::CryptoContext::MessageDigestContext messageDigestContext;
+  if (EVP_DigestVerifyInit(messageDigestContext.get(),
+                           nullptr,
+                           internal::OpenSSLUtils::CryptoContext::getInstance().getKECCAK256(),
+                           nullptr,
+                           getInternalKey().get()) <= 0)
   {
     throw OpenSSLException(internal::OpenSSLUtils::getErrorMessage("EVP_DigestVerifyInit"));
   }
@@ -9,7 +9,7 @@
 #include "impl/HexConverter.h"
 #include "impl/PrivateKeyImpl.h"
 #include "impl/Utilities.h"
-#include "impl/openssl_utils/EVP_MD_CTX.h"
+#include "impl/openssl_utils/CryptoContext.h"
 #include "impl/openssl_utils/EVP_PKEY.h"
 #include "impl/openssl_utils/EVP_PKEY_CTX.h"
 #include "impl/openssl_utils/OpenSSLUtils.h"
@@ -165,11 +165,7 @@ std::unique_ptr<proto::Key> ED25519PrivateKey::toProtobufKey() const
 //-----
 std::vector<std::byte> ED25519PrivateKey::sign(const std::vector<std::byte>& bytesToSign) const
 {
-  internal::OpenSSLUtils::EVP_MD_CTX messageDigestContext(EVP_MD_CTX_new());
-  if (!messageDigestContext)
-  {
-    throw OpenSSLException(internal::OpenSSLUtils::getErrorMessage("EVP_MD_CTX_new"));
-  }
+  const internal::OpenSSLUtils::CryptoContext::MessageDigestContext messageDigestContext;
 
   if (EVP_DigestSignInit(messageDigestContext.get(), nullptr, nullptr, nullptr, getInternalKey().get()) <= 0)
   {
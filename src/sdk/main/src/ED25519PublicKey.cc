@@ -6,7 +6,7 @@
 #include "impl/HexConverter.h"
 #include "impl/PublicKeyImpl.h"
 #include "impl/Utilities.h"
-#include "impl/openssl_utils/EVP_MD_CTX.h"
+#include "impl/openssl_utils/CryptoContext.h"
 #include "impl/openssl_utils/OpenSSLUtils.h"
 
 #include <basic_types.pb.h>
@@ -111,11 +111,7 @@ std::unique_ptr<proto::Key> ED25519PublicKey::toProtobufKey() const
 bool ED25519PublicKey::verifySignature(const std::vector<std::byte>& signatureBytes,
                                        const std::vector<std::byte>& signedBytes) const
 {
-  internal::OpenSSLUtils::EVP_MD_CTX messageDigestContext(EVP_MD_CTX_new());
-  if (!messageDigestContext)
-  {
-    throw OpenSSLException(internal::OpenSSLUtils::getErrorMessage("EVP_MD_CTX_new"));
-  }
+  const internal::OpenSSLUtils::CryptoContext::MessageDigestContext messageDigestContext;
 
   if (EVP_DigestVerifyInit(messageDigestContext.get(), nullptr, nullptr, nullptr, getInternalKey().get()) <= 0)
   {
@@ -75,7 +75,7 @@ void EthereumTransaction::addToBody(proto::TransactionBody& body) const
 //-----
 void EthereumTransaction::initFromSourceTransactionBody()
 {
-  const proto::TransactionBody transactionBody = getSourceTransactionBody();
+  const proto::TransactionBody& transactionBody = getSourceTransactionBody();
 
   if (!transactionBody.has_ethereumtransaction())
   {
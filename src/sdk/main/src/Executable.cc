@@ -83,22 +83,213 @@
 #include "exceptions/IllegalStateException.h"
 #include "exceptions/MaxAttemptsExceededException.h"
 #include "exceptions/PrecheckStatusException.h"
+#include "impl/ArenaPool.h"
+#include "impl/CompletionQueueDriver.h"
+#include "impl/MetricsRegistry.h"
 #include "impl/Network.h"
 #include "impl/Node.h"
+#include "impl/NodeSelector.h"
 #include "impl/Utilities.h"
 
 #include <algorithm>
+#include <google/protobuf/arena.h>
+#include <grpcpp/client_context.h>
 #include <grpcpp/impl/codegen/status.h>
 #include <limits>
+#include <memory>
 #include <query.pb.h>
 #include <response.pb.h>
 #include <stdexcept>
+#include <string>
 #include <thread>
 #include <transaction.pb.h>
 #include <transaction_response.pb.h>
+#include <utility>
 
 namespace Hiero
 {
+namespace
+{
+// Helper function used to get the time elapsed since a point in time.
+std::chrono::nanoseconds getElapsedTime(const std::chrono::steady_clock::time_point& start)
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+}
+
+/**
+ * Records the end of a synchronous execution in a MetricsRegistry when it goes out of scope, however the execution
+ * ends. An execution that hasn't been marked as succeeded by then (i.e. one that threw) is recorded as failed.
+ */
+class ExecutionRecorder
+{
+public:
+  ExecutionRecorder(std::shared_ptr<internal::MetricsRegistry> metrics, std::string requestType)
+    : mMetrics(std::move(metrics))
+    , mRequestType(std::move(requestType))
+  {
+  }
+
+  ~ExecutionRecorder() { mMetrics->recordExecution(mRequestType, getElapsedTime(mStart), mSucceeded); }
+
+  ExecutionRecorder(const ExecutionRecorder&) = delete;
+  ExecutionRecorder& operator=(const ExecutionRecorder&) = delete;
+  ExecutionRecorder(ExecutionRecorder&&) = delete;
+  ExecutionRecorder& operator=(ExecutionRecorder&&) = delete;
+
+  // Mark the execution as succeeded.
+  void succeed() { mSucceeded = true; }
+
+  // Get the type of request being executed.
+  [[nodiscard]] const std::string& getRequestType() const { return mRequestType; }
+
+private:
+  // The registry in which to record the execution.
+  std::shared_ptr<internal::MetricsRegistry> mMetrics;
+
+  // The type of request being executed.
+  std::string mRequestType;
+
+  // The time at which the execution started.
+  std::chrono::steady_clock::time_point mStart = std::chrono::steady_clock::now();
+
+  // Has the execution succeeded?
+  bool mSucceeded = false;
+};
+
+} // namespace
+
+//-----
+template<typename SdkRequestType, typename ProtoRequestType, typename ProtoResponseType, typename SdkResponseType>
+struct Executable<SdkRequestType, ProtoRequestType, ProtoResponseType, SdkResponseType>::AsyncExecution
+{
+  /**
+   * Complete this execution successfully. Does nothing if this execution has already completed.
+   *
+   * @param response The response with which to complete.
+   */
+  void succeed(const SdkResponseType& response)
+  {
+    if (!mCompleted)
+    {
+      mCompleted = true;
+      recordExecution(true);
+      mResponseCallback(response);
+    }
+  }
+
+  /**
+   * Complete this execution with an exception. Does nothing if this execution has already completed.
+   *
+   * @param exception The exception with which to complete.
+   */
+  void fail(const std::exception_ptr& exception)
+  {
+    if (!mCompleted)
+    {
+      mCompleted = true;
+      recordExecution(false);
+      mExceptionCallback(exception);
+    }
+  }
+
+  /**
+   * Get the metrics of the attempts of this execution at a node.
+   *
+   * @param node The node of which to get the metrics.
+   * @return A reference to the metrics of the attempts of this execution at the node.
+   */
+  internal::MetricsRegistry::NodeRequestMetrics& getNodeMetrics(const std::shared_ptr<internal::Node>& node) const
+  {
+    return mMetricsRegistry->getNodeRequestMetrics(mRequestType, node->getAccountId().toString());
+  }
+
+  /**
+   * Record the end of this execution. Does nothing if this execution failed before its metrics could be set up.
+   *
+   * @param succeeded \c TRUE if this execution succeeded, \c FALSE if it failed.
+   */
+  void recordExecution(bool succeeded) const
+  {
+    if (mMetricsRegistry)
+    {
+      mMetricsRegistry->recordExecution(mRequestType, getElapsedTime(mStart), succeeded);
+    }
+  }
+
+  // The Client submitting the Executable.
+  const Client* mClient = nullptr;
+
+  // The driver running the continuations of this execution. Only one continuation of an execution is ever pending, so
+  // the state below needs no locking.
+  std::shared_ptr<internal::CompletionQueueDriver> mDriver = nullptr;
+
+  // The network of the Client, through which nodes are backed off from.
+  std::shared_ptr<internal::Network> mNetwork = nullptr;
+
+  // The nodes associated with the Executable's node account IDs.
+  std::vector<std::shared_ptr<internal::Node>> mNodes;
+
+  // The registry in which the metrics of this execution are recorded.
+  std::shared_ptr<internal::MetricsRegistry> mMetricsRegistry = nullptr;
+
+  // The type of the request, under which the metrics of this execution are recorded.
+  std::string mRequestType;
+
+  // The time at which this execution started.
+  std::chrono::steady_clock::time_point mStart = std::chrono::steady_clock::now();
+
+  // The time at which the current attempt was submitted.
+  std::chrono::steady_clock::time_point mAttemptStart;
+
+  // The time to timeout.
+  std::chrono::system_clock::time_point mTimeoutTime;
+
+  // The responses from each node.
+  std::unordered_map<std::shared_ptr<internal::Node>, Status> mNodeResponses;
+
+  // The current attempt.
+  unsigned int mAttempt = 0U;
+
+  // Are the attempts of this execution hedged?
+  bool mHedging = false;
+
+  // The percentile of a node's recent response times after which an attempt to it is hedged.
+  double mHedgingPercentile = DEFAULT_HEDGING_PERCENTILE;
+
+  // Has this execution completed?
+  bool mCompleted = false;
+
+  // The callback to call with the response.
+  std::function<void(const SdkResponseType&)> mResponseCallback;
+
+  // The callback to call with the exception.
+  std::function<void(const std::exception_ptr&)> mExceptionCallback;
+};
+
+//-----
+template<typename SdkRequestType, typename ProtoRequestType, typename ProtoResponseType, typename SdkResponseType>
+struct Executable<SdkRequestType, ProtoRequestType, ProtoResponseType, SdkResponseType>::HedgedAttempt
+{
+  // The mutex protecting this attempt. The submissions of a hedged attempt and its hedging timer complete on any of the
+  // driver's threads, so unlike the rest of the execution, this state is accessed concurrently.
+  std::mutex mMutex;
+
+  // The deadline of the submissions of this attempt.
+  std::chrono::system_clock::time_point mDeadline;
+
+  // The indices of the nodes to which this attempt has been submitted.
+  std::vector<unsigned int> mNodeIndices;
+
+  // The contexts of the submissions of this attempt, used to cancel the submissions that lose.
+  std::vector<std::shared_ptr<grpc::ClientContext>> mContexts;
+
+  // The number of submissions of this attempt that haven't completed yet.
+  unsigned int mOutstanding = 0U;
+
+  // Has this attempt been decided? Once it has, the execution continues and the other submissions are ignored.
+  bool mDecided = false;
+};
+
 //-----
 template<typename SdkRequestType, typename ProtoRequestType, typename ProtoResponseType, typename SdkResponseType>
 SdkResponseType Executable<SdkRequestType, ProtoRequestType, ProtoResponseType, SdkResponseType>::execute(
@@ -112,6 +303,19 @@ SdkResponseType Executable<SdkRequestType, ProtoRequestType, ProtoResponseType,
   const Client& client,
   const std::chrono::system_clock::duration& timeout)
 {
+  // Hedged submissions run concurrently, which only the asynchronous execution supports. A thread of a
+  // CompletionQueueDriver can't wait for an asynchronous execution though, as the execution may need that very thread
+  // to make progress, so there this is executed without hedging.
+  if (isHedgingAllowed(client) && !internal::CompletionQueueDriver::isDriverThread())
+  {
+    return executeAsync(client, timeout).get();
+  }
+
+  // The metrics of this execution are recorded in the Client's MetricsRegistry, under the type of this request, however
+  // the execution ends.
+  const std::shared_ptr<internal::MetricsRegistry> metrics = client.getMetricsRegistry();
+  ExecutionRecorder recorder(metrics, getRequestType());
+
   if (mLogger.getLogger()->getName() == DEFAULT_LOGGER_NAME)
   {
     mLogger = client.getLogger();
@@ -121,6 +325,7 @@ SdkResponseType Executable<SdkRequestType, ProtoRequestType, ProtoResponseType,
   onExecute(client);
 
   // Get the nodes associated with this Executable's node account IDs.
+  const std::shared_ptr<internal::Network> network = client.getClientNetwork();
   const std::vector<std::shared_ptr<internal::Node>> nodes = getNodesFromNodeAccountIds(client);
 
   // The time to timeout.
@@ -146,42 +351,65 @@ SdkResponseType Executable<SdkRequestType, ProtoRequestType, ProtoResponseType,
 
     const unsigned int nodeIndex = getNodeIndexForExecute(nodes, attempt);
     const std::shared_ptr<internal::Node>& node = nodes.at(nodeIndex);
+    internal::MetricsRegistry::NodeRequestMetrics& nodeMetrics =
+      metrics->getNodeRequestMetrics(recorder.getRequestType(), node->getAccountId().toString());
 
     // If the returned node is not healthy, then no nodes are healthy and the returned node has the shortest remaining
     // delay. Sleep for the delay period.
     if (!node->isHealthy())
     {
-      std::this_thread::sleep_for(node->getRemainingTimeForBackoff());
+      const std::chrono::system_clock::duration backoff = node->getRemainingTimeForBackoff();
+      nodeMetrics.recordBackoff(backoff);
+      std::this_thread::sleep_for(backoff);
     }
 
-    // Make sure the Node is connected. If it can't connect, mark this Node as unhealthy and try another Node.
-    if (node->channelFailedToConnect())
+    // Skip the Node if it's known to be unreachable, and mark it as unhealthy. This doesn't wait for a Node that is
+    // still connecting, a request sent to it waits for the connection within its deadline.
+    if (node->isChannelUnreachable())
     {
-      mLogger.trace("Failed to connect to node " + node->getAccountId().toString() + " at address " +
-                    node->getAddress().toString() + " on attempt " + std::to_string(attempt));
+      mLogger.trace(
+        [&]()
+        {
+          return "Node " + node->getAccountId().toString() + " at address " + node->getAddress().toString() +
+                 " is unreachable on attempt " + std::to_string(attempt);
+        });
       mLogger.warn(
-        "Retrying in " +
-        std::to_string(
-          std::chrono::duration_cast<std::chrono::milliseconds>(node->getRemainingTimeForBackoff()).count()) +
-        " ms after channel connection failure with node " + node->getAccountId().toString() + " during attempt #" +
-        std::to_string(attempt));
-      node->increaseBackoff();
+        [&]()
+        {
+          return "Retrying in " +
+                 std::to_string(
+                   std::chrono::duration_cast<std::chrono::milliseconds>(node->getRemainingTimeForBackoff()).count()) +
+                 " ms after channel connection failure with node " + node->getAccountId().toString() +
+                 " during attempt #" + std::to_string(attempt);
+        });
+      network->increaseBackoff(node);
       continue;
     }
 
-    // Create the request based on the index of the node being used.
-    ProtoRequestType request = makeRequest(nodeIndex);
-    if (mRequestListener)
-    {
-      request = mRequestListener(request);
-    }
+    // Create the request based on the index of the node being used. It's only copied if a request listener can modify
+    // it.
+    ProtoRequestType listenedRequest;
+    const ProtoRequestType& request = getRequest(nodeIndex, listenedRequest);
 
-    // Submit the request and get the response.
-    ProtoResponseType response;
+    // Submit the request and parse the response on a pooled arena, so that its nested messages aren't allocated one by
+    // one on the heap.
+    const internal::ArenaPool::Lease arena = internal::ArenaPool::getInstance().acquire();
+    ProtoResponseType& response = *google::protobuf::Arena::CreateMessage<ProtoResponseType>(arena.get());
+    nodeMetrics.recordAttempt();
+    const std::chrono::steady_clock::time_point attemptStart = std::chrono::steady_clock::now();
     const grpc::Status status = submitRequest(request, node, attemptTimeout, &response);
+    nodeMetrics.recordGrpcStatus(status.error_code());
+    if (status.ok())
+    {
+      nodeMetrics.recordLatency(getElapsedTime(attemptStart));
+    }
 
-    mLogger.trace("Execute request submitted to node " + node->getAccountId().toString() +
-                  " attempt: " + std::to_string(attempt));
+    mLogger.trace(
+      [&]()
+      {
+        return "Execute request submitted to node " + node->getAccountId().toString() +
+               " attempt: " + std::to_string(attempt);
+      });
 
     // Increase backoff for this node but try submitting again for UNAVAILABLE, RESOURCE_EXHAUSTED, and INTERNAL
     // responses.
@@ -189,7 +417,8 @@ SdkResponseType Executable<SdkRequestType, ProtoRequestType, ProtoResponseType,
                                                                 errorCode == grpc::StatusCode::RESOURCE_EXHAUSTED ||
                                                                 errorCode == grpc::StatusCode::INTERNAL)
     {
-      node->increaseBackoff();
+      network->increaseBackoff(node);
+      nodeMetrics.recordRetry();
       continue;
     }
 
@@ -205,16 +434,25 @@ SdkResponseType Executable<SdkRequestType, ProtoRequestType, ProtoResponseType,
     // Grab and save the response status, and determine what to do next.
     const Status responseStatus = mapResponseStatus(response);
     nodeResponses[node] = responseStatus;
+    nodeMetrics.recordPrecheckStatus(responseStatus);
 
-    mLogger.trace(std::string("Received ") + gStatusToString.at(responseStatus) + " response from node " +
-                  node->getAccountId().toString() + " during attempt #" + std::to_string(attempt));
+    mLogger.trace(
+      [&]()
+      {
+        return std::string("Received ") + gStatusToString.at(responseStatus) + " response from node " +
+               node->getAccountId().toString() + " during attempt #" + std::to_string(attempt);
+      });
 
     switch (determineStatus(responseStatus, client, response))
     {
       case ExecutionStatus::SERVER_ERROR:
       {
-        mLogger.warn("Problem submitting request to node " + node->getAccountId().toString() + " for attempt #" +
-                     std::to_string(attempt) + ", retry with new node: " + gStatusToString.at(responseStatus));
+        mLogger.warn(
+          [&]()
+          {
+            return "Problem submitting request to node " + node->getAccountId().toString() + " for attempt #" +
+                   std::to_string(attempt) + ", retry with new node: " + gStatusToString.at(responseStatus);
+          });
 
         // If all nodes have returned a BUSY signal, backoff (just fallthrough to ExecutionStatus::RETRY case).
         // Otherwise, try the next node.
@@ -223,6 +461,7 @@ SdkResponseType Executable<SdkRequestType, ProtoRequestType, ProtoResponseType,
                          nodeResponses.cend(),
                          [](const auto& nodeAndStatus) { return nodeAndStatus.second == Status::BUSY; }))
         {
+          nodeMetrics.recordRetry();
           continue;
         }
 
@@ -233,11 +472,17 @@ SdkResponseType Executable<SdkRequestType, ProtoRequestType, ProtoResponseType,
       // Response isn't ready yet from the network
       case ExecutionStatus::RETRY:
       {
-        mLogger.warn("Retrying in " +
-                     std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(mCurrentBackoff).count()) +
-                     " ms after failure with node " + node->getAccountId().toString() + " during attempt #" +
-                     std::to_string(attempt));
+        mLogger.warn(
+          [&]()
+          {
+            return "Retrying in " +
+                   std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(mCurrentBackoff).count()) +
+                   " ms after failure with node " + node->getAccountId().toString() + " during attempt #" +
+                   std::to_string(attempt);
+          });
 
+        nodeMetrics.recordRetry();
+        nodeMetrics.recordBackoff(mCurrentBackoff);
         std::this_thread::sleep_for(mCurrentBackoff);
         mCurrentBackoff *= 2.0;
         if (mCurrentBackoff > mCurrentMaxBackoff)
@@ -253,7 +498,9 @@ SdkResponseType Executable<SdkRequestType, ProtoRequestType, ProtoResponseType,
       }
       default:
       {
-        return mapResponse(response);
+        SdkResponseType sdkResponse = mapResponse(response);
+        recorder.succeed();
+        return sdkResponse;
       }
     }
   }
@@ -274,7 +521,16 @@ Executable<SdkRequestType, ProtoRequestType, ProtoResponseType, SdkResponseType>
   const Client& client,
   const std::chrono::system_clock::duration& timeout)
 {
-  return std::async(std::launch::async, [this, &client, &timeout]() { return this->execute(client, timeout); });
+  auto promise = std::make_shared<std::promise<SdkResponseType>>();
+  std::future<SdkResponseType> future = promise->get_future();
+
+  executeAsyncInternal(
+    client,
+    timeout,
+    [promise](const SdkResponseType& response) { promise->set_value(response); },
+    [promise](const std::exception_ptr& exception) { promise->set_exception(exception); });
+
+  return future;
 }
 
 //-----
@@ -293,17 +549,21 @@ void Executable<SdkRequestType, ProtoRequestType, ProtoResponseType, SdkResponse
   const std::chrono::system_clock::duration& timeout,
   const std::function<void(const SdkResponseType&, const std::exception&)>& callback)
 {
-  std::future<SdkResponseType> future =
-    std::async(std::launch::async, [this, &client, &timeout]() { return this->execute(client, timeout); });
-
-  try
-  {
-    callback(future.get(), std::exception());
-  }
-  catch (const std::exception& exception)
-  {
-    callback(SdkResponseType(), exception);
-  }
+  executeAsyncInternal(
+    client,
+    timeout,
+    [callback](const SdkResponseType& response) { callback(response, std::exception()); },
+    [callback](const std::exception_ptr& exception)
+    {
+      try
+      {
+        std::rethrow_exception(exception);
+      }
+      catch (const std::exception& ex)
+      {
+        callback(SdkResponseType(), ex);
+      }
+    });
 }
 
 //-----
@@ -324,17 +584,63 @@ void Executable<SdkRequestType, ProtoRequestType, ProtoResponseType, SdkResponse
   const std::function<void(const SdkResponseType&)>& responseCallback,
   const std::function<void(const std::exception&)>& exceptionCallback)
 {
-  std::future<SdkResponseType> future =
-    std::async(std::launch::async, [this, &client, &timeout]() { return this->execute(client, timeout); });
+  executeAsyncInternal(client,
+                       timeout,
+                       responseCallback,
+                       [exceptionCallback](const std::exception_ptr& exception)
+                       {
+                         try
+                         {
+                           std::rethrow_exception(exception);
+                         }
+                         catch (const std::exception& ex)
+                         {
+                           exceptionCallback(ex);
+                         }
+                       });
+}
+
+//-----
+template<typename SdkRequestType, typename ProtoRequestType, typename ProtoResponseType, typename SdkResponseType>
+void Executable<SdkRequestType, ProtoRequestType, ProtoResponseType, SdkResponseType>::executeAsyncInternal(
+  const Client& client,
+  const std::chrono::system_clock::duration& timeout,
+  const std::function<void(const SdkResponseType&)>& responseCallback,
+  const std::function<void(const std::exception_ptr&)>& exceptionCallback)
+{
+  auto execution = std::make_shared<AsyncExecution>();
+  execution->mResponseCallback = responseCallback;
+  execution->mExceptionCallback = exceptionCallback;
 
   try
   {
-    responseCallback(future.get());
+    if (mLogger.getLogger()->getName() == DEFAULT_LOGGER_NAME)
+    {
+      mLogger = client.getLogger();
+    }
+
+    setExecutionParameters(client);
+
+    // Check for hedging before onExecute(), which may execute this Executable to get its cost.
+    execution->mHedging = isHedgingAllowed(client);
+    execution->mHedgingPercentile = client.getHedgingPercentile();
+    onExecute(client);
+
+    execution->mMetricsRegistry = client.getMetricsRegistry();
+    execution->mRequestType = getRequestType();
+    execution->mClient = &client;
+    execution->mDriver = client.getCompletionQueueDriver();
+    execution->mNetwork = client.getClientNetwork();
+    execution->mNodes = getNodesFromNodeAccountIds(client);
+    execution->mTimeoutTime = std::chrono::system_clock::now() + timeout;
   }
-  catch (const std::exception& exception)
+  catch (...)
   {
-    exceptionCallback(exception);
+    execution->fail(std::current_exception());
+    return;
   }
+
+  startAsyncAttempt(execution);
 }
 
 //-----
@@ -443,6 +749,25 @@ Executable<SdkRequestType, ProtoRequestType, ProtoResponseType, SdkResponseType>
   }
 }
 
+//-----
+template<typename SdkRequestType, typename ProtoRequestType, typename ProtoResponseType, typename SdkResponseType>
+void Executable<SdkRequestType, ProtoRequestType, ProtoResponseType, SdkResponseType>::determineStatusAsync(
+  Status status,
+  const Client& client,
+  const ProtoResponseType& response,
+  const std::function<void(ExecutionStatus, const ProtoResponseType&)>& callback)
+{
+  callback(determineStatus(status, client, response), response);
+}
+
+//-----
+template<typename SdkRequestType, typename ProtoRequestType, typename ProtoResponseType, typename SdkResponseType>
+bool Executable<SdkRequestType, ProtoRequestType, ProtoResponseType, SdkResponseType>::isHedgingAllowed(
+  const Client&) const
+{
+  return false;
+}
+
 //-----
 template<typename SdkRequestType, typename ProtoRequestType, typename ProtoResponseType, typename SdkResponseType>
 void Executable<SdkRequestType, ProtoRequestType, ProtoResponseType, SdkResponseType>::setExecutionParameters(
@@ -461,6 +786,7 @@ void Executable<SdkRequestType, ProtoRequestType, ProtoResponseType, SdkResponse
   mCurrentGrpcDeadline = mGrpcDeadline.has_value()              ? mGrpcDeadline.value()
                          : client.getGrpcDeadline().has_value() ? client.getGrpcDeadline().value()
                                                                 : DEFAULT_GRPC_DEADLINE;
+  mCurrentNodeSelectionPolicy = client.getNodeSelectionPolicy();
   mMirrorNodeIds = client.getMirrorNetwork();
 }
 
@@ -516,6 +842,34 @@ unsigned int Executable<SdkRequestType, ProtoRequestType, ProtoResponseType, Sdk
   const std::vector<std::shared_ptr<internal::Node>>& nodes,
   unsigned int attempt) const
 {
+  // The nodes are already in random order, so only the other policies have to choose the node for the first attempt.
+  if (attempt == 0U && mCurrentNodeSelectionPolicy != NodeSelectionPolicy::RANDOM)
+  {
+    std::vector<std::shared_ptr<internal::Node>> healthyNodes;
+    std::vector<unsigned int> healthyNodeIndices;
+    for (unsigned int i = 0U; i < nodes.size(); ++i)
+    {
+      if (nodes.at(i)->isHealthy())
+      {
+        healthyNodes.push_back(nodes.at(i));
+        healthyNodeIndices.push_back(i);
+      }
+    }
+
+    if (!healthyNodes.empty())
+    {
+      const unsigned int nodeIndex = healthyNodeIndices.at(
+        internal::NodeSelector::selectNode(mCurrentNodeSelectionPolicy, healthyNodes, healthyNodes.size()));
+      mLogger.trace(
+        [&]()
+        {
+          return "Using node " + nodes.at(nodeIndex)->getAccountId().toString() + " for request #" +
+                 std::to_string(attempt);
+        });
+      return nodeIndex;
+    }
+  }
+
   // Keep track of the best candidate node and its delay (initialize to make compiler happy, but this should never be
   // returned without being provided an actual legitimate value).
   unsigned int candidateNodeIndex = -1U;
@@ -539,17 +893,487 @@ unsigned int Executable<SdkRequestType, ProtoRequestType, ProtoResponseType, Sdk
     // If this node is healthy, then its usable.
     else
     {
-      mLogger.trace("Using node " + node->getAccountId().toString() + " for request #" + std::to_string(attempt));
+      mLogger.trace(
+        [&]() { return "Using node " + node->getAccountId().toString() + " for request #" + std::to_string(attempt); });
       return i;
     }
   }
 
   // No nodes are healthy, return the index of the one with the smallest delay.
-  mLogger.trace("Using node " + nodes.at(candidateNodeIndex)->getAccountId().toString() + " for request #" +
-                std::to_string(attempt));
+  mLogger.trace(
+    [&]()
+    {
+      return "Using node " + nodes.at(candidateNodeIndex)->getAccountId().toString() + " for request #" +
+             std::to_string(attempt);
+    });
   return candidateNodeIndex;
 }
 
+//-----
+template<typename SdkRequestType, typename ProtoRequestType, typename ProtoResponseType, typename SdkResponseType>
+const ProtoRequestType& Executable<SdkRequestType, ProtoRequestType, ProtoResponseType, SdkResponseType>::getRequest(
+  unsigned int index,
+  ProtoRequestType& listened) const
+{
+  const ProtoRequestType& request = makeRequest(index);
+  if (!mRequestListener)
+  {
+    return request;
+  }
+
+  ProtoRequestType copy = request;
+  listened = mRequestListener(copy);
+  return listened;
+}
+
+//-----
+template<typename SdkRequestType, typename ProtoRequestType, typename ProtoResponseType, typename SdkResponseType>
+void Executable<SdkRequestType, ProtoRequestType, ProtoResponseType, SdkResponseType>::startAsyncAttempt(
+  const std::shared_ptr<AsyncExecution>& execution)
+{
+  try
+  {
+    if (execution->mAttempt >= mCurrentMaxAttempts)
+    {
+      throw MaxAttemptsExceededException(
+        "Max number of attempts made (max attempts allowed: " + std::to_string(mCurrentMaxAttempts) + ')');
+    }
+
+    const unsigned int nodeIndex = getNodeIndexForExecute(execution->mNodes, execution->mAttempt);
+    const std::shared_ptr<internal::Node>& node = execution->mNodes.at(nodeIndex);
+
+    // If the returned node is not healthy, then no nodes are healthy and the returned node has the shortest remaining
+    // delay. Wait for the delay period without holding a thread. Connection failures are not waited for either, they
+    // come back as an UNAVAILABLE status of the submission.
+    if (!node->isHealthy())
+    {
+      const std::chrono::system_clock::duration backoff = node->getRemainingTimeForBackoff();
+      execution->getNodeMetrics(node).recordBackoff(backoff);
+      continueAsyncAt(execution,
+                      std::chrono::system_clock::now() + backoff,
+                      [this, execution, nodeIndex]() { submitAsyncAttempt(execution, nodeIndex); });
+      return;
+    }
+
+    // Skip the node right away if it's known to be unreachable, and mark it as unhealthy.
+    if (node->isChannelUnreachable())
+    {
+      mLogger.trace(
+        [&]()
+        {
+          return "Node " + node->getAccountId().toString() + " is unreachable on attempt " +
+                 std::to_string(execution->mAttempt);
+        });
+      execution->mNetwork->increaseBackoff(node);
+      ++execution->mAttempt;
+      startAsyncAttempt(execution);
+      return;
+    }
+
+    submitAsyncAttempt(execution, nodeIndex);
+  }
+  catch (...)
+  {
+    execution->fail(std::current_exception());
+  }
+}
+
+//-----
+template<typename SdkRequestType, typename ProtoRequestType, typename ProtoResponseType, typename SdkResponseType>
+void Executable<SdkRequestType, ProtoRequestType, ProtoResponseType, SdkResponseType>::submitAsyncAttempt(
+  const std::shared_ptr<AsyncExecution>& execution,
+  unsigned int nodeIndex)
+{
+  try
+  {
+    const std::shared_ptr<internal::Node> node = execution->mNodes.at(nodeIndex);
+
+    // Get the timeout for the current attempt.
+    std::chrono::system_clock::time_point attemptTimeout = std::chrono::system_clock::now() + mCurrentGrpcDeadline;
+    if (attemptTimeout > execution->mTimeoutTime)
+    {
+      attemptTimeout = execution->mTimeoutTime;
+    }
+
+    // Hedge the attempt if there's another node to hedge to. The attempt is hedged once the node has taken longer to
+    // respond than the hedging percentile of its recent response times.
+    if (execution->mHedging && execution->mNodes.size() > 1)
+    {
+      const internal::NodeStats& stats = node->getStats();
+      std::chrono::nanoseconds delay = stats.getLatencyPercentile(execution->mHedgingPercentile);
+      if (delay == std::chrono::nanoseconds(0))
+      {
+        delay = stats.getAverageLatency();
+      }
+
+      auto attempt = std::make_shared<HedgedAttempt>();
+      attempt->mDeadline = attemptTimeout;
+      execution->mAttemptStart = std::chrono::steady_clock::now();
+      const std::chrono::system_clock::time_point hedgeTime =
+        std::chrono::system_clock::now() +
+        std::max(std::chrono::duration_cast<std::chrono::system_clock::duration>(delay),
+                 std::chrono::duration_cast<std::chrono::system_clock::duration>(DEFAULT_MIN_HEDGING_DELAY));
+
+      // Hold the lock while submitting, so that the submission can't complete before it's recorded in the attempt.
+      std::unique_lock lock(attempt->mMutex);
+      submitHedgedAttempt(execution, attempt, nodeIndex);
+      if (hedgeTime < attemptTimeout)
+      {
+        // If the driver has been shut down, the submission is cancelled as well and fails the attempt.
+        execution->mDriver->schedule(hedgeTime,
+                                     [this, execution, attempt](bool ok)
+                                     {
+                                       if (ok)
+                                       {
+                                         hedgeAsyncAttempt(execution, attempt);
+                                       }
+                                     });
+      }
+
+      return;
+    }
+
+    // Create the request based on the index of the node being used. It's only copied if a request listener can modify
+    // it.
+    ProtoRequestType listenedRequest;
+    const ProtoRequestType& request = getRequest(nodeIndex, listenedRequest);
+
+    mLogger.trace(
+      [&]()
+      {
+        return "Execute request submitted to node " + node->getAccountId().toString() +
+               " attempt: " + std::to_string(execution->mAttempt);
+      });
+
+    execution->getNodeMetrics(node).recordAttempt();
+    execution->mAttemptStart = std::chrono::steady_clock::now();
+
+    // Nothing of this Executable may be touched once the submission has started, since its response can complete the
+    // execution at any time.
+    if (!submitRequestAsync(request,
+                            node,
+                            attemptTimeout,
+                            *execution->mDriver,
+                            [this, execution, node](const grpc::Status& status, const ProtoResponseType& response)
+                            { handleAsyncResponse(execution, node, status, response); },
+                            nullptr))
+    {
+      throw IllegalStateException("Client was closed before the request could be submitted");
+    }
+  }
+  catch (...)
+  {
+    execution->fail(std::current_exception());
+  }
+}
+
+//-----
+template<typename SdkRequestType, typename ProtoRequestType, typename ProtoResponseType, typename SdkResponseType>
+void Executable<SdkRequestType, ProtoRequestType, ProtoResponseType, SdkResponseType>::submitHedgedAttempt(
+  const std::shared_ptr<AsyncExecution>& execution,
+  const std::shared_ptr<HedgedAttempt>& attempt,
+  unsigned int nodeIndex)
+{
+  const std::shared_ptr<internal::Node> node = execution->mNodes.at(nodeIndex);
+
+  // Create the request based on the index of the node being used. For paid requests, this creates a payment for the
+  // node being used.
+  ProtoRequestType listenedRequest;
+  const ProtoRequestType& request = getRequest(nodeIndex, listenedRequest);
+
+  mLogger.trace(
+    [&]()
+    {
+      return "Execute request submitted to node " + node->getAccountId().toString() +
+             " attempt: " + std::to_string(execution->mAttempt) +
+             (attempt->mNodeIndices.empty() ? std::string() : std::string(" (hedged)"));
+    });
+
+  execution->getNodeMetrics(node).recordAttempt();
+  auto context = std::make_shared<grpc::ClientContext>();
+  if (!submitRequestAsync(
+        request,
+        node,
+        attempt->mDeadline,
+        *execution->mDriver,
+        [this, execution, attempt, node](const grpc::Status& status, const ProtoResponseType& response)
+        { handleHedgedResponse(execution, attempt, node, status, response); },
+        context))
+  {
+    throw IllegalStateException("Client was closed before the request could be submitted");
+  }
+
+  attempt->mNodeIndices.push_back(nodeIndex);
+  attempt->mContexts.push_back(context);
+  ++attempt->mOutstanding;
+}
+
+//-----
+template<typename SdkRequestType, typename ProtoRequestType, typename ProtoResponseType, typename SdkResponseType>
+void Executable<SdkRequestType, ProtoRequestType, ProtoResponseType, SdkResponseType>::hedgeAsyncAttempt(
+  const std::shared_ptr<AsyncExecution>& execution,
+  const std::shared_ptr<HedgedAttempt>& attempt)
+{
+  std::unique_lock lock(attempt->mMutex);
+  if (attempt->mDecided)
+  {
+    return;
+  }
+
+  // Hedge to the next healthy node after the one the attempt was first submitted to.
+  for (unsigned int i = 1U; i < execution->mNodes.size(); ++i)
+  {
+    const auto nodeIndex = static_cast<unsigned int>((attempt->mNodeIndices.front() + i) % execution->mNodes.size());
+    const std::shared_ptr<internal::Node>& node = execution->mNodes.at(nodeIndex);
+    if (std::find(attempt->mNodeIndices.cbegin(), attempt->mNodeIndices.cend(), nodeIndex) !=
+          attempt->mNodeIndices.cend() ||
+        !node->isHealthy() || node->isChannelUnreachable())
+    {
+      continue;
+    }
+
+    // A hedge that can't be submitted is simply skipped, the first submission is still in flight.
+    try
+    {
+      submitHedgedAttempt(execution, attempt, nodeIndex);
+    }
+    catch (const std::exception& ex)
+    {
+      mLogger.warn(
+        [&]() { return "Unable to hedge request to node " + node->getAccountId().toString() + ": " + ex.what(); });
+    }
+
+    return;
+  }
+}
+
+//-----
+template<typename SdkRequestType, typename ProtoRequestType, typename ProtoResponseType, typename SdkResponseType>
+void Executable<SdkRequestType, ProtoRequestType, ProtoResponseType, SdkResponseType>::handleHedgedResponse(
+  const std::shared_ptr<AsyncExecution>& execution,
+  const std::shared_ptr<HedgedAttempt>& attempt,
+  const std::shared_ptr<internal::Node>& node,
+  const grpc::Status& status,
+  const ProtoResponseType& response)
+{
+  std::vector<std::shared_ptr<grpc::ClientContext>> contexts;
+
+  {
+    std::unique_lock lock(attempt->mMutex);
+    --attempt->mOutstanding;
+    if (attempt->mDecided)
+    {
+      return;
+    }
+
+    // A submission that didn't get a response only decides the attempt if it's the last one in flight. Otherwise, mark
+    // its node as unhealthy the same way the attempt would, and wait for the other submissions.
+    if (!status.ok() && attempt->mOutstanding > 0U)
+    {
+      execution->getNodeMetrics(node).recordGrpcStatus(status.error_code());
+      if (const grpc::StatusCode errorCode = status.error_code(); errorCode == grpc::StatusCode::UNAVAILABLE ||
+                                                                  errorCode == grpc::StatusCode::RESOURCE_EXHAUSTED ||
+                                                                  errorCode == grpc::StatusCode::INTERNAL)
+      {
+        execution->mNetwork->increaseBackoff(node);
+      }
+
+      return;
+    }
+
+    attempt->mDecided = true;
+    contexts = attempt->mContexts;
+  }
+
+  // Cancel the submissions that lost. Cancelling the deciding submission does nothing, as it has already completed.
+  for (const std::shared_ptr<grpc::ClientContext>& context : contexts)
+  {
+    context->TryCancel();
+  }
+
+  // The execution continues with only this submission, as if the attempt had not been hedged.
+  handleAsyncResponse(execution, node, status, response);
+}
+
+//-----
+template<typename SdkRequestType, typename ProtoRequestType, typename ProtoResponseType, typename SdkResponseType>
+void Executable<SdkRequestType, ProtoRequestType, ProtoResponseType, SdkResponseType>::handleAsyncResponse(
+  const std::shared_ptr<AsyncExecution>& execution,
+  const std::shared_ptr<internal::Node>& node,
+  const grpc::Status& status,
+  const ProtoResponseType& response)
+{
+  try
+  {
+    const unsigned int attempt = execution->mAttempt;
+    internal::MetricsRegistry::NodeRequestMetrics& nodeMetrics = execution->getNodeMetrics(node);
+    nodeMetrics.recordGrpcStatus(status.error_code());
+    if (status.ok())
+    {
+      nodeMetrics.recordLatency(getElapsedTime(execution->mAttemptStart));
+    }
+
+    // Increase backoff for this node but try submitting again for UNAVAILABLE, RESOURCE_EXHAUSTED, and INTERNAL
+    // responses.
+    if (const grpc::StatusCode errorCode = status.error_code(); errorCode == grpc::StatusCode::UNAVAILABLE ||
+                                                                errorCode == grpc::StatusCode::RESOURCE_EXHAUSTED ||
+                                                                errorCode == grpc::StatusCode::INTERNAL)
+    {
+      execution->mNetwork->increaseBackoff(node);
+      nodeMetrics.recordRetry();
+      ++execution->mAttempt;
+      startAsyncAttempt(execution);
+      return;
+    }
+
+    // Successful submission, so decrease backoff for this node.
+    node->decreaseBackoff();
+
+    // Call the response callback if one exists. Only copy the response if it's needed.
+    const ProtoResponseType* finalResponse = &response;
+    ProtoResponseType listenedResponse;
+    if (mResponseListener)
+    {
+      listenedResponse = response;
+      listenedResponse = mResponseListener(listenedResponse);
+      finalResponse = &listenedResponse;
+    }
+
+    // Grab and save the response status, and determine what to do next.
+    const Status responseStatus = mapResponseStatus(*finalResponse);
+    execution->mNodeResponses[node] = responseStatus;
+    nodeMetrics.recordPrecheckStatus(responseStatus);
+
+    mLogger.trace(
+      [&]()
+      {
+        return std::string("Received ") + gStatusToString.at(responseStatus) + " response from node " +
+               node->getAccountId().toString() + " during attempt #" + std::to_string(attempt);
+      });
+
+    // The status may take another request to determine, in which case the execution continues once it has completed.
+    determineStatusAsync(
+      responseStatus,
+      *execution->mClient,
+      *finalResponse,
+      [this, execution, node, responseStatus](ExecutionStatus executionStatus, const ProtoResponseType& decidedResponse)
+      { continueAsyncExecution(execution, node, responseStatus, executionStatus, decidedResponse); });
+  }
+  catch (...)
+  {
+    execution->fail(std::current_exception());
+  }
+}
+
+//-----
+template<typename SdkRequestType, typename ProtoRequestType, typename ProtoResponseType, typename SdkResponseType>
+void Executable<SdkRequestType, ProtoRequestType, ProtoResponseType, SdkResponseType>::continueAsyncExecution(
+  const std::shared_ptr<AsyncExecution>& execution,
+  const std::shared_ptr<internal::Node>& node,
+  Status responseStatus,
+  ExecutionStatus executionStatus,
+  const ProtoResponseType& response)
+{
+  try
+  {
+    const unsigned int attempt = execution->mAttempt;
+    internal::MetricsRegistry::NodeRequestMetrics& nodeMetrics = execution->getNodeMetrics(node);
+
+    switch (executionStatus)
+    {
+      case ExecutionStatus::SERVER_ERROR:
+      {
+        mLogger.warn(
+          [&]()
+          {
+            return "Problem submitting request to node " + node->getAccountId().toString() + " for attempt #" +
+                   std::to_string(attempt) + ", retry with new node: " + gStatusToString.at(responseStatus);
+          });
+
+        // If all nodes have returned a BUSY signal, backoff (just fallthrough to ExecutionStatus::RETRY case).
+        // Otherwise, try the next node.
+        if (execution->mNodeResponses.size() != execution->mNodes.size() ||
+            !std::all_of(execution->mNodeResponses.cbegin(),
+                         execution->mNodeResponses.cend(),
+                         [](const auto& nodeAndStatus) { return nodeAndStatus.second == Status::BUSY; }))
+        {
+          nodeMetrics.recordRetry();
+          ++execution->mAttempt;
+          startAsyncAttempt(execution);
+          return;
+        }
+
+        // If all nodes have returned BUSY, clear the responses.
+        execution->mNodeResponses.clear();
+        [[fallthrough]];
+      }
+      // Response isn't ready yet from the network
+      case ExecutionStatus::RETRY:
+      {
+        mLogger.warn(
+          [&]()
+          {
+            return "Retrying in " +
+                   std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(mCurrentBackoff).count()) +
+                   " ms after failure with node " + node->getAccountId().toString() + " during attempt #" +
+                   std::to_string(attempt);
+          });
+
+        nodeMetrics.recordRetry();
+        nodeMetrics.recordBackoff(mCurrentBackoff);
+        const std::chrono::system_clock::time_point retryTime = std::chrono::system_clock::now() + mCurrentBackoff;
+        mCurrentBackoff *= 2.0;
+        if (mCurrentBackoff > mCurrentMaxBackoff)
+        {
+          mCurrentBackoff = mCurrentMaxBackoff;
+        }
+
+        ++execution->mAttempt;
+        continueAsyncAt(execution, retryTime, [this, execution]() { startAsyncAttempt(execution); });
+        return;
+      }
+      case ExecutionStatus::REQUEST_ERROR:
+      {
+        throw PrecheckStatusException(responseStatus, getTransactionIdInternal());
+      }
+      default:
+      {
+        execution->succeed(mapResponse(response));
+        return;
+      }
+    }
+  }
+  catch (...)
+  {
+    execution->fail(std::current_exception());
+  }
+}
+
+//-----
+template<typename SdkRequestType, typename ProtoRequestType, typename ProtoResponseType, typename SdkResponseType>
+void Executable<SdkRequestType, ProtoRequestType, ProtoResponseType, SdkResponseType>::continueAsyncAt(
+  const std::shared_ptr<AsyncExecution>& execution,
+  const std::chrono::system_clock::time_point& time,
+  const std::function<void()>& continuation)
+{
+  if (!execution->mDriver->schedule(time,
+                                    [execution, continuation](bool ok)
+                                    {
+                                      if (ok)
+                                      {
+                                        continuation();
+                                      }
+                                      else
+                                      {
+                                        execution->fail(std::make_exception_ptr(
+                                          IllegalStateException("Client was closed before the request completed")));
+                                      }
+                                    }))
+  {
+    throw IllegalStateException("Client was closed before the request completed");
+  }
+}
+
 /**
  * Explicit template instantiations.
  */
@@ -90,7 +90,7 @@ void FileAppendTransaction::addToChunk(uint32_t chunk, uint32_t, proto::Transact
 //-----
 void FileAppendTransaction::initFromSourceTransactionBody()
 {
-  const proto::TransactionBody transactionBody = getSourceTransactionBody();
+  const proto::TransactionBody& transactionBody = getSourceTransactionBody();
 
   if (!transactionBody.has_fileappend())
   {
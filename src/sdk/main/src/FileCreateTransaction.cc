@@ -106,7 +106,7 @@ void FileCreateTransaction::addToBody(proto::TransactionBody& body) const
 //-----
 void FileCreateTransaction::initFromSourceTransactionBody()
 {
-  const proto::TransactionBody transactionBody = getSourceTransactionBody();
+  const proto::TransactionBody& transactionBody = getSourceTransactionBody();
 
   if (!transactionBody.has_filecreate())
   {
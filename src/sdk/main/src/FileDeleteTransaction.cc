@@ -56,7 +56,7 @@ void FileDeleteTransaction::addToBody(proto::TransactionBody& body) const
 //-----
 void FileDeleteTransaction::initFromSourceTransactionBody()
 {
-  const proto::TransactionBody transactionBody = getSourceTransactionBody();
+  const proto::TransactionBody& transactionBody = getSourceTransactionBody();
 
   if (!transactionBody.has_filedelete())
   {
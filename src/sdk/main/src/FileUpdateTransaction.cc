@@ -107,7 +107,7 @@ void FileUpdateTransaction::addToBody(proto::TransactionBody& body) const
 //-----
 void FileUpdateTransaction::initFromSourceTransactionBody()
 {
-  const proto::TransactionBody transactionBody = getSourceTransactionBody();
+  const proto::TransactionBody& transactionBody = getSourceTransactionBody();
 
   if (!transactionBody.has_fileupdate())
   {
@@ -85,7 +85,7 @@ void FreezeTransaction::addToBody(proto::TransactionBody& body) const
 //-----
 void FreezeTransaction::initFromSourceTransactionBody()
 {
-  const proto::TransactionBody transactionBody = getSourceTransactionBody();
+  const proto::TransactionBody& transactionBody = getSourceTransactionBody();
 
   if (!transactionBody.has_freeze())
   {
@@ -55,6 +55,31 @@ void Logger::error(std::string_view message) const
   }
 }
 
+//-----
+bool Logger::isEnabled(LoggingLevel level) const
+{
+  if (mCurrentLevel == LoggingLevel::SILENT || !mLogger)
+  {
+    return false;
+  }
+
+  switch (level)
+  {
+    case LoggingLevel::TRACE:
+      return mLogger->isTraceEnabled();
+    case LoggingLevel::DEBUG:
+      return mLogger->isDebugEnabled();
+    case LoggingLevel::INFO:
+      return mLogger->isInfoEnabled();
+    case LoggingLevel::WARN:
+      return mLogger->isWarnEnabled();
+    case LoggingLevel::ERROR:
+      return mLogger->isErrorEnabled();
+    default:
+      return false;
+  }
+}
+
 //-----
 Logger& Logger::setLogger(const log4cxx::LoggerPtr& logger)
 {
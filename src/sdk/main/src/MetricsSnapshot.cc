@@ -0,0 +1,204 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "MetricsSnapshot.h"
+#include "impl/LatencyHistogram.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <sstream>
+
+namespace Hiero
+{
+namespace
+{
+// Helper function used to write a duration as a number of seconds, exactly.
+std::string toSeconds(const std::chrono::nanoseconds& duration)
+{
+  const std::int64_t count = std::max(duration.count(), static_cast<std::int64_t>(0));
+  const std::string nanos = std::to_string(count % 1000000000LL);
+  return std::to_string(count / 1000000000LL) + '.' + std::string(9ULL - nanos.size(), '0') + nanos;
+}
+
+// Helper function used to escape the value of a Prometheus label.
+std::string escapeLabel(const std::string& value)
+{
+  std::string escaped;
+  escaped.reserve(value.size());
+  for (const char character : value)
+  {
+    switch (character)
+    {
+      case '\\':
+        escaped += "\\\\";
+        break;
+      case '"':
+        escaped += "\\\"";
+        break;
+      case '\n':
+        escaped += "\\n";
+        break;
+      default:
+        escaped += character;
+    }
+  }
+
+  return escaped;
+}
+
+// Helper function used to write the header of a Prometheus metric.
+void writeHeader(std::ostream& os, const std::string& name, const std::string& type, const std::string& help)
+{
+  os << "# HELP " << name << ' ' << help << '\n' << "# TYPE " << name << ' ' << type << '\n';
+}
+
+// Helper function used to write a Prometheus histogram, with a bucket for each power of two.
+void writeHistogram(std::ostream& os,
+                    const std::string& name,
+                    const std::string& labels,
+                    const MetricsSnapshot::Histogram& histogram)
+{
+  auto bucket = histogram.mBuckets.cbegin();
+  std::uint64_t cumulative = 0ULL;
+  for (unsigned int exponent = internal::LatencyHistogram::MIN_EXPONENT;
+       exponent <= internal::LatencyHistogram::MAX_EXPONENT;
+       ++exponent)
+  {
+    const std::chrono::nanoseconds bound(1LL << exponent);
+    for (; bucket != histogram.mBuckets.cend() && bucket->first <= bound; ++bucket)
+    {
+      cumulative += bucket->second;
+    }
+
+    os << name << "_bucket{" << labels << ",le=\"" << toSeconds(bound) << "\"} " << cumulative << '\n';
+  }
+
+  os << name << "_bucket{" << labels << ",le=\"+Inf\"} " << histogram.mCount << '\n';
+  os << name << "_sum{" << labels << "} " << toSeconds(histogram.mSum) << '\n';
+  os << name << "_count{" << labels << "} " << histogram.mCount << '\n';
+}
+
+} // namespace
+
+//-----
+std::chrono::nanoseconds MetricsSnapshot::Histogram::getPercentile(double percentile) const
+{
+  if (mCount == 0ULL)
+  {
+    return std::chrono::nanoseconds(0);
+  }
+
+  // The rank of the percentile among the durations, counting from 1.
+  const std::uint64_t rank = std::max<std::uint64_t>(
+    static_cast<std::uint64_t>(std::ceil(std::clamp(percentile, 0.0, 100.0) / 100.0 * static_cast<double>(mCount))),
+    1ULL);
+  std::uint64_t seen = 0ULL;
+  for (const auto& [upperBound, count] : mBuckets)
+  {
+    seen += count;
+    if (seen >= rank)
+    {
+      return upperBound;
+    }
+  }
+
+  return mBuckets.empty() ? std::chrono::nanoseconds(0) : mBuckets.back().first;
+}
+
+//-----
+std::string MetricsSnapshot::toPrometheus() const
+{
+  std::ostringstream os;
+
+  writeHeader(os, "hiero_sdk_requests_total", "counter", "Executions of requests, by request type and outcome.");
+  for (const RequestMetrics& request : mRequests)
+  {
+    const std::string labels = "request_type=\"" + escapeLabel(request.mRequestType) + '"';
+    os << "hiero_sdk_requests_total{" << labels << ",outcome=\"success\"} " << request.mSucceeded << '\n';
+    os << "hiero_sdk_requests_total{" << labels << ",outcome=\"failure\"} " << request.mFailed << '\n';
+  }
+
+  writeHeader(os,
+              "hiero_sdk_request_duration_seconds",
+              "histogram",
+              "End-to-end latency of the executions of requests, by request type.");
+  for (const RequestMetrics& request : mRequests)
+  {
+    writeHistogram(os,
+                   "hiero_sdk_request_duration_seconds",
+                   "request_type=\"" + escapeLabel(request.mRequestType) + '"',
+                   request.mLatency);
+  }
+
+  // The samples of a metric must follow its header, so each metric is written in its own pass over the nodes.
+  std::vector<std::string> labels;
+  labels.reserve(mNodeRequests.size());
+  for (const NodeRequestMetrics& request : mNodeRequests)
+  {
+    labels.push_back("request_type=\"" + escapeLabel(request.mRequestType) + "\",node=\"" + escapeLabel(request.mNode) +
+                     '"');
+  }
+
+  writeHeader(os, "hiero_sdk_attempts_total", "counter", "Attempts submitted to nodes, by request type and node.");
+  for (std::size_t i = 0ULL; i < mNodeRequests.size(); ++i)
+  {
+    os << "hiero_sdk_attempts_total{" << labels.at(i) << "} " << mNodeRequests.at(i).mAttempts << '\n';
+  }
+
+  writeHeader(os, "hiero_sdk_grpc_status_total", "counter", "gRPC status codes of attempts, by request type and node.");
+  for (std::size_t i = 0ULL; i < mNodeRequests.size(); ++i)
+  {
+    for (const auto& [code, count] : mNodeRequests.at(i).mGrpcStatuses)
+    {
+      os << "hiero_sdk_grpc_status_total{" << labels.at(i) << ",code=\"" << code << "\"} " << count << '\n';
+    }
+  }
+
+  writeHeader(
+    os, "hiero_sdk_precheck_status_total", "counter", "Precheck statuses of responses, by request type and node.");
+  for (std::size_t i = 0ULL; i < mNodeRequests.size(); ++i)
+  {
+    for (const auto& [status, count] : mNodeRequests.at(i).mPrecheckStatuses)
+    {
+      os << "hiero_sdk_precheck_status_total{" << labels.at(i) << ",status=\"" << gStatusToString.at(status) << "\"} "
+         << count << '\n';
+    }
+  }
+
+  writeHeader(os, "hiero_sdk_retries_total", "counter", "Attempts after which a request was retried.");
+  for (std::size_t i = 0ULL; i < mNodeRequests.size(); ++i)
+  {
+    os << "hiero_sdk_retries_total{" << labels.at(i) << "} " << mNodeRequests.at(i).mRetries << '\n';
+  }
+
+  writeHeader(os, "hiero_sdk_backoffs_total", "counter", "Sleeps of requests before being submitted again.");
+  for (std::size_t i = 0ULL; i < mNodeRequests.size(); ++i)
+  {
+    os << "hiero_sdk_backoffs_total{" << labels.at(i) << "} " << mNodeRequests.at(i).mBackoffs << '\n';
+  }
+
+  writeHeader(os, "hiero_sdk_backoff_seconds_total", "counter", "Time requests slept before being submitted again.");
+  for (std::size_t i = 0ULL; i < mNodeRequests.size(); ++i)
+  {
+    os << "hiero_sdk_backoff_seconds_total{" << labels.at(i) << "} " << toSeconds(mNodeRequests.at(i).mBackoffTime)
+       << '\n';
+  }
+
+  writeHeader(os,
+              "hiero_sdk_attempt_duration_seconds",
+              "histogram",
+              "Latency of the attempts answered by nodes, by request type and node.");
+  for (std::size_t i = 0ULL; i < mNodeRequests.size(); ++i)
+  {
+    writeHistogram(os, "hiero_sdk_attempt_duration_seconds", labels.at(i), mNodeRequests.at(i).mLatency);
+  }
+
+  writeHeader(os, "hiero_sdk_node_backoffs_total", "counter", "Times a consensus node was backed off from, by node.");
+  for (const auto& [node, count] : mNodeBackoffs)
+  {
+    os << "hiero_sdk_node_backoffs_total{node=\"" << escapeLabel(node) << "\"} " << count << '\n';
+  }
+
+  return os.str();
+}
+
+} // namespace Hiero
@@ -6,8 +6,7 @@
 #include "exceptions/OpenSSLException.h"
 #include "impl/DerivationPathUtils.h"
 #include "impl/Utilities.h"
-#include "impl/openssl_utils/EVP_MD.h"
-#include "impl/openssl_utils/EVP_MD_CTX.h"
+#include "impl/openssl_utils/CryptoContext.h"
 #include "impl/openssl_utils/OpenSSLUtils.h"
 
 #include <openssl/evp.h>
@@ -108,23 +107,6 @@ std::unique_ptr<PrivateKey> MnemonicBIP39::toStandardECDSAsecp256k1PrivateKey(st
 //-----
 std::vector<std::byte> MnemonicBIP39::toSeed(std::string_view passphrase) const
 {
-  internal::OpenSSLUtils::EVP_MD_CTX messageDigestContext(EVP_MD_CTX_new());
-  if (!messageDigestContext)
-  {
-    throw OpenSSLException(internal::OpenSSLUtils::getErrorMessage("EVP_MD_CTX_new"));
-  }
-
-  const internal::OpenSSLUtils::EVP_MD messageDigest(EVP_MD_fetch(nullptr, "SHA512", nullptr));
-  if (!messageDigest)
-  {
-    throw OpenSSLException(internal::OpenSSLUtils::getErrorMessage("EVP_MD_fetch"));
-  }
-
-  if (EVP_DigestInit(messageDigestContext.get(), messageDigest.get()) <= 0)
-  {
-    throw OpenSSLException(internal::OpenSSLUtils::getErrorMessage("EVP_DigestInit"));
-  }
-
   std::vector<std::byte> seed(SEED_SIZE);
 
   const std::string mnemonicString = toString();
@@ -136,7 +118,7 @@ std::vector<std::byte> MnemonicBIP39::toSeed(std::string_view passphrase) const
                         internal::Utilities::toTypePtr<unsigned char>(salt.data()),
                         static_cast<int>(salt.size()),
                         SEED_ITERATIONS,
-                        messageDigest.get(),
+                        internal::OpenSSLUtils::CryptoContext::getInstance().getSHA512(),
                         static_cast<int>(seed.size()),
                         internal::Utilities::toTypePtr<unsigned char>(seed.data())) <= 0)
   {
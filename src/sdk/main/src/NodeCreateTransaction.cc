@@ -107,7 +107,7 @@ void NodeCreateTransaction::addToBody(proto::TransactionBody& body) const
 //-----
 void NodeCreateTransaction::initFromSourceTransactionBody()
 {
-  const proto::TransactionBody transactionBody = getSourceTransactionBody();
+  const proto::TransactionBody& transactionBody = getSourceTransactionBody();
 
   if (!transactionBody.has_nodecreate())
   {
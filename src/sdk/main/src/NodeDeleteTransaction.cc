@@ -58,7 +58,7 @@ void NodeDeleteTransaction::addToBody(proto::TransactionBody& body) const
 //-----
 void NodeDeleteTransaction::initFromSourceTransactionBody()
 {
-  const proto::TransactionBody transactionBody = getSourceTransactionBody();
+  const proto::TransactionBody& transactionBody = getSourceTransactionBody();
 
   if (!transactionBody.has_nodedelete())
   {
@@ -115,7 +115,7 @@ void NodeUpdateTransaction::addToBody(proto::TransactionBody& body) const
 //-----
 void NodeUpdateTransaction::initFromSourceTransactionBody()
 {
-  const proto::TransactionBody transactionBody = getSourceTransactionBody();
+  const proto::TransactionBody& transactionBody = getSourceTransactionBody();
 
   if (!transactionBody.has_nodeupdate())
   {
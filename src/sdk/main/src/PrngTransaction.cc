@@ -55,7 +55,7 @@ void PrngTransaction::addToBody(proto::TransactionBody& body) const
 //-----
 void PrngTransaction::initFromSourceTransactionBody()
 {
-  const proto::TransactionBody transactionBody = getSourceTransactionBody();
+  const proto::TransactionBody& transactionBody = getSourceTransactionBody();
 
   if (!transactionBody.has_util_prng())
   {
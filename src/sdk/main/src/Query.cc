@@ -37,13 +37,33 @@
 #include "exceptions/MaxQueryPaymentExceededException.h"
 #include "exceptions/UninitializedException.h"
 #include "impl/Network.h"
-
+#include "impl/Node.h"
+#include "impl/PaymentTransactionPool.h"
+#include "impl/QueryCostCache.h"
+#include "impl/TransactionIdGenerator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <exception>
+#include <google/protobuf/descriptor.h>
 #include <query.pb.h>
 #include <query_header.pb.h>
+#include <string>
 #include <transaction.pb.h>
 
 namespace Hiero
 {
+namespace
+{
+// Get the maximum amount to pay for a query, which is the query's own maximum if it has one, otherwise the maximum of
+// the Client used to submit it.
+[[nodiscard]] Hbar getMaxPayment(const std::optional<Hbar>& maxPayment, const Client& client)
+{
+  return maxPayment.value_or(client.getMaxQueryPayment().value_or(DEFAULT_MAX_QUERY_PAYMENT));
+}
+
+} // namespace
+
 //-----
 template<typename SdkRequestType, typename SdkResponseType>
 struct Query<SdkRequestType, SdkResponseType>::QueryImpl
@@ -57,14 +77,27 @@ struct Query<SdkRequestType, SdkResponseType>::QueryImpl
   // The transaction ID to use for the payment transaction for this Query.
   std::optional<TransactionId> mPaymentTransactionId;
 
+  // The HedgingPolicy of this Query. If not set, the Client's HedgingPolicy is used.
+  std::optional<HedgingPolicy> mHedgingPolicy;
+
   // Is this Query meant to get the cost?
   bool mGetCost = false;
 
   // The cost to execute this Query.
   Hbar mCost;
 
+  // Is the cost to execute this Query a remembered cost, rather than one the network just gave?
+  bool mIsCostEstimated = false;
+
+  // The key under which the cost of this Query is remembered.
+  std::string mCostCacheKey;
+
   // The Client that should be used to pay for the payment transaction of this Query.
   const Client* mClient = nullptr;
+
+  // The Query protobuf object most recently built by makeRequest(). It's kept here so that it can be submitted by
+  // reference.
+  proto::Query mRequest;
 };
 
 //-----
@@ -196,6 +229,21 @@ std::optional<TransactionId> Query<SdkRequestType, SdkResponseType>::getPaymentT
   return mImpl->mPaymentTransactionId;
 }
 
+//-----
+template<typename SdkRequestType, typename SdkResponseType>
+SdkRequestType& Query<SdkRequestType, SdkResponseType>::setHedgingPolicy(HedgingPolicy policy)
+{
+  mImpl->mHedgingPolicy = policy;
+  return static_cast<SdkRequestType&>(*this);
+}
+
+//-----
+template<typename SdkRequestType, typename SdkResponseType>
+std::optional<HedgingPolicy> Query<SdkRequestType, SdkResponseType>::getHedgingPolicy() const
+{
+  return mImpl->mHedgingPolicy;
+}
+
 //-----
 template<typename SdkRequestType, typename SdkResponseType>
 void Query<SdkRequestType, SdkResponseType>::saveCostFromHeader(const proto::ResponseHeader& header) const
@@ -271,7 +319,7 @@ Query<SdkRequestType, SdkResponseType>& Query<SdkRequestType, SdkResponseType>::
 
 //-----
 template<typename SdkRequestType, typename SdkResponseType>
-proto::Query Query<SdkRequestType, SdkResponseType>::makeRequest(unsigned int index) const
+const proto::Query& Query<SdkRequestType, SdkResponseType>::makeRequest(unsigned int index) const
 {
   auto header = std::make_unique<proto::QueryHeader>();
 
@@ -281,25 +329,42 @@ proto::Query Query<SdkRequestType, SdkResponseType>::makeRequest(unsigned int in
     const AccountId accountId =
       Executable<SdkRequestType, proto::Query, proto::Response, SdkResponseType>::getNodeAccountIds().at(index);
 
-    header->set_allocated_payment(
-      std::make_unique<proto::Transaction>(
-        TransferTransaction()
-          .setTransactionId(mImpl->mPaymentTransactionId.has_value()
-                              ? mImpl->mPaymentTransactionId.value()
-                              : TransactionId::generate(mImpl->mClient->getOperatorAccountId().value()))
-          .setNodeAccountIds({ accountId })
-          .addHbarTransfer(mImpl->mClient->getOperatorAccountId().value(), mImpl->mCost.negated())
-          .addHbarTransfer(accountId, mImpl->mCost)
-          .freeze()
-          .signWithOperator(*mImpl->mClient)
-          // There's only one node account ID, therefore only one Transaction protobuf object will be created, and that
-          // will be put in the 0th index.
-          .makeRequest(0U))
-        .release());
+    // Take a payment signed ahead of time if the Client keeps them, unless the payment's TransactionId has been set.
+    const std::shared_ptr<internal::PaymentTransactionPool> paymentPool =
+      mImpl->mPaymentTransactionId.has_value() ? nullptr : mImpl->mClient->getPaymentTransactionPool();
+    if (paymentPool)
+    {
+      header->set_allocated_payment(
+        std::make_unique<proto::Transaction>(paymentPool->take(*mImpl->mClient, accountId, mImpl->mCost)).release());
+    }
+    else
+    {
+      header->set_allocated_payment(
+        std::make_unique<proto::Transaction>(
+          TransferTransaction()
+            .setTransactionId(mImpl->mPaymentTransactionId.has_value()
+                                ? mImpl->mPaymentTransactionId.value()
+                                : TransactionId::withValidStart(
+                                    mImpl->mClient->getOperatorAccountId().value(),
+                                    internal::TransactionIdGenerator::getInstance().next(
+                                      mImpl->mClient->getOperatorAccountId().value(),
+                                      1U,
+                                      mImpl->mClient->getTransactionIdBackdate())))
+            .setNodeAccountIds({ accountId })
+            .addHbarTransfer(mImpl->mClient->getOperatorAccountId().value(), mImpl->mCost.negated())
+            .addHbarTransfer(accountId, mImpl->mCost)
+            .freeze()
+            .signWithOperator(*mImpl->mClient)
+            // There's only one node account ID, therefore only one Transaction protobuf object will be created, and
+            // that will be put in the 0th index.
+            .makeRequest(0U))
+          .release());
+    }
   }
 
   header->set_responsetype(mImpl->mGetCost ? proto::ResponseType::COST_ANSWER : proto::ResponseType::ANSWER_ONLY);
-  return buildRequest(header.release());
+  mImpl->mRequest = buildRequest(header.release());
+  return mImpl->mRequest;
 }
 
 //-----
@@ -341,19 +406,164 @@ void Query<SdkRequestType, SdkResponseType>::onExecute(const Client& client)
 
   // Save the Client for use later to generate payment Transaction protobuf objects.
   mImpl->mClient = &client;
+  mImpl->mIsCostEstimated = false;
+
+  const Hbar maxPayment = getMaxPayment(mImpl->mMaxPayment, client);
+  const std::shared_ptr<internal::QueryCostCache> costCache = client.getQueryCostCache();
+
+  // Pay the explicit amount if one has been set.
+  if (mImpl->mPayment.has_value())
+  {
+    mImpl->mCost = mImpl->mPayment.value();
+  }
 
-  // Get the cost and make sure it's willing to be paid.
-  mImpl->mCost = getCost(client);
-  if (mImpl->mCost.toTinybars() > ((mImpl->mMaxPayment.has_value()) ? mImpl->mMaxPayment->toTinybars()
-                                                                    : ((client.getMaxQueryPayment().has_value())
-                                                                         ? client.getMaxQueryPayment()->toTinybars()
-                                                                         : DEFAULT_MAX_QUERY_PAYMENT.toTinybars())))
+  else
+  {
+    // Pay a remembered cost plus the margin if the Client remembers one, so that the network doesn't have to be asked
+    // for the cost.
+    if (costCache)
+    {
+      mImpl->mCostCacheKey = buildRequest(std::make_unique<proto::QueryHeader>().release()).SerializeAsString();
+      if (const std::optional<Hbar> cost = costCache->get(mImpl->mCostCacheKey);
+          cost.has_value() && cost->toTinybars() <= maxPayment.toTinybars())
+      {
+        const auto estimate = static_cast<int64_t>(
+          std::ceil(static_cast<double>(cost->toTinybars()) * (1.0 + client.getQueryCostMargin())));
+        mImpl->mCost = Hbar(std::min(estimate, maxPayment.toTinybars()), HbarUnit::TINYBAR());
+        mImpl->mIsCostEstimated = true;
+        return;
+      }
+    }
+
+    // Get the cost.
+    mImpl->mCost = getCost(client);
+    if (costCache)
+    {
+      costCache->put(mImpl->mCostCacheKey, mImpl->mCost);
+    }
+  }
+
+  // Make sure the cost is willing to be paid.
+  if (mImpl->mCost.toTinybars() > maxPayment.toTinybars())
   {
     throw MaxQueryPaymentExceededException("Cost to execute Query (" + std::to_string(mImpl->mCost.toTinybars()) +
                                            HbarUnit::TINYBAR().getSymbol() + ") is larger than allowed amount.");
   }
 }
 
+//-----
+template<typename SdkRequestType, typename SdkResponseType>
+typename Executable<SdkRequestType, proto::Query, proto::Response, SdkResponseType>::ExecutionStatus
+Query<SdkRequestType, SdkResponseType>::determineStatus(Status status,
+                                                        const Client& client,
+                                                        const proto::Response& response)
+{
+  if (status != Status::INSUFFICIENT_TX_FEE || !mImpl->mIsCostEstimated)
+  {
+    return Executable<SdkRequestType, proto::Query, proto::Response, SdkResponseType>::determineStatus(
+      status, client, response);
+  }
+
+  // The remembered cost is out of date. Pay the exact cost instead, which the network gives in the response header if
+  // it can, and otherwise has to be asked for.
+  mImpl->mIsCostEstimated = false;
+  Hbar cost(static_cast<int64_t>(mapResponseHeader(response).cost()), HbarUnit::TINYBAR());
+  if (cost.toTinybars() <= 0LL)
+  {
+    try
+    {
+      SdkRequestType costQuery(static_cast<const SdkRequestType&>(*this));
+      cost = costQuery.getCost(client);
+    }
+    catch (const std::exception&)
+    {
+      if (const std::shared_ptr<internal::QueryCostCache> costCache = client.getQueryCostCache())
+      {
+        costCache->erase(mImpl->mCostCacheKey);
+      }
+
+      return Executable<SdkRequestType, proto::Query, proto::Response, SdkResponseType>::ExecutionStatus::
+        REQUEST_ERROR;
+    }
+  }
+
+  return updateCost(cost, client);
+}
+
+//-----
+template<typename SdkRequestType, typename SdkResponseType>
+void Query<SdkRequestType, SdkResponseType>::determineStatusAsync(
+  Status status,
+  const Client& client,
+  const proto::Response& response,
+  const std::function<
+    void(typename Executable<SdkRequestType, proto::Query, proto::Response, SdkResponseType>::ExecutionStatus,
+         const proto::Response&)>& callback)
+{
+  // Only a remembered cost that's out of date, without the exact cost in the response header, needs a cost query.
+  if (status != Status::INSUFFICIENT_TX_FEE || !mImpl->mIsCostEstimated || mapResponseHeader(response).cost() > 0ULL)
+  {
+    callback(determineStatus(status, client, response), response);
+    return;
+  }
+
+  // Ask the network for the exact cost without blocking the thread of the CompletionQueueDriver this runs on, and
+  // continue the attempt once the cost is known. The cost query is a copy of this Query, which is kept alive by its own
+  // callbacks until its execution completes.
+  mImpl->mIsCostEstimated = false;
+  const std::shared_ptr<SdkRequestType> costQuery =
+    std::make_shared<SdkRequestType>(static_cast<const SdkRequestType&>(*this));
+  QueryImpl* costQueryImpl = costQuery->Query<SdkRequestType, SdkResponseType>::mImpl.get();
+  costQueryImpl->mGetCost = true;
+  costQuery->executeAsync(
+    client,
+    [this, &client, costQuery, costQueryImpl, callback, response](const SdkResponseType&)
+    { callback(updateCost(costQueryImpl->mCost, client), response); },
+    [this, &client, costQuery, callback, response](const std::exception&)
+    {
+      if (const std::shared_ptr<internal::QueryCostCache> costCache = client.getQueryCostCache())
+      {
+        costCache->erase(mImpl->mCostCacheKey);
+      }
+
+      callback(
+        Executable<SdkRequestType, proto::Query, proto::Response, SdkResponseType>::ExecutionStatus::REQUEST_ERROR,
+        response);
+    });
+}
+
+//-----
+template<typename SdkRequestType, typename SdkResponseType>
+typename Executable<SdkRequestType, proto::Query, proto::Response, SdkResponseType>::ExecutionStatus
+Query<SdkRequestType, SdkResponseType>::updateCost(const Hbar& cost, const Client& client)
+{
+  if (const std::shared_ptr<internal::QueryCostCache> costCache = client.getQueryCostCache())
+  {
+    costCache->put(mImpl->mCostCacheKey, cost);
+  }
+
+  if (cost.toTinybars() > getMaxPayment(mImpl->mMaxPayment, client).toTinybars())
+  {
+    return Executable<SdkRequestType, proto::Query, proto::Response, SdkResponseType>::ExecutionStatus::REQUEST_ERROR;
+  }
+
+  mImpl->mCost = cost;
+  return Executable<SdkRequestType, proto::Query, proto::Response, SdkResponseType>::ExecutionStatus::RETRY;
+}
+
+//-----
+template<typename SdkRequestType, typename SdkResponseType>
+bool Query<SdkRequestType, SdkResponseType>::submitRequestAsync(
+  const proto::Query& request,
+  const std::shared_ptr<internal::Node>& node,
+  const std::chrono::system_clock::time_point& deadline,
+  internal::CompletionQueueDriver& driver,
+  const std::function<void(const grpc::Status&, const proto::Response&)>& callback,
+  const std::shared_ptr<grpc::ClientContext>& context) const
+{
+  return node->submitQueryAsync(request.query_case(), request, deadline, driver, callback, context);
+}
+
 //-----
 template<typename SdkRequestType, typename SdkResponseType>
 std::optional<TransactionId> Query<SdkRequestType, SdkResponseType>::getTransactionIdInternal() const
@@ -361,6 +571,37 @@ std::optional<TransactionId> Query<SdkRequestType, SdkResponseType>::getTransact
   return getPaymentTransactionId();
 }
 
+//-----
+template<typename SdkRequestType, typename SdkResponseType>
+std::string Query<SdkRequestType, SdkResponseType>::getRequestType() const
+{
+  // The cases of the oneof are numbered after its fields. Every query of a type sets the same case, so the request is
+  // only built to find it once per type.
+  static const std::string requestType = [this]()
+  {
+    const google::protobuf::FieldDescriptor* field = proto::Query::descriptor()->FindFieldByNumber(
+      buildRequest(std::make_unique<proto::QueryHeader>().release()).query_case());
+    return field ? std::string(field->name()) : std::string("unknown");
+  }();
+
+  return requestType;
+}
+
+//-----
+template<typename SdkRequestType, typename SdkResponseType>
+bool Query<SdkRequestType, SdkResponseType>::isHedgingAllowed(const Client& client) const
+{
+  switch (mImpl->mHedgingPolicy.value_or(client.getHedgingPolicy()))
+  {
+    case HedgingPolicy::FREE_QUERIES:
+      return !isPaymentRequired() || mImpl->mGetCost;
+    case HedgingPolicy::ALL_QUERIES:
+      return true;
+    default:
+      return false;
+  }
+}
+
 /**
  * Explicit template instantiations.
  */
@@ -0,0 +1,690 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "ReceiptPoller.h"
+#include "AccountId.h"
+#include "Client.h"
+#include "Defaults.h"
+#include "Status.h"
+#include "TransactionId.h"
+#include "TransactionReceipt.h"
+#include "TransactionReceiptQuery.h"
+#include "TransactionResponse.h"
+#include "exceptions/IllegalStateException.h"
+#include "exceptions/MaxAttemptsExceededException.h"
+#include "exceptions/PrecheckStatusException.h"
+#include "exceptions/UninitializedException.h"
+#include "impl/CompletionQueueDriver.h"
+#include "impl/Network.h"
+#include "impl/Node.h"
+#include "impl/Utilities.h"
+
+#include <algorithm>
+#include <deque>
+#include <iterator>
+#include <mutex>
+#include <query.pb.h>
+#include <query_header.pb.h>
+#include <response.pb.h>
+#include <stdexcept>
+#include <transaction_get_receipt.pb.h>
+#include <unordered_map>
+
+namespace Hiero
+{
+namespace
+{
+/**
+ * The number of slots in the timer wheel of a ReceiptPoller. Receipts due further away than this many ticks stay in
+ * their slot for more than one revolution of the wheel.
+ */
+constexpr std::size_t WHEEL_SIZE = 256ULL;
+
+/**
+ * A receipt a ReceiptPoller is waiting on.
+ */
+struct PendingReceipt
+{
+  // The ID of the Transaction whose receipt is being waited on.
+  TransactionId mTransactionId;
+
+  // The account ID of the node from which to poll the receipt.
+  AccountId mNodeAccountId;
+
+  // Should a receipt without a successful status be delivered as a ReceiptStatusException?
+  bool mValidateStatus = true;
+
+  // The callback that consumes the receipt.
+  std::function<void(const TransactionReceipt&)> mResponseCallback;
+
+  // The callback that consumes the exception if the receipt could not be retrieved.
+  std::function<void(const std::exception_ptr&)> mExceptionCallback;
+
+  // The number of receipt requests that have been sent for this receipt.
+  unsigned int mAttempt = 0U;
+
+  // The amount of time to wait before polling this receipt again if it's not available yet.
+  std::chrono::system_clock::duration mBackoff;
+
+  // The tick of the timer wheel at which this receipt should be polled again.
+  uint64_t mDueTick = 0ULL;
+};
+
+/**
+ * The receipts of a single node that are due to be polled, and the number of receipt requests in flight to that node.
+ */
+struct NodeQueue
+{
+  // The receipts that are due to be polled, oldest first.
+  std::deque<std::shared_ptr<PendingReceipt>> mReady;
+
+  // The number of receipt requests in flight to the node.
+  unsigned int mInFlight = 0U;
+};
+
+/**
+ * Build a TransactionGetReceipt Query protobuf object. Receipt queries are free, so no payment is attached.
+ *
+ * @param transactionId The ID of the Transaction whose receipt to query.
+ * @return The Query protobuf object.
+ */
+proto::Query buildReceiptQuery(const TransactionId& transactionId)
+{
+  auto header = std::make_unique<proto::QueryHeader>();
+  header->set_responsetype(proto::ResponseType::ANSWER_ONLY);
+
+  auto transactionGetReceiptQuery = std::make_unique<proto::TransactionGetReceiptQuery>();
+  transactionGetReceiptQuery->set_allocated_header(header.release());
+  transactionGetReceiptQuery->set_allocated_transactionid(transactionId.toProtobuf().release());
+
+  proto::Query query;
+  query.set_allocated_transactiongetreceipt(transactionGetReceiptQuery.release());
+  return query;
+}
+
+} // namespace
+
+//-----
+struct ReceiptPoller::ReceiptPollerImpl : public std::enable_shared_from_this<ReceiptPollerImpl>
+{
+  /**
+   * Start waiting on a receipt, and poll it right away if its node has room for another request.
+   *
+   * @param receipt The receipt to wait on.
+   */
+  void add(const std::shared_ptr<PendingReceipt>& receipt)
+  {
+    std::vector<std::shared_ptr<PendingReceipt>> toSubmit;
+    bool closed = false;
+
+    {
+      std::unique_lock lock(mMutex);
+      closed = mIsClosed;
+      if (!closed)
+      {
+        ++mPendingCount;
+        mNodeQueues[receipt->mNodeAccountId].mReady.push_back(receipt);
+        collect(receipt->mNodeAccountId, toSubmit);
+      }
+    }
+
+    if (closed)
+    {
+      receipt->mExceptionCallback(
+        std::make_exception_ptr(IllegalStateException("ReceiptPoller was closed before the receipt was available")));
+      return;
+    }
+
+    submitAll(toSubmit);
+  }
+
+  /**
+   * Move the receipts of a node that are due to be polled into the list of receipts to submit, while the node has room
+   * for more requests in flight. The lock must be held.
+   *
+   * @param nodeAccountId The account ID of the node.
+   * @param toSubmit      The list of receipts to submit.
+   */
+  void collect(const AccountId& nodeAccountId, std::vector<std::shared_ptr<PendingReceipt>>& toSubmit)
+  {
+    NodeQueue& queue = mNodeQueues[nodeAccountId];
+    while (!queue.mReady.empty() && queue.mInFlight < mMaxInFlightPerNode)
+    {
+      toSubmit.push_back(std::move(queue.mReady.front()));
+      queue.mReady.pop_front();
+      ++queue.mInFlight;
+    }
+  }
+
+  /**
+   * Send a receipt request for each receipt in a list. The lock must not be held.
+   *
+   * @param toSubmit The receipts to poll.
+   */
+  void submitAll(const std::vector<std::shared_ptr<PendingReceipt>>& toSubmit)
+  {
+    std::for_each(toSubmit.cbegin(),
+                  toSubmit.cend(),
+                  [this](const std::shared_ptr<PendingReceipt>& receipt) { submit(receipt); });
+  }
+
+  /**
+   * Send a receipt request for a receipt to a healthy proxy of its node. The lock must not be held.
+   *
+   * @param receipt The receipt to poll.
+   */
+  void submit(const std::shared_ptr<PendingReceipt>& receipt)
+  {
+    try
+    {
+      const std::vector<std::shared_ptr<internal::Node>> proxies = mNetwork->getNodeProxies(receipt->mNodeAccountId);
+      if (proxies.empty())
+      {
+        throw IllegalStateException("Node account ID " + receipt->mNodeAccountId.toString() +
+                                    " did not map to a valid node in the input Client's network.");
+      }
+
+      // Start at a random proxy so that the load is spread over all of them.
+      const auto start = internal::Utilities::getRandomNumber(0U, static_cast<unsigned int>(proxies.size()) - 1U);
+      std::shared_ptr<internal::Node> node;
+      std::chrono::system_clock::duration shortestBackoff = std::chrono::system_clock::duration::max();
+      for (std::size_t i = 0ULL; i < proxies.size() && !node; ++i)
+      {
+        const std::shared_ptr<internal::Node>& proxy = proxies.at((start + i) % proxies.size());
+        if (proxy->isHealthy())
+        {
+          node = proxy;
+        }
+        else
+        {
+          shortestBackoff = std::min(shortestBackoff, proxy->getRemainingTimeForBackoff());
+        }
+      }
+
+      // If no proxy is healthy, wait for the first one to come out of its backoff. This doesn't count as an attempt.
+      if (!node)
+      {
+        reschedule(receipt, shortestBackoff);
+        return;
+      }
+
+      ++receipt->mAttempt;
+      if (!node->submitQueryAsync(proto::Query::QueryCase::kTransactionGetReceipt,
+                                  buildReceiptQuery(receipt->mTransactionId),
+                                  std::chrono::system_clock::now() + mGrpcDeadline,
+                                  *mDriver,
+                                  [self = shared_from_this(), receipt, node](const grpc::Status& status,
+                                                                             const proto::Response& response)
+                                  { self->handleResponse(receipt, node, status, response); }))
+      {
+        throw IllegalStateException("Client was closed before the receipt was available");
+      }
+    }
+    catch (...)
+    {
+      finish(receipt, nullptr, std::current_exception());
+    }
+  }
+
+  /**
+   * Handle the response to a receipt request.
+   *
+   * @param receipt  The receipt that was polled.
+   * @param node     The node that was polled.
+   * @param status   The gRPC status of the request.
+   * @param response The response of the node.
+   */
+  void handleResponse(const std::shared_ptr<PendingReceipt>& receipt,
+                      const std::shared_ptr<internal::Node>& node,
+                      const grpc::Status& status,
+                      const proto::Response& response)
+  {
+    try
+    {
+      // Increase backoff for this node and poll again later for UNAVAILABLE, RESOURCE_EXHAUSTED, and INTERNAL
+      // responses. Other failed requests (i.e. DEADLINE_EXCEEDED) are just polled again later.
+      if (const grpc::StatusCode errorCode = status.error_code(); !status.ok())
+      {
+        if (errorCode == grpc::StatusCode::UNAVAILABLE || errorCode == grpc::StatusCode::RESOURCE_EXHAUSTED ||
+            errorCode == grpc::StatusCode::INTERNAL)
+        {
+          node->increaseBackoff();
+        }
+
+        retry(receipt);
+        return;
+      }
+
+      node->decreaseBackoff();
+
+      // Classify the response exactly as a TransactionReceiptQuery would.
+      const Status precheckStatus =
+        gProtobufResponseCodeToStatus.at(response.transactiongetreceipt().header().nodetransactionprecheckcode());
+      switch (TransactionReceiptQuery::determineReceiptStatus(precheckStatus, response))
+      {
+        case TransactionReceiptQuery::ExecutionStatus::SERVER_ERROR:
+          node->increaseBackoff();
+          retry(receipt);
+          return;
+        case TransactionReceiptQuery::ExecutionStatus::RETRY:
+          retry(receipt);
+          return;
+        case TransactionReceiptQuery::ExecutionStatus::REQUEST_ERROR:
+          throw PrecheckStatusException(precheckStatus, receipt->mTransactionId);
+        default:
+          break;
+      }
+
+      const TransactionReceipt txReceipt =
+        TransactionReceipt::fromProtobuf(response.transactiongetreceipt(), receipt->mTransactionId);
+      if (receipt->mValidateStatus)
+      {
+        txReceipt.validateStatus();
+      }
+
+      finish(receipt, &txReceipt, nullptr);
+    }
+    catch (...)
+    {
+      finish(receipt, nullptr, std::current_exception());
+    }
+  }
+
+  /**
+   * Poll a receipt again after its backoff, or fail it if it has run out of attempts. The lock must not be held.
+   *
+   * @param receipt The receipt to poll again.
+   */
+  void retry(const std::shared_ptr<PendingReceipt>& receipt)
+  {
+    if (receipt->mAttempt >= mMaxAttempts)
+    {
+      finish(receipt,
+             nullptr,
+             std::make_exception_ptr(MaxAttemptsExceededException(
+               "Max number of attempts made (max attempts allowed: " + std::to_string(mMaxAttempts) + ')')));
+      return;
+    }
+
+    const std::chrono::system_clock::duration delay = receipt->mBackoff;
+    receipt->mBackoff = std::min(receipt->mBackoff * 2, mMaxBackoff);
+    reschedule(receipt, delay);
+  }
+
+  /**
+   * Release the request slot of a receipt and put it on the timer wheel to be polled again after a delay. The lock must
+   * not be held.
+   *
+   * @param receipt The receipt to poll again.
+   * @param delay   The amount of time to wait before polling the receipt again.
+   */
+  void reschedule(const std::shared_ptr<PendingReceipt>& receipt, const std::chrono::system_clock::duration& delay)
+  {
+    std::vector<std::shared_ptr<PendingReceipt>> toSubmit;
+    bool closed = false;
+    bool driverShutDown = false;
+
+    {
+      std::unique_lock lock(mMutex);
+      --mNodeQueues[receipt->mNodeAccountId].mInFlight;
+
+      closed = mIsClosed;
+      if (closed)
+      {
+        --mPendingCount;
+      }
+      else
+      {
+        // Round up to the next tick, but always wait at least one tick.
+        const uint64_t ticks = static_cast<uint64_t>((delay + mPollInterval - std::chrono::system_clock::duration(1)) /
+                                                     mPollInterval);
+        receipt->mDueTick = mCurrentTick + std::max<uint64_t>(ticks, 1ULL);
+        mWheel[receipt->mDueTick % WHEEL_SIZE].push_back(receipt);
+        ++mWaitingCount;
+
+        collect(receipt->mNodeAccountId, toSubmit);
+        driverShutDown = !scheduleTick();
+      }
+    }
+
+    if (closed)
+    {
+      receipt->mExceptionCallback(
+        std::make_exception_ptr(IllegalStateException("ReceiptPoller was closed before the receipt was available")));
+    }
+    else if (driverShutDown)
+    {
+      // This fails the receipt that was just put on the timer wheel as well.
+      close(std::make_exception_ptr(IllegalStateException("Client was closed before the receipt was available")));
+      return;
+    }
+
+    submitAll(toSubmit);
+  }
+
+  /**
+   * Stop waiting on a receipt, deliver its result, and send requests for the next receipts due for its node. The lock
+   * must not be held.
+   *
+   * @param receipt   The receipt to deliver.
+   * @param txReceipt The TransactionReceipt to deliver. nullptr if an exception should be delivered instead.
+   * @param exception The exception to deliver if there is no TransactionReceipt.
+   */
+  void finish(const std::shared_ptr<PendingReceipt>& receipt,
+              const TransactionReceipt* txReceipt,
+              const std::exception_ptr& exception)
+  {
+    std::vector<std::shared_ptr<PendingReceipt>> toSubmit;
+
+    {
+      std::unique_lock lock(mMutex);
+      --mNodeQueues[receipt->mNodeAccountId].mInFlight;
+      --mPendingCount;
+      collect(receipt->mNodeAccountId, toSubmit);
+    }
+
+    if (txReceipt)
+    {
+      receipt->mResponseCallback(*txReceipt);
+    }
+    else
+    {
+      receipt->mExceptionCallback(exception);
+    }
+
+    submitAll(toSubmit);
+  }
+
+  /**
+   * Schedule the next tick of the timer wheel if there are receipts on it and no tick is scheduled yet. The lock must
+   * be held.
+   *
+   * @return \c TRUE if the next tick is scheduled or not needed, \c FALSE if the CompletionQueueDriver was shut down.
+   */
+  bool scheduleTick()
+  {
+    if (mIsTickScheduled || mWaitingCount == 0ULL)
+    {
+      return true;
+    }
+
+    mIsTickScheduled = mDriver->schedule(std::chrono::system_clock::now() + mPollInterval,
+                                         [self = shared_from_this()](bool ok) { self->tick(ok); });
+    return mIsTickScheduled;
+  }
+
+  /**
+   * Advance the timer wheel by one tick, and poll the receipts that have come due.
+   *
+   * @param ok \c TRUE if the tick's timer fired, \c FALSE if it was cancelled because the driver was shut down.
+   */
+  void tick(bool ok)
+  {
+    if (!ok)
+    {
+      close(std::make_exception_ptr(IllegalStateException("Client was closed before the receipt was available")));
+      return;
+    }
+
+    std::vector<std::shared_ptr<PendingReceipt>> toSubmit;
+    bool driverShutDown = false;
+
+    {
+      std::unique_lock lock(mMutex);
+      mIsTickScheduled = false;
+      if (mIsClosed)
+      {
+        return;
+      }
+
+      ++mCurrentTick;
+
+      // Move the due receipts of this slot to their nodes' queues, and leave the ones due in a later revolution.
+      std::vector<std::shared_ptr<PendingReceipt>>& slot = mWheel[mCurrentTick % WHEEL_SIZE];
+      const auto notDue = std::partition(slot.begin(),
+                                         slot.end(),
+                                         [this](const std::shared_ptr<PendingReceipt>& receipt)
+                                         { return receipt->mDueTick > mCurrentTick; });
+      std::vector<AccountId> nodeAccountIds;
+      for (auto iter = notDue; iter != slot.end(); ++iter)
+      {
+        nodeAccountIds.push_back((*iter)->mNodeAccountId);
+        mNodeQueues[(*iter)->mNodeAccountId].mReady.push_back(std::move(*iter));
+        --mWaitingCount;
+      }
+
+      slot.erase(notDue, slot.end());
+
+      // Requests are coalesced per node: each node gets as many of its due receipts as it has room for. Collecting a
+      // node more than once is harmless, as its queue is already drained as far as it can be.
+      for (const AccountId& nodeAccountId : nodeAccountIds)
+      {
+        collect(nodeAccountId, toSubmit);
+      }
+
+      driverShutDown = !scheduleTick();
+    }
+
+    if (driverShutDown)
+    {
+      close(std::make_exception_ptr(IllegalStateException("Client was closed before the receipt was available")));
+    }
+
+    submitAll(toSubmit);
+  }
+
+  /**
+   * Stop accepting receipts, and fail every receipt that isn't currently being requested. Receipts that are being
+   * requested fail once their request completes if they would have to be polled again.
+   *
+   * @param exception The exception with which to fail the receipts.
+   */
+  void close(const std::exception_ptr& exception)
+  {
+    std::vector<std::shared_ptr<PendingReceipt>> toFail;
+
+    {
+      std::unique_lock lock(mMutex);
+      mIsClosed = true;
+
+      for (std::vector<std::shared_ptr<PendingReceipt>>& slot : mWheel)
+      {
+        std::move(slot.begin(), slot.end(), std::back_inserter(toFail));
+        slot.clear();
+      }
+
+      for (auto& [nodeAccountId, queue] : mNodeQueues)
+      {
+        std::move(queue.mReady.begin(), queue.mReady.end(), std::back_inserter(toFail));
+        queue.mReady.clear();
+      }
+
+      mWaitingCount = 0ULL;
+      mPendingCount -= toFail.size();
+    }
+
+    std::for_each(toFail.cbegin(),
+                  toFail.cend(),
+                  [&exception](const std::shared_ptr<PendingReceipt>& receipt)
+                  { receipt->mExceptionCallback(exception); });
+  }
+
+  // The network from which to poll receipts.
+  std::shared_ptr<internal::Network> mNetwork = nullptr;
+
+  // The CompletionQueueDriver that drives the receipt requests and the timer wheel.
+  std::shared_ptr<internal::CompletionQueueDriver> mDriver = nullptr;
+
+  // The maximum number of receipt requests to send for a single receipt.
+  unsigned int mMaxAttempts = DEFAULT_MAX_ATTEMPTS;
+
+  // The amount of time to wait before polling a receipt again the first time it's not available.
+  std::chrono::system_clock::duration mMinBackoff = DEFAULT_MIN_BACKOFF;
+
+  // The maximum amount of time to wait before polling a receipt again.
+  std::chrono::system_clock::duration mMaxBackoff = DEFAULT_MAX_BACKOFF;
+
+  // The deadline of a single receipt request.
+  std::chrono::system_clock::duration mGrpcDeadline = DEFAULT_GRPC_DEADLINE;
+
+  // The interval at which the timer wheel advances.
+  std::chrono::system_clock::duration mPollInterval = DEFAULT_RECEIPT_POLL_INTERVAL;
+
+  // The maximum number of receipt requests in flight to a single node.
+  unsigned int mMaxInFlightPerNode = DEFAULT_MAX_RECEIPT_POLLS_IN_FLIGHT_PER_NODE;
+
+  // The mutex protecting the timer wheel, the node queues, and the counters.
+  mutable std::mutex mMutex;
+
+  // The timer wheel. Each slot holds the receipts due at the ticks that map to it.
+  std::vector<std::vector<std::shared_ptr<PendingReceipt>>> mWheel =
+    std::vector<std::vector<std::shared_ptr<PendingReceipt>>>(WHEEL_SIZE);
+
+  // The current tick of the timer wheel.
+  uint64_t mCurrentTick = 0ULL;
+
+  // The number of receipts on the timer wheel.
+  std::size_t mWaitingCount = 0ULL;
+
+  // Is the next tick of the timer wheel scheduled?
+  bool mIsTickScheduled = false;
+
+  // The receipts that are due to be polled and the number of requests in flight, per node.
+  std::unordered_map<AccountId, NodeQueue> mNodeQueues;
+
+  // The number of receipts being waited on.
+  std::size_t mPendingCount = 0ULL;
+
+  // Has this ReceiptPoller been closed?
+  bool mIsClosed = false;
+};
+
+//-----
+ReceiptPoller::ReceiptPoller(const Client& client)
+  : mImpl(std::make_shared<ReceiptPollerImpl>())
+{
+  mImpl->mNetwork = client.getClientNetwork();
+  if (!mImpl->mNetwork)
+  {
+    throw UninitializedException("Client has no network from which to poll receipts.");
+  }
+
+  mImpl->mDriver = client.getCompletionQueueDriver();
+  mImpl->mMaxAttempts = client.getMaxAttempts().value_or(DEFAULT_MAX_ATTEMPTS);
+  mImpl->mMinBackoff = client.getMinBackoff().value_or(DEFAULT_MIN_BACKOFF);
+  mImpl->mMaxBackoff = client.getMaxBackoff().value_or(DEFAULT_MAX_BACKOFF);
+  mImpl->mGrpcDeadline = client.getGrpcDeadline().value_or(DEFAULT_GRPC_DEADLINE);
+}
+
+//-----
+ReceiptPoller::~ReceiptPoller()
+{
+  close();
+}
+
+//-----
+std::future<TransactionReceipt> ReceiptPoller::poll(const TransactionResponse& response)
+{
+  return poll(response.mTransactionId, response.mNodeId, response.getValidateStatus());
+}
+
+//-----
+std::future<TransactionReceipt> ReceiptPoller::poll(const TransactionId& transactionId,
+                                                    const AccountId& nodeAccountId,
+                                                    bool validateStatus)
+{
+  auto promise = std::make_shared<std::promise<TransactionReceipt>>();
+  std::future<TransactionReceipt> future = promise->get_future();
+
+  auto receipt = std::make_shared<PendingReceipt>();
+  receipt->mTransactionId = transactionId;
+  receipt->mNodeAccountId = nodeAccountId;
+  receipt->mValidateStatus = validateStatus;
+  receipt->mResponseCallback = [promise](const TransactionReceipt& txReceipt) { promise->set_value(txReceipt); };
+  receipt->mExceptionCallback = [promise](const std::exception_ptr& exception) { promise->set_exception(exception); };
+  receipt->mBackoff = mImpl->mMinBackoff;
+  mImpl->add(receipt);
+
+  return future;
+}
+
+//-----
+void ReceiptPoller::poll(const TransactionResponse& response,
+                         const std::function<void(const TransactionReceipt&)>& responseCallback,
+                         const std::function<void(const std::exception_ptr&)>& exceptionCallback)
+{
+  auto receipt = std::make_shared<PendingReceipt>();
+  receipt->mTransactionId = response.mTransactionId;
+  receipt->mNodeAccountId = response.mNodeId;
+  receipt->mValidateStatus = response.getValidateStatus();
+  receipt->mResponseCallback = responseCallback;
+  receipt->mExceptionCallback = exceptionCallback;
+  receipt->mBackoff = mImpl->mMinBackoff;
+  mImpl->add(receipt);
+}
+
+//-----
+std::vector<std::future<TransactionReceipt>> ReceiptPoller::pollAll(const std::vector<TransactionResponse>& responses)
+{
+  std::vector<std::future<TransactionReceipt>> futures;
+  futures.reserve(responses.size());
+  std::transform(responses.cbegin(),
+                 responses.cend(),
+                 std::back_inserter(futures),
+                 [this](const TransactionResponse& response) { return poll(response); });
+  return futures;
+}
+
+//-----
+void ReceiptPoller::close()
+{
+  mImpl->close(
+    std::make_exception_ptr(IllegalStateException("ReceiptPoller was closed before the receipt was available")));
+}
+
+//-----
+ReceiptPoller& ReceiptPoller::setPollInterval(const std::chrono::system_clock::duration& interval)
+{
+  if (interval <= std::chrono::system_clock::duration::zero())
+  {
+    throw std::invalid_argument("Poll interval must be positive");
+  }
+
+  std::unique_lock lock(mImpl->mMutex);
+  mImpl->mPollInterval = interval;
+  return *this;
+}
+
+//-----
+ReceiptPoller& ReceiptPoller::setMaxInFlightPerNode(unsigned int max)
+{
+  if (max == 0U)
+  {
+    throw std::invalid_argument("Maximum number of receipt requests in flight per node must be greater than 0");
+  }
+
+  std::unique_lock lock(mImpl->mMutex);
+  mImpl->mMaxInFlightPerNode = max;
+  return *this;
+}
+
+//-----
+std::chrono::system_clock::duration ReceiptPoller::getPollInterval() const
+{
+  std::unique_lock lock(mImpl->mMutex);
+  return mImpl->mPollInterval;
+}
+
+//-----
+unsigned int ReceiptPoller::getMaxInFlightPerNode() const
+{
+  std::unique_lock lock(mImpl->mMutex);
+  return mImpl->mMaxInFlightPerNode;
+}
+
+//-----
+std::size_t ReceiptPoller::getPendingCount() const
+{
+  std::unique_lock lock(mImpl->mMutex);
+  return mImpl->mPendingCount;
+}
+
+} // namespace Hiero
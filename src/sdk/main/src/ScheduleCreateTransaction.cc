@@ -220,7 +220,7 @@ void ScheduleCreateTransaction::addToBody(proto::TransactionBody& body) const
 //-----
 void ScheduleCreateTransaction::initFromSourceTransactionBody()
 {
-  const proto::TransactionBody transactionBody = getSourceTransactionBody();
+  const proto::TransactionBody& transactionBody = getSourceTransactionBody();
 
   if (!transactionBody.has_schedulecreate())
   {
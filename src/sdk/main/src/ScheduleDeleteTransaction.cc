@@ -59,7 +59,7 @@ void ScheduleDeleteTransaction::addToBody(proto::TransactionBody& body) const
 //-----
 void ScheduleDeleteTransaction::initFromSourceTransactionBody()
 {
-  const proto::TransactionBody transactionBody = getSourceTransactionBody();
+  const proto::TransactionBody& transactionBody = getSourceTransactionBody();
 
   if (!transactionBody.has_scheduledelete())
   {
@@ -67,7 +67,7 @@ void ScheduleSignTransaction::addToBody(proto::TransactionBody& body) const
 //-----
 void ScheduleSignTransaction::initFromSourceTransactionBody()
 {
-  const proto::TransactionBody transactionBody = getSourceTransactionBody();
+  const proto::TransactionBody& transactionBody = getSourceTransactionBody();
 
   if (!transactionBody.has_schedulesign())
   {
@@ -84,7 +84,7 @@ void SystemDeleteTransaction::addToBody(proto::TransactionBody& body) const
 //-----
 void SystemDeleteTransaction::initFromSourceTransactionBody()
 {
-  const proto::TransactionBody transactionBody = getSourceTransactionBody();
+  const proto::TransactionBody& transactionBody = getSourceTransactionBody();
 
   if (!transactionBody.has_systemdelete())
   {
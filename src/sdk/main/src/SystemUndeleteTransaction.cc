@@ -75,7 +75,7 @@ void SystemUndeleteTransaction::addToBody(proto::TransactionBody& body) const
 //-----
 void SystemUndeleteTransaction::initFromSourceTransactionBody()
 {
-  const proto::TransactionBody transactionBody = getSourceTransactionBody();
+  const proto::TransactionBody& transactionBody = getSourceTransactionBody();
 
   if (!transactionBody.has_systemundelete())
   {
@@ -159,7 +159,7 @@ void TokenAirdropTransaction::addToBody(proto::TransactionBody& body) const
 //-----
 void TokenAirdropTransaction::initFromSourceTransactionBody()
 {
-  const proto::TransactionBody transactionBody = getSourceTransactionBody();
+  const proto::TransactionBody& transactionBody = getSourceTransactionBody();
 
   if (!transactionBody.has_tokenairdrop())
   {
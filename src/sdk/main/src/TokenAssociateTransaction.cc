@@ -70,7 +70,7 @@ void TokenAssociateTransaction::addToBody(proto::TransactionBody& body) const
 //-----
 void TokenAssociateTransaction::initFromSourceTransactionBody()
 {
-  const proto::TransactionBody transactionBody = getSourceTransactionBody();
+  const proto::TransactionBody& transactionBody = getSourceTransactionBody();
 
   if (!transactionBody.has_tokenassociate())
   {
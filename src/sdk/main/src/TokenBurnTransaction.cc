@@ -72,7 +72,7 @@ void TokenBurnTransaction::addToBody(proto::TransactionBody& body) const
 //-----
 void TokenBurnTransaction::initFromSourceTransactionBody()
 {
-  const proto::TransactionBody transactionBody = getSourceTransactionBody();
+  const proto::TransactionBody& transactionBody = getSourceTransactionBody();
 
   if (!transactionBody.has_tokenburn())
   {
@@ -58,7 +58,7 @@ void TokenCancelAirdropTransaction::addToBody(proto::TransactionBody& body) cons
 //-----
 void TokenCancelAirdropTransaction::initFromSourceTransactionBody()
 {
-  const proto::TransactionBody transactionBody = getSourceTransactionBody();
+  const proto::TransactionBody& transactionBody = getSourceTransactionBody();
 
   if (!transactionBody.has_tokencancelairdrop())
   {
@@ -58,7 +58,7 @@ void TokenClaimAirdropTransaction::addToBody(proto::TransactionBody& body) const
 //-----
 void TokenClaimAirdropTransaction::initFromSourceTransactionBody()
 {
-  const proto::TransactionBody transactionBody = getSourceTransactionBody();
+  const proto::TransactionBody& transactionBody = getSourceTransactionBody();
 
   if (!transactionBody.has_tokenclaimairdrop())
   {
@@ -258,7 +258,7 @@ void TokenCreateTransaction::addToBody(proto::TransactionBody& body) const
 //-----
 void TokenCreateTransaction::initFromSourceTransactionBody()
 {
-  const proto::TransactionBody transactionBody = getSourceTransactionBody();
+  const proto::TransactionBody& transactionBody = getSourceTransactionBody();
 
   if (!transactionBody.has_tokencreation())
   {
@@ -59,7 +59,7 @@ void TokenDeleteTransaction::addToBody(proto::TransactionBody& body) const
 //-----
 void TokenDeleteTransaction::initFromSourceTransactionBody()
 {
-  const proto::TransactionBody transactionBody = getSourceTransactionBody();
+  const proto::TransactionBody& transactionBody = getSourceTransactionBody();
 
   if (!transactionBody.has_tokendeletion())
   {
@@ -70,7 +70,7 @@ void TokenDissociateTransaction::addToBody(proto::TransactionBody& body) const
 //-----
 void TokenDissociateTransaction::initFromSourceTransactionBody()
 {
-  const proto::TransactionBody transactionBody = getSourceTransactionBody();
+  const proto::TransactionBody& transactionBody = getSourceTransactionBody();
 
   if (!transactionBody.has_tokendissociate())
   {
@@ -70,7 +70,7 @@ void TokenFeeScheduleUpdateTransaction::addToBody(proto::TransactionBody& body)
 //-----
 void TokenFeeScheduleUpdateTransaction::initFromSourceTransactionBody()
 {
-  const proto::TransactionBody transactionBody = getSourceTransactionBody();
+  const proto::TransactionBody& transactionBody = getSourceTransactionBody();
 
   if (!transactionBody.has_token_fee_schedule_update())
   {
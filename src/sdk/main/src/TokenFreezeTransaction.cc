@@ -65,7 +65,7 @@ void TokenFreezeTransaction::addToBody(proto::TransactionBody& body) const
 //-----
 void TokenFreezeTransaction::initFromSourceTransactionBody()
 {
-  const proto::TransactionBody transactionBody = getSourceTransactionBody();
+  const proto::TransactionBody& transactionBody = getSourceTransactionBody();
 
   if (!transactionBody.has_tokenfreeze())
   {
@@ -65,7 +65,7 @@ void TokenGrantKycTransaction::addToBody(proto::TransactionBody& body) const
 //-----
 void TokenGrantKycTransaction::initFromSourceTransactionBody()
 {
-  const proto::TransactionBody transactionBody = getSourceTransactionBody();
+  const proto::TransactionBody& transactionBody = getSourceTransactionBody();
 
   if (!transactionBody.has_tokengrantkyc())
   {
@@ -82,7 +82,7 @@ void TokenMintTransaction::addToBody(proto::TransactionBody& body) const
 //-----
 void TokenMintTransaction::initFromSourceTransactionBody()
 {
-  const proto::TransactionBody transactionBody = getSourceTransactionBody();
+  const proto::TransactionBody& transactionBody = getSourceTransactionBody();
 
   if (!transactionBody.has_tokenmint())
   {
@@ -56,7 +56,7 @@ void TokenPauseTransaction::addToBody(proto::TransactionBody& body) const
 //-----
 void TokenPauseTransaction::initFromSourceTransactionBody()
 {
-  const proto::TransactionBody transactionBody = getSourceTransactionBody();
+  const proto::TransactionBody& transactionBody = getSourceTransactionBody();
 
   if (!transactionBody.has_token_pause())
   {
@@ -83,7 +83,7 @@ void TokenRejectTransaction::addToBody(proto::TransactionBody& body) const
 //-----
 void TokenRejectTransaction::initFromSourceTransactionBody()
 {
-  const proto::TransactionBody transactionBody = getSourceTransactionBody();
+  const proto::TransactionBody& transactionBody = getSourceTransactionBody();
 
   if (!transactionBody.has_tokenreject())
   {
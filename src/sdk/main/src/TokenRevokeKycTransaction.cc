@@ -65,7 +65,7 @@ void TokenRevokeKycTransaction::addToBody(proto::TransactionBody& body) const
 //-----
 void TokenRevokeKycTransaction::initFromSourceTransactionBody()
 {
-  const proto::TransactionBody transactionBody = getSourceTransactionBody();
+  const proto::TransactionBody& transactionBody = getSourceTransactionBody();
 
   if (!transactionBody.has_tokenrevokekyc())
   {
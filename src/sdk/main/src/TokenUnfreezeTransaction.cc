@@ -65,7 +65,7 @@ void TokenUnfreezeTransaction::addToBody(proto::TransactionBody& body) const
 //-----
 void TokenUnfreezeTransaction::initFromSourceTransactionBody()
 {
-  const proto::TransactionBody transactionBody = getSourceTransactionBody();
+  const proto::TransactionBody& transactionBody = getSourceTransactionBody();
 
   if (!transactionBody.has_tokenunfreeze())
   {
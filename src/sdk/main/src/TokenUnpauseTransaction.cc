@@ -56,7 +56,7 @@ void TokenUnpauseTransaction::addToBody(proto::TransactionBody& body) const
 //-----
 void TokenUnpauseTransaction::initFromSourceTransactionBody()
 {
-  const proto::TransactionBody transactionBody = getSourceTransactionBody();
+  const proto::TransactionBody& transactionBody = getSourceTransactionBody();
 
   if (!transactionBody.has_token_unpause())
   {
@@ -76,7 +76,7 @@ void TokenUpdateNftsTransaction::addToBody(proto::TransactionBody& body) const
 //-----
 void TokenUpdateNftsTransaction::initFromSourceTransactionBody()
 {
-  const proto::TransactionBody transactionBody = getSourceTransactionBody();
+  const proto::TransactionBody& transactionBody = getSourceTransactionBody();
 
   if (!transactionBody.has_token_update_nfts())
   {
@@ -207,7 +207,7 @@ void TokenUpdateTransaction::addToBody(proto::TransactionBody& body) const
 //-----
 void TokenUpdateTransaction::initFromSourceTransactionBody()
 {
-  const proto::TransactionBody transactionBody = getSourceTransactionBody();
+  const proto::TransactionBody& transactionBody = getSourceTransactionBody();
 
   if (!transactionBody.has_tokenupdate())
   {
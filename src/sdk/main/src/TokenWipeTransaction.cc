@@ -81,7 +81,7 @@ void TokenWipeTransaction::addToBody(proto::TransactionBody& body) const
 //-----
 void TokenWipeTransaction::initFromSourceTransactionBody()
 {
-  const proto::TransactionBody transactionBody = getSourceTransactionBody();
+  const proto::TransactionBody& transactionBody = getSourceTransactionBody();
 
   if (!transactionBody.has_tokenwipe())
   {
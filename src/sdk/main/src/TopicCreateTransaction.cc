@@ -92,7 +92,7 @@ void TopicCreateTransaction::addToBody(proto::TransactionBody& body) const
 //-----
 void TopicCreateTransaction::initFromSourceTransactionBody()
 {
-  const proto::TransactionBody transactionBody = getSourceTransactionBody();
+  const proto::TransactionBody& transactionBody = getSourceTransactionBody();
 
   if (!transactionBody.has_consensuscreatetopic())
   {
@@ -59,7 +59,7 @@ void TopicDeleteTransaction::addToBody(proto::TransactionBody& body) const
 //-----
 void TopicDeleteTransaction::initFromSourceTransactionBody()
 {
-  const proto::TransactionBody transactionBody = getSourceTransactionBody();
+  const proto::TransactionBody& transactionBody = getSourceTransactionBody();
 
   if (!transactionBody.has_consensusdeletetopic())
   {
@@ -5,6 +5,7 @@
 
 #include <mirror/consensus_service.pb.h>
 
+#include <string>
 #include <utility>
 
 namespace Hiero
@@ -41,28 +42,39 @@ TopicMessage TopicMessage::ofSingle(const com::hedera::mirror::api::proto::Conse
 TopicMessage TopicMessage::ofMany(const std::vector<com::hedera::mirror::api::proto::ConsensusTopicResponse>& protos)
 {
   // Place the responses in order from oldest to newest.
-  std::vector<TopicMessageChunk> chunks(protos.size(), TopicMessageChunk());
-  std::vector<std::vector<std::byte>> contents(protos.size(), std::vector<std::byte>());
-  TransactionId transactionId;
+  TopicMessage message;
+  message.mChunks.resize(protos.size());
+  std::vector<const std::string*> contents(protos.size(), nullptr);
+  std::size_t size = 0;
 
   for (const auto& proto : protos)
   {
     if (proto.has_chunkinfo() && proto.chunkinfo().has_initialtransactionid())
     {
-      transactionId = TransactionId::fromProtobuf(proto.chunkinfo().initialtransactionid());
+      message.mTransactionId = TransactionId::fromProtobuf(proto.chunkinfo().initialtransactionid());
     }
 
     const int32_t index = proto.chunkinfo().number() - 1;
-    chunks[index] = TopicMessageChunk(proto);
-    contents[index] = internal::Utilities::stringToByteVector(proto.message());
+    message.mChunks[index] = TopicMessageChunk(proto);
+    contents[index] = &proto.message();
+    size += proto.message().size();
   }
 
-  return { chunks.back().mConsensusTimestamp,
-           internal::Utilities::concatenateVectors(contents),
-           chunks.back().mRunningHash,
-           chunks.back().mSequenceNumber,
-           chunks,
-           transactionId };
+  // Copy the contents of the chunks straight into the message.
+  message.mContents.reserve(size);
+  for (const std::string* content : contents)
+  {
+    if (content)
+    {
+      const auto* data = reinterpret_cast<const std::byte*>(content->data());
+      message.mContents.insert(message.mContents.end(), data, data + content->size());
+    }
+  }
+
+  message.mConsensusTimestamp = message.mChunks.back().mConsensusTimestamp;
+  message.mRunningHash = message.mChunks.back().mRunningHash;
+  message.mSequenceNumber = message.mChunks.back().mSequenceNumber;
+  return message;
 }
 
 } // namespace Hiero
@@ -2,37 +2,38 @@
 #include "TopicMessageQuery.h"
 #include "Client.h"
 #include "Defaults.h"
+#include "Logger.h"
 #include "SubscriptionHandle.h"
 #include "TopicId.h"
 #include "TopicMessage.h"
+#include "impl/ChunkReassembler.h"
+#include "impl/CompletionQueueDriver.h"
+#include "impl/MetricsRegistry.h"
 #include "impl/MirrorNetwork.h"
 #include "impl/MirrorNode.h"
+#include "impl/SubscriptionReactor.h"
 #include "impl/TimestampConverter.h"
-#include "impl/Utilities.h"
 
 #include <chrono>
 #include <grpcpp/grpcpp.h>
+#include <memory>
 #include <mirror/consensus_service.grpc.pb.h>
-#include <thread>
-#include <unordered_map>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <utility>
 
 namespace Hiero
 {
 namespace
 {
-// Enum to track the status of the gRPC call.
-enum class CallStatus
-{
-  STATUS_CREATE = 0,
-  STATUS_PROCESSING = 1,
-  STATUS_FINISH = 2
-};
-
-// Helper function used to get a connected mirror node.
-std::shared_ptr<internal::MirrorNode> getConnectedMirrorNode(const std::shared_ptr<internal::MirrorNetwork>& network)
+// Helper function used to get a mirror node that isn't known to be unreachable. This never blocks, as it's run on the
+// threads of the SubscriptionReactor. If every mirror node is unreachable, the last one tried is used anyway.
+std::shared_ptr<internal::MirrorNode> getReachableMirrorNode(const std::shared_ptr<internal::MirrorNetwork>& network)
 {
+  const std::size_t nodes = network->getNetwork().size();
   std::shared_ptr<internal::MirrorNode> node = network->getNextMirrorNode();
-  while (node->channelFailedToConnect())
+  for (std::size_t i = 1; i < nodes && node->isChannelUnreachable(); ++i)
   {
     node = network->getNextMirrorNode();
   }
@@ -40,197 +41,367 @@ std::shared_ptr<internal::MirrorNode> getConnectedMirrorNode(const std::shared_p
   return node;
 }
 
-// Subscriber function called by TopicMessageQuery::subscribe().
-void startSubscription(
-  const std::shared_ptr<internal::MirrorNetwork>& network,
-  std::unique_ptr<grpc::ClientAsyncReader<com::hedera::mirror::api::proto::ConsensusTopicResponse>> reader,
-  std::unique_ptr<grpc::ClientContext> context,
-  std::unique_ptr<grpc::CompletionQueue> queue,
-  std::unique_ptr<CallStatus> callStatus,
-  com::hedera::mirror::api::proto::ConsensusTopicQuery query,
-  std::function<void(grpc::Status)> errorHandler,
-  std::function<bool(grpc::Status)> retryHandler,
-  std::function<void(void)> completionHandler,
-  std::function<void(const TopicMessage&)> onNext,
-  uint32_t maxAttempts,
-  std::chrono::system_clock::duration maxBackoff,
-  std::shared_ptr<SubscriptionHandle> handle)
-{
-  // Grab moved objects.
-  std::vector<std::unique_ptr<grpc::ClientContext>> contexts;
-  std::vector<std::unique_ptr<grpc::CompletionQueue>> queues;
-  contexts.push_back(std::move(context));
-  queues.push_back(std::move(queue));
-
-  handle->setOnUnsubscribe([&contexts]() { contexts.back()->TryCancel(); });
-
-  // Declare needed variables.
-  com::hedera::mirror::api::proto::ConsensusTopicResponse response;
-  std::unordered_map<TransactionId, std::vector<com::hedera::mirror::api::proto::ConsensusTopicResponse>>
-    pendingMessages;
-  std::chrono::system_clock::duration backoff = DEFAULT_MIN_BACKOFF;
-  grpc::Status grpcStatus;
-  uint64_t attempt = 0ULL;
-  bool complete = false;
-  bool ok = false;
-  void* tag;
-
-  // Loop until the RPC completes.
-  while (true)
+class TopicSubscription;
+
+// An event of a TopicSubscription's stream. Each event is deleted by the CompletionQueueDriver once it has been
+// processed, and keeps the TopicSubscription alive until then.
+class SubscriptionEvent : public internal::CompletionQueueDriver::Operation
+{
+public:
+  // The TopicSubscription function to run when the event completes.
+  using Handler = void (TopicSubscription::*)(bool);
+
+  SubscriptionEvent(std::shared_ptr<TopicSubscription> subscription, Handler handler)
+    : mSubscription(std::move(subscription))
+    , mHandler(handler)
   {
-    // Process based on the completion queue status.
-    switch (queues.back()->AsyncNext(
-      &tag, &ok, std::chrono::system_clock::now() + std::chrono::duration_cast<std::chrono::milliseconds>(backoff)))
-    {
-      case grpc::CompletionQueue::TIMEOUT:
-      {
-        // Backoff if the completion queue timed out.
-        backoff = (backoff * 2 > maxBackoff) ? maxBackoff : backoff * 2;
-        break;
-      }
-      case grpc::CompletionQueue::GOT_EVENT:
-      {
-        // Decrease the backoff time.
-        backoff = (backoff / 2 < DEFAULT_MIN_BACKOFF) ? DEFAULT_MIN_BACKOFF : backoff / 2;
+  }
 
-        // Process based on the call status.
-        switch (static_cast<CallStatus>(*internal::Utilities::toTypePtr<long>(tag)))
-        {
-          case CallStatus::STATUS_CREATE:
-          {
-            if (ok)
-            {
-              // Update the call status to processing.
-              *callStatus = CallStatus::STATUS_PROCESSING;
-            }
-
-            // Let fall through to process message.
-            [[fallthrough]];
-          }
-          case CallStatus::STATUS_PROCESSING:
-          {
-            // If the response should be processed, process it.
-            if (ok)
-            {
-              // Read the response.
-              reader->Read(&response, callStatus.get());
-
-              // Adjust the query timestamp and limit, in case a retry is triggered.
-              if (response.has_consensustimestamp())
-              {
-                // Add one of the smallest denomination of time this machine can handle.
-                query.set_allocated_consensusstarttime(internal::TimestampConverter::toProtobuf(
-                  internal::TimestampConverter::fromProtobuf(response.consensustimestamp()) +
-                  std::chrono::duration<int, std::ratio<1, std::chrono::system_clock::period::den>>()));
-              }
-
-              if (query.limit() > 0ULL)
-              {
-                query.set_limit(query.limit() - 1ULL);
-              }
-
-              // Process the received message.
-              if (!response.has_chunkinfo() || response.chunkinfo().total() == 1)
-              {
-                onNext(TopicMessage::ofSingle(response));
-              }
-              else
-              {
-                const TransactionId transactionId =
-                  TransactionId::fromProtobuf(response.chunkinfo().initialtransactionid());
-                pendingMessages[transactionId].push_back(response);
-
-                if (pendingMessages[transactionId].size() == response.chunkinfo().total())
-                {
-                  onNext(TopicMessage::ofMany(pendingMessages[transactionId]));
-                }
-              }
-            }
-
-            // If the response shouldn't be processed (due to completion or error), finish the RPC.
-            else
-            {
-              *callStatus = CallStatus::STATUS_FINISH;
-              reader->Finish(&grpcStatus, callStatus.get());
-            }
-
-            break;
-          }
-          case CallStatus::STATUS_FINISH:
-          {
-            if (grpcStatus.ok())
-            {
-              // RPC completed successfully.
-              completionHandler();
-
-              // Shutdown the completion queue.
-              queues.back()->Shutdown();
-
-              // Mark the RPC as complete.
-              complete = true;
-              break;
-            }
-            else
-            {
-              // An error occurred. Whether retrying or not, cancel the call and close the queue.
-              contexts.back()->TryCancel();
-              queues.back()->Shutdown();
-
-              if (attempt >= maxAttempts || !retryHandler(grpcStatus))
-              {
-                // This RPC call shouldn't be retried, handle the error and mark as complete to exit.
-                errorHandler(grpcStatus);
-                complete = true;
-              }
-            }
-
-            break;
-          }
-          default:
-          {
-            // Unrecognized call status, do nothing for now (not sure if this is correct).
-            break;
-          }
-        }
+  void proceed(bool ok) override;
 
-        break;
-      }
-      case grpc::CompletionQueue::SHUTDOWN:
+private:
+  // The TopicSubscription to which this event belongs.
+  std::shared_ptr<TopicSubscription> mSubscription;
+
+  // The function to run when this event completes.
+  Handler mHandler;
+};
+
+// A subscription started by TopicMessageQuery::subscribe(). The stream is driven by the events of a
+// SubscriptionReactor's CompletionQueueDriver, so no thread is ever blocked on a subscription: each completed read
+// processes the received message and issues the next read, and retries are scheduled on a timer.
+class TopicSubscription
+  : public internal::SubscriptionReactor::Subscription
+  , public std::enable_shared_from_this<TopicSubscription>
+{
+public:
+  TopicSubscription(std::shared_ptr<internal::MirrorNetwork> network,
+                    com::hedera::mirror::api::proto::ConsensusTopicQuery query,
+                    std::function<void(grpc::Status)> errorHandler,
+                    std::function<bool(grpc::Status)> retryHandler,
+                    std::function<void(void)> completionHandler,
+                    std::function<void(const TopicMessage&)> onNext,
+                    uint32_t maxAttempts,
+                    const std::chrono::system_clock::duration& maxBackoff,
+                    internal::ChunkReassembler chunkReassembler,
+                    Logger logger,
+                    std::shared_ptr<internal::MetricsRegistry> metricsRegistry)
+    : mNetwork(std::move(network))
+    , mQuery(std::move(query))
+    , mErrorHandler(std::move(errorHandler))
+    , mRetryHandler(std::move(retryHandler))
+    , mCompletionHandler(std::move(completionHandler))
+    , mOnNext(std::move(onNext))
+    , mMaxAttempts(maxAttempts)
+    , mMaxBackoff(maxBackoff)
+    , mChunkReassembler(std::move(chunkReassembler))
+    , mLogger(std::move(logger))
+    , mMetricsRegistry(std::move(metricsRegistry))
+  {
+  }
+
+  // Add this subscription to a SubscriptionReactor and send the query. The subscription keeps the handle alive until it
+  // ends, so that dropping the handle doesn't end the subscription.
+  void start(const std::shared_ptr<internal::SubscriptionReactor>& reactor, std::shared_ptr<SubscriptionHandle> handle)
+  {
+    std::weak_ptr<TopicSubscription> weakThis = weak_from_this();
+    handle->setOnUnsubscribe(
+      [weakThis]()
       {
-        // Getting here means the RPC is reached completion or encountered an un-retriable error, and the completion
-        // queue has been shut down. End the subscription.
-        if (complete)
+        if (const std::shared_ptr<TopicSubscription> subscription = weakThis.lock())
         {
-          // Give a second for the queue to finish its processing.
-          std::this_thread::sleep_for(std::chrono::seconds(1));
-          return;
+          subscription->cancel();
         }
+      });
+
+    mReactor = reactor;
+    mHandle = std::move(handle);
+    mDriver = reactor->add(shared_from_this());
+    if (!mDriver)
+    {
+      complete(grpc::Status(grpc::StatusCode::CANCELLED, "Client has been closed"));
+      return;
+    }
 
-        // If the completion queue has been shut down and the RPC hasn't completed, that means the RPC needs to be
-        // retried. Increase the backoff for the retry.
-        backoff = (backoff * 2 > maxBackoff) ? maxBackoff : backoff * 2;
-        std::this_thread::sleep_for(backoff);
-        ++attempt;
+    connect();
+  }
 
-        // Resend the query to a different node with a different completion queue and client context.
-        contexts.push_back(std::make_unique<grpc::ClientContext>());
-        queues.push_back(std::make_unique<grpc::CompletionQueue>());
+  // Cancel the gRPC call of this subscription, and don't let it be retried.
+  void cancel() override
+  {
+    std::unique_lock lock(mMutex);
+    mCancelled = true;
+    if (mContext)
+    {
+      mContext->TryCancel();
+    }
+  }
 
-        // Reset the call status and send the query.
-        *callStatus = CallStatus::STATUS_CREATE;
-        reader = getConnectedMirrorNode(network)->getConsensusServiceStub()->AsyncsubscribeTopic(
-          contexts.back().get(), query, queues.back().get(), callStatus.get());
+  // Called when the call has started.
+  void onStarted(bool ok)
+  {
+    if (ok)
+    {
+      read();
+    }
+    else
+    {
+      finish();
+    }
+  }
+
+  // Called when a read has completed.
+  void onRead(bool ok)
+  {
+    // If the response shouldn't be processed (due to completion or error), finish the RPC.
+    if (!ok)
+    {
+      finish();
+      return;
+    }
+
+    // Adjust the query timestamp and limit, in case a retry is triggered.
+    if (mResponse.has_consensustimestamp())
+    {
+      // Add one of the smallest denomination of time this machine can handle.
+      mQuery.set_allocated_consensusstarttime(internal::TimestampConverter::toProtobuf(
+        internal::TimestampConverter::fromProtobuf(mResponse.consensustimestamp()) +
+        std::chrono::duration<int, std::ratio<1, std::chrono::system_clock::period::den>>()));
+    }
+
+    if (mQuery.limit() > 0ULL)
+    {
+      mQuery.set_limit(mQuery.limit() - 1ULL);
+    }
+
+    // Process the received message. Chunks are held until the rest of their message arrives.
+    if (std::optional<TopicMessage> message = mChunkReassembler.add(std::move(mResponse)))
+    {
+      mOnNext(*message);
+    }
+
+    read();
+  }
+
+  // Called when the call has finished.
+  void onFinished(bool) { complete(mStatus); }
+
+private:
+  // Send the query to a mirror node.
+  void connect()
+  {
+    const std::shared_ptr<internal::MirrorNode> node = getReachableMirrorNode(mNetwork);
+    const std::shared_ptr<com::hedera::mirror::api::proto::ConsensusService::Stub> stub =
+      node->getConsensusServiceStub();
+    mNodeMetrics = &mMetricsRegistry->getNodeRequestMetrics("subscribeTopic", node->getAddress().toString());
+
+    std::unique_lock lock(mMutex);
+    if (mCancelled)
+    {
+      lock.unlock();
+      complete(grpc::Status(grpc::StatusCode::CANCELLED, "Subscription has been cancelled"));
+      return;
+    }
+
+    // The reader of the previous call is owned by the previous context, so it must be released first.
+    mReader.reset();
+    mContext = std::make_unique<grpc::ClientContext>();
+    mNodeMetrics->recordAttempt();
+    const bool started = mDriver->start(
+      [this, &stub](grpc::CompletionQueue* queue)
+      {
+        mReader = stub->PrepareAsyncsubscribeTopic(mContext.get(), mQuery, queue);
+        mReader->StartCall(new SubscriptionEvent(shared_from_this(), &TopicSubscription::onStarted));
+      });
+    lock.unlock();
+
+    if (!started)
+    {
+      complete(grpc::Status(grpc::StatusCode::CANCELLED, "Client has been closed"));
+    }
+  }
+
+  // Read the next message of the stream.
+  void read()
+  {
+    if (!mDriver->start(
+          [this](grpc::CompletionQueue*)
+          { mReader->Read(&mResponse, new SubscriptionEvent(shared_from_this(), &TopicSubscription::onRead)); }))
+    {
+      complete(grpc::Status(grpc::StatusCode::CANCELLED, "Client has been closed"));
+    }
+  }
+
+  // Get the final status of the stream.
+  void finish()
+  {
+    if (!mDriver->start(
+          [this](grpc::CompletionQueue*)
+          { mReader->Finish(&mStatus, new SubscriptionEvent(shared_from_this(), &TopicSubscription::onFinished)); }))
+    {
+      complete(grpc::Status(grpc::StatusCode::CANCELLED, "Client has been closed"));
+    }
+  }
+
+  // Handle the final status of a call: complete the subscription, retry it after a backoff, or fail it.
+  void complete(const grpc::Status& status)
+  {
+    if (mNodeMetrics)
+    {
+      mNodeMetrics->recordGrpcStatus(status.error_code());
+    }
 
-        break;
+    if (status.ok())
+    {
+      // RPC completed successfully.
+      mCompletionHandler();
+      end();
+      return;
+    }
+
+    bool cancelled = false;
+    {
+      std::unique_lock lock(mMutex);
+      cancelled = mCancelled;
+    }
+
+    if (!cancelled && mDriver && mAttempt < mMaxAttempts && mRetryHandler(status))
+    {
+      // Resend the query to a different node once the backoff has passed.
+      ++mAttempt;
+      mBackoff = (mBackoff * 2 > mMaxBackoff) ? mMaxBackoff : mBackoff * 2;
+      if (mNodeMetrics)
+      {
+        mNodeMetrics->recordRetry();
+        mNodeMetrics->recordBackoff(mBackoff);
       }
-      default:
+
+      mLogger.warn(
+        [&]()
+        {
+          return "Retrying topic subscription in " +
+                 std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(mBackoff).count()) +
+                 " ms after failure during attempt #" + std::to_string(mAttempt) + ": " + status.error_message();
+        });
+      if (mDriver->schedule(std::chrono::system_clock::now() + mBackoff,
+                            [self = shared_from_this(), status](bool ok)
+                            {
+                              if (ok)
+                              {
+                                self->connect();
+                              }
+                              else
+                              {
+                                self->mErrorHandler(status);
+                                self->end();
+                              }
+                            }))
       {
-        // Not sure what to do here, just fail out.
-        std::cout << "Unknown gRPC completion queue event, failing.." << std::endl;
         return;
       }
     }
+
+    // This RPC call shouldn't be retried, handle the error.
+    mLogger.debug(
+      [&]()
+      {
+        return "Topic subscription failed after attempt #" + std::to_string(mAttempt) + ": " +
+               status.error_message();
+      });
+    mErrorHandler(status);
+    end();
+  }
+
+  // Remove this subscription from the SubscriptionReactor, and release the handle.
+  void end()
+  {
+    if (const std::shared_ptr<internal::SubscriptionReactor> reactor = mReactor.lock())
+    {
+      reactor->remove(this);
+    }
+
+    // Releasing the last reference to the handle unsubscribes, which takes the lock.
+    std::shared_ptr<SubscriptionHandle> handle;
+    {
+      std::unique_lock lock(mMutex);
+      handle = std::move(mHandle);
+    }
   }
+
+  // The mirror network to which to send the query.
+  std::shared_ptr<internal::MirrorNetwork> mNetwork;
+
+  // The query to send. It is updated as messages are received, so that a retry resumes where the stream left off.
+  com::hedera::mirror::api::proto::ConsensusTopicQuery mQuery;
+
+  // The function to run when there's an error.
+  std::function<void(grpc::Status)> mErrorHandler;
+
+  // The function to run when a retry is required.
+  std::function<bool(grpc::Status)> mRetryHandler;
+
+  // The function to run when streaming is complete.
+  std::function<void(void)> mCompletionHandler;
+
+  // The function to run with each received message.
+  std::function<void(const TopicMessage&)> mOnNext;
+
+  // The maximum number of times to retry the call.
+  uint32_t mMaxAttempts;
+
+  // The maximum amount of time to wait between attempts.
+  std::chrono::system_clock::duration mMaxBackoff;
+
+  // The amount of time waited before the last retry.
+  std::chrono::system_clock::duration mBackoff = DEFAULT_MIN_BACKOFF;
+
+  // The number of times the call has been retried.
+  uint32_t mAttempt = 0U;
+
+  // The reactor running this subscription.
+  std::weak_ptr<internal::SubscriptionReactor> mReactor;
+
+  // The driver on which this subscription's events run.
+  std::shared_ptr<internal::CompletionQueueDriver> mDriver;
+
+  // The handle of this subscription.
+  std::shared_ptr<SubscriptionHandle> mHandle;
+
+  // The mutex protecting the context, handle, and cancellation flag, which are used by unsubscribing threads.
+  std::mutex mMutex;
+
+  // Has this subscription been cancelled?
+  bool mCancelled = false;
+
+  // The context of the current call.
+  std::unique_ptr<grpc::ClientContext> mContext;
+
+  // The reader of the current call.
+  std::unique_ptr<grpc::ClientAsyncReader<com::hedera::mirror::api::proto::ConsensusTopicResponse>> mReader;
+
+  // The message being read.
+  com::hedera::mirror::api::proto::ConsensusTopicResponse mResponse;
+
+  // The final status of the current call.
+  grpc::Status mStatus;
+
+  // The chunks received so far of chunked messages that are not complete yet.
+  internal::ChunkReassembler mChunkReassembler;
+
+  // The Logger with which to log retries and failures.
+  Logger mLogger;
+
+  // The registry in which the metrics of this subscription are recorded.
+  std::shared_ptr<internal::MetricsRegistry> mMetricsRegistry;
+
+  // The metrics of the mirror node of the current call. Null until the first call is sent.
+  internal::MetricsRegistry::NodeRequestMetrics* mNodeMetrics = nullptr;
+};
+
+//-----
+void SubscriptionEvent::proceed(bool ok)
+{
+  ((*mSubscription).*mHandler)(ok);
 }
 
 } // namespace
@@ -247,6 +418,16 @@ struct TopicMessageQuery::TopicMessageQueryImpl
   // The maximum amount of time to wait between submission attempts.
   std::chrono::system_clock::duration mMaxBackoff = DEFAULT_MAX_BACKOFF;
 
+  // The maximum number of bytes of chunks to keep for incomplete chunked messages.
+  std::size_t mMaxPendingChunkBytes = DEFAULT_MAX_PENDING_CHUNK_BYTES;
+
+  // The amount of time to wait for the rest of a chunked message after its first chunk arrives.
+  std::chrono::system_clock::duration mChunkReassemblyTimeout = DEFAULT_CHUNK_REASSEMBLY_TIMEOUT;
+
+  // The chunk reassembly counters shared by the subscriptions started from this query.
+  std::shared_ptr<internal::ChunkReassembler::Counters> mChunkCounters =
+    std::make_shared<internal::ChunkReassembler::Counters>();
+
   // The function to run when there's an error.
   std::function<void(grpc::Status)> mErrorHandler = [](const grpc::Status& status)
   { std::cout << "Subscription error: " << status.error_message() << std::endl; };
@@ -280,6 +461,8 @@ TopicMessageQuery::TopicMessageQuery(const TopicMessageQuery& other)
   mImpl->mQuery = other.mImpl->mQuery;
   mImpl->mMaxAttempts = other.mImpl->mMaxAttempts;
   mImpl->mMaxBackoff = other.mImpl->mMaxBackoff;
+  mImpl->mMaxPendingChunkBytes = other.mImpl->mMaxPendingChunkBytes;
+  mImpl->mChunkReassemblyTimeout = other.mImpl->mChunkReassemblyTimeout;
 }
 
 //-----
@@ -290,6 +473,8 @@ TopicMessageQuery& TopicMessageQuery::operator=(const TopicMessageQuery& other)
     mImpl->mQuery = other.mImpl->mQuery;
     mImpl->mMaxAttempts = other.mImpl->mMaxAttempts;
     mImpl->mMaxBackoff = other.mImpl->mMaxBackoff;
+    mImpl->mMaxPendingChunkBytes = other.mImpl->mMaxPendingChunkBytes;
+    mImpl->mChunkReassemblyTimeout = other.mImpl->mChunkReassemblyTimeout;
   }
 
   return *this;
@@ -321,33 +506,24 @@ TopicMessageQuery& TopicMessageQuery::operator=(TopicMessageQuery&& other) noexc
 std::shared_ptr<SubscriptionHandle> TopicMessageQuery::subscribe(const Client& client,
                                                                  const std::function<void(const TopicMessage&)>& onNext)
 {
-  // Create the subscription handle and assign its unsubscribe function to cancel this TopicMessageQuery's context
-  // (which will cancel the gRPC call).
+  // Create the subscription handle. Its unsubscribe function cancels the subscription's current gRPC call.
   auto handle = std::make_shared<SubscriptionHandle>();
 
-  // Set up the subscription before passing it to the listening thread.
-  auto context = std::make_unique<grpc::ClientContext>();
-  auto queue = std::make_unique<grpc::CompletionQueue>();
-  auto callStatus = std::make_unique<CallStatus>();
-
-  // Send the query and initiate the subscription.
-  std::thread(&startSubscription,
-              client.getClientMirrorNetwork(),
-              getConnectedMirrorNode(client.getClientMirrorNetwork())
-                ->getConsensusServiceStub()
-                ->AsyncsubscribeTopic(context.get(), mImpl->mQuery, queue.get(), callStatus.get()),
-              std::move(context),
-              std::move(queue),
-              std::move(callStatus),
-              mImpl->mQuery,
-              mImpl->mErrorHandler,
-              mImpl->mRetryHandler,
-              mImpl->mCompletionHandler,
-              onNext,
-              mImpl->mMaxAttempts,
-              mImpl->mMaxBackoff,
-              handle)
-    .detach();
+  // Send the query and initiate the subscription. From here on, it is driven by the Client's SubscriptionReactor.
+  std::make_shared<TopicSubscription>(client.getClientMirrorNetwork(),
+                                      mImpl->mQuery,
+                                      mImpl->mErrorHandler,
+                                      mImpl->mRetryHandler,
+                                      mImpl->mCompletionHandler,
+                                      onNext,
+                                      mImpl->mMaxAttempts,
+                                      mImpl->mMaxBackoff,
+                                      internal::ChunkReassembler(mImpl->mMaxPendingChunkBytes,
+                                                                 mImpl->mChunkReassemblyTimeout,
+                                                                 mImpl->mChunkCounters),
+                                      client.getLogger(),
+                                      client.getMetricsRegistry())
+    ->start(client.getSubscriptionReactor(), handle);
 
   return handle;
 }
@@ -394,6 +570,20 @@ TopicMessageQuery& TopicMessageQuery::setMaxBackoff(const std::chrono::system_cl
   return *this;
 }
 
+//-----
+TopicMessageQuery& TopicMessageQuery::setMaxPendingChunkBytes(std::size_t bytes)
+{
+  mImpl->mMaxPendingChunkBytes = bytes;
+  return *this;
+}
+
+//-----
+TopicMessageQuery& TopicMessageQuery::setChunkReassemblyTimeout(const std::chrono::system_clock::duration& timeout)
+{
+  mImpl->mChunkReassemblyTimeout = timeout;
+  return *this;
+}
+
 //-----
 TopicMessageQuery& TopicMessageQuery::setErrorHandler(const std::function<void(grpc::Status)>& func)
 {
@@ -451,4 +641,22 @@ std::chrono::system_clock::duration TopicMessageQuery::getMaxBackoff() const
   return mImpl->mMaxBackoff;
 }
 
+//-----
+std::size_t TopicMessageQuery::getMaxPendingChunkBytes() const
+{
+  return mImpl->mMaxPendingChunkBytes;
+}
+
+//-----
+std::chrono::system_clock::duration TopicMessageQuery::getChunkReassemblyTimeout() const
+{
+  return mImpl->mChunkReassemblyTimeout;
+}
+
+//-----
+TopicMessageQuery::ChunkStatistics TopicMessageQuery::getChunkStatistics() const
+{
+  return mImpl->mChunkCounters->get();
+}
+
 } // namespace Hiero
@@ -84,10 +84,16 @@ void TopicMessageSubmitTransaction::addToChunk(uint32_t chunk, uint32_t total, p
   body.mutable_consensussubmitmessage()->mutable_chunkinfo()->set_total(static_cast<int32_t>(total));
 }
 
+//-----
+bool TopicMessageSubmitTransaction::isChunkOrderSensitive() const
+{
+  return false;
+}
+
 //-----
 void TopicMessageSubmitTransaction::initFromSourceTransactionBody()
 {
-  const proto::TransactionBody transactionBody = getSourceTransactionBody();
+  const proto::TransactionBody& transactionBody = getSourceTransactionBody();
 
   if (!transactionBody.has_consensussubmitmessage())
   {
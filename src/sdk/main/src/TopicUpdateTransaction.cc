@@ -144,7 +144,7 @@ void TopicUpdateTransaction::addToBody(proto::TransactionBody& body) const
 //-----
 void TopicUpdateTransaction::initFromSourceTransactionBody()
 {
-  const proto::TransactionBody transactionBody = getSourceTransactionBody();
+  const proto::TransactionBody& transactionBody = getSourceTransactionBody();
 
   if (!transactionBody.has_consensusupdatetopic())
   {
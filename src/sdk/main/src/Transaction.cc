@@ -61,19 +61,46 @@
 #include "exceptions/UninitializedException.h"
 #include "impl/DurationConverter.h"
 #include "impl/Network.h"
+#include "impl/Node.h"
+#include "impl/TaskPool.h"
+#include "impl/TransactionBodyTemplate.h"
+#include "impl/TransactionIdGenerator.h"
 #include "impl/Utilities.h"
 #include "impl/openssl_utils/OpenSSLUtils.h"
 
 #include <basic_types.pb.h>
+#include <google/protobuf/descriptor.h>
 #include <transaction.pb.h>
 #include <transaction_body.pb.h>
 #include <transaction_contents.pb.h>
 #include <transaction_list.pb.h>
 #include <transaction_response.pb.h>
+#include <algorithm>
+#include <iterator>
+#include <numeric>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 
 namespace Hiero
 {
+namespace
+{
+//-----
+// Has the key with a public key prefix already contributed a signature to a
+// SignedTransaction protobuf object (i.e. in a previous build)? Such a key
+// doesn't need to sign it again.
+bool hasSigned(const proto::SignedTransaction& signedTransaction, const std::string& publicKeyPrefix)
+{
+  const auto& signaturePairs = signedTransaction.sigmap().sigpair();
+  return std::any_of(signaturePairs.cbegin(),
+                     signaturePairs.cend(),
+                     [&publicKeyPrefix](const proto::SignaturePair& signaturePair)
+                     { return signaturePair.pubkeyprefix() == publicKeyPrefix; });
+}
+
+} // namespace
+
 //-----
 template<typename SdkRequestType>
 struct Transaction<SdkRequestType>::TransactionImpl
@@ -91,6 +118,11 @@ struct Transaction<SdkRequestType>::TransactionImpl
   // sent.
   std::vector<proto::Transaction> mTransactions;
 
+  // The SHA384 hashes of the signed transaction bytes of the Transaction
+  // protobuf objects in mTransactions, computed once when each is built. The
+  // hash of a Transaction protobuf object that hasn't been built is empty.
+  std::vector<std::vector<std::byte>> mTransactionHashes;
+
   // List of SignedTransaction protobuf objects. The index of these
   // SignedTransactions match up with their corresponding Transaction protobuf
   // object in mTransactions.
@@ -143,6 +175,9 @@ struct Transaction<SdkRequestType>::TransactionImpl
   // will use the Client's set transaction ID regeneration policy. If that's not
   // set, the default behavior is captured in DEFAULT_REGENERATE_TRANSACTION_ID.
   std::optional<bool> mTransactionIdRegenerationPolicy;
+
+  // Should this Transaction generate its signatures in parallel?
+  bool mParallelSigning = false;
 };
 
 //-----
@@ -410,6 +445,8 @@ SdkRequestType& Transaction<SdkRequestType>::addSignature(const std::shared_ptr<
   // regenerated.
   mImpl->mTransactions.clear();
   mImpl->mTransactions.resize(mImpl->mSignedTransactions.size());
+  mImpl->mTransactionHashes.clear();
+  mImpl->mTransactionHashes.resize(mImpl->mSignedTransactions.size());
   mImpl->mSignatories.emplace(publicKey, std::function<std::vector<std::byte>(const std::vector<std::byte>&)>());
   mImpl->mPrivateKeys.emplace(publicKey, nullptr);
 
@@ -473,7 +510,11 @@ SdkRequestType& Transaction<SdkRequestType>::freezeWith(const Client* client)
     }
 
     // Generate a transaction ID with the client.
-    mImpl->mTransactionId = TransactionId::generate(client->getOperatorAccountId().value());
+    const AccountId operatorAccountId = client->getOperatorAccountId().value();
+    mImpl->mTransactionId = TransactionId::withValidStart(
+      operatorAccountId,
+      internal::TransactionIdGenerator::getInstance().next(
+        operatorAccountId, getRequiredValidStarts(), client->getTransactionIdBackdate()));
   }
 
   if (Executable<SdkRequestType, proto::Transaction, proto::TransactionResponse, TransactionResponse>::
@@ -534,8 +575,7 @@ std::vector<std::byte> Transaction<SdkRequestType>::getTransactionHash() const
 
   // Use the first transaction's hash.
   buildTransaction(0U);
-  return internal::OpenSSLUtils::computeSHA384(
-    internal::Utilities::stringToByteVector(getTransactionProtobufObject(0U).signedtransactionbytes()));
+  return getTransactionProtobufObjectHash(0U);
 }
 
 //-----
@@ -555,8 +595,7 @@ std::map<AccountId, std::vector<std::byte>> Transaction<SdkRequestType>::getTran
   std::map<AccountId, std::vector<std::byte>> hashes;
   for (unsigned int i = 0; i < mImpl->mTransactions.size(); ++i)
   {
-    hashes[nodeAccountIds.at(i)] = internal::OpenSSLUtils::computeSHA384(
-      internal::Utilities::stringToByteVector(getTransactionProtobufObject(i).signedtransactionbytes()));
+    hashes[nodeAccountIds.at(i)] = getTransactionProtobufObjectHash(i);
   }
 
   return hashes;
@@ -630,6 +669,14 @@ SdkRequestType& Transaction<SdkRequestType>::setRegenerateTransactionIdPolicy(bo
   return static_cast<SdkRequestType&>(*this);
 }
 
+//-----
+template<typename SdkRequestType>
+SdkRequestType& Transaction<SdkRequestType>::setParallelSigning(bool parallel)
+{
+  mImpl->mParallelSigning = parallel;
+  return static_cast<SdkRequestType&>(*this);
+}
+
 //-----
 template<typename SdkRequestType>
 TransactionId Transaction<SdkRequestType>::getTransactionId() const
@@ -679,6 +726,13 @@ std::optional<bool> Transaction<SdkRequestType>::getRegenerateTransactionIdPolic
   return mImpl->mTransactionIdRegenerationPolicy;
 }
 
+//-----
+template<typename SdkRequestType>
+bool Transaction<SdkRequestType>::getParallelSigning() const
+{
+  return mImpl->mParallelSigning;
+}
+
 //-----
 template<typename SdkRequestType>
 Transaction<SdkRequestType>::Transaction()
@@ -878,7 +932,7 @@ Transaction<SdkRequestType>::Transaction(
 
 //-----
 template<typename SdkRequestType>
-proto::Transaction Transaction<SdkRequestType>::makeRequest(unsigned int index) const
+const proto::Transaction& Transaction<SdkRequestType>::makeRequest(unsigned int index) const
 {
   mImpl->mTransactionIndex = index;
   buildTransaction(index);
@@ -889,6 +943,14 @@ proto::Transaction Transaction<SdkRequestType>::makeRequest(unsigned int index)
 template<typename SdkRequestType>
 void Transaction<SdkRequestType>::buildAllTransactions() const
 {
+  if (mImpl->mParallelSigning)
+  {
+    std::vector<unsigned int> indices(mImpl->mSignedTransactions.size());
+    std::iota(indices.begin(), indices.end(), 0U);
+    buildTransactionsInParallel(indices);
+    return;
+  }
+
   // Go through each SignedTransaction protobuf object and add all signatures to
   // its SignatureMap protobuf object.
   for (unsigned int i = 0; i < mImpl->mSignedTransactions.size(); ++i)
@@ -951,6 +1013,9 @@ void Transaction<SdkRequestType>::addTransaction(const proto::Transaction& trans
   // Add the Transaction protobuf object to the Transaction protobuf object
   // list.
   mImpl->mTransactions.push_back(transaction);
+  mImpl->mTransactionHashes.push_back(transaction.signedtransactionbytes().empty()
+                                        ? std::vector<std::byte>()
+                                        : internal::OpenSSLUtils::computeSHA384(transaction.signedtransactionbytes()));
 
   // Parse the Transaction protobuf object into a SignedTransaction protobuf
   // object.
@@ -968,26 +1033,26 @@ template<typename SdkRequestType>
 void Transaction<SdkRequestType>::addTransaction(const proto::SignedTransaction& transaction) const
 {
   mImpl->mTransactions.push_back(proto::Transaction());
+  mImpl->mTransactionHashes.emplace_back();
   mImpl->mSignedTransactions.push_back(transaction);
 }
 
 //-----
 template<typename SdkRequestType>
-void Transaction<SdkRequestType>::addSignedTransactionForEachNode(proto::TransactionBody transactionBody) const
+void Transaction<SdkRequestType>::addSignedTransactionForEachNode(const proto::TransactionBody& transactionBody) const
 {
+  // Serialize the TransactionBody once, and only splice in the node account ID for each node.
+  const internal::TransactionBodyTemplate bodyTemplate(transactionBody);
+
   // For each node account ID, generate the SignedTransaction protobuf object.
+  proto::SignedTransaction signedTransaction;
   for (const AccountId& accountId :
        Executable<SdkRequestType, proto::Transaction, proto::TransactionResponse, TransactionResponse>::
          getNodeAccountIds())
   {
-    transactionBody.set_allocated_nodeaccountid(accountId.toProtobuf().release());
-
-    proto::SignedTransaction signedTransaction;
-    signedTransaction.set_bodybytes(transactionBody.SerializeAsString());
+    signedTransaction.set_bodybytes(bodyTemplate.getBodyBytes(accountId));
     addTransaction(signedTransaction);
   }
-
-  transactionBody.clear_nodeaccountid();
 }
 
 //-----
@@ -996,6 +1061,7 @@ void Transaction<SdkRequestType>::clearTransactions() const
 {
   mImpl->mSignedTransactions.clear();
   mImpl->mTransactions.clear();
+  mImpl->mTransactionHashes.clear();
 }
 
 //-----
@@ -1062,14 +1128,21 @@ Transaction<SdkRequestType>::getSignaturesInternal(size_t offset) const
 
 //-----
 template<typename SdkRequestType>
-proto::Transaction Transaction<SdkRequestType>::getTransactionProtobufObject(unsigned int index) const
+const proto::Transaction& Transaction<SdkRequestType>::getTransactionProtobufObject(unsigned int index) const
 {
   return mImpl->mTransactions.at(index);
 }
 
 //-----
 template<typename SdkRequestType>
-proto::TransactionBody Transaction<SdkRequestType>::getSourceTransactionBody() const
+const std::vector<std::byte>& Transaction<SdkRequestType>::getTransactionProtobufObjectHash(unsigned int index) const
+{
+  return mImpl->mTransactionHashes.at(index);
+}
+
+//-----
+template<typename SdkRequestType>
+const proto::TransactionBody& Transaction<SdkRequestType>::getSourceTransactionBody() const
 {
   // mSourceTransactionBody should not be updated in this call because
   // updateSourceTransactionBody() makes a virtual call to addBody(), which will
@@ -1089,6 +1162,20 @@ TransactionId Transaction<SdkRequestType>::getCurrentTransactionId() const
   return mImpl->mTransactionId.value_or(TransactionId());
 }
 
+//-----
+template<typename SdkRequestType>
+unsigned int Transaction<SdkRequestType>::getRequiredValidStarts() const
+{
+  return 1U;
+}
+
+//-----
+template<typename SdkRequestType>
+bool Transaction<SdkRequestType>::isMaxTransactionFeeSet() const
+{
+  return mImpl->mMaxTransactionFee.has_value();
+}
+
 //-----
 template<typename SdkRequestType>
 TransactionResponse Transaction<SdkRequestType>::mapResponse(const proto::TransactionResponse&) const
@@ -1100,8 +1187,7 @@ TransactionResponse Transaction<SdkRequestType>::mapResponse(const proto::Transa
             getNodeAccountIds()
               .size()),
     getCurrentTransactionId(),
-    internal::OpenSSLUtils::computeSHA384(internal::Utilities::stringToByteVector(
-      getTransactionProtobufObject(mImpl->mTransactionIndex).signedtransactionbytes())));
+    getTransactionProtobufObjectHash(mImpl->mTransactionIndex));
 }
 
 //-----
@@ -1145,11 +1231,22 @@ typename Executable<SdkRequestType, proto::Transaction, proto::TransactionRespon
   {
     // If transaction IDs are allowed to be regenerated, regenerate the
     // transaction ID and the Transaction protobuf objects.
-    mImpl->mTransactionId = TransactionId::generate(mImpl->mTransactionId->mAccountId);
+    const TransactionId expiredTransactionId = mImpl->mTransactionId.value();
+    mImpl->mTransactionId = TransactionId::withValidStart(
+      mImpl->mTransactionId->mAccountId,
+      internal::TransactionIdGenerator::getInstance().next(
+        mImpl->mTransactionId->mAccountId, getRequiredValidStarts(), client.getTransactionIdBackdate()));
 
     // Regenerate the SignedTransaction protobuf objects.
     regenerateSignedTransactions(&client);
 
+    Executable<SdkRequestType, proto::Transaction, proto::TransactionResponse, TransactionResponse>::getLogger().debug(
+      [&]()
+      {
+        return "Transaction ID " + expiredTransactionId.toString() +
+               " expired, retrying with regenerated transaction ID " + mImpl->mTransactionId->toString();
+      });
+
     // Retry execution with the new transaction ID.
     return Executable<SdkRequestType, proto::Transaction, proto::TransactionResponse, TransactionResponse>::
       ExecutionStatus::RETRY;
@@ -1185,6 +1282,20 @@ void Transaction<SdkRequestType>::onExecute(const Client& client)
   }
 }
 
+//-----
+template<typename SdkRequestType>
+bool Transaction<SdkRequestType>::submitRequestAsync(
+  const proto::Transaction& request,
+  const std::shared_ptr<internal::Node>& node,
+  const std::chrono::system_clock::time_point& deadline,
+  internal::CompletionQueueDriver& driver,
+  const std::function<void(const grpc::Status&, const proto::TransactionResponse&)>& callback,
+  const std::shared_ptr<grpc::ClientContext>& context) const
+{
+  return node->submitTransactionAsync(
+    mImpl->mSourceTransactionBody.data_case(), request, deadline, driver, callback, context);
+}
+
 //-----
 template<typename SdkRequestType>
 void Transaction<SdkRequestType>::buildTransaction(unsigned int index) const
@@ -1196,6 +1307,12 @@ void Transaction<SdkRequestType>::buildTransaction(unsigned int index) const
     return;
   }
 
+  if (mImpl->mParallelSigning)
+  {
+    buildTransactionsInParallel({ index });
+    return;
+  }
+
   // For each PublicKey and signer function, generate a signature of the
   // TransactionBody protobuf object bytes held in the SignedTransaction
   // protobuf object at the provided index.
@@ -1204,8 +1321,9 @@ void Transaction<SdkRequestType>::buildTransaction(unsigned int index) const
   {
     // If there is no signer function, the signature has already been generated
     // for the SignedTransaction (either added manually with addSignature() or
-    // this Transaction came from fromBytes()).
-    if (signer)
+    // this Transaction came from fromBytes()). A signer that has already signed
+    // in a previous build doesn't sign again, as in buildTransactionsInParallel().
+    if (signer && !hasSigned(signedTransaction, internal::Utilities::byteVectorToString(publicKey->toBytesRaw())))
     {
       *signedTransaction.mutable_sigmap()->add_sigpair() = *publicKey->toSignaturePairProtobuf(
         signer(internal::Utilities::stringToByteVector(signedTransaction.bodybytes())));
@@ -1213,6 +1331,110 @@ void Transaction<SdkRequestType>::buildTransaction(unsigned int index) const
   }
 
   mImpl->mTransactions[index].set_signedtransactionbytes(signedTransaction.SerializeAsString());
+  mImpl->mTransactionHashes[index] =
+    internal::OpenSSLUtils::computeSHA384(mImpl->mTransactions[index].signedtransactionbytes());
+}
+
+//-----
+template<typename SdkRequestType>
+void Transaction<SdkRequestType>::buildTransactionsInParallel(const std::vector<unsigned int>& indices) const
+{
+  // Only the Transaction protobuf objects that haven't been built yet need
+  // signatures.
+  std::vector<unsigned int> toBuild;
+  std::copy_if(indices.cbegin(),
+               indices.cend(),
+               std::back_inserter(toBuild),
+               [this](unsigned int index) { return mImpl->mTransactions[index].signedtransactionbytes().empty(); });
+  if (toBuild.empty())
+  {
+    return;
+  }
+
+  // Gather the signer functions (and the public key prefixes they sign with)
+  // in the same order as they are visited in buildTransaction(), so the
+  // SignatureMaps come out in the same order.
+  std::vector<std::shared_ptr<PublicKey>> publicKeys;
+  std::vector<const std::function<std::vector<std::byte>(const std::vector<std::byte>&)>*> signers;
+  std::vector<std::string> publicKeyPrefixes;
+  for (const auto& [publicKey, signer] : mImpl->mSignatories)
+  {
+    if (signer)
+    {
+      publicKeys.push_back(publicKey);
+      signers.push_back(&signer);
+      publicKeyPrefixes.push_back(internal::Utilities::byteVectorToString(publicKey->toBytesRaw()));
+    }
+  }
+
+  // Group the SignedTransaction protobuf objects by body bytes, so that each
+  // distinct body is only signed once per signer.
+  std::vector<std::vector<std::byte>> bodies;
+  std::vector<size_t> bodyIndices(toBuild.size());
+  std::unordered_map<std::string_view, size_t> bodyIndicesByBytes;
+  for (size_t i = 0; i < toBuild.size(); ++i)
+  {
+    const std::string& bodyBytes = mImpl->mSignedTransactions[toBuild[i]].bodybytes();
+    const auto [iter, inserted] = bodyIndicesByBytes.try_emplace(bodyBytes, bodies.size());
+    if (inserted)
+    {
+      bodies.push_back(internal::Utilities::stringToByteVector(bodyBytes));
+    }
+
+    bodyIndices[i] = iter->second;
+  }
+
+  // Determine each (body, signer) pair that needs a signature.
+  std::vector<bool> isNeeded(bodies.size() * signers.size(), false);
+  for (size_t i = 0; i < toBuild.size(); ++i)
+  {
+    for (size_t signer = 0; signer < signers.size(); ++signer)
+    {
+      if (!hasSigned(mImpl->mSignedTransactions[toBuild[i]], publicKeyPrefixes[signer]))
+      {
+        isNeeded[bodyIndices[i] * signers.size() + signer] = true;
+      }
+    }
+  }
+
+  std::vector<size_t> tasks;
+  for (size_t task = 0; task < isNeeded.size(); ++task)
+  {
+    if (isNeeded[task])
+    {
+      tasks.push_back(task);
+    }
+  }
+
+  // Generate the signatures. Each task writes only its own slot, so no
+  // synchronization is needed.
+  std::vector<std::vector<std::byte>> signatures(isNeeded.size());
+  internal::TaskPool::getInstance().run(tasks.size(),
+                                        [&tasks, &signers, &bodies, &signatures](size_t task)
+                                        {
+                                          const size_t slot = tasks[task];
+                                          signatures[slot] =
+                                            (*signers[slot % signers.size()])(bodies[slot / signers.size()]);
+                                        });
+
+  // Add the signatures to each SignedTransaction protobuf object, in signer
+  // order, and build the Transaction protobuf objects.
+  for (size_t i = 0; i < toBuild.size(); ++i)
+  {
+    proto::SignedTransaction& signedTransaction = mImpl->mSignedTransactions[toBuild[i]];
+    for (size_t signer = 0; signer < signers.size(); ++signer)
+    {
+      if (!hasSigned(signedTransaction, publicKeyPrefixes[signer]))
+      {
+        *signedTransaction.mutable_sigmap()->add_sigpair() =
+          *publicKeys[signer]->toSignaturePairProtobuf(signatures[bodyIndices[i] * signers.size() + signer]);
+      }
+    }
+
+    mImpl->mTransactions[toBuild[i]].set_signedtransactionbytes(signedTransaction.SerializeAsString());
+    mImpl->mTransactionHashes[toBuild[i]] =
+      internal::OpenSSLUtils::computeSHA384(mImpl->mTransactions[toBuild[i]].signedtransactionbytes());
+  }
 }
 
 //-----
@@ -1222,6 +1444,16 @@ std::optional<TransactionId> Transaction<SdkRequestType>::getTransactionIdIntern
   return mImpl->mTransactionId;
 }
 
+//-----
+template<typename SdkRequestType>
+std::string Transaction<SdkRequestType>::getRequestType() const
+{
+  // The cases of the oneof are numbered after its fields.
+  const google::protobuf::FieldDescriptor* field =
+    proto::TransactionBody::descriptor()->FindFieldByNumber(mImpl->mSourceTransactionBody.data_case());
+  return field ? std::string(field->name()) : std::string("unknown");
+}
+
 //-----
 template<typename SdkRequestType>
 bool Transaction<SdkRequestType>::keyAlreadySigned(const std::shared_ptr<PublicKey>& publicKey) const
@@ -1254,6 +1486,8 @@ SdkRequestType& Transaction<SdkRequestType>::signInternal(
     // regenerated.
     mImpl->mTransactions.clear();
     mImpl->mTransactions.resize(mImpl->mSignedTransactions.size());
+    mImpl->mTransactionHashes.clear();
+    mImpl->mTransactionHashes.resize(mImpl->mSignedTransactions.size());
     mImpl->mSignatories.emplace(publicKey, signer);
     mImpl->mPrivateKeys.emplace(publicKey, privateKey);
   }
@@ -0,0 +1,222 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "TransactionBatchBuilder.h"
+#include "Client.h"
+#include "PublicKey.h"
+#include "exceptions/UninitializedException.h"
+#include "impl/Network.h"
+#include "impl/TaskPool.h"
+#include "impl/TransactionBodyTemplate.h"
+#include "impl/TransactionIdGenerator.h"
+
+#include <algorithm>
+#include <basic_types.pb.h>
+#include <chrono>
+#include <crypto_transfer.pb.h>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <timestamp.pb.h>
+#include <transaction_body.pb.h>
+#include <transaction_contents.pb.h>
+#include <transaction_list.pb.h>
+#include <utility>
+
+namespace Hiero
+{
+namespace
+{
+// The number of transfers built by each task of a batch. Each task reuses its scratch protobuf objects for all of its
+// transfers.
+constexpr std::size_t TRANSFERS_PER_TASK = 64ULL;
+
+//-----
+void setTimestamp(proto::Timestamp& timestamp, const std::chrono::system_clock::time_point& time)
+{
+  const std::chrono::system_clock::duration sinceEpoch = time.time_since_epoch();
+  const auto seconds = std::chrono::duration_cast<std::chrono::seconds>(sinceEpoch);
+  timestamp.set_seconds(seconds.count());
+  timestamp.set_nanos(
+    static_cast<int32_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(sinceEpoch - seconds).count()));
+}
+
+//-----
+void addHbarTransfer(proto::TransferList& transfers, const AccountId& accountId, int64_t amount)
+{
+  // Merge the amount into an unapproved transfer already in the list for the account, like a TransferTransaction does.
+  for (auto iter = transfers.mutable_accountamounts()->begin(); iter != transfers.mutable_accountamounts()->end();
+       ++iter)
+  {
+    if (!iter->is_approval() && AccountId::fromProtobuf(iter->accountid()) == accountId)
+    {
+      if (iter->amount() + amount == 0LL)
+      {
+        transfers.mutable_accountamounts()->erase(iter);
+      }
+      else
+      {
+        iter->set_amount(iter->amount() + amount);
+      }
+
+      return;
+    }
+  }
+
+  proto::AccountAmount* accountAmount = transfers.add_accountamounts();
+  accountAmount->set_allocated_accountid(accountId.toProtobuf().release());
+  accountAmount->set_amount(amount);
+}
+
+} // namespace
+
+//-----
+TransactionBatchBuilder::TransactionBatchBuilder(TransferTransaction prototype)
+  : mPrototype(std::move(prototype))
+{
+}
+
+//-----
+TransactionBatchBuilder& TransactionBatchBuilder::setSender(const AccountId& sender)
+{
+  mSender = sender;
+  return *this;
+}
+
+//-----
+TransactionBatchBuilder& TransactionBatchBuilder::setRecipients(std::vector<AccountId> recipients)
+{
+  mRecipients = std::move(recipients);
+  return *this;
+}
+
+//-----
+TransactionBatchBuilder& TransactionBatchBuilder::setAmounts(std::vector<Hbar> amounts)
+{
+  mAmounts = std::move(amounts);
+  return *this;
+}
+
+//-----
+TransactionBatchBuilder& TransactionBatchBuilder::setMemos(std::vector<std::string> memos)
+{
+  mMemos = std::move(memos);
+  return *this;
+}
+
+//-----
+TransactionBatchBuilder::Batch TransactionBatchBuilder::build(const Client& client) const
+{
+  if (mAmounts.size() != mRecipients.size())
+  {
+    throw std::invalid_argument("The number of amounts doesn't match the number of recipients");
+  }
+
+  if (!mMemos.empty() && mMemos.size() != mRecipients.size())
+  {
+    throw std::invalid_argument("The number of memos doesn't match the number of recipients");
+  }
+
+  if (!client.getOperatorAccountId().has_value())
+  {
+    throw UninitializedException("Client operator has not been initialized and cannot build transfers.");
+  }
+
+  const AccountId payer = client.getOperatorAccountId().value();
+  const AccountId sender = mSender.value_or(payer);
+  if (std::find(mRecipients.cbegin(), mRecipients.cend(), sender) != mRecipients.cend())
+  {
+    throw std::invalid_argument("A transfer can't be sent to its own sender");
+  }
+
+  const std::shared_ptr<PublicKey> operatorPublicKey = client.getOperatorPublicKey();
+  const std::function<std::vector<std::byte>(const std::vector<std::byte>&)> operatorSigner =
+    client.getOperatorSigner().value();
+
+  Batch batch;
+  batch.mNodeAccountIds = mPrototype.getNodeAccountIds();
+  if (batch.mNodeAccountIds.empty())
+  {
+    if (!client.getClientNetwork())
+    {
+      throw UninitializedException("Client has not been initialized with a valid network.");
+    }
+
+    batch.mNodeAccountIds = client.getClientNetwork()->getNodeAccountIdsForExecute();
+  }
+
+  // Get the TransactionBody shared by the transfers from the prototype, once for the whole batch.
+  proto::TransactionBody prototypeBody;
+  {
+    const std::vector<std::byte> bytes = mPrototype.toBytes();
+    proto::TransactionList transactionList;
+    transactionList.ParseFromArray(bytes.data(), static_cast<int>(bytes.size()));
+    proto::SignedTransaction signedTransaction;
+    signedTransaction.ParseFromString(transactionList.transaction_list(0).signedtransactionbytes());
+    prototypeBody.ParseFromString(signedTransaction.bodybytes());
+    prototypeBody.clear_nodeaccountid();
+    prototypeBody.clear_transactionid();
+    prototypeBody.mutable_transactionid()->set_allocated_accountid(payer.toProtobuf().release());
+  }
+
+  // Like a frozen Transaction, prefer the maximum transaction fee of the Client to the default one.
+  if (!mPrototype.isMaxTransactionFeeSet() && client.getMaxTransactionFee().has_value())
+  {
+    prototypeBody.set_transactionfee(static_cast<uint64_t>(client.getMaxTransactionFee()->toTinybars()));
+  }
+
+  // Reserve the valid starts of all the transfers at once. They are consecutive ticks of the system clock.
+  const std::chrono::system_clock::time_point firstValidStart = internal::TransactionIdGenerator::getInstance().next(
+    payer, static_cast<unsigned int>(mRecipients.size()), client.getTransactionIdBackdate());
+
+  batch.mTransfers.resize(mRecipients.size());
+  const auto buildTransfers = [&](std::size_t task)
+  {
+    // The scratch protobuf objects of this task. Only the fields that differ between transfers are updated for each.
+    proto::TransactionBody body = prototypeBody;
+    proto::Timestamp* validStart = body.mutable_transactionid()->mutable_transactionvalidstart();
+    proto::TransferList* transfers = body.mutable_cryptotransfer()->mutable_transfers();
+    proto::SignedTransaction signedTransaction;
+    std::vector<std::byte> bodyBytes;
+
+    const std::size_t end = std::min((task + 1U) * TRANSFERS_PER_TASK, mRecipients.size());
+    for (std::size_t i = task * TRANSFERS_PER_TASK; i < end; ++i)
+    {
+      const std::chrono::system_clock::time_point time =
+        firstValidStart + std::chrono::system_clock::duration(static_cast<std::chrono::system_clock::rep>(i));
+      setTimestamp(*validStart, time);
+
+      // Start from the prototype's transfers, which may already move Hbar to or from the sender or the recipient.
+      *transfers = prototypeBody.cryptotransfer().transfers();
+      addHbarTransfer(*transfers, sender, -mAmounts[i].toTinybars());
+      addHbarTransfer(*transfers, mRecipients[i], mAmounts[i].toTinybars());
+      if (!mMemos.empty())
+      {
+        body.set_memo(mMemos[i]);
+      }
+
+      SignedTransfer& transfer = batch.mTransfers[i];
+      transfer.mTransactionId = TransactionId::withValidStart(payer, time);
+      transfer.mTransactions.resize(batch.mNodeAccountIds.size());
+
+      // Serialize the body once, and only splice in the node account ID and sign it for each node.
+      const internal::TransactionBodyTemplate bodyTemplate(body);
+      for (std::size_t node = 0; node < batch.mNodeAccountIds.size(); ++node)
+      {
+        signedTransaction.set_bodybytes(bodyTemplate.getBodyBytes(batch.mNodeAccountIds[node]));
+        const auto* data = reinterpret_cast<const std::byte*>(signedTransaction.bodybytes().data());
+        bodyBytes.assign(data, data + signedTransaction.bodybytes().size());
+
+        signedTransaction.mutable_sigmap()->clear_sigpair();
+        *signedTransaction.mutable_sigmap()->add_sigpair() =
+          *operatorPublicKey->toSignaturePairProtobuf(operatorSigner(bodyBytes));
+        signedTransaction.SerializeToString(transfer.mTransactions[node].mutable_signedtransactionbytes());
+      }
+    }
+  };
+
+  internal::TaskPool::getInstance().run((mRecipients.size() + TRANSFERS_PER_TASK - 1U) / TRANSFERS_PER_TASK,
+                                        buildTransfers);
+  return batch;
+}
+
+} // namespace Hiero
@@ -7,6 +7,7 @@
 #include "TransactionRecordQuery.h"
 #include "impl/EntityIdHelper.h"
 #include "impl/TimestampConverter.h"
+#include "impl/TransactionIdGenerator.h"
 #include "impl/Utilities.h"
 
 #include <basic_types.pb.h>
@@ -23,7 +24,7 @@ TransactionId TransactionId::withValidStart(const AccountId& accountId,
 //-----
 TransactionId TransactionId::generate(const AccountId& accountId)
 {
-  return TransactionId(accountId, std::chrono::system_clock::now());
+  return TransactionId(accountId, internal::TransactionIdGenerator::getInstance().next(accountId));
 }
 
 //-----
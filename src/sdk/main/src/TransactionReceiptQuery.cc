@@ -58,20 +58,16 @@ void TransactionReceiptQuery::validateChecksums(const Client& client) const
 
 //-----
 typename Executable<TransactionReceiptQuery, proto::Query, proto::Response, TransactionReceipt>::ExecutionStatus
-TransactionReceiptQuery::determineStatus(Status status, const Client& client, const proto::Response& response)
+TransactionReceiptQuery::determineReceiptStatus(Status status, const proto::Response& response)
 {
-  if (const Executable<TransactionReceiptQuery, proto::Query, proto::Response, TransactionReceipt>::ExecutionStatus
-        baseStatus =
-          Executable<TransactionReceiptQuery, proto::Query, proto::Response, TransactionReceipt>::determineStatus(
-            status, client, response);
-      baseStatus == ExecutionStatus::SERVER_ERROR)
-  {
-    return baseStatus;
-  }
-
   switch (status)
   {
+    // The same statuses as Executable::determineStatus, for which another node should be tried.
+    case Status::PLATFORM_TRANSACTION_NOT_CREATED:
+    case Status::PLATFORM_NOT_ACTIVE:
     case Status::BUSY:
+      return ExecutionStatus::SERVER_ERROR;
+
     case Status::UNKNOWN:
     case Status::RECEIPT_NOT_FOUND:
     case Status::RECORD_NOT_FOUND:
@@ -97,6 +93,13 @@ TransactionReceiptQuery::determineStatus(Status status, const Client& client, co
   }
 }
 
+//-----
+typename Executable<TransactionReceiptQuery, proto::Query, proto::Response, TransactionReceipt>::ExecutionStatus
+TransactionReceiptQuery::determineStatus(Status status, const Client&, const proto::Response& response)
+{
+  return determineReceiptStatus(status, response);
+}
+
 //-----
 proto::Query TransactionReceiptQuery::buildRequest(proto::QueryHeader* header) const
 {
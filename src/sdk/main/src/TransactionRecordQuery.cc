@@ -62,11 +62,10 @@ void TransactionRecordQuery::validateChecksums(const Client& client) const
 typename Executable<TransactionRecordQuery, proto::Query, proto::Response, TransactionRecord>::ExecutionStatus
 TransactionRecordQuery::determineStatus(Status status, const Client& client, const proto::Response& response)
 {
+  // The base Query retries with the exact cost if a remembered cost was insufficient.
   if (const Executable<TransactionRecordQuery, proto::Query, proto::Response, TransactionRecord>::ExecutionStatus
-        baseStatus =
-          Executable<TransactionRecordQuery, proto::Query, proto::Response, TransactionRecord>::determineStatus(
-            status, client, response);
-      baseStatus == ExecutionStatus::SERVER_ERROR)
+        baseStatus = Query<TransactionRecordQuery, TransactionRecord>::determineStatus(status, client, response);
+      baseStatus == ExecutionStatus::SERVER_ERROR || baseStatus == ExecutionStatus::RETRY)
   {
     return baseStatus;
   }
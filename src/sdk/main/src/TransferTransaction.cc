@@ -204,7 +204,7 @@ void TransferTransaction::addToBody(proto::TransactionBody& body) const
 //-----
 void TransferTransaction::initFromSourceTransactionBody()
 {
-  const proto::TransactionBody transactionBody = getSourceTransactionBody();
+  const proto::TransactionBody& transactionBody = getSourceTransactionBody();
 
   if (!transactionBody.has_cryptotransfer())
   {
@@ -0,0 +1,117 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "impl/ArenaPool.h"
+
+#include <utility>
+
+namespace Hiero::internal
+{
+//-----
+struct ArenaPool::Lease::PooledArena
+{
+  explicit PooledArena(std::size_t initialBlockSize)
+    : mInitialBlock(initialBlockSize)
+    , mArena(getOptions(mInitialBlock))
+  {
+  }
+
+  // Get the options of an Arena that starts with the given block.
+  static google::protobuf::ArenaOptions getOptions(std::vector<char>& initialBlock)
+  {
+    google::protobuf::ArenaOptions options;
+    options.initial_block = initialBlock.data();
+    options.initial_block_size = initialBlock.size();
+    options.start_block_size = initialBlock.size();
+    return options;
+  }
+
+  // The initial block of the Arena. It's owned here rather than by the Arena, so that it's kept when the Arena is reset.
+  std::vector<char> mInitialBlock;
+
+  // The Arena.
+  google::protobuf::Arena mArena;
+};
+
+//-----
+ArenaPool::Lease::~Lease()
+{
+  if (mPool && mArena)
+  {
+    mPool->release(std::move(mArena));
+  }
+}
+
+//-----
+ArenaPool::Lease::Lease(Lease&& other) noexcept
+  : mPool(other.mPool)
+  , mArena(std::move(other.mArena))
+{
+  other.mPool = nullptr;
+}
+
+//-----
+google::protobuf::Arena* ArenaPool::Lease::get() const
+{
+  return &mArena->mArena;
+}
+
+//-----
+ArenaPool::Lease::Lease(ArenaPool* pool, std::unique_ptr<PooledArena> arena)
+  : mPool(pool)
+  , mArena(std::move(arena))
+{
+}
+
+//-----
+ArenaPool& ArenaPool::getInstance()
+{
+  static ArenaPool pool;
+  return pool;
+}
+
+//-----
+ArenaPool::ArenaPool(std::size_t initialBlockSize, std::size_t maxIdleArenas)
+  : mInitialBlockSize(initialBlockSize)
+  , mMaxIdleArenas(maxIdleArenas)
+{
+}
+
+//-----
+ArenaPool::~ArenaPool() = default;
+
+//-----
+ArenaPool::Lease ArenaPool::acquire()
+{
+  {
+    std::unique_lock lock(mMutex);
+    if (!mIdleArenas.empty())
+    {
+      std::unique_ptr<Lease::PooledArena> arena = std::move(mIdleArenas.back());
+      mIdleArenas.pop_back();
+      return Lease(this, std::move(arena));
+    }
+  }
+
+  return Lease(this, std::make_unique<Lease::PooledArena>(mInitialBlockSize));
+}
+
+//-----
+std::size_t ArenaPool::getIdleArenas() const
+{
+  std::unique_lock lock(mMutex);
+  return mIdleArenas.size();
+}
+
+//-----
+void ArenaPool::release(std::unique_ptr<Lease::PooledArena> arena)
+{
+  // Resetting frees the blocks the Arena allocated beyond its initial block, and destroys the messages on it.
+  arena->mArena.Reset();
+
+  std::unique_lock lock(mMutex);
+  if (mIdleArenas.size() < mMaxIdleArenas)
+  {
+    mIdleArenas.push_back(std::move(arena));
+  }
+}
+
+} // namespace Hiero::internal
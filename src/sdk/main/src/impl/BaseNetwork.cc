@@ -2,6 +2,8 @@
 #include "impl/BaseNetwork.h"
 #include "AccountId.h"
 #include "impl/BaseNodeAddress.h"
+#include "impl/CompletionQueueDriver.h"
+#include "impl/MetricsRegistry.h"
 #include "impl/MirrorNetwork.h"
 #include "impl/MirrorNode.h"
 #include "impl/Network.h"
@@ -10,6 +12,7 @@
 
 #include <algorithm>
 #include <thread>
+#include <utility>
 
 namespace Hiero::internal
 {
@@ -69,7 +72,13 @@ NetworkType& BaseNetwork<NetworkType, KeyType, NodeType>::setNetwork(
     }
 
     // If an entry doesn't exist, create one and add it to the nodes lists and network.
+    if (!mConnectivityDriver || mConnectivityDriver->isShutdown())
+    {
+      mConnectivityDriver = std::make_shared<CompletionQueueDriver>(1U);
+    }
+
     const std::shared_ptr<NodeType> newNode = createNodeFromNetworkEntry(address, key);
+    newNode->setConnectivityDriver(mConnectivityDriver);
     newNodes.insert(newNode);
     newNetwork[key].insert(newNode);
   }
@@ -84,11 +93,7 @@ NetworkType& BaseNetwork<NetworkType, KeyType, NodeType>::setNetwork(
   // Set the new nodes list and network.
   mNodes = newNodes;
   mNetwork = newNetwork;
-  mHealthyNodes.clear();
-
-  // Try to readmit all nodes.
-  mEarliestReadmitTime = std::chrono::system_clock::now();
-  readmitNodes();
+  publishNodeTable();
 
   return static_cast<NetworkType&>(*this);
 }
@@ -97,16 +102,18 @@ NetworkType& BaseNetwork<NetworkType, KeyType, NodeType>::setNetwork(
 template<typename NetworkType, typename KeyType, typename NodeType>
 void BaseNetwork<NetworkType, KeyType, NodeType>::increaseBackoff(const std::shared_ptr<NodeType>& node)
 {
-  std::unique_lock lock(*mMutex);
   node->increaseBackoff();
-  mHealthyNodes.erase(node);
+
+  if (const std::shared_ptr<MetricsRegistry> registry = std::atomic_load(&mMetricsRegistry))
+  {
+    registry->recordNodeBackoff(node->getKey().toString());
+  }
 }
 
 //-----
 template<typename NetworkType, typename KeyType, typename NodeType>
 void BaseNetwork<NetworkType, KeyType, NodeType>::decreaseBackoff(const std::shared_ptr<NodeType>& node) const
 {
-  std::unique_lock lock(*mMutex);
   node->decreaseBackoff();
 }
 
@@ -114,9 +121,13 @@ void BaseNetwork<NetworkType, KeyType, NodeType>::decreaseBackoff(const std::sha
 template<typename NetworkType, typename KeyType, typename NodeType>
 std::vector<std::shared_ptr<NodeType>> BaseNetwork<NetworkType, KeyType, NodeType>::getNodeProxies(const KeyType& key)
 {
-  std::unique_lock lock(*mMutex);
-  readmitNodes();
-  return { mNetwork[key].cbegin(), mNetwork[key].cend() };
+  const std::shared_ptr<const NodeTable> table = getNodeTable();
+  if (const auto iter = table->mNetwork.find(key); iter != table->mNetwork.cend())
+  {
+    return iter->second;
+  }
+
+  return {};
 }
 
 //-----
@@ -128,6 +139,11 @@ void BaseNetwork<NetworkType, KeyType, NodeType>::close() const
   {
     node->close();
   }
+
+  if (mConnectivityDriver)
+  {
+    mConnectivityDriver->shutdown();
+  }
 }
 
 //-----
@@ -136,6 +152,7 @@ NetworkType& BaseNetwork<NetworkType, KeyType, NodeType>::setMaxNodeAttempts(uns
 {
   std::unique_lock lock(*mMutex);
   mMaxNodeAttempts = attempts;
+  publishNodeTable();
   return static_cast<NetworkType&>(*this);
 }
 
@@ -176,6 +193,7 @@ NetworkType& BaseNetwork<NetworkType, KeyType, NodeType>::setMaxNodeReadmitTime(
 {
   std::unique_lock lock(*mMutex);
   mMaxNodeReadmitTime = time;
+  publishNodeTable();
   return static_cast<NetworkType&>(*this);
 }
 
@@ -198,50 +216,78 @@ NetworkType& BaseNetwork<NetworkType, KeyType, NodeType>::setLedgerId(const Ledg
   return static_cast<NetworkType&>(*this);
 }
 
+//-----
+template<typename NetworkType, typename KeyType, typename NodeType>
+NetworkType& BaseNetwork<NetworkType, KeyType, NodeType>::setMetricsRegistry(std::shared_ptr<MetricsRegistry> registry)
+{
+  std::atomic_store(&mMetricsRegistry, std::move(registry));
+  return static_cast<NetworkType&>(*this);
+}
+
 //-----
 template<typename NetworkType, typename KeyType, typename NodeType>
 std::vector<std::shared_ptr<NodeType>> BaseNetwork<NetworkType, KeyType, NodeType>::getNumberOfMostHealthyNodes(
   unsigned int count)
 {
-  // First, remove any nodes from the network that have exceeded the maximum number of node attempts.
-  if (mMaxNodeAttempts > 0U)
+  std::shared_ptr<const NodeTable> table = getNodeTable();
+
+  // First, remove any nodes from the network that have exceeded the maximum number of node attempts. This is rare, so
+  // the lock is only taken if there is such a node.
+  const auto exceededMaxAttempts = [&table](const std::shared_ptr<NodeType>& node)
+  { return table->mMaxNodeAttempts > 0U && node->getBadGrpcStatusCount() >= table->mMaxNodeAttempts; };
+  if (std::any_of(table->mNodes.cbegin(), table->mNodes.cend(), exceededMaxAttempts))
   {
-    auto nodeIter = mNodes.begin();
-    while (nodeIter != mNodes.end())
-    {
-      if ((*nodeIter)->getBadGrpcStatusCount() >= mMaxNodeAttempts)
-      {
-        (*nodeIter)->close();
-        removeNodeFromNetwork(*nodeIter);
-      }
-      else
-      {
-        ++nodeIter;
-      }
-    }
+    std::unique_lock lock(*mMutex);
+    table = getNodeTable();
+    std::for_each(table->mNodes.cbegin(),
+                  table->mNodes.cend(),
+                  [this, &exceededMaxAttempts](const std::shared_ptr<NodeType>& node)
+                  {
+                    if (exceededMaxAttempts(node))
+                    {
+                      node->close();
+                      removeNodeFromNetwork(node);
+                    }
+                  });
+
+    publishNodeTable();
+    table = getNodeTable();
   }
 
-  std::unordered_set<std::shared_ptr<NodeType>> nodes;
+  std::vector<std::shared_ptr<NodeType>> nodes;
+  std::vector<std::shared_ptr<NodeType>> candidates = table->mNodes;
+  count = std::min(count, static_cast<unsigned int>(candidates.size()));
+
   while (count > nodes.size())
   {
-    // Readmit nodes each time one is fetched. Since readmitting only happens periodically, calling this each time
-    // should not have a significant impact on performance.
-    readmitNodes();
+    // Move the healthy candidates to the front.
+    const std::chrono::system_clock::time_point now = std::chrono::system_clock::now();
+    const auto unhealthy = std::partition(candidates.begin(),
+                                          candidates.end(),
+                                          [&now](const std::shared_ptr<NodeType>& node)
+                                          { return node->getReadmitTime() < now; });
 
     // If there are no healthy nodes, wait until one can be readmitted.
-    if (mHealthyNodes.empty())
+    if (unhealthy == candidates.begin())
     {
-      std::this_thread::sleep_for(mEarliestReadmitTime - std::chrono::system_clock::now());
+      std::chrono::system_clock::time_point earliestReadmitTime = now + table->mMaxNodeReadmitTime;
+      std::for_each(candidates.cbegin(),
+                    candidates.cend(),
+                    [&earliestReadmitTime](const std::shared_ptr<NodeType>& node)
+                    { earliestReadmitTime = std::min(earliestReadmitTime, node->getReadmitTime()); });
+
+      std::this_thread::sleep_until(earliestReadmitTime);
       continue;
     }
 
-    // Add a random node (it won't be added if its repeated).
-    auto iter = mHealthyNodes.cbegin();
-    std::advance(iter, internal::Utilities::getRandomNumber(0U, static_cast<unsigned int>(mHealthyNodes.size()) - 1U));
-    nodes.insert(*iter);
+    // Take one of the healthy nodes out of the candidates.
+    const auto healthy = static_cast<std::size_t>(unhealthy - candidates.begin());
+    const auto iter = candidates.begin() + static_cast<std::ptrdiff_t>(selectHealthyNode(candidates, healthy));
+    nodes.push_back(*iter);
+    candidates.erase(iter);
   }
 
-  return { nodes.cbegin(), nodes.cend() };
+  return nodes;
 }
 
 //-----
@@ -253,38 +299,27 @@ void BaseNetwork<NetworkType, KeyType, NodeType>::setTransportSecurityInternal(T
 
 //-----
 template<typename NetworkType, typename KeyType, typename NodeType>
-void BaseNetwork<NetworkType, KeyType, NodeType>::readmitNodes()
+std::size_t BaseNetwork<NetworkType, KeyType, NodeType>::selectHealthyNode(
+  [[maybe_unused]] const std::vector<std::shared_ptr<NodeType>>& candidates,
+  std::size_t healthy) const
 {
-  const std::chrono::system_clock::time_point now = std::chrono::system_clock::now();
-
-  // Do nothing if the time for node re-admittance hasn't been reached yet.
-  if (now <= mEarliestReadmitTime)
-  {
-    return;
-  }
-
-  // Determine the next earliest readmit time.
-  std::chrono::system_clock::time_point nextEarliestReadmitTime = now + mMaxNodeReadmitTime;
+  return internal::Utilities::getRandomNumber(0U, static_cast<unsigned int>(healthy) - 1U);
+}
 
-  for (const auto& node : mNodes)
+//-----
+template<typename NetworkType, typename KeyType, typename NodeType>
+void BaseNetwork<NetworkType, KeyType, NodeType>::publishNodeTable()
+{
+  auto table = std::make_shared<NodeTable>();
+  table->mNodes = { mNodes.cbegin(), mNodes.cend() };
+  for (const auto& [key, nodes] : mNetwork)
   {
-    if (node->getReadmitTime() > now && node->getReadmitTime() < nextEarliestReadmitTime)
-    {
-      nextEarliestReadmitTime = node->getReadmitTime();
-    }
+    table->mNetwork[key] = { nodes.cbegin(), nodes.cend() };
   }
 
-  // Set the next earliest readmit time.
-  mEarliestReadmitTime = nextEarliestReadmitTime;
-
-  // Readmit nodes as healthy if they're passed their readmit time.
-  for (const auto& node : mNodes)
-  {
-    if (mHealthyNodes.find(node) == mHealthyNodes.end() && node->getReadmitTime() <= now)
-    {
-      mHealthyNodes.insert(node);
-    }
-  }
+  table->mMaxNodeAttempts = mMaxNodeAttempts;
+  table->mMaxNodeReadmitTime = mMaxNodeReadmitTime;
+  std::atomic_store(&mNodeTable, std::shared_ptr<const NodeTable>(std::move(table)));
 }
 
 //-----
@@ -293,7 +328,6 @@ void BaseNetwork<NetworkType, KeyType, NodeType>::removeNodeFromNetwork(const st
 {
   mNetwork[node->getKey()].erase(node);
   mNodes.erase(node);
-  mHealthyNodes.erase(node);
 }
 
 /**
@@ -5,8 +5,11 @@
 #include "impl/MirrorNode.h"
 #include "impl/Node.h"
 
+#include <algorithm>
 #include <grpcpp/channel.h>
 #include <grpcpp/create_channel.h>
+#include <stdexcept>
+#include <string>
 #include <thread>
 #include <utility>
 
@@ -24,87 +27,168 @@ void BaseNode<NodeType, KeyType>::close()
 template<typename NodeType, typename KeyType>
 void BaseNode<NodeType, KeyType>::increaseBackoff()
 {
-  std::unique_lock lock(*mMutex);
-  ++mBadGrpcStatusCount;
-  mReadmitTime = std::chrono::system_clock::now() + mCurrentBackoff;
-  mCurrentBackoff *= 2.0;
-
-  // Make sure the current backoff doesn't go over the max backoff.
-  if (mCurrentBackoff > mMaxNodeBackoff)
-  {
-    mCurrentBackoff = mMaxNodeBackoff;
-  }
+  mHealth.increaseBackoff();
 }
 
 //-----
 template<typename NodeType, typename KeyType>
 void BaseNode<NodeType, KeyType>::decreaseBackoff()
 {
-  std::unique_lock lock(*mMutex);
-  mCurrentBackoff /= 2.0;
-
-  // Make sure the current backoff doesn't go below the min backoff.
-  if (mCurrentBackoff < mMinNodeBackoff)
-  {
-    mCurrentBackoff = mMinNodeBackoff;
-  }
+  mHealth.decreaseBackoff();
 }
 
 //-----
 template<typename NodeType, typename KeyType>
 bool BaseNode<NodeType, KeyType>::isHealthy() const
 {
-  std::unique_lock lock(*mMutex);
-  return mReadmitTime < std::chrono::system_clock::now();
+  return mHealth.isHealthy(std::chrono::system_clock::now());
 }
 
 //-----
 template<typename NodeType, typename KeyType>
 bool BaseNode<NodeType, KeyType>::channelFailedToConnect()
 {
-  std::unique_lock lock(*mMutex);
-  if (mIsConnected)
+  // Waiting for the connection happens without the lock, so that other threads can keep using this BaseNode.
+  std::vector<std::shared_ptr<grpc::Channel>> channels;
+  std::shared_ptr<const ConnectivityWatchers> watchers;
+  {
+    std::unique_lock lock(*mMutex);
+    channels = getChannels();
+    watchers = mConnectivityWatchers;
+  }
+
+  if (std::any_of(watchers->cbegin(),
+                  watchers->cend(),
+                  [](const std::shared_ptr<ConnectivityWatcher>& watcher)
+                  { return watcher->getState() == GRPC_CHANNEL_READY; }))
   {
     return false;
   }
 
-  const std::chrono::system_clock::time_point timeoutTime = std::chrono::system_clock::now() + GET_STATE_TIMEOUT;
-  mIsConnected = getChannel()->WaitForConnected(timeoutTime);
+  const std::chrono::system_clock::time_point deadline = std::chrono::system_clock::now() + GET_STATE_TIMEOUT;
+  return std::none_of(channels.cbegin(),
+                      channels.cend(),
+                      [&deadline](const std::shared_ptr<grpc::Channel>& channel)
+                      { return channel->WaitForConnected(deadline); });
+}
+
+//-----
+template<typename NodeType, typename KeyType>
+bool BaseNode<NodeType, KeyType>::isChannelUnreachable()
+{
+  std::shared_ptr<const ConnectivityWatchers> watchers = std::atomic_load(&mConnectivityWatchers);
+  if (!watchers)
+  {
+    std::unique_lock lock(*mMutex);
+    static_cast<void>(getChannels());
+    watchers = mConnectivityWatchers;
+  }
 
-  return !mIsConnected;
+  return std::all_of(watchers->cbegin(),
+                     watchers->cend(),
+                     [](const std::shared_ptr<ConnectivityWatcher>& watcher) { return watcher->isUnreachable(); });
 }
 
 //-----
 template<typename NodeType, typename KeyType>
-std::chrono::system_clock::duration BaseNode<NodeType, KeyType>::getRemainingTimeForBackoff() const
+void BaseNode<NodeType, KeyType>::connect()
 {
+  // Creating the channels starts connecting them.
   std::unique_lock lock(*mMutex);
-  return mReadmitTime - std::chrono::system_clock::now();
+  static_cast<void>(getChannels());
 }
 
 //-----
 template<typename NodeType, typename KeyType>
-NodeType& BaseNode<NodeType, KeyType>::setMinNodeBackoff(const std::chrono::system_clock::duration& backoff)
+bool BaseNode<NodeType, KeyType>::waitForConnected(const std::chrono::system_clock::time_point& deadline)
 {
+  std::vector<std::shared_ptr<grpc::Channel>> channels;
+  {
+    std::unique_lock lock(*mMutex);
+    channels = getChannels();
+  }
+
+  // The channels connect concurrently, so waiting for them one after the other doesn't add up their connection times.
+  bool connected = true;
+  for (const std::shared_ptr<grpc::Channel>& channel : channels)
+  {
+    connected = channel->WaitForConnected(deadline) && connected;
+  }
+
+  return connected;
+}
+
+//-----
+template<typename NodeType, typename KeyType>
+NodeType& BaseNode<NodeType, KeyType>::setChannelPoolSize(unsigned int size)
+{
+  if (size == 0U)
+  {
+    throw std::invalid_argument("Channel pool size must be greater than 0");
+  }
+
   std::unique_lock lock(*mMutex);
-  if (mCurrentBackoff == mMinNodeBackoff)
+  if (mChannelPoolSize != size)
   {
-    mCurrentBackoff = backoff;
+    closeChannel();
+    mChannelPoolSize = size;
   }
 
-  mMinNodeBackoff = backoff;
   return static_cast<NodeType&>(*this);
 }
 
 //-----
 template<typename NodeType, typename KeyType>
-NodeType& BaseNode<NodeType, KeyType>::setMaxNodeBackoff(const std::chrono::system_clock::duration& backoff)
+NodeType& BaseNode<NodeType, KeyType>::setConnectivityDriver(std::shared_ptr<CompletionQueueDriver> driver)
 {
   std::unique_lock lock(*mMutex);
-  mMaxNodeBackoff = backoff;
+  mConnectivityDriver = std::move(driver);
   return static_cast<NodeType&>(*this);
 }
 
+//-----
+template<typename NodeType, typename KeyType>
+unsigned int BaseNode<NodeType, KeyType>::getChannelPoolSize() const
+{
+  std::unique_lock lock(*mMutex);
+  return mChannelPoolSize;
+}
+
+//-----
+template<typename NodeType, typename KeyType>
+std::chrono::system_clock::duration BaseNode<NodeType, KeyType>::getRemainingTimeForBackoff() const
+{
+  return mHealth.getReadmitTime() - std::chrono::system_clock::now();
+}
+
+//-----
+template<typename NodeType, typename KeyType>
+NodeType& BaseNode<NodeType, KeyType>::setMinNodeBackoff(const std::chrono::system_clock::duration& backoff)
+{
+  mHealth.setMinBackoff(backoff);
+  return static_cast<NodeType&>(*this);
+}
+
+//-----
+template<typename NodeType, typename KeyType>
+NodeType& BaseNode<NodeType, KeyType>::setMaxNodeBackoff(const std::chrono::system_clock::duration& backoff)
+{
+  mHealth.setMaxBackoff(backoff);
+  return static_cast<NodeType&>(*this);
+}
+
+//-----
+template<typename NodeType, typename KeyType>
+BaseNode<NodeType, KeyType>::~BaseNode()
+{
+  if (mConnectivityWatchers)
+  {
+    std::for_each(mConnectivityWatchers->cbegin(),
+                  mConnectivityWatchers->cend(),
+                  [](const std::shared_ptr<ConnectivityWatcher>& watcher) { watcher->stop(); });
+  }
+}
+
 //-----
 template<typename NodeType, typename KeyType>
 BaseNode<NodeType, KeyType>::BaseNode(BaseNodeAddress address)
@@ -127,26 +211,41 @@ NodeType& BaseNode<NodeType, KeyType>::setAddress(const BaseNodeAddress& address
 template<typename NodeType, typename KeyType>
 std::shared_ptr<grpc::Channel> BaseNode<NodeType, KeyType>::getChannel()
 {
-  if (!mChannel)
-  {
-    grpc::ChannelArguments channelArguments;
-    channelArguments.SetInt(GRPC_ARG_ENABLE_RETRIES, 0);
-    channelArguments.SetInt(GRPC_ARG_KEEPALIVE_TIMEOUT_MS, 10000);
-    channelArguments.SetInt(GRPC_ARG_KEEPALIVE_PERMIT_WITHOUT_CALLS, 1);
+  return getChannels().front();
+}
 
-    if (const std::string authority = getAuthority(); !authority.empty())
+//-----
+template<typename NodeType, typename KeyType>
+const std::vector<std::shared_ptr<grpc::Channel>>& BaseNode<NodeType, KeyType>::getChannels()
+{
+  if (mChannels.empty())
+  {
+    auto watchers = std::make_shared<ConnectivityWatchers>();
+    mChannels.reserve(mChannelPoolSize);
+    watchers->reserve(mChannelPoolSize);
+    for (unsigned int i = 0U; i < mChannelPoolSize; ++i)
     {
-      channelArguments.SetString(GRPC_ARG_DEFAULT_AUTHORITY, authority);
+      mChannels.push_back(createChannel(i));
     }
 
-    mChannel = grpc::CreateCustomChannel(mAddress.toString(),
-                                         mAddress.isTransportSecurity() ? getTlsChannelCredentials()
-                                                                        : grpc::InsecureChannelCredentials(),
-                                         channelArguments);
     initializeStubs();
+
+    // Start connecting right away, and keep track of the connectivity of the channels from now on.
+    std::for_each(mChannels.cbegin(),
+                  mChannels.cend(),
+                  [this, &watchers](const std::shared_ptr<grpc::Channel>& channel)
+                  { watchers->push_back(ConnectivityWatcher::watch(channel, mConnectivityDriver)); });
+    std::atomic_store(&mConnectivityWatchers, std::shared_ptr<const ConnectivityWatchers>(std::move(watchers)));
   }
 
-  return mChannel;
+  return mChannels;
+}
+
+//-----
+template<typename NodeType, typename KeyType>
+std::size_t BaseNode<NodeType, KeyType>::getNextChannelIndex(std::size_t channels)
+{
+  return mNextChannelIndex.fetch_add(1ULL, std::memory_order_relaxed) % channels;
 }
 
 //-----
@@ -156,14 +255,50 @@ std::shared_ptr<grpc::ChannelCredentials> BaseNode<NodeType, KeyType>::getTlsCha
   return grpc::experimental::TlsCredentials(grpc::experimental::TlsChannelCredentialsOptions());
 }
 
+//-----
+template<typename NodeType, typename KeyType>
+std::shared_ptr<grpc::Channel> BaseNode<NodeType, KeyType>::createChannel(unsigned int index) const
+{
+  grpc::ChannelArguments channelArguments;
+  channelArguments.SetInt(GRPC_ARG_ENABLE_RETRIES, 0);
+  channelArguments.SetInt(GRPC_ARG_KEEPALIVE_TIMEOUT_MS, 10000);
+  channelArguments.SetInt(GRPC_ARG_KEEPALIVE_PERMIT_WITHOUT_CALLS, 1);
+
+  if (const std::string authority = getAuthority(); !authority.empty())
+  {
+    channelArguments.SetString(GRPC_ARG_DEFAULT_AUTHORITY, authority);
+  }
+
+  // gRPC shares a connection between channels with the same target and arguments. Each channel of a pool gets its own
+  // subchannel pool and pooling domain, so that each one opens its own connection to the remote node.
+  if (mChannelPoolSize > 1U)
+  {
+    channelArguments.SetInt(GRPC_ARG_USE_LOCAL_SUBCHANNEL_POOL, 1);
+    channelArguments.SetString(GRPC_ARG_CHANNEL_POOL_DOMAIN, mAddress.toString() + '#' + std::to_string(index));
+  }
+
+  return grpc::CreateCustomChannel(mAddress.toString(),
+                                   mAddress.isTransportSecurity() ? getTlsChannelCredentials()
+                                                                  : grpc::InsecureChannelCredentials(),
+                                   channelArguments);
+}
+
 //-----
 template<typename NodeType, typename KeyType>
 void BaseNode<NodeType, KeyType>::closeChannel()
 {
   closeStubs();
 
-  // The connection is closed automatically upon destruction of the channel.
-  mChannel = nullptr;
+  if (mConnectivityWatchers)
+  {
+    std::for_each(mConnectivityWatchers->cbegin(),
+                  mConnectivityWatchers->cend(),
+                  [](const std::shared_ptr<ConnectivityWatcher>& watcher) { watcher->stop(); });
+    std::atomic_store(&mConnectivityWatchers, std::shared_ptr<const ConnectivityWatchers>());
+  }
+
+  // The connections are closed automatically upon destruction of the channels.
+  mChannels.clear();
 }
 
 /**
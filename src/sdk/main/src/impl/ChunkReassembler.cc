@@ -0,0 +1,154 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "impl/ChunkReassembler.h"
+
+#include <iterator>
+#include <utility>
+
+namespace Hiero::internal
+{
+//-----
+ChunkReassembler::Statistics ChunkReassembler::Counters::get() const
+{
+  Statistics statistics;
+  statistics.mCompletedMessages = mCompletedMessages.load(std::memory_order_relaxed);
+  statistics.mDuplicateChunks = mDuplicateChunks.load(std::memory_order_relaxed);
+  statistics.mInvalidChunks = mInvalidChunks.load(std::memory_order_relaxed);
+  statistics.mExpiredMessages = mExpiredMessages.load(std::memory_order_relaxed);
+  statistics.mEvictedMessages = mEvictedMessages.load(std::memory_order_relaxed);
+  return statistics;
+}
+
+//-----
+ChunkReassembler::ChunkReassembler(std::size_t maxPendingBytes,
+                                   const std::chrono::system_clock::duration& timeout,
+                                   std::shared_ptr<Counters> counters)
+  : mMaxPendingBytes(maxPendingBytes)
+  , mTimeout(timeout)
+  , mCounters(std::move(counters))
+{
+}
+
+//-----
+std::optional<TopicMessage> ChunkReassembler::add(com::hedera::mirror::api::proto::ConsensusTopicResponse response,
+                                                  const std::chrono::system_clock::time_point& now)
+{
+  evictExpired(now);
+
+  if (!response.has_chunkinfo() || response.chunkinfo().total() <= 1)
+  {
+    ++mCounters->mCompletedMessages;
+    return TopicMessage::ofSingle(response);
+  }
+
+  const auto total = static_cast<std::size_t>(response.chunkinfo().total());
+  const int32_t number = response.chunkinfo().number();
+  const TransactionId transactionId = TransactionId::fromProtobuf(response.chunkinfo().initialtransactionid());
+
+  // A late duplicate of a chunk of a message that has already been delivered would start the message over.
+  if (mCompletedTransactionIds.find(transactionId) != mCompletedTransactionIds.end())
+  {
+    ++mCounters->mDuplicateChunks;
+    return std::nullopt;
+  }
+
+  auto iter = mGroupsByTransactionId.find(transactionId);
+  if (iter == mGroupsByTransactionId.end())
+  {
+    if (number < 1 || static_cast<std::size_t>(number) > total)
+    {
+      ++mCounters->mInvalidChunks;
+      return std::nullopt;
+    }
+
+    ChunkGroup group;
+    group.mTransactionId = transactionId;
+    group.mFirstChunkTime = now;
+    group.mChunks.resize(total);
+    group.mReceived.resize(total, false);
+    mGroups.push_back(std::move(group));
+    iter = mGroupsByTransactionId.try_emplace(transactionId, std::prev(mGroups.end())).first;
+  }
+
+  // The total number of chunks of the message is the one given by its first chunk to arrive.
+  const std::list<ChunkGroup>::iterator group = iter->second;
+  if (number < 1 || static_cast<std::size_t>(number) > group->mChunks.size())
+  {
+    ++mCounters->mInvalidChunks;
+    return std::nullopt;
+  }
+
+  const auto index = static_cast<std::size_t>(number - 1);
+  if (group->mReceived[index])
+  {
+    ++mCounters->mDuplicateChunks;
+    return std::nullopt;
+  }
+
+  const std::size_t bytes = response.ByteSizeLong();
+  group->mChunks[index] = std::move(response);
+  group->mReceived[index] = true;
+  ++group->mReceivedCount;
+  group->mBytes += bytes;
+  mPendingBytes += bytes;
+
+  if (group->mReceivedCount == group->mChunks.size())
+  {
+    TopicMessage message = TopicMessage::ofMany(group->mChunks);
+    erase(group);
+    remember(transactionId, now);
+    ++mCounters->mCompletedMessages;
+    return message;
+  }
+
+  evictOverCapacity();
+  return std::nullopt;
+}
+
+//-----
+void ChunkReassembler::evictExpired(const std::chrono::system_clock::time_point& now)
+{
+  while (!mGroups.empty() && now - mGroups.front().mFirstChunkTime >= mTimeout)
+  {
+    erase(mGroups.begin());
+    ++mCounters->mExpiredMessages;
+  }
+
+  while (!mCompleted.empty() && now - mCompleted.front().second >= mTimeout)
+  {
+    mCompletedTransactionIds.erase(mCompleted.front().first);
+    mCompleted.pop_front();
+  }
+}
+
+//-----
+void ChunkReassembler::remember(const TransactionId& transactionId, const std::chrono::system_clock::time_point& now)
+{
+  if (mCompleted.size() == MAX_COMPLETED_MESSAGES)
+  {
+    mCompletedTransactionIds.erase(mCompleted.front().first);
+    mCompleted.pop_front();
+  }
+
+  mCompleted.emplace_back(transactionId, now);
+  mCompletedTransactionIds.insert(transactionId);
+}
+
+//-----
+void ChunkReassembler::evictOverCapacity()
+{
+  while (!mGroups.empty() && mPendingBytes > mMaxPendingBytes)
+  {
+    erase(mGroups.begin());
+    ++mCounters->mEvictedMessages;
+  }
+}
+
+//-----
+void ChunkReassembler::erase(std::list<ChunkGroup>::iterator group)
+{
+  mPendingBytes -= group->mBytes;
+  mGroupsByTransactionId.erase(group->mTransactionId);
+  mGroups.erase(group);
+}
+
+} // namespace Hiero::internal
@@ -0,0 +1,203 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "impl/CompletionQueueDriver.h"
+
+#include <algorithm>
+#include <exception>
+#include <grpcpp/alarm.h>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <utility>
+
+namespace Hiero::internal
+{
+namespace
+{
+// Is this thread one of the threads of a CompletionQueueDriver?
+thread_local bool gIsDriverThread = false;
+
+} // namespace
+
+//-----
+struct CompletionQueueDriver::State
+{
+  explicit State(const Logger& logger)
+    : mLogger(logger)
+  {
+  }
+
+  // Remove a timer from the set of pending timers.
+  void removeTimer(grpc::Alarm* alarm)
+  {
+    std::unique_lock lock(mTimerMutex);
+    mPendingTimers.erase(alarm);
+  }
+
+  // The CompletionQueue the driver is draining.
+  grpc::CompletionQueue mCompletionQueue;
+
+  // The Logger with which to report exceptions that escape a continuation.
+  Logger mLogger;
+
+  // The mutex protecting the set of pending timers.
+  std::mutex mTimerMutex;
+
+  // The alarms of the timers that have not fired yet, so that they can be cancelled on shutdown.
+  std::unordered_set<grpc::Alarm*> mPendingTimers;
+};
+
+//-----
+class CompletionQueueDriver::TimerOperation : public CompletionQueueDriver::Operation
+{
+public:
+  TimerOperation(State& state, std::function<void(bool)> callback)
+    : mState(state)
+    , mCallback(std::move(callback))
+  {
+  }
+
+  void proceed(bool ok) override
+  {
+    mState.removeTimer(&mAlarm);
+    mCallback(ok);
+  }
+
+  // The state of the driver that scheduled this timer. The thread running this timer co-owns it.
+  State& mState;
+
+  // The alarm that fires this timer.
+  grpc::Alarm mAlarm;
+
+  // The callback to run when this timer fires or is cancelled.
+  std::function<void(bool)> mCallback;
+};
+
+//-----
+CompletionQueueDriver::CompletionQueueDriver(unsigned int threads, const Logger& logger)
+  : mState(std::make_shared<State>(logger))
+{
+  threads = std::max(threads, 1U);
+  mThreads.reserve(threads);
+  for (unsigned int i = 0U; i < threads; ++i)
+  {
+    // Each thread gets its own reference to the state.
+    mThreads.emplace_back(&CompletionQueueDriver::run, mState);
+  }
+}
+
+//-----
+CompletionQueueDriver::~CompletionQueueDriver()
+{
+  shutdown();
+}
+
+//-----
+bool CompletionQueueDriver::start(const std::function<void(grpc::CompletionQueue*)>& start)
+{
+  std::shared_lock lock(mMutex);
+  if (mIsShutdown)
+  {
+    return false;
+  }
+
+  start(&mState->mCompletionQueue);
+  return true;
+}
+
+//-----
+bool CompletionQueueDriver::schedule(const std::chrono::system_clock::time_point& time,
+                                     std::function<void(bool)> callback)
+{
+  return start(
+    [this, &time, &callback](grpc::CompletionQueue* queue)
+    {
+      auto* timer = new TimerOperation(*mState, std::move(callback));
+
+      std::unique_lock lock(mState->mTimerMutex);
+      mState->mPendingTimers.insert(&timer->mAlarm);
+      timer->mAlarm.Set(queue, time, timer);
+    });
+}
+
+//-----
+void CompletionQueueDriver::shutdown()
+{
+  {
+    std::unique_lock lock(mMutex);
+    if (mIsShutdown)
+    {
+      return;
+    }
+
+    mIsShutdown = true;
+
+    // Cancelled timers complete with ok == false, so their callbacks still get a chance to clean up.
+    {
+      std::unique_lock timerLock(mState->mTimerMutex);
+      std::for_each(mState->mPendingTimers.begin(),
+                    mState->mPendingTimers.end(),
+                    [](grpc::Alarm* alarm) { alarm->Cancel(); });
+    }
+
+    mState->mCompletionQueue.Shutdown();
+  }
+
+  // A callback run by this driver may be the one shutting it down, in which case its own thread can't be joined. It's
+  // detached instead, and only touches the state it co-owns from then on, so this driver may safely be destroyed while
+  // that callback is still running.
+  for (std::thread& thread : mThreads)
+  {
+    if (thread.get_id() == std::this_thread::get_id())
+    {
+      thread.detach();
+    }
+    else if (thread.joinable())
+    {
+      thread.join();
+    }
+  }
+}
+
+//-----
+bool CompletionQueueDriver::isShutdown() const
+{
+  std::shared_lock lock(mMutex);
+  return mIsShutdown;
+}
+
+//-----
+bool CompletionQueueDriver::isDriverThread()
+{
+  return gIsDriverThread;
+}
+
+//-----
+void CompletionQueueDriver::run(const std::shared_ptr<State>& state)
+{
+  gIsDriverThread = true;
+
+  void* tag = nullptr;
+  bool ok = false;
+  while (state->mCompletionQueue.Next(&tag, &ok))
+  {
+    auto* operation = static_cast<Operation*>(tag);
+
+    // Continuations deliver their own errors, but a stray exception must never take down a thread of the driver.
+    try
+    {
+      operation->proceed(ok);
+    }
+    catch (const std::exception& ex)
+    {
+      state->mLogger.error(std::string("Exception escaped a completion queue continuation: ") + ex.what());
+    }
+    catch (...)
+    {
+      state->mLogger.error("Unknown exception escaped a completion queue continuation");
+    }
+
+    delete operation;
+  }
+}
+
+} // namespace Hiero::internal
@@ -0,0 +1,112 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "impl/ConnectivityWatcher.h"
+#include "impl/CompletionQueueDriver.h"
+
+#include <utility>
+
+namespace Hiero::internal
+{
+//-----
+class ConnectivityWatcher::WatchOperation : public CompletionQueueDriver::Operation
+{
+public:
+  explicit WatchOperation(std::shared_ptr<ConnectivityWatcher> watcher)
+    : mWatcher(std::move(watcher))
+  {
+  }
+
+  // A notification completes when the state changes or its deadline passes. Either way, the state is observed again.
+  void proceed(bool) override { mWatcher->observe(false); }
+
+  // The ConnectivityWatcher that registered this notification.
+  std::shared_ptr<ConnectivityWatcher> mWatcher;
+};
+
+//-----
+std::shared_ptr<ConnectivityWatcher> ConnectivityWatcher::watch(std::shared_ptr<grpc::Channel> channel,
+                                                                std::shared_ptr<CompletionQueueDriver> driver)
+{
+  std::shared_ptr<ConnectivityWatcher> watcher(new ConnectivityWatcher(std::move(channel), std::move(driver)));
+  watcher->observe(true);
+  return watcher;
+}
+
+//-----
+void ConnectivityWatcher::stop()
+{
+  mIsStopped = true;
+}
+
+//-----
+grpc_connectivity_state ConnectivityWatcher::getState()
+{
+  if (mIsWatching.load(std::memory_order_acquire) || mIsStopped)
+  {
+    return mState.load(std::memory_order_acquire);
+  }
+
+  // The watch is parked, so the last observed state may be stale. Observing the state doesn't make the channel connect.
+  const grpc_connectivity_state state = mChannel->GetState(false);
+  mState.store(state, std::memory_order_release);
+
+  // Resume the watch if the channel has started connecting again, i.e. because a request was sent on it.
+  if (bool parked = false; (state == GRPC_CHANNEL_CONNECTING || state == GRPC_CHANNEL_TRANSIENT_FAILURE) &&
+                           mIsWatching.compare_exchange_strong(parked, true))
+  {
+    observe(false);
+  }
+
+  return state;
+}
+
+//-----
+bool ConnectivityWatcher::isUnreachable()
+{
+  const grpc_connectivity_state state = getState();
+  return state == GRPC_CHANNEL_TRANSIENT_FAILURE || state == GRPC_CHANNEL_SHUTDOWN;
+}
+
+//-----
+ConnectivityWatcher::ConnectivityWatcher(std::shared_ptr<grpc::Channel> channel,
+                                         std::shared_ptr<CompletionQueueDriver> driver)
+  : mChannel(std::move(channel))
+  , mDriver(std::move(driver))
+{
+}
+
+//-----
+void ConnectivityWatcher::observe(bool tryToConnect)
+{
+  if (mIsStopped)
+  {
+    mIsWatching = false;
+    return;
+  }
+
+  // Only the first observation asks the channel to connect. Later ones just look, so that a channel left IDLE by an
+  // idle client isn't kept connected by this ConnectivityWatcher.
+  const grpc_connectivity_state state = mChannel->GetState(tryToConnect);
+  mState.store(state, std::memory_order_release);
+
+  // There is nothing to wait for once the channel is connected, idle, or shut down. The watch is resumed when the state
+  // is checked and the channel is connecting again.
+  if (state == GRPC_CHANNEL_READY || state == GRPC_CHANNEL_SHUTDOWN || (state == GRPC_CHANNEL_IDLE && !tryToConnect))
+  {
+    mIsWatching = false;
+    return;
+  }
+
+  if (!mDriver || !mDriver->start(
+                    [this, &state](grpc::CompletionQueue* queue)
+                    {
+                      mChannel->NotifyOnStateChange(state,
+                                                    std::chrono::system_clock::now() + WATCH_INTERVAL,
+                                                    queue,
+                                                    new WatchOperation(shared_from_this()));
+                    }))
+  {
+    mIsWatching = false;
+  }
+}
+
+} // namespace Hiero::internal
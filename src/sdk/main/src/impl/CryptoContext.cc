@@ -0,0 +1,110 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "impl/openssl_utils/CryptoContext.h"
+#include "exceptions/OpenSSLException.h"
+#include "impl/openssl_utils/EVP_MD_CTX.h"
+#include "impl/openssl_utils/OpenSSLUtils.h"
+
+namespace Hiero::internal::OpenSSLUtils
+{
+namespace
+{
+/**
+ * Fetch a message digest.
+ *
+ * @param libraryContext The library context from which to fetch the message digest.
+ * @param algorithm      The name of the message digest algorithm to fetch.
+ * @param error          The error message to fill if the message digest could not be fetched.
+ * @return The fetched message digest, or an empty EVP_MD if it could not be fetched.
+ */
+EVP_MD fetchMessageDigest(::OSSL_LIB_CTX* libraryContext, const char* algorithm, std::string& error)
+{
+  EVP_MD messageDigest(EVP_MD_fetch(libraryContext, algorithm, nullptr));
+  if (!messageDigest)
+  {
+    error = getErrorMessage("EVP_MD_fetch");
+  }
+
+  return messageDigest;
+}
+
+/**
+ * Create a library context.
+ *
+ * @return The created library context.
+ * @throws OpenSSLException If the library context could not be created.
+ */
+OSSL_LIB_CTX createLibraryContext()
+{
+  OSSL_LIB_CTX libraryContext(OSSL_LIB_CTX_new());
+  if (!libraryContext)
+  {
+    throw OpenSSLException(getErrorMessage("OSSL_LIB_CTX_new"));
+  }
+
+  return libraryContext;
+}
+
+} // namespace
+
+//-----
+CryptoContext::MessageDigestContext::MessageDigestContext()
+{
+  thread_local EVP_MD_CTX threadContext(nullptr);
+  if (!threadContext)
+  {
+    threadContext = EVP_MD_CTX(EVP_MD_CTX_new());
+    if (!threadContext)
+    {
+      throw OpenSSLException(getErrorMessage("EVP_MD_CTX_new"));
+    }
+  }
+
+  mContext = threadContext.get();
+  EVP_MD_CTX_reset(mContext);
+}
+
+//-----
+CryptoContext::MessageDigestContext::~MessageDigestContext()
+{
+  EVP_MD_CTX_reset(mContext);
+}
+
+//-----
+const CryptoContext& CryptoContext::getInstance()
+{
+  // If construction throws, it is attempted again on the next call.
+  static const CryptoContext instance;
+  return instance;
+}
+
+//-----
+const ::EVP_MD* CryptoContext::getKECCAK256() const
+{
+  if (!mKECCAK256)
+  {
+    throw OpenSSLException(mKECCAK256Error);
+  }
+
+  return mKECCAK256.get();
+}
+
+//-----
+const ::EVP_MD* CryptoContext::getSHA512() const
+{
+  if (!mSHA512)
+  {
+    throw OpenSSLException(mSHA512Error);
+  }
+
+  return mSHA512.get();
+}
+
+//-----
+CryptoContext::CryptoContext()
+  : mLibraryContext(createLibraryContext())
+  , mKECCAK256(fetchMessageDigest(mLibraryContext.get(), "KECCAK-256", mKECCAK256Error))
+  , mSHA512(fetchMessageDigest(nullptr, "SHA512", mSHA512Error))
+{
+}
+
+} // namespace Hiero::internal::OpenSSLUtils
@@ -2,10 +2,16 @@
 
 #include "impl/HttpClient.h"
 
+#include <condition_variable>
 #include <httplib.h>
+#include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace Hiero::internal
 {
@@ -14,6 +20,162 @@ namespace
 // The index in a URL to begin searching for the path after the end of the URL scheme ("http://" or "https://").
 const int SCHEME_END_INDEX = 8;
 
+//
+// A pool of keep-alive HTTP clients, keyed by the scheme, host, and port to which they connect. An httplib::Client can
+// only send one request at a time, so a request checks out a client for its duration and returns it afterwards.
+//
+class ConnectionPool
+{
+public:
+  //
+  // Check out a client for a host, waiting for one to be returned if the host is at its connection limit.
+  //
+  // @param host The scheme, host, and port to which to connect.
+  // @return The client to use to send a request.
+  //
+  [[nodiscard]] std::unique_ptr<httplib::Client> acquire(const std::string& host)
+  {
+    std::unique_lock lock(mMutex);
+    HostConnections& connections = mHosts[host];
+    mReleased.wait(lock,
+                   [this, &connections]()
+                   { return !connections.mIdle.empty() || connections.mOpen < mOptions.mMaxConnectionsPerHost; });
+
+    std::unique_ptr<httplib::Client> client;
+    if (!connections.mIdle.empty())
+    {
+      client = std::move(connections.mIdle.back());
+      connections.mIdle.pop_back();
+    }
+    else
+    {
+      client = std::make_unique<httplib::Client>(host);
+      client->set_keep_alive(true);
+      ++connections.mOpen;
+    }
+
+    // Apply the options every time, so that changed options also reach clients that were in use when they changed.
+    client->set_connection_timeout(mOptions.mConnectTimeout);
+    client->set_read_timeout(mOptions.mRequestTimeout);
+    client->set_write_timeout(mOptions.mRequestTimeout);
+    return client;
+  }
+
+  //
+  // Return a checked-out client to the pool.
+  //
+  // @param host   The scheme, host, and port to which the client connects.
+  // @param client The client to return.
+  // @param reuse  Should the client be kept for later requests? Clients whose request failed are closed instead.
+  //
+  void release(const std::string& host, std::unique_ptr<httplib::Client> client, bool reuse)
+  {
+    {
+      std::unique_lock lock(mMutex);
+      HostConnections& connections = mHosts[host];
+      if (reuse && connections.mOpen <= mOptions.mMaxConnectionsPerHost)
+      {
+        connections.mIdle.push_back(std::move(client));
+      }
+      else
+      {
+        --connections.mOpen;
+      }
+    }
+
+    mReleased.notify_one();
+  }
+
+  //
+  // Set the options of the clients, and close the idle ones.
+  //
+  // @param options The options to set.
+  //
+  void setOptions(const HttpClient::ConnectionOptions& options)
+  {
+    {
+      std::unique_lock lock(mMutex);
+      mOptions = options;
+      closeIdle();
+    }
+
+    // A higher connection limit may unblock waiting requests.
+    mReleased.notify_all();
+  }
+
+  //
+  // Get the options of the clients.
+  //
+  // @return The options of the clients.
+  //
+  [[nodiscard]] HttpClient::ConnectionOptions getOptions() const
+  {
+    std::unique_lock lock(mMutex);
+    return mOptions;
+  }
+
+  //
+  // Close the idle clients.
+  //
+  void closeIdleConnections()
+  {
+    {
+      std::unique_lock lock(mMutex);
+      closeIdle();
+    }
+
+    mReleased.notify_all();
+  }
+
+private:
+  //
+  // The clients of a host.
+  //
+  struct HostConnections
+  {
+    // The clients that aren't in use.
+    std::vector<std::unique_ptr<httplib::Client>> mIdle;
+
+    // The number of clients open to the host, in use or not.
+    unsigned int mOpen = 0U;
+  };
+
+  //
+  // Close the idle clients. The lock must be held.
+  //
+  void closeIdle()
+  {
+    for (auto& [host, connections] : mHosts)
+    {
+      connections.mOpen -= static_cast<unsigned int>(connections.mIdle.size());
+      connections.mIdle.clear();
+    }
+  }
+
+  // The mutex protecting the clients and options.
+  mutable std::mutex mMutex;
+
+  // Signaled when a client is returned or closed.
+  std::condition_variable mReleased;
+
+  // The clients of each host.
+  std::unordered_map<std::string, HostConnections> mHosts;
+
+  // The options of the clients.
+  HttpClient::ConnectionOptions mOptions;
+};
+
+//
+// Get the pool of clients shared by all requests.
+//
+// @return The pool of clients.
+//
+[[nodiscard]] ConnectionPool& getConnectionPool()
+{
+  static ConnectionPool pool;
+  return pool;
+}
+
 //
 // Perform an HTTP request.
 //
@@ -22,34 +184,48 @@ const int SCHEME_END_INDEX = 8;
 // @param body   The body of the request.
 // @return The response of the request.
 //
-[[nodiscard]] std::string performRequest(std::string_view url, std::string_view method, std::string_view body)
+[[nodiscard]] HttpClient::Response performRequest(std::string_view url, std::string_view method, std::string_view body)
 {
-  // Create an HTTP client to communicate with the given URL.
-  httplib::Client client(std::string(url.substr(0, url.find('/', SCHEME_END_INDEX))));
-  const std::string path = url.substr(url.find('/', SCHEME_END_INDEX)).data();
+  if (method != "GET" && method != "POST")
+  {
+    throw std::invalid_argument("Unsupported HTTP method: " + std::string(method));
+  }
+
+  // Check out a client connected to the scheme, host, and port of the given URL.
+  const std::size_t pathIndex = url.find('/', SCHEME_END_INDEX);
+  const std::string host(url.substr(0, pathIndex));
+  const std::string path = (pathIndex == std::string_view::npos) ? "/" : std::string(url.substr(pathIndex));
+  std::unique_ptr<httplib::Client> client = getConnectionPool().acquire(host);
 
   httplib::Result res;
 
   // Perform the request based on the HTTP method
-  if (method == "GET")
-  {
-    res = client.Get(path);
-  }
-  else if (method == "POST")
+  try
   {
-    res = client.Post(path, body.data(), body.size(), "application/json");
+    if (method == "GET")
+    {
+      res = client->Get(path);
+    }
+    else
+    {
+      res = client->Post(path, body.data(), body.size(), "application/json");
+    }
   }
-  else
+  catch (...)
   {
-    throw std::invalid_argument(std::string("Unsupported HTTP method: ") + method.data());
+    getConnectionPool().release(host, std::move(client), false);
+    throw;
   }
 
+  // Only keep the connection if the request went through.
+  getConnectionPool().release(host, std::move(client), static_cast<bool>(res));
+
   if (!res)
   {
     throw std::runtime_error("HTTP error: " + httplib::to_string(res.error()));
   }
 
-  return res->body;
+  return { res->status, std::move(res->body) };
 }
 
 } // namespace
@@ -58,7 +234,7 @@ const int SCHEME_END_INDEX = 8;
 // R"("],"id":1})"
 std::string HttpClient::invokeRPC(std::string_view url, std::string_view rpcMethod)
 {
-  return performRequest(url, "POST", rpcMethod);
+  return performRequest(url, "POST", rpcMethod).mBody;
 }
 
 // example mirrorNode query:
@@ -67,10 +243,39 @@ std::string HttpClient::invokeRPC(std::string_view url, std::string_view rpcMeth
 // been created exactly before the call. Works without timeout if the data in the mirror node is there from some seconds
 // beforehand
 std::string HttpClient::invokeREST(std::string_view url, std::string_view httpMethod, std::string_view requestBody)
+{
+  return performRequest(url, httpMethod, requestBody).mBody;
+}
+
+//-----
+HttpClient::Response HttpClient::invokeRESTWithStatus(std::string_view url,
+                                                      std::string_view httpMethod,
+                                                      std::string_view requestBody)
 {
   return performRequest(url, httpMethod, requestBody);
 }
 
 //-----
+void HttpClient::setConnectionOptions(const ConnectionOptions& options)
+{
+  if (options.mMaxConnectionsPerHost == 0U)
+  {
+    throw std::invalid_argument("Maximum number of connections per host must be greater than 0");
+  }
+
+  getConnectionPool().setOptions(options);
+}
+
+//-----
+HttpClient::ConnectionOptions HttpClient::getConnectionOptions()
+{
+  return getConnectionPool().getOptions();
+}
+
+//-----
+void HttpClient::closeIdleConnections()
+{
+  getConnectionPool().closeIdleConnections();
+}
 
-} // namespace Hiero::internal
\ No newline at end of file
+} // namespace Hiero::internal
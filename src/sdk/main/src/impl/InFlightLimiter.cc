@@ -0,0 +1,94 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "impl/InFlightLimiter.h"
+
+#include <stdexcept>
+
+namespace Hiero::internal
+{
+//-----
+InFlightLimiter::Permit::Permit(InFlightLimiter* limiter)
+  : mLimiter(limiter)
+{
+}
+
+//-----
+InFlightLimiter::Permit::~Permit()
+{
+  if (mLimiter)
+  {
+    mLimiter->release();
+  }
+}
+
+//-----
+InFlightLimiter::Permit::Permit(Permit&& other) noexcept
+  : mLimiter(other.mLimiter)
+{
+  other.mLimiter = nullptr;
+}
+
+//-----
+InFlightLimiter::InFlightLimiter(unsigned int max)
+  : mMax(max)
+{
+  if (max == 0U)
+  {
+    throw std::invalid_argument("Maximum number of requests in flight must be greater than 0");
+  }
+}
+
+//-----
+InFlightLimiter::Permit InFlightLimiter::acquire(const std::chrono::system_clock::time_point& deadline)
+{
+  std::unique_lock lock(mMutex);
+  if (!mSlotFreed.wait_until(lock, deadline, [this]() { return mInFlight < mMax; }))
+  {
+    return Permit(nullptr);
+  }
+
+  ++mInFlight;
+  return Permit(this);
+}
+
+//-----
+void InFlightLimiter::setMax(unsigned int max)
+{
+  if (max == 0U)
+  {
+    throw std::invalid_argument("Maximum number of requests in flight must be greater than 0");
+  }
+
+  {
+    std::unique_lock lock(mMutex);
+    mMax = max;
+  }
+
+  mSlotFreed.notify_all();
+}
+
+//-----
+unsigned int InFlightLimiter::getMax() const
+{
+  std::unique_lock lock(mMutex);
+  return mMax;
+}
+
+//-----
+unsigned int InFlightLimiter::getInFlight() const
+{
+  std::unique_lock lock(mMutex);
+  return mInFlight;
+}
+
+//-----
+void InFlightLimiter::release()
+{
+  {
+    std::unique_lock lock(mMutex);
+    --mInFlight;
+  }
+
+  mSlotFreed.notify_one();
+}
+
+} // namespace Hiero::internal
@@ -0,0 +1,79 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "impl/LatencyHistogram.h"
+
+#include <algorithm>
+
+namespace Hiero::internal
+{
+//-----
+void LatencyHistogram::record(const std::chrono::nanoseconds& duration)
+{
+  const std::chrono::nanoseconds recorded = std::max(duration, std::chrono::nanoseconds(0));
+  mBuckets.at(getBucketIndex(recorded)).fetch_add(1ULL, std::memory_order_relaxed);
+  mCount.fetch_add(1ULL, std::memory_order_relaxed);
+  mSum.fetch_add(recorded.count(), std::memory_order_relaxed);
+}
+
+//-----
+MetricsSnapshot::Histogram LatencyHistogram::getSnapshot() const
+{
+  MetricsSnapshot::Histogram histogram;
+  for (std::size_t i = 0ULL; i < BUCKETS; ++i)
+  {
+    if (const std::uint64_t count = mBuckets.at(i).load(std::memory_order_relaxed); count > 0ULL)
+    {
+      histogram.mBuckets.emplace_back(getBucketUpperBound(i), count);
+      histogram.mCount += count;
+    }
+  }
+
+  // The count is taken from the buckets, so that it always matches them even if durations are recorded meanwhile.
+  histogram.mSum = std::chrono::nanoseconds(mSum.load(std::memory_order_relaxed));
+  return histogram;
+}
+
+//-----
+std::size_t LatencyHistogram::getBucketIndex(const std::chrono::nanoseconds& duration)
+{
+  const auto value = static_cast<std::uint64_t>(std::max(duration.count(), static_cast<std::int64_t>(0)));
+  if (value < (1ULL << MIN_EXPONENT))
+  {
+    return 0ULL;
+  }
+
+  if (value >= (1ULL << MAX_EXPONENT))
+  {
+    return BUCKETS - 1ULL;
+  }
+
+  // Find the highest bit of the duration, the bits below it select the sub-bucket.
+  unsigned int exponent = MIN_EXPONENT;
+  while ((value >> (exponent + 1U)) != 0ULL)
+  {
+    ++exponent;
+  }
+
+  const std::uint64_t subBucket = (value >> (exponent - SUB_BUCKET_BITS)) & (SUB_BUCKETS - 1ULL);
+  return 1ULL + (exponent - MIN_EXPONENT) * SUB_BUCKETS + subBucket;
+}
+
+//-----
+std::chrono::nanoseconds LatencyHistogram::getBucketUpperBound(std::size_t index)
+{
+  if (index == 0ULL)
+  {
+    return std::chrono::nanoseconds(1LL << MIN_EXPONENT);
+  }
+
+  if (index >= BUCKETS - 1ULL)
+  {
+    return std::chrono::nanoseconds::max();
+  }
+
+  const auto exponent = static_cast<unsigned int>(MIN_EXPONENT + (index - 1ULL) / SUB_BUCKETS);
+  const std::size_t subBucket = (index - 1ULL) % SUB_BUCKETS;
+  return std::chrono::nanoseconds((1LL << exponent) +
+                                  static_cast<std::int64_t>(subBucket + 1ULL) * (1LL << (exponent - SUB_BUCKET_BITS)));
+}
+
+} // namespace Hiero::internal
@@ -0,0 +1,182 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "impl/MetricsRegistry.h"
+
+#include <mutex>
+
+namespace Hiero::internal
+{
+namespace
+{
+// The names of the gRPC status codes, indexed by code.
+constexpr std::array<const char*, 17ULL> GRPC_STATUS_CODE_NAMES = {
+  "OK",
+  "CANCELLED",
+  "UNKNOWN",
+  "INVALID_ARGUMENT",
+  "DEADLINE_EXCEEDED",
+  "NOT_FOUND",
+  "ALREADY_EXISTS",
+  "PERMISSION_DENIED",
+  "RESOURCE_EXHAUSTED",
+  "FAILED_PRECONDITION",
+  "ABORTED",
+  "OUT_OF_RANGE",
+  "UNIMPLEMENTED",
+  "INTERNAL",
+  "UNAVAILABLE",
+  "DATA_LOSS",
+  "UNAUTHENTICATED",
+};
+
+// Helper function used to get the value of a key in a map of metrics, creating it if it doesn't exist yet. Metrics that
+// already exist are found under the shared lock.
+template<typename MapType, typename KeyType>
+typename MapType::mapped_type::element_type& getOrCreate(MapType& map, const KeyType& key, std::shared_mutex& mutex)
+{
+  {
+    std::shared_lock lock(mutex);
+    if (const auto iter = map.find(key); iter != map.end())
+    {
+      return *iter->second;
+    }
+  }
+
+  std::unique_lock lock(mutex);
+  auto& value = map[key];
+  if (!value)
+  {
+    value = std::make_unique<typename MapType::mapped_type::element_type>();
+  }
+
+  return *value;
+}
+
+} // namespace
+
+//-----
+void MetricsRegistry::NodeRequestMetrics::recordAttempt()
+{
+  mAttempts.fetch_add(1ULL, std::memory_order_relaxed);
+}
+
+//-----
+void MetricsRegistry::NodeRequestMetrics::recordGrpcStatus(grpc::StatusCode code)
+{
+  if (const auto index = static_cast<std::size_t>(code); index < GRPC_STATUS_CODES)
+  {
+    mGrpcStatuses.at(index).fetch_add(1ULL, std::memory_order_relaxed);
+  }
+}
+
+//-----
+void MetricsRegistry::NodeRequestMetrics::recordPrecheckStatus(Status status)
+{
+  if (const auto index = static_cast<std::size_t>(status); index < PRECHECK_STATUSES)
+  {
+    mPrecheckStatuses.at(index).fetch_add(1ULL, std::memory_order_relaxed);
+  }
+}
+
+//-----
+void MetricsRegistry::NodeRequestMetrics::recordLatency(const std::chrono::nanoseconds& latency)
+{
+  mLatency.record(latency);
+}
+
+//-----
+void MetricsRegistry::NodeRequestMetrics::recordRetry()
+{
+  mRetries.fetch_add(1ULL, std::memory_order_relaxed);
+}
+
+//-----
+void MetricsRegistry::NodeRequestMetrics::recordBackoff(const std::chrono::nanoseconds& backoff)
+{
+  mBackoffs.fetch_add(1ULL, std::memory_order_relaxed);
+  mBackoffTime.fetch_add(backoff.count(), std::memory_order_relaxed);
+}
+
+//-----
+MetricsSnapshot::NodeRequestMetrics MetricsRegistry::NodeRequestMetrics::getSnapshot(const std::string& requestType,
+                                                                                     const std::string& node) const
+{
+  MetricsSnapshot::NodeRequestMetrics metrics;
+  metrics.mRequestType = requestType;
+  metrics.mNode = node;
+  metrics.mAttempts = mAttempts.load(std::memory_order_relaxed);
+
+  for (std::size_t i = 0ULL; i < GRPC_STATUS_CODES; ++i)
+  {
+    if (const std::uint64_t count = mGrpcStatuses.at(i).load(std::memory_order_relaxed); count > 0ULL)
+    {
+      metrics.mGrpcStatuses[GRPC_STATUS_CODE_NAMES.at(i)] = count;
+    }
+  }
+
+  for (std::size_t i = 0ULL; i < PRECHECK_STATUSES; ++i)
+  {
+    if (const std::uint64_t count = mPrecheckStatuses.at(i).load(std::memory_order_relaxed); count > 0ULL)
+    {
+      metrics.mPrecheckStatuses[static_cast<Status>(i)] = count;
+    }
+  }
+
+  metrics.mRetries = mRetries.load(std::memory_order_relaxed);
+  metrics.mBackoffs = mBackoffs.load(std::memory_order_relaxed);
+  metrics.mBackoffTime = std::chrono::nanoseconds(mBackoffTime.load(std::memory_order_relaxed));
+  metrics.mLatency = mLatency.getSnapshot();
+  return metrics;
+}
+
+//-----
+MetricsRegistry::NodeRequestMetrics& MetricsRegistry::getNodeRequestMetrics(const std::string& requestType,
+                                                                             const std::string& node)
+{
+  return getOrCreate(mNodeRequests, std::make_pair(requestType, node), mMutex);
+}
+
+//-----
+void MetricsRegistry::recordExecution(const std::string& requestType,
+                                      const std::chrono::nanoseconds& latency,
+                                      bool succeeded)
+{
+  RequestMetrics& metrics = getOrCreate(mRequests, requestType, mMutex);
+  (succeeded ? metrics.mSucceeded : metrics.mFailed).fetch_add(1ULL, std::memory_order_relaxed);
+  metrics.mLatency.record(latency);
+}
+
+//-----
+void MetricsRegistry::recordNodeBackoff(const std::string& node)
+{
+  getOrCreate(mNodeBackoffs, node, mMutex).fetch_add(1ULL, std::memory_order_relaxed);
+}
+
+//-----
+MetricsSnapshot MetricsRegistry::getSnapshot() const
+{
+  std::shared_lock lock(mMutex);
+  MetricsSnapshot snapshot;
+
+  for (const auto& [requestType, metrics] : mRequests)
+  {
+    MetricsSnapshot::RequestMetrics& request = snapshot.mRequests.emplace_back();
+    request.mRequestType = requestType;
+    request.mSucceeded = metrics->mSucceeded.load(std::memory_order_relaxed);
+    request.mFailed = metrics->mFailed.load(std::memory_order_relaxed);
+    request.mLatency = metrics->mLatency.getSnapshot();
+  }
+
+  for (const auto& [key, metrics] : mNodeRequests)
+  {
+    snapshot.mNodeRequests.push_back(metrics->getSnapshot(key.first, key.second));
+  }
+
+  for (const auto& [node, backoffs] : mNodeBackoffs)
+  {
+    snapshot.mNodeBackoffs[node] = backoffs->load(std::memory_order_relaxed);
+  }
+
+  return snapshot;
+}
+
+} // namespace Hiero::internal
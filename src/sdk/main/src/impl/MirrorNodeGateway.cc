@@ -3,6 +3,7 @@
 #include "exceptions/IllegalStateException.h"
 #include "impl/HttpClient.h"
 
+#include <algorithm>
 #include <chrono>
 #include <string>
 #include <thread>
@@ -11,6 +12,44 @@ using json = nlohmann::json;
 
 namespace Hiero::internal::MirrorNodeGateway
 {
+namespace
+{
+// The HTTP status code of a mirror node response for data it hasn't ingested (yet).
+constexpr int HTTP_NOT_FOUND = 404;
+
+// The initial and maximum amount of time to wait between probes of a local mirror node.
+constexpr auto INITIAL_READINESS_PROBE_INTERVAL = std::chrono::milliseconds(50);
+constexpr auto MAX_READINESS_PROBE_INTERVAL = std::chrono::milliseconds(500);
+
+//
+// Send a mirror node query to a local mirror node, and probe it again while it hasn't ingested the queried data yet.
+// The last response is returned if the data doesn't show up in time.
+//
+// @param url The URL of the query.
+// @return The body of the response.
+//
+[[nodiscard]] std::string queryWhenReady(const std::string& url)
+{
+  const std::chrono::steady_clock::time_point deadline =
+    std::chrono::steady_clock::now() + DEFAULT_MIRROR_NODE_READINESS_TIMEOUT;
+  std::chrono::steady_clock::duration interval = INITIAL_READINESS_PROBE_INTERVAL;
+
+  while (true)
+  {
+    HttpClient::Response response = HttpClient::invokeRESTWithStatus(url);
+    const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    if (response.mStatus != HTTP_NOT_FOUND || now + interval > deadline)
+    {
+      return std::move(response.mBody);
+    }
+
+    std::this_thread::sleep_for(interval);
+    interval = std::min<std::chrono::steady_clock::duration>(interval * 2, MAX_READINESS_PROBE_INTERVAL);
+  }
+}
+
+} // namespace
+
 //-----
 json MirrorNodeQuery(std::string_view mirrorNodeUrl, const std::vector<std::string>& params, std::string_view queryType)
 {
@@ -20,14 +59,10 @@ json MirrorNodeQuery(std::string_view mirrorNodeUrl, const std::vector<std::stri
     bool isLocalNetwork = true;
     const std::string url = buildUrlForNetwork(mirrorNodeUrl, queryType, params, isLocalNetwork);
 
-    // this is needed because of Mirror Node update delay time
-    // agreed to be handled by the user not a local network
-    if (isLocalNetwork)
-    {
-      std::this_thread::sleep_for(std::chrono::seconds(3));
-    }
-
-    response = HttpClient::invokeREST(url);
+    // A local mirror node may not have ingested the data of a transaction that just reached consensus, so probe it
+    // until it has instead of always waiting for the worst case. Handling this delay is left to the user for other
+    // networks.
+    response = isLocalNetwork ? queryWhenReady(url) : HttpClient::invokeREST(url);
   }
   catch (const std::exception& e)
   {
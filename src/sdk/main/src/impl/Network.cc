@@ -5,11 +5,13 @@
 #include "NodeAddress.h"
 #include "NodeAddressBook.h"
 #include "impl/Node.h"
+#include "impl/NodeSelector.h"
 
 #include <algorithm>
 #include <cmath>
 #include <filesystem>
 #include <fstream>
+#include <stdexcept>
 
 namespace Hiero::internal
 {
@@ -79,17 +81,100 @@ Network& Network::setVerifyCertificates(bool verify)
 //-----
 Network& Network::setMaxNodesPerRequest(unsigned int max)
 {
+  mMaxNodesPerRequest->store(max, std::memory_order_relaxed);
+  return *this;
+}
+
+//-----
+Network& Network::setNodeSelectionPolicy(NodeSelectionPolicy policy)
+{
+  mNodeSelectionPolicy->store(policy, std::memory_order_relaxed);
+  return *this;
+}
+
+//-----
+Network& Network::setChannelPoolSize(unsigned int size)
+{
+  if (size == 0U)
+  {
+    throw std::invalid_argument("Channel pool size must be greater than 0");
+  }
+
   std::unique_lock lock(*getLock());
-  mMaxNodesPerRequest = max;
+  mChannelPoolSize = size;
+
+  // Set the new channel pool size for all Nodes on this Network.
+  std::for_each(getNodes().cbegin(),
+                getNodes().cend(),
+                [&size](const std::shared_ptr<Node>& node) { node->setChannelPoolSize(size); });
+
+  return *this;
+}
+
+//-----
+Network& Network::setMaxRequestsInFlightPerNode(unsigned int max)
+{
+  if (max == 0U)
+  {
+    throw std::invalid_argument("Maximum number of requests in flight must be greater than 0");
+  }
+
+  std::unique_lock lock(*getLock());
+  mMaxRequestsInFlightPerNode = max;
+
+  // Set the new maximum for all Nodes on this Network.
+  std::for_each(getNodes().cbegin(),
+                getNodes().cend(),
+                [&max](const std::shared_ptr<Node>& node) { node->setMaxRequestsInFlight(max); });
+
   return *this;
 }
 
+//-----
+bool Network::warmUp(const std::chrono::system_clock::time_point& deadline) const
+{
+  // Nodes are taken from the NodeTable, so connecting doesn't hold the lock.
+  const std::vector<std::shared_ptr<Node>> nodes = getNodeTable()->mNodes;
+
+  // Start all connections before waiting on any of them, so that they are made in parallel.
+  std::for_each(nodes.cbegin(), nodes.cend(), [](const std::shared_ptr<Node>& node) { node->connect(); });
+
+  bool connected = true;
+  for (const std::shared_ptr<Node>& node : nodes)
+  {
+    connected = node->waitForConnected(deadline) && connected;
+  }
+
+  return connected;
+}
+
+//-----
+NodeSelectionPolicy Network::getNodeSelectionPolicy() const
+{
+  return mNodeSelectionPolicy->load(std::memory_order_relaxed);
+}
+
+//-----
+unsigned int Network::getChannelPoolSize() const
+{
+  std::unique_lock lock(*getLock());
+  return mChannelPoolSize;
+}
+
+//-----
+unsigned int Network::getMaxRequestsInFlightPerNode() const
+{
+  std::unique_lock lock(*getLock());
+  return mMaxRequestsInFlightPerNode;
+}
+
 //-----
 unsigned int Network::getNumberOfNodesForRequest() const
 {
-  if (mMaxNodesPerRequest > 0)
+  if (const unsigned int maxNodesPerRequest = mMaxNodesPerRequest->load(std::memory_order_relaxed);
+      maxNodesPerRequest > 0U)
   {
-    return mMaxNodesPerRequest;
+    return maxNodesPerRequest;
   }
 
   return (getNetworkInternal().size() + 3 - 1) / 3;
@@ -131,12 +216,14 @@ Network& Network::setTransportSecurity(TLSBehavior tls)
 //-----
 std::vector<AccountId> Network::getNodeAccountIdsForExecute()
 {
-  std::unique_lock lock(*getLock());
+  // Nodes are selected from the NodeTable, so this doesn't take the lock.
+  const auto size = static_cast<unsigned int>(getNodeTable()->mNodes.size());
+  const unsigned int maxNodesPerRequest = mMaxNodesPerRequest->load(std::memory_order_relaxed);
 
   // Get either the 1/3 most healthy nodes, or the number of most healthy nodes specified by mMaxNodesPerRequest.
   const std::vector<std::shared_ptr<Node>> nodes = getNumberOfMostHealthyNodes(
-    mMaxNodesPerRequest > 0U ? std::min(mMaxNodesPerRequest, static_cast<unsigned int>(getNodes().size()))
-                             : static_cast<unsigned int>(std::ceil(static_cast<double>(getNodes().size()) / 3.0)));
+    maxNodesPerRequest > 0U ? std::min(maxNodesPerRequest, size)
+                            : static_cast<unsigned int>(std::ceil(static_cast<double>(size) / 3.0)));
 
   std::vector<AccountId> accountIds;
   accountIds.reserve(nodes.size());
@@ -193,9 +280,17 @@ std::shared_ptr<Node> Network::createNodeFromNetworkEntry(std::string_view addre
 {
   auto node = std::make_shared<Node>(key, address);
   node->setVerifyCertificates(mVerifyCertificates);
+  node->setChannelPoolSize(mChannelPoolSize);
+  node->setMaxRequestsInFlight(mMaxRequestsInFlightPerNode);
   return node;
 }
 
+//-----
+std::size_t Network::selectHealthyNode(const std::vector<std::shared_ptr<Node>>& candidates, std::size_t healthy) const
+{
+  return NodeSelector::selectNode(getNodeSelectionPolicy(), candidates, healthy);
+}
+
 //-----
 Network& Network::setLedgerIdInternal(const LedgerId& ledgerId, const NodeAddressBook& addressBook)
 {
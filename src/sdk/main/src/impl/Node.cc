@@ -1,13 +1,80 @@
 // SPDX-License-Identifier: Apache-2.0
 #include "impl/Node.h"
+#include "impl/ArenaPool.h"
 #include "impl/BaseNodeAddress.h"
+#include "impl/CompletionQueueDriver.h"
 #include "impl/HieroCertificateVerifier.h"
 
 #include <algorithm>
+#include <atomic>
+#include <google/protobuf/arena.h>
 #include <utility>
 
 namespace Hiero::internal
 {
+namespace
+{
+/**
+ * An asynchronous unary gRPC call, registered with a CompletionQueueDriver.
+ *
+ * @tparam ResponseType The protobuf response message type of the call.
+ */
+template<typename ResponseType>
+class UnaryCall : public CompletionQueueDriver::Operation
+{
+public:
+  UnaryCall(std::shared_ptr<NodeStats> stats,
+            std::shared_ptr<grpc::ClientContext> context,
+            std::function<void(const grpc::Status&, const ResponseType&)> callback)
+    : mStats(std::move(stats))
+    , mContext(context ? std::move(context) : std::make_shared<grpc::ClientContext>())
+    , mResponse(google::protobuf::Arena::CreateMessage<ResponseType>(mArena.get()))
+    , mCallback(std::move(callback))
+  {
+  }
+
+  void proceed(bool) override
+  {
+    // A cancelled call (i.e. the losing submission of a hedged request) didn't get to hear from the node.
+    if (mStatus.error_code() == grpc::StatusCode::CANCELLED)
+    {
+      mStats->cancelRequest();
+    }
+    else
+    {
+      mStats->endRequest(mStart, !mStatus.ok());
+    }
+
+    mCallback(mStatus, *mResponse);
+  }
+
+  // The statistics of the node to which the call is made.
+  std::shared_ptr<NodeStats> mStats;
+
+  // The time at which the call started.
+  std::chrono::steady_clock::time_point mStart;
+
+  // The context of the call. It is shared with the submitter of the call, so that the call can be cancelled.
+  std::shared_ptr<grpc::ClientContext> mContext;
+
+  // The reader of the call.
+  std::unique_ptr<grpc::ClientAsyncResponseReader<ResponseType>> mReader;
+
+  // The arena on which the response of the call is parsed. It is returned to the pool once the callback has run.
+  ArenaPool::Lease mArena = ArenaPool::getInstance().acquire();
+
+  // The response of the call, owned by the arena.
+  ResponseType* mResponse = nullptr;
+
+  // The status of the call.
+  grpc::Status mStatus;
+
+  // The callback to run when the call completes.
+  std::function<void(const grpc::Status&, const ResponseType&)> mCallback;
+};
+
+} // namespace
+
 //-----
 Node::Node(AccountId accountId, const BaseNodeAddress& address)
   : BaseNode<Node, AccountId>(address)
@@ -26,48 +93,295 @@ grpc::Status Node::submitQuery(proto::Query::QueryCase funcEnum,
                                const proto::Query& query,
                                const std::chrono::system_clock::time_point& deadline,
                                proto::Response* response)
+{
+  // The limiter, rather than this Node's lock, bounds the requests in flight, so that they don't wait on each other.
+  const InFlightLimiter::Permit permit = mInFlightLimiter->acquire(deadline);
+  if (!permit)
+  {
+    return grpc::Status(grpc::StatusCode::DEADLINE_EXCEEDED, "Deadline passed waiting for a request to the node");
+  }
+
+  const std::chrono::steady_clock::time_point start = mStats->startRequest();
+
+  try
+  {
+    const grpc::Status status = callQuery(funcEnum, query, deadline, response);
+    mStats->endRequest(start, !status.ok());
+    return status;
+  }
+  catch (...)
+  {
+    mStats->endRequest(start, true);
+    throw;
+  }
+}
+
+//-----
+grpc::Status Node::submitTransaction(proto::TransactionBody::DataCase funcEnum,
+                                     const proto::Transaction& transaction,
+                                     const std::chrono::system_clock::time_point& deadline,
+                                     proto::TransactionResponse* response)
+{
+  // The limiter, rather than this Node's lock, bounds the requests in flight, so that they don't wait on each other.
+  const InFlightLimiter::Permit permit = mInFlightLimiter->acquire(deadline);
+  if (!permit)
+  {
+    return grpc::Status(grpc::StatusCode::DEADLINE_EXCEEDED, "Deadline passed waiting for a request to the node");
+  }
+
+  const std::chrono::steady_clock::time_point start = mStats->startRequest();
+
+  try
+  {
+    const grpc::Status status = callTransaction(funcEnum, transaction, deadline, response);
+    mStats->endRequest(start, !status.ok());
+    return status;
+  }
+  catch (...)
+  {
+    mStats->endRequest(start, true);
+    throw;
+  }
+}
+
+//-----
+bool Node::submitQueryAsync(proto::Query::QueryCase funcEnum,
+                            const proto::Query& query,
+                            const std::chrono::system_clock::time_point& deadline,
+                            CompletionQueueDriver& driver,
+                            const std::function<void(const grpc::Status&, const proto::Response&)>& callback,
+                            const std::shared_ptr<grpc::ClientContext>& context)
+{
+  auto call = std::make_unique<UnaryCall<proto::Response>>(mStats, context, callback);
+  call->mContext->set_deadline(deadline);
+
+  const bool started = driver.start(
+    [this, funcEnum, &query, &call](grpc::CompletionQueue* queue)
+    {
+      // The channels and stubs are created if they don't exist. Connection failures surface as an UNAVAILABLE status of
+      // the call.
+      call->mReader = prepareQuery(funcEnum, call->mContext.get(), query, queue);
+
+      call->mStart = mStats->startRequest();
+      call->mReader->StartCall();
+      call->mReader->Finish(call->mResponse, &call->mStatus, call.get());
+    });
+
+  // Once started, the call belongs to the CompletionQueueDriver.
+  if (started)
+  {
+    call.release(); // NOLINT
+  }
+
+  return started;
+}
+
+//-----
+bool Node::submitTransactionAsync(
+  proto::TransactionBody::DataCase funcEnum,
+  const proto::Transaction& transaction,
+  const std::chrono::system_clock::time_point& deadline,
+  CompletionQueueDriver& driver,
+  const std::function<void(const grpc::Status&, const proto::TransactionResponse&)>& callback,
+  const std::shared_ptr<grpc::ClientContext>& context)
+{
+  auto call = std::make_unique<UnaryCall<proto::TransactionResponse>>(mStats, context, callback);
+  call->mContext->set_deadline(deadline);
+
+  const bool started = driver.start(
+    [this, funcEnum, &transaction, &call](grpc::CompletionQueue* queue)
+    {
+      // The channels and stubs are created if they don't exist. Connection failures surface as an UNAVAILABLE status of
+      // the call.
+      call->mReader = prepareTransaction(funcEnum, call->mContext.get(), transaction, queue);
+
+      call->mStart = mStats->startRequest();
+      call->mReader->StartCall();
+      call->mReader->Finish(call->mResponse, &call->mStatus, call.get());
+    });
+
+  // Once started, the call belongs to the CompletionQueueDriver.
+  if (started)
+  {
+    call.release(); // NOLINT
+  }
+
+  return started;
+}
+
+//-----
+Node& Node::toInsecure()
+{
+  const BaseNodeAddress address = getAddress().toInsecure();
+
+  std::unique_lock lock(*getLock());
+  return BaseNode<Node, AccountId>::setAddress(address);
+}
+
+//-----
+Node& Node::toSecure()
+{
+  const BaseNodeAddress address = getAddress().toSecure();
+
+  std::unique_lock lock(*getLock());
+  return BaseNode<Node, AccountId>::setAddress(address);
+}
+
+//-----
+Node& Node::setNodeCertificateHash(const std::vector<std::byte>& hash)
+{
+  std::unique_lock lock(*getLock());
+  mNodeCertificateHash = hash;
+  return *this;
+}
+
+//-----
+Node& Node::setVerifyCertificates(bool verify)
 {
   std::unique_lock lock(*getLock());
+  mVerifyCertificates = verify;
+  return *this;
+}
+
+//-----
+Node& Node::setMaxRequestsInFlight(unsigned int max)
+{
+  mInFlightLimiter->setMax(max);
+  return *this;
+}
+
+//-----
+Node::Node(const Node& node, const BaseNodeAddress& address)
+  : BaseNode<Node, AccountId>(address)
+  , mAccountId(node.mAccountId)
+  , mNodeCertificateHash(node.mNodeCertificateHash)
+  , mVerifyCertificates(node.mVerifyCertificates)
+  , mInFlightLimiter(std::make_shared<InFlightLimiter>(node.getMaxRequestsInFlight()))
+{
+}
+
+//-----
+std::shared_ptr<grpc::ChannelCredentials> Node::getTlsChannelCredentials() const
+{
+  grpc::experimental::TlsChannelCredentialsOptions tlsChannelCredentialsOptions;
+
+  // Custom verification using the node's certificate chain hash
+  tlsChannelCredentialsOptions.set_verify_server_certs(false);
+  tlsChannelCredentialsOptions.set_check_call_host(false);
+  tlsChannelCredentialsOptions.set_certificate_verifier(
+    grpc::experimental::ExternalCertificateVerifier::Create<HieroCertificateVerifier>(mNodeCertificateHash));
+
+  // Feed in the root CA's file manually for Windows (this is a bug in the gRPC implementation and says here
+  // https://deploy-preview-763--grpc-io.netlify.app/docs/guides/auth/#using-client-side-ssltls that this needs to be
+  // specified manually).
+#ifdef _WIN32
+  tlsChannelCredentialsOptions.set_certificate_provider(
+    std::make_shared<grpc::experimental::FileWatcherCertificateProvider>("roots.pem", -1));
+  tlsChannelCredentialsOptions.watch_root_certs();
+#endif
+
+  return grpc::experimental::TlsCredentials(tlsChannelCredentialsOptions);
+}
+
+//-----
+void Node::initializeStubs()
+{
+  auto stubsPerChannel = std::make_shared<std::vector<Stubs>>();
+  stubsPerChannel->reserve(getChannels().size());
+
+  for (const std::shared_ptr<grpc::Channel>& channel : getChannels())
+  {
+    Stubs& stubs = stubsPerChannel->emplace_back();
+
+    // clang-format off
+    stubs.mConsensusStub     = proto::ConsensusService::NewStub(channel);
+    stubs.mCryptoStub        = proto::CryptoService::NewStub(channel);
+    stubs.mFileStub          = proto::FileService::NewStub(channel);
+    stubs.mFreezeStub        = proto::FreezeService::NewStub(channel);
+    stubs.mNetworkStub       = proto::NetworkService::NewStub(channel);
+    stubs.mScheduleStub      = proto::ScheduleService::NewStub(channel);
+    stubs.mSmartContractStub = proto::SmartContractService::NewStub(channel);
+    stubs.mTokenStub         = proto::TokenService::NewStub(channel);
+    stubs.mUtilStub          = proto::UtilService::NewStub(channel);
+    stubs.mAddressBookStub   = proto::AddressBookService::NewStub(channel);
+    // clang-format on
+  }
+
+  std::atomic_store(&mStubs, std::shared_ptr<const std::vector<Stubs>>(std::move(stubsPerChannel)));
+}
+
+//-----
+void Node::closeStubs()
+{
+  // Requests in flight keep the stubs they use (and so their channels) alive until they complete.
+  std::atomic_store(&mStubs, std::shared_ptr<const std::vector<Stubs>>());
+}
+
+//-----
+std::shared_ptr<const Node::Stubs> Node::getNextStubs()
+{
+  std::shared_ptr<const std::vector<Stubs>> stubsPerChannel = std::atomic_load(&mStubs);
+  if (!stubsPerChannel)
+  {
+    std::unique_lock lock(*getLock());
+
+    // Creating the channels initializes the stubs, one set per channel.
+    static_cast<void>(getChannels());
+    stubsPerChannel = std::atomic_load(&mStubs);
+  }
+
+  // Share ownership of all the stubs, so that the returned stubs outlive the closing of this Node's connection.
+  const Stubs& stubs = (*stubsPerChannel)[getNextChannelIndex(stubsPerChannel->size())];
+  return std::shared_ptr<const Stubs>(stubsPerChannel, &stubs);
+}
 
+//-----
+grpc::Status Node::callQuery(proto::Query::QueryCase funcEnum,
+                             const proto::Query& query,
+                             const std::chrono::system_clock::time_point& deadline,
+                             proto::Response* response)
+{
   grpc::ClientContext context;
   context.set_deadline(deadline);
 
+  const std::shared_ptr<const Stubs> nextStubs = getNextStubs();
+  const Stubs& stubs = *nextStubs;
   switch (funcEnum)
   {
     case proto::Query::QueryCase::kConsensusGetTopicInfo:
-      return mConsensusStub->getTopicInfo(&context, query, response);
+      return stubs.mConsensusStub->getTopicInfo(&context, query, response);
     case proto::Query::QueryCase::kContractCallLocal:
-      return mSmartContractStub->contractCallLocalMethod(&context, query, response);
+      return stubs.mSmartContractStub->contractCallLocalMethod(&context, query, response);
     case proto::Query::QueryCase::kContractGetBytecode:
-      return mSmartContractStub->ContractGetBytecode(&context, query, response);
+      return stubs.mSmartContractStub->ContractGetBytecode(&context, query, response);
     case proto::Query::QueryCase::kContractGetInfo:
-      return mSmartContractStub->getContractInfo(&context, query, response);
+      return stubs.mSmartContractStub->getContractInfo(&context, query, response);
     case proto::Query::QueryCase::kCryptogetAccountBalance:
-      return mCryptoStub->cryptoGetBalance(&context, query, response);
+      return stubs.mCryptoStub->cryptoGetBalance(&context, query, response);
     case proto::Query::QueryCase::kCryptoGetAccountRecords:
-      return mCryptoStub->getAccountRecords(&context, query, response);
+      return stubs.mCryptoStub->getAccountRecords(&context, query, response);
     case proto::Query::QueryCase::kCryptoGetInfo:
-      return mCryptoStub->getAccountInfo(&context, query, response);
+      return stubs.mCryptoStub->getAccountInfo(&context, query, response);
     case proto::Query::QueryCase::kCryptoGetLiveHash:
-      return mCryptoStub->getLiveHash(&context, query, response);
+      return stubs.mCryptoStub->getLiveHash(&context, query, response);
     case proto::Query::QueryCase::kCryptoGetProxyStakers:
-      return mCryptoStub->getStakersByAccountID(&context, query, response);
+      return stubs.mCryptoStub->getStakersByAccountID(&context, query, response);
     case proto::Query::QueryCase::kFileGetContents:
-      return mFileStub->getFileContent(&context, query, response);
+      return stubs.mFileStub->getFileContent(&context, query, response);
     case proto::Query::QueryCase::kFileGetInfo:
-      return mFileStub->getFileInfo(&context, query, response);
+      return stubs.mFileStub->getFileInfo(&context, query, response);
     case proto::Query::QueryCase::kNetworkGetVersionInfo:
-      return mNetworkStub->getVersionInfo(&context, query, response);
+      return stubs.mNetworkStub->getVersionInfo(&context, query, response);
     case proto::Query::QueryCase::kScheduleGetInfo:
-      return mScheduleStub->getScheduleInfo(&context, query, response);
+      return stubs.mScheduleStub->getScheduleInfo(&context, query, response);
     case proto::Query::QueryCase::kTokenGetInfo:
-      return mTokenStub->getTokenInfo(&context, query, response);
+      return stubs.mTokenStub->getTokenInfo(&context, query, response);
     case proto::Query::QueryCase::kTokenGetNftInfo:
-      return mTokenStub->getTokenNftInfo(&context, query, response);
+      return stubs.mTokenStub->getTokenNftInfo(&context, query, response);
     case proto::Query::QueryCase::kTransactionGetReceipt:
-      return mCryptoStub->getTransactionReceipts(&context, query, response);
+      return stubs.mCryptoStub->getTransactionReceipts(&context, query, response);
     case proto::Query::QueryCase::kTransactionGetRecord:
-      return mCryptoStub->getTxRecordByTxID(&context, query, response);
+      return stubs.mCryptoStub->getTxRecordByTxID(&context, query, response);
     default:
       // This should never happen
       throw std::invalid_argument("Unrecognized gRPC query method case");
@@ -75,120 +389,120 @@ grpc::Status Node::submitQuery(proto::Query::QueryCase funcEnum,
 }
 
 //-----
-grpc::Status Node::submitTransaction(proto::TransactionBody::DataCase funcEnum,
-                                     const proto::Transaction& transaction,
-                                     const std::chrono::system_clock::time_point& deadline,
-                                     proto::TransactionResponse* response)
+grpc::Status Node::callTransaction(proto::TransactionBody::DataCase funcEnum,
+                                   const proto::Transaction& transaction,
+                                   const std::chrono::system_clock::time_point& deadline,
+                                   proto::TransactionResponse* response)
 {
-  std::unique_lock lock(*getLock());
-
   grpc::ClientContext context;
   context.set_deadline(deadline);
 
+  const std::shared_ptr<const Stubs> nextStubs = getNextStubs();
+  const Stubs& stubs = *nextStubs;
   switch (funcEnum)
   {
     case proto::TransactionBody::DataCase::kNodeCreate:
-      return mAddressBookStub->createNode(&context, transaction, response);
+      return stubs.mAddressBookStub->createNode(&context, transaction, response);
     case proto::TransactionBody::DataCase::kNodeDelete:
-      return mAddressBookStub->createNode(&context, transaction, response);
+      return stubs.mAddressBookStub->createNode(&context, transaction, response);
     case proto::TransactionBody::DataCase::kNodeUpdate:
-      return mAddressBookStub->createNode(&context, transaction, response);
+      return stubs.mAddressBookStub->createNode(&context, transaction, response);
     case proto::TransactionBody::DataCase::kConsensusCreateTopic:
-      return mConsensusStub->createTopic(&context, transaction, response);
+      return stubs.mConsensusStub->createTopic(&context, transaction, response);
     case proto::TransactionBody::DataCase::kConsensusDeleteTopic:
-      return mConsensusStub->deleteTopic(&context, transaction, response);
+      return stubs.mConsensusStub->deleteTopic(&context, transaction, response);
     case proto::TransactionBody::DataCase::kConsensusSubmitMessage:
-      return mConsensusStub->submitMessage(&context, transaction, response);
+      return stubs.mConsensusStub->submitMessage(&context, transaction, response);
     case proto::TransactionBody::DataCase::kConsensusUpdateTopic:
-      return mConsensusStub->updateTopic(&context, transaction, response);
+      return stubs.mConsensusStub->updateTopic(&context, transaction, response);
     case proto::TransactionBody::DataCase::kContractCall:
-      return mSmartContractStub->contractCallMethod(&context, transaction, response);
+      return stubs.mSmartContractStub->contractCallMethod(&context, transaction, response);
     case proto::TransactionBody::DataCase::kContractCreateInstance:
-      return mSmartContractStub->createContract(&context, transaction, response);
+      return stubs.mSmartContractStub->createContract(&context, transaction, response);
     case proto::TransactionBody::DataCase::kContractDeleteInstance:
-      return mSmartContractStub->deleteContract(&context, transaction, response);
+      return stubs.mSmartContractStub->deleteContract(&context, transaction, response);
     case proto::TransactionBody::DataCase::kContractUpdateInstance:
-      return mSmartContractStub->updateContract(&context, transaction, response);
+      return stubs.mSmartContractStub->updateContract(&context, transaction, response);
     case proto::TransactionBody::DataCase::kCryptoAddLiveHash:
-      return mCryptoStub->addLiveHash(&context, transaction, response);
+      return stubs.mCryptoStub->addLiveHash(&context, transaction, response);
     case proto::TransactionBody::DataCase::kCryptoApproveAllowance:
-      return mCryptoStub->approveAllowances(&context, transaction, response);
+      return stubs.mCryptoStub->approveAllowances(&context, transaction, response);
     case proto::TransactionBody::DataCase::kCryptoDeleteAllowance:
-      return mCryptoStub->deleteAllowances(&context, transaction, response);
+      return stubs.mCryptoStub->deleteAllowances(&context, transaction, response);
     case proto::TransactionBody::DataCase::kCryptoCreateAccount:
-      return mCryptoStub->createAccount(&context, transaction, response);
+      return stubs.mCryptoStub->createAccount(&context, transaction, response);
     case proto::TransactionBody::DataCase::kCryptoDelete:
-      return mCryptoStub->cryptoDelete(&context, transaction, response);
+      return stubs.mCryptoStub->cryptoDelete(&context, transaction, response);
     case proto::TransactionBody::DataCase::kCryptoDeleteLiveHash:
-      return mCryptoStub->deleteLiveHash(&context, transaction, response);
+      return stubs.mCryptoStub->deleteLiveHash(&context, transaction, response);
     case proto::TransactionBody::DataCase::kCryptoTransfer:
-      return mCryptoStub->cryptoTransfer(&context, transaction, response);
+      return stubs.mCryptoStub->cryptoTransfer(&context, transaction, response);
     case proto::TransactionBody::DataCase::kCryptoUpdateAccount:
-      return mCryptoStub->updateAccount(&context, transaction, response);
+      return stubs.mCryptoStub->updateAccount(&context, transaction, response);
     case proto::TransactionBody::DataCase::kEthereumTransaction:
-      return mSmartContractStub->callEthereum(&context, transaction, response);
+      return stubs.mSmartContractStub->callEthereum(&context, transaction, response);
     case proto::TransactionBody::DataCase::kFileAppend:
-      return mFileStub->appendContent(&context, transaction, response);
+      return stubs.mFileStub->appendContent(&context, transaction, response);
     case proto::TransactionBody::DataCase::kFileCreate:
-      return mFileStub->createFile(&context, transaction, response);
+      return stubs.mFileStub->createFile(&context, transaction, response);
     case proto::TransactionBody::DataCase::kFileDelete:
-      return mFileStub->deleteFile(&context, transaction, response);
+      return stubs.mFileStub->deleteFile(&context, transaction, response);
     case proto::TransactionBody::DataCase::kFileUpdate:
-      return mFileStub->updateFile(&context, transaction, response);
+      return stubs.mFileStub->updateFile(&context, transaction, response);
     case proto::TransactionBody::DataCase::kFreeze:
-      return mFreezeStub->freeze(&context, transaction, response);
+      return stubs.mFreezeStub->freeze(&context, transaction, response);
     case proto::TransactionBody::DataCase::kScheduleCreate:
-      return mScheduleStub->createSchedule(&context, transaction, response);
+      return stubs.mScheduleStub->createSchedule(&context, transaction, response);
     case proto::TransactionBody::DataCase::kScheduleDelete:
-      return mScheduleStub->deleteSchedule(&context, transaction, response);
+      return stubs.mScheduleStub->deleteSchedule(&context, transaction, response);
     case proto::TransactionBody::DataCase::kScheduleSign:
-      return mScheduleStub->signSchedule(&context, transaction, response);
+      return stubs.mScheduleStub->signSchedule(&context, transaction, response);
     case proto::TransactionBody::DataCase::kSystemDelete:
-      return mFileStub->systemDelete(&context, transaction, response);
+      return stubs.mFileStub->systemDelete(&context, transaction, response);
     case proto::TransactionBody::DataCase::kSystemUndelete:
-      return mFileStub->systemUndelete(&context, transaction, response);
+      return stubs.mFileStub->systemUndelete(&context, transaction, response);
     case proto::TransactionBody::DataCase::kTokenAirdrop:
-      return mTokenStub->airdropTokens(&context, transaction, response);
+      return stubs.mTokenStub->airdropTokens(&context, transaction, response);
     case proto::TransactionBody::DataCase::kTokenAssociate:
-      return mTokenStub->associateTokens(&context, transaction, response);
+      return stubs.mTokenStub->associateTokens(&context, transaction, response);
     case proto::TransactionBody::DataCase::kTokenBurn:
-      return mTokenStub->burnToken(&context, transaction, response);
+      return stubs.mTokenStub->burnToken(&context, transaction, response);
     case proto::TransactionBody::DataCase::kTokenCancelAirdrop:
-      return mTokenStub->burnToken(&context, transaction, response);
+      return stubs.mTokenStub->burnToken(&context, transaction, response);
     case proto::TransactionBody::DataCase::kTokenClaimAirdrop:
-      return mTokenStub->burnToken(&context, transaction, response);
+      return stubs.mTokenStub->burnToken(&context, transaction, response);
     case proto::TransactionBody::DataCase::kTokenCreation:
-      return mTokenStub->createToken(&context, transaction, response);
+      return stubs.mTokenStub->createToken(&context, transaction, response);
     case proto::TransactionBody::DataCase::kTokenDeletion:
-      return mTokenStub->deleteToken(&context, transaction, response);
+      return stubs.mTokenStub->deleteToken(&context, transaction, response);
     case proto::TransactionBody::DataCase::kTokenDissociate:
-      return mTokenStub->dissociateTokens(&context, transaction, response);
+      return stubs.mTokenStub->dissociateTokens(&context, transaction, response);
     case proto::TransactionBody::DataCase::kTokenFeeScheduleUpdate:
-      return mTokenStub->updateTokenFeeSchedule(&context, transaction, response);
+      return stubs.mTokenStub->updateTokenFeeSchedule(&context, transaction, response);
     case proto::TransactionBody::DataCase::kTokenFreeze:
-      return mTokenStub->freezeTokenAccount(&context, transaction, response);
+      return stubs.mTokenStub->freezeTokenAccount(&context, transaction, response);
     case proto::TransactionBody::DataCase::kTokenGrantKyc:
-      return mTokenStub->grantKycToTokenAccount(&context, transaction, response);
+      return stubs.mTokenStub->grantKycToTokenAccount(&context, transaction, response);
     case proto::TransactionBody::DataCase::kTokenMint:
-      return mTokenStub->mintToken(&context, transaction, response);
+      return stubs.mTokenStub->mintToken(&context, transaction, response);
     case proto::TransactionBody::DataCase::kTokenPause:
-      return mTokenStub->pauseToken(&context, transaction, response);
+      return stubs.mTokenStub->pauseToken(&context, transaction, response);
     case proto::TransactionBody::DataCase::kTokenReject:
-      return mTokenStub->revokeKycFromTokenAccount(&context, transaction, response);
+      return stubs.mTokenStub->revokeKycFromTokenAccount(&context, transaction, response);
     case proto::TransactionBody::DataCase::kTokenRevokeKyc:
-      return mTokenStub->revokeKycFromTokenAccount(&context, transaction, response);
+      return stubs.mTokenStub->revokeKycFromTokenAccount(&context, transaction, response);
     case proto::TransactionBody::DataCase::kTokenUnfreeze:
-      return mTokenStub->unfreezeTokenAccount(&context, transaction, response);
+      return stubs.mTokenStub->unfreezeTokenAccount(&context, transaction, response);
     case proto::TransactionBody::DataCase::kTokenUnpause:
-      return mTokenStub->unpauseToken(&context, transaction, response);
+      return stubs.mTokenStub->unpauseToken(&context, transaction, response);
     case proto::TransactionBody::DataCase::kTokenUpdate:
-      return mTokenStub->updateToken(&context, transaction, response);
+      return stubs.mTokenStub->updateToken(&context, transaction, response);
     case proto::TransactionBody::DataCase::kTokenUpdateNfts:
-      return mTokenStub->updateToken(&context, transaction, response);
+      return stubs.mTokenStub->updateToken(&context, transaction, response);
     case proto::TransactionBody::DataCase::kTokenWipe:
-      return mTokenStub->wipeTokenAccount(&context, transaction, response);
+      return stubs.mTokenStub->wipeTokenAccount(&context, transaction, response);
     case proto::TransactionBody::DataCase::kUtilPrng:
-      return mUtilStub->prng(&context, transaction, response);
+      return stubs.mUtilStub->prng(&context, transaction, response);
     default:
       // This should never happen
       throw std::invalid_argument("Unrecognized gRPC transaction method case");
@@ -196,101 +510,172 @@ grpc::Status Node::submitTransaction(proto::TransactionBody::DataCase funcEnum,
 }
 
 //-----
-Node& Node::toInsecure()
-{
-  const BaseNodeAddress address = getAddress().toInsecure();
-
-  std::unique_lock lock(*getLock());
-  return BaseNode<Node, AccountId>::setAddress(address);
-}
-
-//-----
-Node& Node::toSecure()
-{
-  const BaseNodeAddress address = getAddress().toSecure();
-
-  std::unique_lock lock(*getLock());
-  return BaseNode<Node, AccountId>::setAddress(address);
-}
-
-//-----
-Node& Node::setNodeCertificateHash(const std::vector<std::byte>& hash)
-{
-  std::unique_lock lock(*getLock());
-  mNodeCertificateHash = hash;
-  return *this;
-}
-
-//-----
-Node& Node::setVerifyCertificates(bool verify)
-{
-  std::unique_lock lock(*getLock());
-  mVerifyCertificates = verify;
-  return *this;
-}
-
-//-----
-Node::Node(const Node& node, const BaseNodeAddress& address)
-  : BaseNode<Node, AccountId>(address)
-  , mAccountId(node.mAccountId)
-  , mNodeCertificateHash(node.mNodeCertificateHash)
-  , mVerifyCertificates(node.mVerifyCertificates)
-{
-}
-
-//-----
-std::shared_ptr<grpc::ChannelCredentials> Node::getTlsChannelCredentials() const
+std::unique_ptr<grpc::ClientAsyncResponseReader<proto::Response>> Node::prepareQuery(proto::Query::QueryCase funcEnum,
+                                                                                    grpc::ClientContext* context,
+                                                                                    const proto::Query& query,
+                                                                                    grpc::CompletionQueue* queue)
 {
-  grpc::experimental::TlsChannelCredentialsOptions tlsChannelCredentialsOptions;
-
-  // Custom verification using the node's certificate chain hash
-  tlsChannelCredentialsOptions.set_verify_server_certs(false);
-  tlsChannelCredentialsOptions.set_check_call_host(false);
-  tlsChannelCredentialsOptions.set_certificate_verifier(
-    grpc::experimental::ExternalCertificateVerifier::Create<HieroCertificateVerifier>(mNodeCertificateHash));
-
-  // Feed in the root CA's file manually for Windows (this is a bug in the gRPC implementation and says here
-  // https://deploy-preview-763--grpc-io.netlify.app/docs/guides/auth/#using-client-side-ssltls that this needs to be
-  // specified manually).
-#ifdef _WIN32
-  tlsChannelCredentialsOptions.set_certificate_provider(
-    std::make_shared<grpc::experimental::FileWatcherCertificateProvider>("roots.pem", -1));
-  tlsChannelCredentialsOptions.watch_root_certs();
-#endif
-
-  return grpc::experimental::TlsCredentials(tlsChannelCredentialsOptions);
-}
-
-//-----
-void Node::initializeStubs()
-{
-  // clang-format off
-  if (!mConsensusStub)     mConsensusStub     = proto::ConsensusService::NewStub(getChannel());
-  if (!mCryptoStub)        mCryptoStub        = proto::CryptoService::NewStub(getChannel());
-  if (!mFileStub)          mFileStub          = proto::FileService::NewStub(getChannel());
-  if (!mFreezeStub)        mFreezeStub        = proto::FreezeService::NewStub(getChannel());
-  if (!mNetworkStub)       mNetworkStub       = proto::NetworkService::NewStub(getChannel());
-  if (!mScheduleStub)      mScheduleStub      = proto::ScheduleService::NewStub(getChannel());
-  if (!mSmartContractStub) mSmartContractStub = proto::SmartContractService::NewStub(getChannel());
-  if (!mTokenStub)         mTokenStub         = proto::TokenService::NewStub(getChannel());
-  if (!mUtilStub)          mUtilStub          = proto::UtilService::NewStub(getChannel());
-  if (!mAddressBookStub)   mAddressBookStub   = proto::AddressBookService::NewStub(getChannel());
-  // clang-format on
+  const std::shared_ptr<const Stubs> nextStubs = getNextStubs();
+  const Stubs& stubs = *nextStubs;
+  switch (funcEnum)
+  {
+    case proto::Query::QueryCase::kConsensusGetTopicInfo:
+      return stubs.mConsensusStub->PrepareAsyncgetTopicInfo(context, query, queue);
+    case proto::Query::QueryCase::kContractCallLocal:
+      return stubs.mSmartContractStub->PrepareAsynccontractCallLocalMethod(context, query, queue);
+    case proto::Query::QueryCase::kContractGetBytecode:
+      return stubs.mSmartContractStub->PrepareAsyncContractGetBytecode(context, query, queue);
+    case proto::Query::QueryCase::kContractGetInfo:
+      return stubs.mSmartContractStub->PrepareAsyncgetContractInfo(context, query, queue);
+    case proto::Query::QueryCase::kCryptogetAccountBalance:
+      return stubs.mCryptoStub->PrepareAsynccryptoGetBalance(context, query, queue);
+    case proto::Query::QueryCase::kCryptoGetAccountRecords:
+      return stubs.mCryptoStub->PrepareAsyncgetAccountRecords(context, query, queue);
+    case proto::Query::QueryCase::kCryptoGetInfo:
+      return stubs.mCryptoStub->PrepareAsyncgetAccountInfo(context, query, queue);
+    case proto::Query::QueryCase::kCryptoGetLiveHash:
+      return stubs.mCryptoStub->PrepareAsyncgetLiveHash(context, query, queue);
+    case proto::Query::QueryCase::kCryptoGetProxyStakers:
+      return stubs.mCryptoStub->PrepareAsyncgetStakersByAccountID(context, query, queue);
+    case proto::Query::QueryCase::kFileGetContents:
+      return stubs.mFileStub->PrepareAsyncgetFileContent(context, query, queue);
+    case proto::Query::QueryCase::kFileGetInfo:
+      return stubs.mFileStub->PrepareAsyncgetFileInfo(context, query, queue);
+    case proto::Query::QueryCase::kNetworkGetVersionInfo:
+      return stubs.mNetworkStub->PrepareAsyncgetVersionInfo(context, query, queue);
+    case proto::Query::QueryCase::kScheduleGetInfo:
+      return stubs.mScheduleStub->PrepareAsyncgetScheduleInfo(context, query, queue);
+    case proto::Query::QueryCase::kTokenGetInfo:
+      return stubs.mTokenStub->PrepareAsyncgetTokenInfo(context, query, queue);
+    case proto::Query::QueryCase::kTokenGetNftInfo:
+      return stubs.mTokenStub->PrepareAsyncgetTokenNftInfo(context, query, queue);
+    case proto::Query::QueryCase::kTransactionGetReceipt:
+      return stubs.mCryptoStub->PrepareAsyncgetTransactionReceipts(context, query, queue);
+    case proto::Query::QueryCase::kTransactionGetRecord:
+      return stubs.mCryptoStub->PrepareAsyncgetTxRecordByTxID(context, query, queue);
+    default:
+      // This should never happen
+      throw std::invalid_argument("Unrecognized gRPC query method case");
+  }
 }
 
 //-----
-void Node::closeStubs()
+std::unique_ptr<grpc::ClientAsyncResponseReader<proto::TransactionResponse>> Node::prepareTransaction(
+  proto::TransactionBody::DataCase funcEnum,
+  grpc::ClientContext* context,
+  const proto::Transaction& transaction,
+  grpc::CompletionQueue* queue)
 {
-  mConsensusStub = nullptr;
-  mCryptoStub = nullptr;
-  mFileStub = nullptr;
-  mFreezeStub = nullptr;
-  mNetworkStub = nullptr;
-  mScheduleStub = nullptr;
-  mSmartContractStub = nullptr;
-  mTokenStub = nullptr;
-  mUtilStub = nullptr;
-  mAddressBookStub = nullptr;
+  const std::shared_ptr<const Stubs> nextStubs = getNextStubs();
+  const Stubs& stubs = *nextStubs;
+  switch (funcEnum)
+  {
+    case proto::TransactionBody::DataCase::kNodeCreate:
+      return stubs.mAddressBookStub->PrepareAsynccreateNode(context, transaction, queue);
+    case proto::TransactionBody::DataCase::kNodeDelete:
+      return stubs.mAddressBookStub->PrepareAsynccreateNode(context, transaction, queue);
+    case proto::TransactionBody::DataCase::kNodeUpdate:
+      return stubs.mAddressBookStub->PrepareAsynccreateNode(context, transaction, queue);
+    case proto::TransactionBody::DataCase::kConsensusCreateTopic:
+      return stubs.mConsensusStub->PrepareAsynccreateTopic(context, transaction, queue);
+    case proto::TransactionBody::DataCase::kConsensusDeleteTopic:
+      return stubs.mConsensusStub->PrepareAsyncdeleteTopic(context, transaction, queue);
+    case proto::TransactionBody::DataCase::kConsensusSubmitMessage:
+      return stubs.mConsensusStub->PrepareAsyncsubmitMessage(context, transaction, queue);
+    case proto::TransactionBody::DataCase::kConsensusUpdateTopic:
+      return stubs.mConsensusStub->PrepareAsyncupdateTopic(context, transaction, queue);
+    case proto::TransactionBody::DataCase::kContractCall:
+      return stubs.mSmartContractStub->PrepareAsynccontractCallMethod(context, transaction, queue);
+    case proto::TransactionBody::DataCase::kContractCreateInstance:
+      return stubs.mSmartContractStub->PrepareAsynccreateContract(context, transaction, queue);
+    case proto::TransactionBody::DataCase::kContractDeleteInstance:
+      return stubs.mSmartContractStub->PrepareAsyncdeleteContract(context, transaction, queue);
+    case proto::TransactionBody::DataCase::kContractUpdateInstance:
+      return stubs.mSmartContractStub->PrepareAsyncupdateContract(context, transaction, queue);
+    case proto::TransactionBody::DataCase::kCryptoAddLiveHash:
+      return stubs.mCryptoStub->PrepareAsyncaddLiveHash(context, transaction, queue);
+    case proto::TransactionBody::DataCase::kCryptoApproveAllowance:
+      return stubs.mCryptoStub->PrepareAsyncapproveAllowances(context, transaction, queue);
+    case proto::TransactionBody::DataCase::kCryptoDeleteAllowance:
+      return stubs.mCryptoStub->PrepareAsyncdeleteAllowances(context, transaction, queue);
+    case proto::TransactionBody::DataCase::kCryptoCreateAccount:
+      return stubs.mCryptoStub->PrepareAsynccreateAccount(context, transaction, queue);
+    case proto::TransactionBody::DataCase::kCryptoDelete:
+      return stubs.mCryptoStub->PrepareAsynccryptoDelete(context, transaction, queue);
+    case proto::TransactionBody::DataCase::kCryptoDeleteLiveHash:
+      return stubs.mCryptoStub->PrepareAsyncdeleteLiveHash(context, transaction, queue);
+    case proto::TransactionBody::DataCase::kCryptoTransfer:
+      return stubs.mCryptoStub->PrepareAsynccryptoTransfer(context, transaction, queue);
+    case proto::TransactionBody::DataCase::kCryptoUpdateAccount:
+      return stubs.mCryptoStub->PrepareAsyncupdateAccount(context, transaction, queue);
+    case proto::TransactionBody::DataCase::kEthereumTransaction:
+      return stubs.mSmartContractStub->PrepareAsynccallEthereum(context, transaction, queue);
+    case proto::TransactionBody::DataCase::kFileAppend:
+      return stubs.mFileStub->PrepareAsyncappendContent(context, transaction, queue);
+    case proto::TransactionBody::DataCase::kFileCreate:
+      return stubs.mFileStub->PrepareAsynccreateFile(context, transaction, queue);
+    case proto::TransactionBody::DataCase::kFileDelete:
+      return stubs.mFileStub->PrepareAsyncdeleteFile(context, transaction, queue);
+    case proto::TransactionBody::DataCase::kFileUpdate:
+      return stubs.mFileStub->PrepareAsyncupdateFile(context, transaction, queue);
+    case proto::TransactionBody::DataCase::kFreeze:
+      return stubs.mFreezeStub->PrepareAsyncfreeze(context, transaction, queue);
+    case proto::TransactionBody::DataCase::kScheduleCreate:
+      return stubs.mScheduleStub->PrepareAsynccreateSchedule(context, transaction, queue);
+    case proto::TransactionBody::DataCase::kScheduleDelete:
+      return stubs.mScheduleStub->PrepareAsyncdeleteSchedule(context, transaction, queue);
+    case proto::TransactionBody::DataCase::kScheduleSign:
+      return stubs.mScheduleStub->PrepareAsyncsignSchedule(context, transaction, queue);
+    case proto::TransactionBody::DataCase::kSystemDelete:
+      return stubs.mFileStub->PrepareAsyncsystemDelete(context, transaction, queue);
+    case proto::TransactionBody::DataCase::kSystemUndelete:
+      return stubs.mFileStub->PrepareAsyncsystemUndelete(context, transaction, queue);
+    case proto::TransactionBody::DataCase::kTokenAirdrop:
+      return stubs.mTokenStub->PrepareAsyncairdropTokens(context, transaction, queue);
+    case proto::TransactionBody::DataCase::kTokenAssociate:
+      return stubs.mTokenStub->PrepareAsyncassociateTokens(context, transaction, queue);
+    case proto::TransactionBody::DataCase::kTokenBurn:
+      return stubs.mTokenStub->PrepareAsyncburnToken(context, transaction, queue);
+    case proto::TransactionBody::DataCase::kTokenCancelAirdrop:
+      return stubs.mTokenStub->PrepareAsyncburnToken(context, transaction, queue);
+    case proto::TransactionBody::DataCase::kTokenClaimAirdrop:
+      return stubs.mTokenStub->PrepareAsyncburnToken(context, transaction, queue);
+    case proto::TransactionBody::DataCase::kTokenCreation:
+      return stubs.mTokenStub->PrepareAsynccreateToken(context, transaction, queue);
+    case proto::TransactionBody::DataCase::kTokenDeletion:
+      return stubs.mTokenStub->PrepareAsyncdeleteToken(context, transaction, queue);
+    case proto::TransactionBody::DataCase::kTokenDissociate:
+      return stubs.mTokenStub->PrepareAsyncdissociateTokens(context, transaction, queue);
+    case proto::TransactionBody::DataCase::kTokenFeeScheduleUpdate:
+      return stubs.mTokenStub->PrepareAsyncupdateTokenFeeSchedule(context, transaction, queue);
+    case proto::TransactionBody::DataCase::kTokenFreeze:
+      return stubs.mTokenStub->PrepareAsyncfreezeTokenAccount(context, transaction, queue);
+    case proto::TransactionBody::DataCase::kTokenGrantKyc:
+      return stubs.mTokenStub->PrepareAsyncgrantKycToTokenAccount(context, transaction, queue);
+    case proto::TransactionBody::DataCase::kTokenMint:
+      return stubs.mTokenStub->PrepareAsyncmintToken(context, transaction, queue);
+    case proto::TransactionBody::DataCase::kTokenPause:
+      return stubs.mTokenStub->PrepareAsyncpauseToken(context, transaction, queue);
+    case proto::TransactionBody::DataCase::kTokenReject:
+      return stubs.mTokenStub->PrepareAsyncrevokeKycFromTokenAccount(context, transaction, queue);
+    case proto::TransactionBody::DataCase::kTokenRevokeKyc:
+      return stubs.mTokenStub->PrepareAsyncrevokeKycFromTokenAccount(context, transaction, queue);
+    case proto::TransactionBody::DataCase::kTokenUnfreeze:
+      return stubs.mTokenStub->PrepareAsyncunfreezeTokenAccount(context, transaction, queue);
+    case proto::TransactionBody::DataCase::kTokenUnpause:
+      return stubs.mTokenStub->PrepareAsyncunpauseToken(context, transaction, queue);
+    case proto::TransactionBody::DataCase::kTokenUpdate:
+      return stubs.mTokenStub->PrepareAsyncupdateToken(context, transaction, queue);
+    case proto::TransactionBody::DataCase::kTokenUpdateNfts:
+      return stubs.mTokenStub->PrepareAsyncupdateToken(context, transaction, queue);
+    case proto::TransactionBody::DataCase::kTokenWipe:
+      return stubs.mTokenStub->PrepareAsyncwipeTokenAccount(context, transaction, queue);
+    case proto::TransactionBody::DataCase::kUtilPrng:
+      return stubs.mUtilStub->PrepareAsyncprng(context, transaction, queue);
+    default:
+      // This should never happen
+      throw std::invalid_argument("Unrecognized gRPC transaction method case");
+  }
 }
 
 } // namespace Hiero::internal
@@ -0,0 +1,95 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "impl/NodeHealth.h"
+
+#include <algorithm>
+
+namespace Hiero::internal
+{
+//-----
+NodeHealth::NodeHealth(const std::chrono::system_clock::duration& minBackoff,
+                       const std::chrono::system_clock::duration& maxBackoff)
+  : mReadmitTime(std::chrono::system_clock::now().time_since_epoch().count())
+  , mCurrentBackoff(minBackoff.count())
+  , mMinBackoff(minBackoff.count())
+  , mMaxBackoff(maxBackoff.count())
+{
+}
+
+//-----
+void NodeHealth::increaseBackoff()
+{
+  mBadGrpcStatusCount.fetch_add(1U, std::memory_order_relaxed);
+
+  // Double the current backoff (without going over the max backoff), and back off for the backoff it replaced.
+  std::chrono::system_clock::rep backoff = mCurrentBackoff.load(std::memory_order_relaxed);
+  while (!mCurrentBackoff.compare_exchange_weak(
+    backoff, std::min(backoff * 2, mMaxBackoff.load(std::memory_order_relaxed)), std::memory_order_relaxed))
+  {
+  }
+
+  // Concurrent failures can only push the readmit time later, never earlier.
+  const std::chrono::system_clock::rep readmitTime =
+    std::chrono::system_clock::now().time_since_epoch().count() + backoff;
+  std::chrono::system_clock::rep current = mReadmitTime.load(std::memory_order_relaxed);
+  while (current < readmitTime &&
+         !mReadmitTime.compare_exchange_weak(current, readmitTime, std::memory_order_release, std::memory_order_relaxed))
+  {
+  }
+}
+
+//-----
+void NodeHealth::decreaseBackoff()
+{
+  // Halve the current backoff, without going under the min backoff.
+  std::chrono::system_clock::rep backoff = mCurrentBackoff.load(std::memory_order_relaxed);
+  while (!mCurrentBackoff.compare_exchange_weak(
+    backoff, std::max(backoff / 2, mMinBackoff.load(std::memory_order_relaxed)), std::memory_order_relaxed))
+  {
+  }
+}
+
+//-----
+bool NodeHealth::isHealthy(const std::chrono::system_clock::time_point& now) const
+{
+  return getReadmitTime() < now;
+}
+
+//-----
+std::chrono::system_clock::time_point NodeHealth::getReadmitTime() const
+{
+  return std::chrono::system_clock::time_point(
+    std::chrono::system_clock::duration(mReadmitTime.load(std::memory_order_acquire)));
+}
+
+//-----
+unsigned int NodeHealth::getBadGrpcStatusCount() const
+{
+  return mBadGrpcStatusCount.load(std::memory_order_relaxed);
+}
+
+//-----
+void NodeHealth::setMinBackoff(const std::chrono::system_clock::duration& backoff)
+{
+  std::chrono::system_clock::rep previous = mMinBackoff.exchange(backoff.count(), std::memory_order_relaxed);
+  mCurrentBackoff.compare_exchange_strong(previous, backoff.count(), std::memory_order_relaxed);
+}
+
+//-----
+void NodeHealth::setMaxBackoff(const std::chrono::system_clock::duration& backoff)
+{
+  mMaxBackoff.store(backoff.count(), std::memory_order_relaxed);
+}
+
+//-----
+std::chrono::system_clock::duration NodeHealth::getMinBackoff() const
+{
+  return std::chrono::system_clock::duration(mMinBackoff.load(std::memory_order_relaxed));
+}
+
+//-----
+std::chrono::system_clock::duration NodeHealth::getMaxBackoff() const
+{
+  return std::chrono::system_clock::duration(mMaxBackoff.load(std::memory_order_relaxed));
+}
+
+} // namespace Hiero::internal
@@ -0,0 +1,97 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "impl/NodeSelector.h"
+#include "impl/Node.h"
+
+#include <algorithm>
+#include <limits>
+#include <random>
+
+namespace Hiero::internal::NodeSelector
+{
+namespace
+{
+/**
+ * Get the random number engine of the calling thread, so that concurrent selections don't share one.
+ *
+ * @return A reference to the random number engine of the calling thread.
+ */
+std::mt19937& getEngine()
+{
+  thread_local std::mt19937 engine(std::random_device{}());
+  return engine;
+}
+
+/**
+ * Get a random index below a bound.
+ *
+ * @param bound The exclusive upper bound of the index.
+ * @return A random index in [0, bound).
+ */
+std::size_t getRandomIndex(std::size_t bound)
+{
+  return std::uniform_int_distribution<std::size_t>(0ULL, bound - 1ULL)(getEngine());
+}
+
+} // namespace
+
+//-----
+std::size_t selectNode(NodeSelectionPolicy policy, const std::vector<std::shared_ptr<Node>>& nodes, std::size_t count)
+{
+  if (count <= 1ULL)
+  {
+    return 0ULL;
+  }
+
+  switch (policy)
+  {
+    case NodeSelectionPolicy::POWER_OF_TWO_CHOICES:
+    {
+      const std::size_t first = getRandomIndex(count);
+      std::size_t second = getRandomIndex(count - 1ULL);
+      if (second >= first)
+      {
+        ++second;
+      }
+
+      return nodes.at(second)->getStats().getExpectedCost() < nodes.at(first)->getStats().getExpectedCost() ? second
+                                                                                                             : first;
+    }
+    case NodeSelectionPolicy::LEAST_OUTSTANDING_REQUESTS:
+    {
+      // Start at a random node so that ties are broken at random.
+      const std::size_t offset = getRandomIndex(count);
+      std::size_t best = offset;
+      unsigned int bestOutstanding = std::numeric_limits<unsigned int>::max();
+      for (std::size_t i = 0ULL; i < count; ++i)
+      {
+        const std::size_t index = (offset + i) % count;
+        if (const unsigned int outstanding = nodes.at(index)->getStats().getOutstandingRequests();
+            outstanding < bestOutstanding)
+        {
+          best = index;
+          bestOutstanding = outstanding;
+        }
+      }
+
+      return best;
+    }
+    case NodeSelectionPolicy::LATENCY_WEIGHTED:
+    {
+      std::vector<double> weights;
+      weights.reserve(count);
+      for (std::size_t i = 0ULL; i < count; ++i)
+      {
+        weights.push_back(1.0 / std::max(nodes.at(i)->getStats().getExpectedCost(), 1.0));
+      }
+
+      return std::discrete_distribution<std::size_t>(weights.cbegin(), weights.cend())(getEngine());
+    }
+    case NodeSelectionPolicy::RANDOM:
+    default:
+    {
+      return getRandomIndex(count);
+    }
+  }
+}
+
+} // namespace Hiero::internal::NodeSelector
@@ -0,0 +1,123 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "impl/NodeStats.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Hiero::internal
+{
+//-----
+std::chrono::steady_clock::time_point NodeStats::startRequest()
+{
+  mOutstandingRequests.fetch_add(1U, std::memory_order_relaxed);
+  return std::chrono::steady_clock::now();
+}
+
+//-----
+void NodeStats::endRequest(const std::chrono::steady_clock::time_point& start, bool failed)
+{
+  const auto latency = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+  mOutstandingRequests.fetch_sub(1U, std::memory_order_relaxed);
+
+  // The first response replaces the initial estimate instead of being averaged with it.
+  const std::uint64_t completed = mCompletedRequests.fetch_add(1ULL, std::memory_order_relaxed);
+  if (completed == 0ULL)
+  {
+    mAverageLatency.store(static_cast<double>(latency.count()), std::memory_order_relaxed);
+  }
+  else
+  {
+    updateAverage(mAverageLatency, static_cast<double>(latency.count()));
+  }
+
+  updateAverage(mErrorRate, failed ? 1.0 : 0.0);
+
+  // Halving the counts can race with other updates, which at worst loses a few samples of the histogram.
+  if ((completed + 1ULL) % HISTOGRAM_DECAY_INTERVAL == 0ULL)
+  {
+    for (std::atomic<std::uint64_t>& bucket : mHistogram)
+    {
+      bucket.store(bucket.load(std::memory_order_relaxed) / 2ULL, std::memory_order_relaxed);
+    }
+  }
+
+  const auto micros = std::chrono::duration_cast<std::chrono::microseconds>(latency).count();
+  const std::size_t bucket = (micros <= 1) ? 0ULL : static_cast<std::size_t>(std::log2(static_cast<double>(micros)));
+  mHistogram.at(std::min<std::size_t>(bucket, HISTOGRAM_BUCKETS - 1ULL)).fetch_add(1ULL, std::memory_order_relaxed);
+}
+
+//-----
+void NodeStats::cancelRequest()
+{
+  mOutstandingRequests.fetch_sub(1U, std::memory_order_relaxed);
+}
+
+//-----
+std::chrono::nanoseconds NodeStats::getAverageLatency() const
+{
+  return std::chrono::nanoseconds(static_cast<std::int64_t>(mAverageLatency.load(std::memory_order_relaxed)));
+}
+
+//-----
+std::chrono::nanoseconds NodeStats::getLatencyPercentile(double percentile) const
+{
+  std::array<std::uint64_t, HISTOGRAM_BUCKETS> counts = {};
+  std::uint64_t total = 0ULL;
+  for (std::size_t i = 0ULL; i < HISTOGRAM_BUCKETS; ++i)
+  {
+    counts.at(i) = mHistogram.at(i).load(std::memory_order_relaxed);
+    total += counts.at(i);
+  }
+
+  if (total == 0ULL)
+  {
+    return std::chrono::nanoseconds(0);
+  }
+
+  // The rank of the percentile among the samples, counting from 1.
+  const std::uint64_t rank = std::max<std::uint64_t>(
+    static_cast<std::uint64_t>(std::ceil(std::clamp(percentile, 0.0, 100.0) / 100.0 * static_cast<double>(total))),
+    1ULL);
+  std::uint64_t seen = 0ULL;
+  for (std::size_t i = 0ULL; i < HISTOGRAM_BUCKETS; ++i)
+  {
+    seen += counts.at(i);
+    if (seen >= rank)
+    {
+      return std::chrono::microseconds(1LL << (i + 1ULL));
+    }
+  }
+
+  return std::chrono::microseconds(1LL << HISTOGRAM_BUCKETS);
+}
+
+//-----
+double NodeStats::getErrorRate() const
+{
+  return mErrorRate.load(std::memory_order_relaxed);
+}
+
+//-----
+unsigned int NodeStats::getOutstandingRequests() const
+{
+  return mOutstandingRequests.load(std::memory_order_relaxed);
+}
+
+//-----
+double NodeStats::getExpectedCost() const
+{
+  return mAverageLatency.load(std::memory_order_relaxed) * (getOutstandingRequests() + 1U) /
+         std::max(1.0 - getErrorRate(), MIN_SUCCESS_RATE);
+}
+
+//-----
+void NodeStats::updateAverage(std::atomic<double>& average, double sample)
+{
+  double current = average.load(std::memory_order_relaxed);
+  while (!average.compare_exchange_weak(
+    current, current + EWMA_WEIGHT * (sample - current), std::memory_order_relaxed))
+  {
+  }
+}
+
+} // namespace Hiero::internal
@@ -2,9 +2,7 @@
 #include "impl/openssl_utils/OpenSSLUtils.h"
 #include "exceptions/OpenSSLException.h"
 #include "impl/Utilities.h"
-#include "impl/openssl_utils/EVP_MD.h"
-#include "impl/openssl_utils/EVP_MD_CTX.h"
-#include "impl/openssl_utils/OSSL_LIB_CTX.h"
+#include "impl/openssl_utils/CryptoContext.h"
 
 #include <openssl/err.h>
 #include <openssl/hmac.h>
@@ -35,27 +33,20 @@ std::vector<std::byte> computeSHA384(const std::vector<std::byte>& data)
 }
 
 //-----
-std::vector<std::byte> computeKECCAK256(const std::vector<std::byte>& data)
+std::vector<std::byte> computeSHA384(std::string_view data)
 {
-  internal::OpenSSLUtils::OSSL_LIB_CTX libraryContext(OSSL_LIB_CTX_new());
-  if (!libraryContext)
-  {
-    throw OpenSSLException(internal::OpenSSLUtils::getErrorMessage("OSSL_LIB_CTX_new"));
-  }
-
-  const internal::OpenSSLUtils::EVP_MD messageDigest(EVP_MD_fetch(libraryContext.get(), "KECCAK-256", nullptr));
-  if (!messageDigest)
-  {
-    throw OpenSSLException(internal::OpenSSLUtils::getErrorMessage("EVP_MD_fetch"));
-  }
-
-  internal::OpenSSLUtils::EVP_MD_CTX messageDigestContext(EVP_MD_CTX_new());
-  if (!messageDigestContext)
-  {
-    throw OpenSSLException(internal::OpenSSLUtils::getErrorMessage("EVP_MD_CTX_new"));
-  }
+  auto outputBytes = std::vector<std::byte>(SHA384_HASH_SIZE);
+  SHA384(Utilities::toTypePtr<unsigned char>(data.data()),
+         data.size(),
+         Utilities::toTypePtr<unsigned char>(outputBytes.data()));
+  return outputBytes;
+}
 
-  if (EVP_DigestInit(messageDigestContext.get(), messageDigest.get()) <= 0)
+//-----
+std::vector<std::byte> computeKECCAK256(const std::vector<std::byte>& data)
+{
+  const CryptoContext::MessageDigestContext messageDigestContext;
+  if (EVP_DigestInit(messageDigestContext.get(), CryptoContext::getInstance().getKECCAK256()) <= 0)
   {
     throw OpenSSLException(internal::OpenSSLUtils::getErrorMessage("EVP_DigestInit_ex"));
   }
@@ -80,25 +71,8 @@ std::vector<std::byte> computeKECCAK256(const std::vector<std::byte>& data)
 //-----
 std::vector<std::byte> computeSHA512HMAC(const std::vector<std::byte>& key, const std::vector<std::byte>& data)
 {
-  EVP_MD_CTX messageDigestContext(EVP_MD_CTX_new());
-  if (!messageDigestContext)
-  {
-    throw OpenSSLException(getErrorMessage("EVP_MD_CTX_new"));
-  }
-
-  const EVP_MD messageDigest(EVP_MD_fetch(nullptr, "SHA512", nullptr));
-  if (!messageDigest)
-  {
-    throw OpenSSLException(getErrorMessage("EVP_MD_fetch"));
-  }
-
-  if (EVP_DigestInit(messageDigestContext.get(), messageDigest.get()) <= 0)
-  {
-    throw OpenSSLException(getErrorMessage("EVP_DigestInit"));
-  }
-
   std::vector<std::byte> digest(SHA512_HMAC_HASH_SIZE);
-  if (!HMAC(messageDigest.get(),
+  if (!HMAC(CryptoContext::getInstance().getSHA512(),
             key.data(),
             static_cast<int>(key.size()),
             Utilities::toTypePtr<unsigned char>(data.data()),
@@ -0,0 +1,251 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "impl/PaymentTransactionPool.h"
+#include "Client.h"
+#include "TransactionId.h"
+#include "TransferTransaction.h"
+#include "exceptions/UninitializedException.h"
+#include "impl/TransactionIdGenerator.h"
+
+#include <exception>
+#include <iterator>
+#include <optional>
+#include <utility>
+
+namespace Hiero::internal
+{
+//-----
+PaymentTransactionPool::PaymentTransactionPool(unsigned int size,
+                                               const std::chrono::system_clock::duration& validDuration,
+                                               const std::chrono::system_clock::duration& expiryMargin)
+  : mSize(size)
+  , mValidDuration(validDuration)
+  , mExpiryMargin(expiryMargin)
+  , mThread(&PaymentTransactionPool::refill, this)
+{
+}
+
+//-----
+PaymentTransactionPool::~PaymentTransactionPool()
+{
+  close();
+}
+
+//-----
+proto::Transaction PaymentTransactionPool::take(const Client& client,
+                                                const AccountId& nodeAccountId,
+                                                const Hbar& amount)
+{
+  const std::optional<AccountId> operatorAccountId = client.getOperatorAccountId();
+  const std::optional<std::function<std::vector<std::byte>(const std::vector<std::byte>&)>> signer =
+    client.getOperatorSigner();
+  if (!operatorAccountId.has_value() || !signer.has_value())
+  {
+    throw UninitializedException("Client operator has not been initialized and cannot pay for queries.");
+  }
+
+  const Payer payer = {
+    operatorAccountId.value(), client.getOperatorPublicKey(), signer.value(), client.getTransactionIdBackdate()
+  };
+  const Key key = std::make_tuple(payer.mAccountId.mShardNum,
+                                  payer.mAccountId.mRealmNum,
+                                  payer.mAccountId.mAccountNum.value_or(0ULL),
+                                  nodeAccountId.mShardNum,
+                                  nodeAccountId.mRealmNum,
+                                  nodeAccountId.mAccountNum.value_or(0ULL),
+                                  amount.toTinybars());
+
+  {
+    std::unique_lock lock(mMutex);
+    if (!mIsClosed)
+    {
+      Bucket& bucket = mBuckets[key];
+      bucket.mPayer = payer;
+      bucket.mNodeAccountId = nodeAccountId;
+      bucket.mAmount = amount;
+      dropExpired(bucket, std::chrono::system_clock::now());
+
+      std::optional<proto::Transaction> payment;
+      if (!bucket.mPayments.empty())
+      {
+        payment = std::move(bucket.mPayments.front().mTransaction);
+        bucket.mPayments.pop_front();
+        ++mStatistics.mHits;
+      }
+      else
+      {
+        ++mStatistics.mMisses;
+      }
+
+      if (!bucket.mIsQueued && bucket.mPayments.size() + bucket.mPending < mSize)
+      {
+        bucket.mIsQueued = true;
+        mQueue.push_back(key);
+        mCondition.notify_one();
+      }
+
+      if (payment.has_value())
+      {
+        return std::move(payment.value());
+      }
+    }
+  }
+
+  return build(payer, nodeAccountId, amount).mTransaction;
+}
+
+//-----
+void PaymentTransactionPool::close()
+{
+  {
+    std::unique_lock lock(mMutex);
+    if (mIsClosed)
+    {
+      return;
+    }
+
+    mIsClosed = true;
+    mBuckets.clear();
+    mQueue.clear();
+  }
+
+  mCondition.notify_all();
+  if (mThread.joinable())
+  {
+    mThread.join();
+  }
+}
+
+//-----
+std::size_t PaymentTransactionPool::size() const
+{
+  std::unique_lock lock(mMutex);
+  std::size_t size = 0U;
+  for (const auto& [key, bucket] : mBuckets)
+  {
+    size += bucket.mPayments.size();
+  }
+
+  return size;
+}
+
+//-----
+PaymentTransactionPool::Statistics PaymentTransactionPool::getStatistics() const
+{
+  std::unique_lock lock(mMutex);
+  return mStatistics;
+}
+
+//-----
+PaymentTransactionPool::Payment PaymentTransactionPool::build(const Payer& payer,
+                                                              const AccountId& nodeAccountId,
+                                                              const Hbar& amount) const
+{
+  const std::chrono::system_clock::time_point validStart =
+    TransactionIdGenerator::getInstance().next(payer.mAccountId, 1U, payer.mBackdate);
+
+  TransferTransaction transaction;
+  transaction.setTransactionId(TransactionId::withValidStart(payer.mAccountId, validStart))
+    .setNodeAccountIds({ nodeAccountId })
+    .setValidTransactionDuration(mValidDuration)
+    .addHbarTransfer(payer.mAccountId, amount.negated())
+    .addHbarTransfer(nodeAccountId, amount)
+    .freeze()
+    .signWith(payer.mPublicKey, payer.mSigner);
+
+  // There's only one node account ID, therefore only one Transaction protobuf object will be created, and that will be
+  // put in the 0th index.
+  return { transaction.makeRequest(0U), validStart + mValidDuration - mExpiryMargin };
+}
+
+//-----
+void PaymentTransactionPool::dropExpired(Bucket& bucket, const std::chrono::system_clock::time_point& now)
+{
+  while (!bucket.mPayments.empty() && bucket.mPayments.front().mExpiry <= now)
+  {
+    bucket.mPayments.pop_front();
+    ++mStatistics.mExpired;
+  }
+}
+
+//-----
+void PaymentTransactionPool::refill()
+{
+  std::unique_lock lock(mMutex);
+  while (true)
+  {
+    mCondition.wait(lock, [this]() { return mIsClosed || !mQueue.empty(); });
+    if (mIsClosed)
+    {
+      return;
+    }
+
+    const Key key = mQueue.front();
+    mQueue.pop_front();
+
+    // Buckets that have run dry and aren't being topped up are forgotten, so that operators, nodes and amounts that are
+    // no longer used don't linger.
+    const auto now = std::chrono::system_clock::now();
+    for (auto iter = mBuckets.begin(); iter != mBuckets.end();)
+    {
+      dropExpired(iter->second, now);
+      if (iter->second.mPayments.empty() && iter->second.mPending == 0U && !iter->second.mIsQueued &&
+          iter->first != key)
+      {
+        iter = mBuckets.erase(iter);
+      }
+      else
+      {
+        ++iter;
+      }
+    }
+
+    auto iter = mBuckets.find(key);
+    if (iter == mBuckets.end())
+    {
+      continue;
+    }
+
+    Bucket& bucket = iter->second;
+    bucket.mIsQueued = false;
+    const std::size_t ready = bucket.mPayments.size() + bucket.mPending;
+    if (ready >= mSize)
+    {
+      continue;
+    }
+
+    const auto missing = static_cast<unsigned int>(mSize - ready);
+    bucket.mPending += missing;
+    const Payer payer = bucket.mPayer;
+    const AccountId nodeAccountId = bucket.mNodeAccountId;
+    const Hbar amount = bucket.mAmount;
+
+    // Build and sign without the lock, as signing can take a while (e.g. when the operator signs remotely).
+    std::vector<Payment> payments;
+    payments.reserve(missing);
+    lock.unlock();
+    try
+    {
+      for (unsigned int i = 0U; i < missing; ++i)
+      {
+        payments.push_back(build(payer, nodeAccountId, amount));
+      }
+    }
+    catch (const std::exception&)
+    {
+      // Payments that can't be built ahead of time will be built on the spot, where the error will be reported.
+    }
+    lock.lock();
+
+    if (mIsClosed)
+    {
+      return;
+    }
+
+    // The Bucket can't have been erased while its payments were pending.
+    Bucket& toppedUp = mBuckets[key];
+    toppedUp.mPending -= missing;
+    std::move(payments.begin(), payments.end(), std::back_inserter(toppedUp.mPayments));
+  }
+}
+
+} // namespace Hiero::internal
@@ -0,0 +1,62 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "impl/QueryCostCache.h"
+
+#include <iterator>
+
+namespace Hiero::internal
+{
+//-----
+QueryCostCache::QueryCostCache(const std::chrono::system_clock::duration& duration, std::size_t maxEntries)
+  : mDuration(duration)
+  , mMaxEntries(maxEntries)
+{
+}
+
+//-----
+std::optional<Hbar> QueryCostCache::get(const std::string& key, const std::chrono::system_clock::time_point& now) const
+{
+  std::unique_lock lock(mMutex);
+  if (const auto iter = mEntries.find(key); iter != mEntries.cend() && iter->second.mExpiry > now)
+  {
+    return iter->second.mCost;
+  }
+
+  return std::nullopt;
+}
+
+//-----
+void QueryCostCache::put(const std::string& key, const Hbar& cost, const std::chrono::system_clock::time_point& now)
+{
+  std::unique_lock lock(mMutex);
+  if (mEntries.size() >= mMaxEntries && mEntries.find(key) == mEntries.end())
+  {
+    // Make room by dropping the forgotten costs, or if there are none, an arbitrary cost.
+    for (auto iter = mEntries.begin(); iter != mEntries.end();)
+    {
+      iter = iter->second.mExpiry <= now ? mEntries.erase(iter) : std::next(iter);
+    }
+
+    if (!mEntries.empty() && mEntries.size() >= mMaxEntries)
+    {
+      mEntries.erase(mEntries.begin());
+    }
+  }
+
+  mEntries[key] = { cost, now + mDuration };
+}
+
+//-----
+void QueryCostCache::erase(const std::string& key)
+{
+  std::unique_lock lock(mMutex);
+  mEntries.erase(key);
+}
+
+//-----
+std::size_t QueryCostCache::size() const
+{
+  std::unique_lock lock(mMutex);
+  return mEntries.size();
+}
+
+} // namespace Hiero::internal
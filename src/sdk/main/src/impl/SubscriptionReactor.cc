@@ -0,0 +1,87 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "impl/SubscriptionReactor.h"
+#include "impl/CompletionQueueDriver.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace Hiero::internal
+{
+//-----
+SubscriptionReactor::SubscriptionReactor(unsigned int queues)
+{
+  queues = std::max(queues, 1U);
+  mDrivers.reserve(queues);
+  for (unsigned int i = 0U; i < queues; ++i)
+  {
+    mDrivers.push_back(std::make_shared<CompletionQueueDriver>(1U));
+  }
+}
+
+//-----
+SubscriptionReactor::~SubscriptionReactor()
+{
+  shutdown();
+}
+
+//-----
+std::shared_ptr<CompletionQueueDriver> SubscriptionReactor::add(const std::shared_ptr<Subscription>& subscription)
+{
+  std::unique_lock lock(mMutex);
+  if (mIsShutdown)
+  {
+    return nullptr;
+  }
+
+  mSubscriptions.try_emplace(subscription.get(), subscription);
+  return mDrivers.at(mNextDriver.fetch_add(1U, std::memory_order_relaxed) % mDrivers.size());
+}
+
+//-----
+void SubscriptionReactor::remove(const Subscription* subscription)
+{
+  std::unique_lock lock(mMutex);
+  mSubscriptions.erase(subscription);
+}
+
+//-----
+void SubscriptionReactor::shutdown()
+{
+  std::vector<std::shared_ptr<Subscription>> subscriptions;
+  {
+    std::unique_lock lock(mMutex);
+    if (mIsShutdown)
+    {
+      return;
+    }
+
+    mIsShutdown = true;
+    subscriptions.reserve(mSubscriptions.size());
+    for (const auto& [key, subscription] : mSubscriptions)
+    {
+      if (std::shared_ptr<Subscription> running = subscription.lock())
+      {
+        subscriptions.push_back(std::move(running));
+      }
+    }
+  }
+
+  // Cancelled streams complete their outstanding reads, which lets the CompletionQueues drain. The lock isn't held, as
+  // the subscriptions remove themselves while they end.
+  std::for_each(subscriptions.begin(),
+                subscriptions.end(),
+                [](const std::shared_ptr<Subscription>& subscription) { subscription->cancel(); });
+  subscriptions.clear();
+
+  std::for_each(
+    mDrivers.begin(), mDrivers.end(), [](const std::shared_ptr<CompletionQueueDriver>& driver) { driver->shutdown(); });
+}
+
+//-----
+std::size_t SubscriptionReactor::size() const
+{
+  std::unique_lock lock(mMutex);
+  return mSubscriptions.size();
+}
+
+} // namespace Hiero::internal
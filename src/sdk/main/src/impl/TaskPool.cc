@@ -0,0 +1,171 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "impl/TaskPool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+
+namespace Hiero::internal
+{
+//-----
+struct TaskPool::Batch
+{
+  // The number of tasks in this Batch.
+  std::size_t mCount = 0ULL;
+
+  // The function to run for each task. It is owned by the thread waiting in run().
+  const std::function<void(std::size_t)>* mTask = nullptr;
+
+  // The index of the next task to claim.
+  std::atomic<std::size_t> mNext = 0ULL;
+
+  // The mutex protecting the number of completed tasks and the first exception.
+  std::mutex mMutex;
+
+  // Condition variable used to wake the submitting thread when the last task completes.
+  std::condition_variable mCondition;
+
+  // The number of tasks that have completed.
+  std::size_t mCompleted = 0ULL;
+
+  // The first exception thrown by a task, if any.
+  std::exception_ptr mException;
+};
+
+//-----
+TaskPool::TaskPool(unsigned int threads)
+{
+  mThreads.reserve(threads);
+  for (unsigned int i = 0U; i < threads; ++i)
+  {
+    mThreads.emplace_back(&TaskPool::work, this);
+  }
+}
+
+//-----
+TaskPool::~TaskPool()
+{
+  {
+    std::unique_lock lock(mMutex);
+    mIsStopped = true;
+  }
+
+  mCondition.notify_all();
+  for (std::thread& thread : mThreads)
+  {
+    thread.join();
+  }
+}
+
+//-----
+TaskPool& TaskPool::getInstance()
+{
+  static TaskPool instance(std::max(std::thread::hardware_concurrency(), 1U) - 1U);
+  return instance;
+}
+
+//-----
+void TaskPool::run(std::size_t count, const std::function<void(std::size_t)>& task)
+{
+  if (count == 0ULL)
+  {
+    return;
+  }
+
+  // A batch of one task, or a pool without threads, gains nothing from being shared.
+  if (count == 1ULL || mThreads.empty())
+  {
+    for (std::size_t i = 0ULL; i < count; ++i)
+    {
+      task(i);
+    }
+
+    return;
+  }
+
+  auto batch = std::make_shared<Batch>();
+  batch->mCount = count;
+  batch->mTask = &task;
+
+  {
+    std::unique_lock lock(mMutex);
+    mBatches.push_back(batch);
+  }
+
+  mCondition.notify_all();
+
+  process(*batch);
+
+  // Once every task has been claimed there is nothing left for the pool threads to pick up.
+  {
+    std::unique_lock lock(mMutex);
+    mBatches.erase(std::remove(mBatches.begin(), mBatches.end(), batch), mBatches.end());
+  }
+
+  std::unique_lock lock(batch->mMutex);
+  batch->mCondition.wait(lock, [&batch]() { return batch->mCompleted == batch->mCount; });
+
+  if (batch->mException)
+  {
+    std::rethrow_exception(batch->mException);
+  }
+}
+
+//-----
+void TaskPool::work()
+{
+  while (true)
+  {
+    std::shared_ptr<Batch> batch;
+
+    {
+      std::unique_lock lock(mMutex);
+      mCondition.wait(lock, [this]() { return mIsStopped || !mBatches.empty(); });
+      if (mIsStopped)
+      {
+        return;
+      }
+
+      batch = mBatches.front();
+
+      // A batch with no more tasks to claim is only waiting for its running tasks to complete.
+      if (batch->mNext.load() >= batch->mCount)
+      {
+        mBatches.pop_front();
+        continue;
+      }
+    }
+
+    process(*batch);
+  }
+}
+
+//-----
+void TaskPool::process(Batch& batch)
+{
+  for (std::size_t index = batch.mNext.fetch_add(1ULL); index < batch.mCount; index = batch.mNext.fetch_add(1ULL))
+  {
+    std::exception_ptr exception;
+    try
+    {
+      (*batch.mTask)(index);
+    }
+    catch (...)
+    {
+      exception = std::current_exception();
+    }
+
+    std::unique_lock lock(batch.mMutex);
+    if (exception && !batch.mException)
+    {
+      batch.mException = exception;
+    }
+
+    if (++batch.mCompleted == batch.mCount)
+    {
+      batch.mCondition.notify_all();
+    }
+  }
+}
+
+} // namespace Hiero::internal
@@ -0,0 +1,68 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "impl/TransactionBodyTemplate.h"
+#include "AccountId.h"
+#include "impl/ArenaPool.h"
+
+#include <basic_types.pb.h>
+#include <cstdint>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+#include <transaction_body.pb.h>
+
+namespace Hiero::internal
+{
+namespace
+{
+// The wire type of embedded messages.
+constexpr std::uint32_t LENGTH_DELIMITED_WIRE_TYPE = 2U;
+
+//-----
+void appendMessageField(std::string& bytes, int fieldNumber, const std::string& messageBytes)
+{
+  google::protobuf::io::StringOutputStream stream(&bytes);
+  google::protobuf::io::CodedOutputStream output(&stream);
+  output.WriteTag((static_cast<std::uint32_t>(fieldNumber) << 3U) | LENGTH_DELIMITED_WIRE_TYPE);
+  output.WriteVarint32(static_cast<std::uint32_t>(messageBytes.size()));
+  output.WriteString(messageBytes);
+}
+
+} // namespace
+
+//-----
+TransactionBodyTemplate::TransactionBodyTemplate(const proto::TransactionBody& transactionBody)
+{
+  // Protobuf serializes fields in field number order, and the transaction ID is the only field numbered before the node
+  // account ID.
+  static_assert(proto::TransactionBody::kTransactionIDFieldNumber < proto::TransactionBody::kNodeAccountIDFieldNumber);
+
+  if (transactionBody.has_transactionid())
+  {
+    appendMessageField(
+      mPrefix, proto::TransactionBody::kTransactionIDFieldNumber, transactionBody.transactionid().SerializeAsString());
+  }
+
+  // Serialize the rest of the fields from a scratch copy of the body without the first two.
+  const ArenaPool::Lease arena = ArenaPool::getInstance().acquire();
+  auto* body = google::protobuf::Arena::CreateMessage<proto::TransactionBody>(arena.get());
+  body->CopyFrom(transactionBody);
+  body->clear_transactionid();
+  body->clear_nodeaccountid();
+  body->SerializeToString(&mSuffix);
+}
+
+//-----
+std::string TransactionBodyTemplate::getBodyBytes(const AccountId& nodeAccountId) const
+{
+  const std::string nodeAccountIdBytes = nodeAccountId.toProtobuf()->SerializeAsString();
+
+  std::string bytes;
+  // The tag and length of the node account ID field take at most a few bytes.
+  bytes.reserve(mPrefix.size() + nodeAccountIdBytes.size() + mSuffix.size() + 8ULL);
+  bytes.append(mPrefix);
+  appendMessageField(bytes, proto::TransactionBody::kNodeAccountIDFieldNumber, nodeAccountIdBytes);
+  bytes.append(mSuffix);
+  return bytes;
+}
+
+} // namespace Hiero::internal
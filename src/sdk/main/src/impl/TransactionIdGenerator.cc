@@ -0,0 +1,55 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "impl/TransactionIdGenerator.h"
+#include "AccountId.h"
+
+#include <algorithm>
+
+namespace Hiero::internal
+{
+namespace
+{
+//
+// Map an account to a slot. Accounts are spread by their entity numbers, so that hashing doesn't allocate. Accounts
+// identified only by an alias all share a slot.
+//
+// @param accountId The ID of the account.
+// @param slots     The number of slots.
+// @return The index of the slot of the account.
+//
+[[nodiscard]] std::size_t getSlot(const AccountId& accountId, std::size_t slots)
+{
+  uint64_t hash = accountId.mAccountNum.value_or(0ULL);
+  hash = hash * 31ULL + accountId.mRealmNum;
+  hash = hash * 31ULL + accountId.mShardNum;
+  return static_cast<std::size_t>(hash % slots);
+}
+
+} // namespace
+
+//-----
+TransactionIdGenerator& TransactionIdGenerator::getInstance()
+{
+  static TransactionIdGenerator generator;
+  return generator;
+}
+
+//-----
+std::chrono::system_clock::time_point TransactionIdGenerator::next(const AccountId& accountId,
+                                                                   unsigned int count,
+                                                                   const std::chrono::system_clock::duration& backdate)
+{
+  const int64_t ticks = std::max(count, 1U);
+  const int64_t now = (std::chrono::system_clock::now() - backdate).time_since_epoch().count();
+
+  std::atomic<int64_t>& last = mSlots[getSlot(accountId, SLOTS)].mLast;
+  int64_t previous = last.load(std::memory_order_relaxed);
+  int64_t start = 0;
+  do
+  {
+    start = std::max(now, previous + 1);
+  } while (!last.compare_exchange_weak(previous, start + ticks - 1, std::memory_order_relaxed));
+
+  return std::chrono::system_clock::time_point(std::chrono::system_clock::duration(start));
+}
+
+} // namespace Hiero::internal
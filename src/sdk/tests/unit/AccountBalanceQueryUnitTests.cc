@@ -2,6 +2,7 @@
 #include "AccountBalanceQuery.h"
 #include "AccountId.h"
 #include "ContractId.h"
+#include "HedgingPolicy.h"
 
 #include <gtest/gtest.h>
 
@@ -84,3 +85,17 @@ TEST_F(AccountBalanceQueryUnitTests, ResetContractId)
   EXPECT_TRUE(query.getAccountId());
   EXPECT_FALSE(query.getContractId());
 }
+
+//-----
+TEST_F(AccountBalanceQueryUnitTests, SetHedgingPolicy)
+{
+  // Given
+  AccountBalanceQuery query;
+  EXPECT_FALSE(query.getHedgingPolicy().has_value());
+
+  // When
+  query.setHedgingPolicy(HedgingPolicy::FREE_QUERIES);
+
+  // Then
+  EXPECT_EQ(query.getHedgingPolicy(), HedgingPolicy::FREE_QUERIES);
+}
@@ -0,0 +1,86 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "impl/ArenaPool.h"
+
+#include <google/protobuf/arena.h>
+#include <gtest/gtest.h>
+#include <response.pb.h>
+#include <string>
+#include <utility>
+
+using namespace Hiero::internal;
+
+class ArenaPoolUnitTests : public ::testing::Test
+{
+};
+
+//-----
+TEST_F(ArenaPoolUnitTests, DestroyedLeaseReturnsArenaToPool)
+{
+  // Given
+  ArenaPool pool;
+  google::protobuf::Arena* leased = nullptr;
+
+  // When
+  {
+    const ArenaPool::Lease lease = pool.acquire();
+    leased = lease.get();
+    EXPECT_EQ(pool.getIdleArenas(), 0ULL);
+  }
+
+  // Then
+  EXPECT_EQ(pool.getIdleArenas(), 1ULL);
+  const ArenaPool::Lease lease = pool.acquire();
+  EXPECT_EQ(lease.get(), leased);
+  EXPECT_EQ(pool.getIdleArenas(), 0ULL);
+}
+
+//-----
+TEST_F(ArenaPoolUnitTests, ReturnedArenaIsReset)
+{
+  // Given
+  ArenaPool pool(1024ULL);
+  {
+    const ArenaPool::Lease lease = pool.acquire();
+    auto* response = google::protobuf::Arena::CreateMessage<proto::Response>(lease.get());
+    response->mutable_transactiongetreceipt()->mutable_receipt()->set_topicrunninghash(std::string(4096, 'a'));
+    EXPECT_GT(lease.get()->SpaceUsed(), 0ULL);
+  }
+
+  // When
+  const ArenaPool::Lease lease = pool.acquire();
+
+  // Then
+  EXPECT_EQ(lease.get()->SpaceUsed(), 0ULL);
+}
+
+//-----
+TEST_F(ArenaPoolUnitTests, KeepsAtMostMaxIdleArenas)
+{
+  // Given
+  ArenaPool pool(ArenaPool::DEFAULT_INITIAL_BLOCK_SIZE, 1ULL);
+
+  // When
+  {
+    const ArenaPool::Lease first = pool.acquire();
+    const ArenaPool::Lease second = pool.acquire();
+  }
+
+  // Then
+  EXPECT_EQ(pool.getIdleArenas(), 1ULL);
+}
+
+//-----
+TEST_F(ArenaPoolUnitTests, MovedLeaseReturnsArenaOnce)
+{
+  // Given
+  ArenaPool pool;
+
+  // When
+  {
+    ArenaPool::Lease lease = pool.acquire();
+    const ArenaPool::Lease moved = std::move(lease);
+  }
+
+  // Then
+  EXPECT_EQ(pool.getIdleArenas(), 1ULL);
+}
@@ -0,0 +1,190 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "AccountId.h"
+#include "TransactionId.h"
+#include "impl/ChunkReassembler.h"
+#include "impl/Utilities.h"
+
+#include <chrono>
+#include <gtest/gtest.h>
+#include <memory>
+#include <mirror/consensus_service.pb.h>
+#include <optional>
+#include <string>
+#include <string_view>
+
+using namespace Hiero;
+using namespace Hiero::internal;
+
+class ChunkReassemblerUnitTests : public ::testing::Test
+{
+protected:
+  [[nodiscard]] com::hedera::mirror::api::proto::ConsensusTopicResponse getTestChunk(const TransactionId& transactionId,
+                                                                                      int32_t number,
+                                                                                      int32_t total,
+                                                                                      std::string_view contents) const
+  {
+    com::hedera::mirror::api::proto::ConsensusTopicResponse response;
+    response.set_message(std::string(contents));
+    response.set_sequencenumber(static_cast<uint64_t>(number));
+    response.mutable_chunkinfo()->set_allocated_initialtransactionid(transactionId.toProtobuf().release());
+    response.mutable_chunkinfo()->set_number(number);
+    response.mutable_chunkinfo()->set_total(total);
+    return response;
+  }
+
+  [[nodiscard]] inline const TransactionId& getTestTransactionId() const { return mTestTransactionId; }
+  [[nodiscard]] inline const TransactionId& getTestOtherTransactionId() const { return mTestOtherTransactionId; }
+  [[nodiscard]] inline const std::chrono::system_clock::time_point& getTestTime() const { return mTestTime; }
+
+private:
+  const TransactionId mTestTransactionId = TransactionId::generate(AccountId(1ULL));
+  const TransactionId mTestOtherTransactionId = TransactionId::generate(AccountId(2ULL));
+  const std::chrono::system_clock::time_point mTestTime = std::chrono::system_clock::now();
+};
+
+//-----
+TEST_F(ChunkReassemblerUnitTests, ReassembleOutOfOrderChunks)
+{
+  // Given
+  ChunkReassembler reassembler;
+
+  // When
+  const std::optional<TopicMessage> first = reassembler.add(getTestChunk(getTestTransactionId(), 2, 3, "cd"));
+  const std::optional<TopicMessage> second = reassembler.add(getTestChunk(getTestTransactionId(), 3, 3, "ef"));
+  const std::optional<TopicMessage> third = reassembler.add(getTestChunk(getTestTransactionId(), 1, 3, "ab"));
+
+  // Then
+  EXPECT_FALSE(first.has_value());
+  EXPECT_FALSE(second.has_value());
+  ASSERT_TRUE(third.has_value());
+  EXPECT_EQ(third->mContents, Utilities::stringToByteVector("abcdef"));
+  EXPECT_EQ(third->mChunks.size(), 3U);
+  EXPECT_EQ(third->mSequenceNumber, 3ULL);
+  EXPECT_EQ(third->mTransactionId, getTestTransactionId());
+  EXPECT_EQ(reassembler.getPendingMessages(), 0U);
+  EXPECT_EQ(reassembler.getPendingBytes(), 0U);
+  EXPECT_EQ(reassembler.getStatistics().mCompletedMessages, 1ULL);
+}
+
+//-----
+TEST_F(ChunkReassemblerUnitTests, SingleChunkMessageIsReturnedImmediately)
+{
+  // Given
+  ChunkReassembler reassembler;
+
+  // When
+  const std::optional<TopicMessage> message = reassembler.add(getTestChunk(getTestTransactionId(), 1, 1, "ab"));
+
+  // Then
+  ASSERT_TRUE(message.has_value());
+  EXPECT_EQ(message->mContents, Utilities::stringToByteVector("ab"));
+  EXPECT_EQ(reassembler.getPendingMessages(), 0U);
+}
+
+//-----
+TEST_F(ChunkReassemblerUnitTests, DropDuplicateAndInvalidChunks)
+{
+  // Given
+  ChunkReassembler reassembler;
+  ASSERT_FALSE(reassembler.add(getTestChunk(getTestTransactionId(), 1, 2, "ab")).has_value());
+
+  // When
+  const std::optional<TopicMessage> duplicate = reassembler.add(getTestChunk(getTestTransactionId(), 1, 2, "ab"));
+  const std::optional<TopicMessage> invalid = reassembler.add(getTestChunk(getTestTransactionId(), 3, 2, "ef"));
+
+  // Then
+  EXPECT_FALSE(duplicate.has_value());
+  EXPECT_FALSE(invalid.has_value());
+  EXPECT_EQ(reassembler.getStatistics().mDuplicateChunks, 1ULL);
+  EXPECT_EQ(reassembler.getStatistics().mInvalidChunks, 1ULL);
+  EXPECT_EQ(reassembler.getPendingMessages(), 1U);
+}
+
+//-----
+TEST_F(ChunkReassemblerUnitTests, EvictExpiredMessages)
+{
+  // Given
+  ChunkReassembler reassembler(DEFAULT_MAX_PENDING_CHUNK_BYTES, std::chrono::seconds(10));
+  ASSERT_FALSE(reassembler.add(getTestChunk(getTestTransactionId(), 1, 2, "ab"), getTestTime()).has_value());
+
+  // When
+  reassembler.evictExpired(getTestTime() + std::chrono::seconds(10));
+
+  // Then
+  EXPECT_EQ(reassembler.getPendingMessages(), 0U);
+  EXPECT_EQ(reassembler.getPendingBytes(), 0U);
+  EXPECT_EQ(reassembler.getStatistics().mExpiredMessages, 1ULL);
+}
+
+//-----
+TEST_F(ChunkReassemblerUnitTests, EvictOldestMessagesOverCapacity)
+{
+  // Given
+  const com::hedera::mirror::api::proto::ConsensusTopicResponse chunk =
+    getTestChunk(getTestTransactionId(), 1, 2, "ab");
+  ChunkReassembler reassembler(chunk.ByteSizeLong() + 1U);
+  ASSERT_FALSE(reassembler.add(chunk).has_value());
+
+  // When
+  ASSERT_FALSE(reassembler.add(getTestChunk(getTestOtherTransactionId(), 1, 2, "cd")).has_value());
+
+  // Then
+  EXPECT_EQ(reassembler.getPendingMessages(), 1U);
+  EXPECT_EQ(reassembler.getStatistics().mEvictedMessages, 1ULL);
+
+  // The evicted message starts over.
+  EXPECT_FALSE(reassembler.add(getTestChunk(getTestTransactionId(), 2, 2, "cd")).has_value());
+}
+
+//-----
+TEST_F(ChunkReassemblerUnitTests, DropLateDuplicateChunksOfCompletedMessage)
+{
+  // Given
+  ChunkReassembler reassembler;
+  ASSERT_FALSE(reassembler.add(getTestChunk(getTestTransactionId(), 1, 2, "ab"), getTestTime()).has_value());
+  ASSERT_TRUE(reassembler.add(getTestChunk(getTestTransactionId(), 2, 2, "cd"), getTestTime()).has_value());
+
+  // When
+  const std::optional<TopicMessage> late =
+    reassembler.add(getTestChunk(getTestTransactionId(), 1, 2, "ab"), getTestTime() + std::chrono::seconds(1));
+
+  // Then
+  EXPECT_FALSE(late.has_value());
+  EXPECT_EQ(reassembler.getPendingMessages(), 0U);
+  EXPECT_EQ(reassembler.getStatistics().mDuplicateChunks, 1ULL);
+}
+
+//-----
+TEST_F(ChunkReassemblerUnitTests, ForgetCompletedMessagesAfterTimeout)
+{
+  // Given
+  ChunkReassembler reassembler(DEFAULT_MAX_PENDING_CHUNK_BYTES, std::chrono::seconds(10));
+  ASSERT_FALSE(reassembler.add(getTestChunk(getTestTransactionId(), 1, 2, "ab"), getTestTime()).has_value());
+  ASSERT_TRUE(reassembler.add(getTestChunk(getTestTransactionId(), 2, 2, "cd"), getTestTime()).has_value());
+
+  // When
+  const std::optional<TopicMessage> chunk =
+    reassembler.add(getTestChunk(getTestTransactionId(), 1, 2, "ab"), getTestTime() + std::chrono::seconds(10));
+
+  // Then
+  EXPECT_FALSE(chunk.has_value());
+  EXPECT_EQ(reassembler.getPendingMessages(), 1U);
+  EXPECT_EQ(reassembler.getStatistics().mDuplicateChunks, 0ULL);
+}
+
+//-----
+TEST_F(ChunkReassemblerUnitTests, SharedCountersSumReassemblers)
+{
+  // Given
+  const auto counters = std::make_shared<ChunkReassembler::Counters>();
+  ChunkReassembler first(DEFAULT_MAX_PENDING_CHUNK_BYTES, DEFAULT_CHUNK_REASSEMBLY_TIMEOUT, counters);
+  ChunkReassembler second(DEFAULT_MAX_PENDING_CHUNK_BYTES, DEFAULT_CHUNK_REASSEMBLY_TIMEOUT, counters);
+
+  // When
+  ASSERT_TRUE(first.add(getTestChunk(getTestTransactionId(), 1, 1, "ab")).has_value());
+  ASSERT_TRUE(second.add(getTestChunk(getTestOtherTransactionId(), 1, 1, "cd")).has_value());
+
+  // Then
+  EXPECT_EQ(counters->get().mCompletedMessages, 2ULL);
+  EXPECT_EQ(first.getStatistics().mCompletedMessages, 2ULL);
+}
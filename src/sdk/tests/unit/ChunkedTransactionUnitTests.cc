@@ -3,14 +3,38 @@
 #include "Client.h"
 #include "ED25519PrivateKey.h"
 #include "FileAppendTransaction.h"
+#include "FileContentsQuery.h"
+#include "FileId.h"
+#include "MockNetwork.h"
+#include "TopicMessageSubmitTransaction.h"
+#include "TransactionResponse.h"
 #include "exceptions/IllegalStateException.h"
 
+#include <chrono>
 #include <cstddef>
 #include <gtest/gtest.h>
 #include <vector>
 
 using namespace Hiero;
 
+namespace
+{
+// Exposes whether the chunks of a FileAppendTransaction would be pipelined.
+class TestFileAppendTransaction : public FileAppendTransaction
+{
+public:
+  using FileAppendTransaction::shouldPipelineChunks;
+};
+
+// Exposes whether the chunks of a TopicMessageSubmitTransaction would be pipelined.
+class TestTopicMessageSubmitTransaction : public TopicMessageSubmitTransaction
+{
+public:
+  using TopicMessageSubmitTransaction::shouldPipelineChunks;
+};
+
+} // namespace
+
 class ChunkedTransactionUnitTests : public ::testing::Test
 {
 protected:
@@ -73,3 +97,56 @@ TEST_F(ChunkedTransactionUnitTests, GetSetChunkSizeFrozen)
   // When / Then
   EXPECT_THROW(transaction.setChunkSize(getTestChunkSize()), IllegalStateException);
 }
+
+//-----
+TEST_F(ChunkedTransactionUnitTests, OrderSensitiveChunksAreNotPipelined)
+{
+  // Given
+  TestFileAppendTransaction fileAppendTransaction;
+  fileAppendTransaction.setMaxChunksInFlight(8U);
+  TestTopicMessageSubmitTransaction topicMessageSubmitTransaction;
+  topicMessageSubmitTransaction.setMaxChunksInFlight(8U);
+
+  // When / Then
+  EXPECT_FALSE(fileAppendTransaction.shouldPipelineChunks(4U));
+  EXPECT_TRUE(topicMessageSubmitTransaction.shouldPipelineChunks(4U));
+  EXPECT_FALSE(topicMessageSubmitTransaction.shouldPipelineChunks(1U));
+}
+
+//-----
+TEST_F(ChunkedTransactionUnitTests, OrderSensitiveChunksReachConsensusInOrder)
+{
+  // Given
+  // Transactions submitted close together reach consensus in a random order.
+  MockNetwork::Behavior behavior;
+  behavior.mLatency = MockNetwork::uniformLatency(std::chrono::milliseconds(0), std::chrono::milliseconds(10));
+  behavior.mReceiptDelay = std::chrono::milliseconds(5);
+  behavior.mConsensusJitter = std::chrono::milliseconds(50);
+  behavior.mSeed = 1ULL;
+  const MockNetwork network(3U, behavior);
+  Client client = network.createClient();
+  client.setOperator(AccountId(2ULL), ED25519PrivateKey::generatePrivateKey());
+
+  std::vector<std::byte> contents;
+  for (unsigned int i = 0U; i < 32U; ++i)
+  {
+    contents.push_back(static_cast<std::byte>(i));
+  }
+
+  FileAppendTransaction transaction;
+  transaction.setFileId(FileId(1001ULL))
+    .setContents(contents)
+    .setChunkSize(4U)
+    .setMaxChunks(8U)
+    .setMaxChunksInFlight(8U);
+
+  // When
+  const std::vector<TransactionResponse> responses = transaction.executeAll(client);
+
+  // Then
+  // The chunks were submitted one at a time despite the maximum chunks in flight, so they were appended in order.
+  EXPECT_EQ(responses.size(), 8ULL);
+  EXPECT_EQ(FileContentsQuery().setFileId(FileId(1001ULL)).execute(client), contents);
+
+  client.close();
+}
@@ -4,6 +4,13 @@
 #include "Defaults.h"
 #include "ED25519PrivateKey.h"
 #include "Hbar.h"
+#include "HedgingPolicy.h"
+#include "NodeSelectionPolicy.h"
+#include "impl/CompletionQueueDriver.h"
+#include "impl/Network.h"
+#include "impl/PaymentTransactionPool.h"
+#include "impl/QueryCostCache.h"
+#include "impl/SubscriptionReactor.h"
 
 #include <gtest/gtest.h>
 
@@ -145,4 +152,252 @@ TEST_F(ClientUnitTests, SetValidMaxBackoff)
   // When / Then
   EXPECT_NO_THROW(client.setMaxBackoff(DEFAULT_MIN_BACKOFF));
   EXPECT_NO_THROW(client.setMaxBackoff(DEFAULT_MAX_BACKOFF));
-}
\ No newline at end of file
+}
+//-----
+TEST_F(ClientUnitTests, SetCompletionQueueThreads)
+{
+  // Given
+  Client client;
+  EXPECT_EQ(client.getCompletionQueueThreads(), DEFAULT_COMPLETION_QUEUE_THREADS);
+
+  // When
+  client.setCompletionQueueThreads(4U);
+
+  // Then
+  EXPECT_EQ(client.getCompletionQueueThreads(), 4U);
+  EXPECT_THROW(client.setCompletionQueueThreads(0U), std::invalid_argument); // INVALID_ARGUMENT
+}
+
+//-----
+TEST_F(ClientUnitTests, CompletionQueueDriverRestartsAfterClose)
+{
+  // Given
+  Client client;
+  const auto driver = client.getCompletionQueueDriver();
+
+  // When
+  client.close();
+
+  // Then
+  EXPECT_TRUE(driver->isShutdown());
+  EXPECT_NE(client.getCompletionQueueDriver(), driver);
+  EXPECT_FALSE(client.getCompletionQueueDriver()->isShutdown());
+}
+
+//-----
+TEST_F(ClientUnitTests, SetSubscriptionThreads)
+{
+  // Given
+  Client client;
+  EXPECT_EQ(client.getSubscriptionThreads(), DEFAULT_SUBSCRIPTION_THREADS);
+
+  // When
+  client.setSubscriptionThreads(4U);
+
+  // Then
+  EXPECT_EQ(client.getSubscriptionThreads(), 4U);
+  EXPECT_THROW(client.setSubscriptionThreads(0U), std::invalid_argument); // INVALID_ARGUMENT
+}
+
+//-----
+TEST_F(ClientUnitTests, SetTransactionIdBackdate)
+{
+  // Given
+  Client client;
+  EXPECT_EQ(client.getTransactionIdBackdate(), DEFAULT_TRANSACTION_ID_BACKDATE);
+
+  // When
+  client.setTransactionIdBackdate(std::chrono::seconds(3));
+
+  // Then
+  EXPECT_EQ(client.getTransactionIdBackdate(), std::chrono::seconds(3));
+  EXPECT_THROW(client.setTransactionIdBackdate(std::chrono::seconds(-1)), std::invalid_argument); // INVALID_ARGUMENT
+}
+
+//-----
+TEST_F(ClientUnitTests, SetQueryPaymentPoolSize)
+{
+  // Given
+  Client client;
+  client.setOperator(getTestAccountId(), getTestPrivateKey());
+  EXPECT_EQ(client.getQueryPaymentPoolSize(), DEFAULT_QUERY_PAYMENT_POOL_SIZE);
+  EXPECT_EQ(client.getPaymentTransactionPool(), nullptr);
+
+  // When
+  client.setQueryPaymentPoolSize(4U);
+
+  // Then
+  EXPECT_EQ(client.getQueryPaymentPoolSize(), 4U);
+  EXPECT_NE(client.getPaymentTransactionPool(), nullptr);
+}
+
+//-----
+TEST_F(ClientUnitTests, SetQueryCostCacheDuration)
+{
+  // Given
+  Client client;
+  EXPECT_EQ(client.getQueryCostCacheDuration(), DEFAULT_QUERY_COST_CACHE_DURATION);
+  EXPECT_EQ(client.getQueryCostCache(), nullptr);
+
+  // When
+  client.setQueryCostCacheDuration(std::chrono::minutes(5));
+
+  // Then
+  EXPECT_EQ(client.getQueryCostCacheDuration(), std::chrono::minutes(5));
+  EXPECT_NE(client.getQueryCostCache(), nullptr);
+  EXPECT_THROW(client.setQueryCostCacheDuration(std::chrono::seconds(-1)), std::invalid_argument); // INVALID_ARGUMENT
+}
+
+//-----
+TEST_F(ClientUnitTests, SetQueryCostMargin)
+{
+  // Given
+  Client client;
+  EXPECT_EQ(client.getQueryCostMargin(), DEFAULT_QUERY_COST_MARGIN);
+
+  // When
+  client.setQueryCostMargin(0.25);
+
+  // Then
+  EXPECT_EQ(client.getQueryCostMargin(), 0.25);
+  EXPECT_THROW(client.setQueryCostMargin(-0.1), std::invalid_argument); // INVALID_ARGUMENT
+}
+
+//-----
+TEST_F(ClientUnitTests, PaymentTransactionPoolRestartsAfterOperatorChange)
+{
+  // Given
+  Client client;
+  client.setOperator(getTestAccountId(), getTestPrivateKey());
+  client.setQueryPaymentPoolSize(4U);
+  const std::shared_ptr<internal::PaymentTransactionPool> pool = client.getPaymentTransactionPool();
+
+  // When
+  client.setOperator(getTestAccountId(), ED25519PrivateKey::generatePrivateKey());
+
+  // Then
+  EXPECT_NE(client.getPaymentTransactionPool(), pool);
+}
+
+//-----
+TEST_F(ClientUnitTests, SubscriptionReactorRestartsAfterClose)
+{
+  // Given
+  Client client;
+  const auto reactor = client.getSubscriptionReactor();
+
+  // When
+  client.close();
+
+  // Then
+  EXPECT_NE(client.getSubscriptionReactor(), reactor);
+}
+
+//-----
+TEST_F(ClientUnitTests, SetNodeChannelPoolSize)
+{
+  // Given
+  std::unordered_map<std::string, AccountId> networkMap;
+  networkMap["127.0.0.1:50211"] = getTestAccountId();
+  Client client = Client::forNetwork(networkMap);
+  EXPECT_EQ(client.getNodeChannelPoolSize(), DEFAULT_NODE_CHANNEL_POOL_SIZE);
+
+  // When
+  client.setNodeChannelPoolSize(4U);
+
+  // Then
+  EXPECT_EQ(client.getNodeChannelPoolSize(), 4U);
+  EXPECT_THROW(client.setNodeChannelPoolSize(0U), std::invalid_argument); // INVALID_ARGUMENT
+}
+
+//-----
+TEST_F(ClientUnitTests, SetMaxRequestsInFlightPerNode)
+{
+  // Given
+  Client client;
+  EXPECT_EQ(client.getMaxRequestsInFlightPerNode(), DEFAULT_MAX_REQUESTS_IN_FLIGHT_PER_NODE);
+
+  // When
+  client.setMaxRequestsInFlightPerNode(8U);
+
+  // Then
+  EXPECT_EQ(client.getMaxRequestsInFlightPerNode(), 8U);
+  EXPECT_THROW(client.setMaxRequestsInFlightPerNode(0U), std::invalid_argument); // INVALID_ARGUMENT
+  EXPECT_THROW(client.setNodeChannelPoolSize(0U), std::invalid_argument);        // INVALID_ARGUMENT
+}
+
+//-----
+TEST_F(ClientUnitTests, NodeSettingsApplyToNewNetwork)
+{
+  // Given
+  std::unordered_map<std::string, AccountId> networkMap;
+  networkMap["127.0.0.1:50211"] = getTestAccountId();
+  Client client;
+  client.setNodeChannelPoolSize(4U).setMaxRequestsInFlightPerNode(8U);
+
+  // When
+  client.setNetwork(networkMap);
+
+  // Then
+  ASSERT_NE(client.getClientNetwork(), nullptr);
+  EXPECT_EQ(client.getClientNetwork()->getChannelPoolSize(), 4U);
+  EXPECT_EQ(client.getClientNetwork()->getMaxRequestsInFlightPerNode(), 8U);
+}
+
+//-----
+TEST_F(ClientUnitTests, NodeSelectionPolicyAppliesToNewNetwork)
+{
+  // Given
+  std::unordered_map<std::string, AccountId> networkMap;
+  networkMap["127.0.0.1:50211"] = getTestAccountId();
+  Client client;
+  client.setNodeSelectionPolicy(NodeSelectionPolicy::LEAST_OUTSTANDING_REQUESTS);
+
+  // When
+  client.setNetwork(networkMap);
+
+  // Then
+  ASSERT_NE(client.getClientNetwork(), nullptr);
+  EXPECT_EQ(client.getNodeSelectionPolicy(), NodeSelectionPolicy::LEAST_OUTSTANDING_REQUESTS);
+  EXPECT_EQ(client.getClientNetwork()->getNodeSelectionPolicy(), NodeSelectionPolicy::LEAST_OUTSTANDING_REQUESTS);
+}
+
+//-----
+TEST_F(ClientUnitTests, SetHedgingPolicy)
+{
+  // Given
+  Client client;
+  EXPECT_EQ(client.getHedgingPolicy(), HedgingPolicy::NONE);
+
+  // When
+  client.setHedgingPolicy(HedgingPolicy::FREE_QUERIES);
+
+  // Then
+  EXPECT_EQ(client.getHedgingPolicy(), HedgingPolicy::FREE_QUERIES);
+}
+
+//-----
+TEST_F(ClientUnitTests, SetHedgingPercentile)
+{
+  // Given
+  Client client;
+  EXPECT_DOUBLE_EQ(client.getHedgingPercentile(), DEFAULT_HEDGING_PERCENTILE);
+
+  // When
+  client.setHedgingPercentile(99.0);
+
+  // Then
+  EXPECT_DOUBLE_EQ(client.getHedgingPercentile(), 99.0);
+  EXPECT_THROW(client.setHedgingPercentile(0.0), std::invalid_argument);   // INVALID_ARGUMENT
+  EXPECT_THROW(client.setHedgingPercentile(100.5), std::invalid_argument); // INVALID_ARGUMENT
+}
+
+//-----
+TEST_F(ClientUnitTests, WarmUpWithoutNetwork)
+{
+  // Given
+  Client client;
+
+  // When / Then
+  EXPECT_TRUE(client.warmUp(std::chrono::milliseconds(1)));
+}
@@ -0,0 +1,125 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "impl/CompletionQueueDriver.h"
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <gtest/gtest.h>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+
+using namespace Hiero::internal;
+
+class CompletionQueueDriverUnitTests : public ::testing::Test
+{
+protected:
+  [[nodiscard]] inline const std::chrono::seconds& getTestWaitTime() const { return mWaitTime; }
+
+private:
+  const std::chrono::seconds mWaitTime = std::chrono::seconds(5);
+};
+
+//-----
+TEST_F(CompletionQueueDriverUnitTests, ScheduleRunsCallback)
+{
+  // Given
+  CompletionQueueDriver driver(2U);
+  std::promise<bool> fired;
+
+  // When
+  ASSERT_TRUE(driver.schedule(std::chrono::system_clock::now() + std::chrono::milliseconds(10),
+                              [&fired](bool ok) { fired.set_value(ok); }));
+
+  // Then
+  std::future<bool> future = fired.get_future();
+  ASSERT_EQ(future.wait_for(getTestWaitTime()), std::future_status::ready);
+  EXPECT_TRUE(future.get());
+}
+
+//-----
+TEST_F(CompletionQueueDriverUnitTests, ShutdownCancelsPendingTimers)
+{
+  // Given
+  CompletionQueueDriver driver(1U);
+  std::atomic<bool> fired = true;
+  ASSERT_TRUE(driver.schedule(std::chrono::system_clock::now() + std::chrono::hours(1),
+                              [&fired](bool ok) { fired = ok; }));
+
+  // When
+  driver.shutdown();
+
+  // Then
+  EXPECT_TRUE(driver.isShutdown());
+  EXPECT_FALSE(fired);
+  EXPECT_FALSE(driver.schedule(std::chrono::system_clock::now(), [](bool) {}));
+}
+
+//-----
+TEST_F(CompletionQueueDriverUnitTests, ShutdownFromDriverThread)
+{
+  // Given
+  auto driver = std::make_shared<CompletionQueueDriver>(2U);
+  const auto done = std::make_shared<std::promise<void>>();
+  const auto pendingFired = std::make_shared<std::atomic<bool>>(true);
+  ASSERT_TRUE(driver->schedule(std::chrono::system_clock::now() + std::chrono::hours(1),
+                               [pendingFired](bool ok) { *pendingFired = ok; }));
+
+  // When
+  // The callback holds the last reference to the driver, so the driver is destroyed on its own thread.
+  CompletionQueueDriver* rawDriver = driver.get();
+  ASSERT_TRUE(rawDriver->schedule(std::chrono::system_clock::now(),
+                                  [owner = std::move(driver), done](bool) mutable
+                                  {
+                                    owner->shutdown();
+                                    owner.reset();
+                                    done->set_value();
+                                  }));
+
+  // Then
+  ASSERT_EQ(done->get_future().wait_for(getTestWaitTime()), std::future_status::ready);
+
+  // The detached thread drains the cancelled timer once the callback returns.
+  const std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + getTestWaitTime();
+  while (*pendingFired && std::chrono::steady_clock::now() < deadline)
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+
+  EXPECT_FALSE(*pendingFired);
+}
+
+//-----
+TEST_F(CompletionQueueDriverUnitTests, StrayExceptionDoesNotStopDriver)
+{
+  // Given
+  CompletionQueueDriver driver(1U);
+  std::promise<void> done;
+  ASSERT_TRUE(driver.schedule(std::chrono::system_clock::now(), [](bool) { throw std::runtime_error("stray"); }));
+
+  // When
+  ASSERT_TRUE(driver.schedule(std::chrono::system_clock::now() + std::chrono::milliseconds(10),
+                              [&done](bool) { done.set_value(); }));
+
+  // Then
+  EXPECT_EQ(done.get_future().wait_for(getTestWaitTime()), std::future_status::ready);
+}
+
+//-----
+TEST_F(CompletionQueueDriverUnitTests, IsDriverThread)
+{
+  // Given
+  CompletionQueueDriver driver(1U);
+  std::promise<bool> isDriverThread;
+
+  // When
+  ASSERT_TRUE(driver.schedule(std::chrono::system_clock::now(),
+                              [&isDriverThread](bool)
+                              { isDriverThread.set_value(CompletionQueueDriver::isDriverThread()); }));
+
+  // Then
+  std::future<bool> future = isDriverThread.get_future();
+  ASSERT_EQ(future.wait_for(getTestWaitTime()), std::future_status::ready);
+  EXPECT_TRUE(future.get());
+  EXPECT_FALSE(CompletionQueueDriver::isDriverThread());
+}
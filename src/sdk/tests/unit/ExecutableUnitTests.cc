@@ -0,0 +1,338 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "AccountBalance.h"
+#include "AccountBalanceQuery.h"
+#include "AccountId.h"
+#include "Client.h"
+#include "ED25519PrivateKey.h"
+#include "FileContentsQuery.h"
+#include "FileId.h"
+#include "Hbar.h"
+#include "HedgingPolicy.h"
+#include "MockNetwork.h"
+#include "exceptions/IllegalStateException.h"
+#include "exceptions/MaxAttemptsExceededException.h"
+#include "exceptions/MaxQueryPaymentExceededException.h"
+#include "impl/Network.h"
+#include "impl/Node.h"
+#include "impl/QueryCostCache.h"
+
+#include <chrono>
+#include <file_get_contents.pb.h>
+#include <exception>
+#include <future>
+#include <gtest/gtest.h>
+#include <memory>
+#include <optional>
+#include <query.pb.h>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+using namespace Hiero;
+
+class ExecutableUnitTests : public ::testing::Test
+{
+protected:
+  [[nodiscard]] inline const std::chrono::seconds& getTestWaitTime() const { return mWaitTime; }
+  [[nodiscard]] inline const std::string& getTestUnreachableAddress() const { return mUnreachableAddress; }
+  [[nodiscard]] inline const std::string& getOtherTestUnreachableAddress() const { return mOtherUnreachableAddress; }
+
+  // Get a query of the balance of the test account that backs off for as little as possible between attempts.
+  [[nodiscard]] AccountBalanceQuery getTestQuery() const
+  {
+    AccountBalanceQuery query;
+    query.setAccountId(mAccountId)
+      .setMinBackoff(std::chrono::milliseconds(1))
+      .setMaxBackoff(std::chrono::milliseconds(10));
+    return query;
+  }
+
+  // Get a paid query of the contents of the test file that backs off for as little as possible between attempts.
+  [[nodiscard]] FileContentsQuery getTestPaidQuery() const
+  {
+    FileContentsQuery query;
+    query.setFileId(mFileId).setMinBackoff(std::chrono::milliseconds(1)).setMaxBackoff(std::chrono::milliseconds(10));
+    return query;
+  }
+
+  // Get the key under which a Client remembers the cost of the test paid query.
+  [[nodiscard]] std::string getTestPaidQueryCostKey() const
+  {
+    proto::Query query;
+    query.mutable_filegetcontents()->mutable_header();
+    query.mutable_filegetcontents()->set_allocated_fileid(mFileId.toProtobuf().release());
+    return query.SerializeAsString();
+  }
+
+private:
+  const AccountId mAccountId = AccountId(1001ULL);
+  const FileId mFileId = FileId(111ULL);
+  const std::chrono::seconds mWaitTime = std::chrono::seconds(10);
+  // Nothing listens on these ports, so connections to them are refused.
+  const std::string mUnreachableAddress = "127.0.0.1:1";
+  const std::string mOtherUnreachableAddress = "127.0.0.1:2";
+};
+
+//-----
+TEST_F(ExecutableUnitTests, ExecuteAsync)
+{
+  // Given
+  const MockNetwork network(1U);
+  Client client = network.createClient();
+  AccountBalanceQuery query = getTestQuery();
+
+  // When
+  std::future<AccountBalance> future = query.executeAsync(client);
+
+  // Then
+  ASSERT_EQ(future.wait_for(getTestWaitTime()), std::future_status::ready);
+  EXPECT_EQ(future.get().mBalance, Hbar(1LL));
+
+  client.close();
+}
+
+//-----
+TEST_F(ExecutableUnitTests, ExecuteAsyncRetriesBusyNodes)
+{
+  // Given
+  MockNetwork::Behavior behavior;
+  behavior.mBusyProbability = 0.3;
+  behavior.mSeed = 1ULL;
+  const MockNetwork network(3U, behavior);
+  Client client = network.createClient();
+
+  std::vector<AccountBalanceQuery> queries(20U, getTestQuery());
+  std::vector<std::future<AccountBalance>> futures;
+
+  // When
+  for (AccountBalanceQuery& query : queries)
+  {
+    futures.push_back(query.executeAsync(client));
+  }
+
+  // Then
+  for (std::future<AccountBalance>& future : futures)
+  {
+    ASSERT_EQ(future.wait_for(getTestWaitTime()), std::future_status::ready);
+    EXPECT_EQ(future.get().mBalance, Hbar(1LL));
+  }
+
+  EXPECT_GT(network.getStatistics().mBusy, 0ULL);
+  EXPECT_GT(network.getStatistics().mQueries, queries.size());
+
+  client.close();
+}
+
+//-----
+TEST_F(ExecutableUnitTests, ExecuteAsyncTimesOut)
+{
+  // Given
+  MockNetwork::Behavior behavior;
+  behavior.mLatency = MockNetwork::constantLatency(std::chrono::seconds(2));
+  const MockNetwork network(1U, behavior);
+  Client client = network.createClient();
+  client.setCompletionQueueThreads(1U);
+  AccountBalanceQuery slowQuery = getTestQuery();
+  AccountBalanceQuery otherSlowQuery = getTestQuery();
+
+  // When
+  // The attempts are cut short by the timeout of their executions, and neither holds the only thread of the driver.
+  const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  std::future<AccountBalance> slowFuture = slowQuery.executeAsync(client, std::chrono::milliseconds(200));
+  std::future<AccountBalance> otherSlowFuture = otherSlowQuery.executeAsync(client, std::chrono::milliseconds(200));
+
+  // Then
+  EXPECT_EQ(slowFuture.wait_for(std::chrono::seconds(1)), std::future_status::ready);
+  EXPECT_EQ(otherSlowFuture.wait_for(std::chrono::seconds(1)), std::future_status::ready);
+  EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(1));
+
+  client.close();
+}
+
+//-----
+TEST_F(ExecutableUnitTests, CloseClientDuringExecuteAsync)
+{
+  // Given
+  MockNetwork::Behavior behavior;
+  behavior.mLatency = MockNetwork::constantLatency(std::chrono::milliseconds(200));
+  behavior.mBusyProbability = 1.0;
+  const MockNetwork network(1U, behavior);
+  Client client = network.createClient();
+  AccountBalanceQuery query = getTestQuery();
+  std::future<AccountBalance> future = query.executeAsync(client);
+
+  // When
+  // The node answers BUSY after the Client is closed, so the execution can't schedule its retry.
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  client.close();
+
+  // Then
+  // Closing the Client drains the driver, so the execution has completed by the time it returns.
+  ASSERT_EQ(future.wait_for(std::chrono::seconds(0)), std::future_status::ready);
+  EXPECT_THROW(future.get(), IllegalStateException);
+}
+
+//-----
+TEST_F(ExecutableUnitTests, HedgedExecuteAsyncCancelsLosingSubmission)
+{
+  // Given
+  MockNetwork::Behavior slowBehavior;
+  slowBehavior.mLatency = MockNetwork::constantLatency(std::chrono::seconds(2));
+  const MockNetwork network({ slowBehavior, MockNetwork::Behavior() });
+  Client client = network.createClient();
+  client.setHedgingPolicy(HedgingPolicy::FREE_QUERIES);
+  AccountBalanceQuery query = getTestQuery();
+  query.setNodeAccountIds({ AccountId(3ULL), AccountId(4ULL) });
+
+  // When
+  std::future<AccountBalance> future = query.executeAsync(client);
+
+  // Then
+  // The submission hedged to the fast node wins long before the slow node answers.
+  ASSERT_EQ(future.wait_for(std::chrono::seconds(1)), std::future_status::ready);
+  EXPECT_EQ(future.get().mBalance, Hbar(1LL));
+
+  // The losing submission was cancelled, so closing the Client doesn't wait for the slow node to answer it.
+  const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  client.close();
+  EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(1));
+}
+
+//-----
+TEST_F(ExecutableUnitTests, HedgedExecuteAsyncBacksOffFailedHedge)
+{
+  // Given
+  MockNetwork::Behavior slowBehavior;
+  slowBehavior.mLatency = MockNetwork::constantLatency(std::chrono::milliseconds(300));
+  const MockNetwork network(1U, slowBehavior);
+  std::unordered_map<std::string, AccountId> nodes = network.getNetwork();
+  nodes.try_emplace(getTestUnreachableAddress(), AccountId(4ULL));
+  Client client = Client::forNetwork(nodes);
+  client.setHedgingPolicy(HedgingPolicy::FREE_QUERIES);
+  AccountBalanceQuery query = getTestQuery();
+  query.setNodeAccountIds({ AccountId(3ULL), AccountId(4ULL) });
+
+  // When
+  std::future<AccountBalance> future = query.executeAsync(client);
+
+  // Then
+  // The hedge to the unreachable node fails while the first submission is still in flight, so it doesn't decide the
+  // attempt, but its node is backed off.
+  ASSERT_EQ(future.wait_for(getTestWaitTime()), std::future_status::ready);
+  EXPECT_EQ(future.get().mBalance, Hbar(1LL));
+  EXPECT_TRUE(client.getClientNetwork()->getNodeProxies(AccountId(3ULL)).front()->isHealthy());
+  EXPECT_FALSE(client.getClientNetwork()->getNodeProxies(AccountId(4ULL)).front()->isHealthy());
+
+  client.close();
+}
+
+//-----
+TEST_F(ExecutableUnitTests, HedgedExecuteAsyncFailsWithLastOutstandingSubmission)
+{
+  // Given
+  Client client = Client::forNetwork(
+    { { getTestUnreachableAddress(), AccountId(3ULL) }, { getOtherTestUnreachableAddress(), AccountId(4ULL) } });
+  client.setHedgingPolicy(HedgingPolicy::FREE_QUERIES);
+  AccountBalanceQuery query = getTestQuery();
+  query.setNodeAccountIds({ AccountId(3ULL), AccountId(4ULL) }).setMaxAttempts(1U);
+
+  // When
+  std::future<AccountBalance> future = query.executeAsync(client);
+
+  // Then
+  // The failure of the last submission in flight decides the attempt, which was the only one allowed.
+  ASSERT_EQ(future.wait_for(getTestWaitTime()), std::future_status::ready);
+  EXPECT_THROW(future.get(), MaxAttemptsExceededException);
+
+  client.close();
+}
+
+//-----
+TEST_F(ExecutableUnitTests, HedgedExecuteFromDriverThread)
+{
+  // Given
+  const MockNetwork network(2U);
+  Client client = network.createClient();
+  client.setHedgingPolicy(HedgingPolicy::FREE_QUERIES).setCompletionQueueThreads(1U);
+  AccountBalanceQuery outerQuery = getTestQuery();
+  AccountBalanceQuery innerQuery = getTestQuery();
+  std::promise<Hbar> balance;
+
+  // When
+  // The callback runs on the only thread of the Client's driver, which a hedged execution would need to complete.
+  outerQuery.executeAsync(
+    client,
+    [&innerQuery, &client, &balance](const AccountBalance&)
+    {
+      try
+      {
+        balance.set_value(innerQuery.execute(client).mBalance);
+      }
+      catch (...)
+      {
+        balance.set_exception(std::current_exception());
+      }
+    },
+    [&balance](const std::exception& exception)
+    { balance.set_exception(std::make_exception_ptr(std::runtime_error(exception.what()))); });
+
+  // Then
+  std::future<Hbar> future = balance.get_future();
+  ASSERT_EQ(future.wait_for(getTestWaitTime()), std::future_status::ready);
+  EXPECT_EQ(future.get(), Hbar(1LL));
+
+  client.close();
+}
+
+//-----
+TEST_F(ExecutableUnitTests, ExecuteAsyncRefetchesStaleCost)
+{
+  // Given
+  MockNetwork::Behavior behavior;
+  behavior.mQueryCost = 100ULL;
+  const MockNetwork network(1U, behavior);
+  Client client = network.createClient();
+  client.setOperator(AccountId(2ULL), ED25519PrivateKey::generatePrivateKey())
+    .setQueryCostCacheDuration(std::chrono::minutes(1))
+    .setQueryCostMargin(0.0)
+    .setCompletionQueueThreads(1U);
+  client.getQueryCostCache()->put(getTestPaidQueryCostKey(), Hbar(10LL, HbarUnit::TINYBAR()));
+  FileContentsQuery query = getTestPaidQuery();
+
+  // When
+  // The remembered cost is too low, and the node doesn't say what the cost is, so it has to be asked for on the only
+  // thread of the Client's driver before the query can be paid for again.
+  std::future<FileContents> future = query.executeAsync(client);
+
+  // Then
+  ASSERT_EQ(future.wait_for(getTestWaitTime()), std::future_status::ready);
+  EXPECT_NO_THROW(future.get());
+
+  const std::optional<Hbar> cost = client.getQueryCostCache()->get(getTestPaidQueryCostKey());
+  ASSERT_TRUE(cost.has_value());
+  EXPECT_EQ(*cost, Hbar(100LL, HbarUnit::TINYBAR()));
+
+  // The underpaid submission, the cost query, and the submission paid with the exact cost.
+  EXPECT_EQ(network.getStatistics().mQueries, 3ULL);
+
+  client.close();
+}
+
+//-----
+TEST_F(ExecutableUnitTests, ExecuteWithQueryPaymentAboveMaxQueryPayment)
+{
+  // Given
+  const MockNetwork network(1U);
+  Client client = network.createClient();
+  client.setOperator(AccountId(2ULL), ED25519PrivateKey::generatePrivateKey());
+  FileContentsQuery query = getTestPaidQuery();
+  query.setQueryPayment(Hbar(2LL)).setMaxQueryPayment(Hbar(1LL));
+
+  // When / Then
+  EXPECT_THROW(const FileContents contents = query.execute(client), MaxQueryPaymentExceededException);
+  EXPECT_EQ(network.getStatistics().mQueries, 0ULL);
+
+  client.close();
+}
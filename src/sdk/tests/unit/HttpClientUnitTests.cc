@@ -0,0 +1,66 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "Defaults.h"
+#include "impl/HttpClient.h"
+
+#include <chrono>
+#include <gtest/gtest.h>
+#include <stdexcept>
+
+using namespace Hiero;
+using namespace Hiero::internal;
+
+class HttpClientUnitTests : public ::testing::Test
+{
+protected:
+  void TearDown() override { HttpClient::setConnectionOptions(HttpClient::ConnectionOptions()); }
+};
+
+//-----
+TEST_F(HttpClientUnitTests, DefaultConnectionOptions)
+{
+  // Given / When
+  const HttpClient::ConnectionOptions options = HttpClient::getConnectionOptions();
+
+  // Then
+  EXPECT_EQ(options.mMaxConnectionsPerHost, DEFAULT_HTTP_MAX_CONNECTIONS_PER_HOST);
+  EXPECT_EQ(options.mConnectTimeout, DEFAULT_HTTP_CONNECT_TIMEOUT);
+  EXPECT_EQ(options.mRequestTimeout, DEFAULT_HTTP_REQUEST_TIMEOUT);
+}
+
+//-----
+TEST_F(HttpClientUnitTests, SetConnectionOptions)
+{
+  // Given
+  HttpClient::ConnectionOptions options;
+  options.mMaxConnectionsPerHost = 2U;
+  options.mConnectTimeout = std::chrono::seconds(1);
+  options.mRequestTimeout = std::chrono::seconds(5);
+
+  // When
+  HttpClient::setConnectionOptions(options);
+
+  // Then
+  const HttpClient::ConnectionOptions setOptions = HttpClient::getConnectionOptions();
+  EXPECT_EQ(setOptions.mMaxConnectionsPerHost, 2U);
+  EXPECT_EQ(setOptions.mConnectTimeout, std::chrono::seconds(1));
+  EXPECT_EQ(setOptions.mRequestTimeout, std::chrono::seconds(5));
+}
+
+//-----
+TEST_F(HttpClientUnitTests, SetZeroMaxConnectionsPerHost)
+{
+  // Given
+  HttpClient::ConnectionOptions options;
+  options.mMaxConnectionsPerHost = 0U;
+
+  // When / Then
+  EXPECT_THROW(HttpClient::setConnectionOptions(options), std::invalid_argument); // INVALID_ARGUMENT
+}
+
+//-----
+TEST_F(HttpClientUnitTests, UnsupportedHttpMethod)
+{
+  // Given / When / Then
+  EXPECT_THROW(static_cast<void>(HttpClient::invokeREST("http://127.0.0.1:5551/api/v1/accounts/0.0.3", "PUT")),
+               std::invalid_argument);
+}
@@ -0,0 +1,105 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "impl/InFlightLimiter.h"
+
+#include <chrono>
+#include <gtest/gtest.h>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+
+using namespace Hiero::internal;
+
+class InFlightLimiterUnitTests : public ::testing::Test
+{
+};
+
+//-----
+TEST_F(InFlightLimiterUnitTests, ZeroMaxThrows)
+{
+  // Given / When / Then
+  EXPECT_THROW(InFlightLimiter(0U), std::invalid_argument);
+  InFlightLimiter limiter(1U);
+  EXPECT_THROW(limiter.setMax(0U), std::invalid_argument);
+}
+
+//-----
+TEST_F(InFlightLimiterUnitTests, PermitsUpToMaxInFlight)
+{
+  // Given
+  InFlightLimiter limiter(2U);
+  const std::chrono::system_clock::time_point deadline = std::chrono::system_clock::now();
+
+  // When
+  const InFlightLimiter::Permit first = limiter.acquire(deadline);
+  const InFlightLimiter::Permit second = limiter.acquire(deadline);
+  const InFlightLimiter::Permit third = limiter.acquire(deadline);
+
+  // Then
+  EXPECT_TRUE(first);
+  EXPECT_TRUE(second);
+  EXPECT_FALSE(third);
+  EXPECT_EQ(limiter.getInFlight(), 2U);
+}
+
+//-----
+TEST_F(InFlightLimiterUnitTests, DestroyedPermitFreesSlot)
+{
+  // Given
+  InFlightLimiter limiter(1U);
+  const std::chrono::system_clock::time_point deadline = std::chrono::system_clock::now();
+
+  // When
+  {
+    const InFlightLimiter::Permit permit = limiter.acquire(deadline);
+    EXPECT_TRUE(permit);
+  }
+
+  // Then
+  EXPECT_EQ(limiter.getInFlight(), 0U);
+  EXPECT_TRUE(limiter.acquire(deadline));
+}
+
+//-----
+TEST_F(InFlightLimiterUnitTests, WaiterGetsFreedSlot)
+{
+  // Given
+  InFlightLimiter limiter(1U);
+  auto permit = std::make_unique<InFlightLimiter::Permit>(limiter.acquire(std::chrono::system_clock::now()));
+  std::thread releaser(
+    [&permit]()
+    {
+      std::this_thread::sleep_for(std::chrono::milliseconds(20));
+      permit.reset();
+    });
+
+  // When
+  const InFlightLimiter::Permit waited = limiter.acquire(std::chrono::system_clock::now() + std::chrono::seconds(10));
+  releaser.join();
+
+  // Then
+  EXPECT_TRUE(waited);
+  EXPECT_EQ(limiter.getInFlight(), 1U);
+}
+
+//-----
+TEST_F(InFlightLimiterUnitTests, RaisingMaxWakesWaiter)
+{
+  // Given
+  InFlightLimiter limiter(1U);
+  const InFlightLimiter::Permit permit = limiter.acquire(std::chrono::system_clock::now());
+  std::thread raiser(
+    [&limiter]()
+    {
+      std::this_thread::sleep_for(std::chrono::milliseconds(20));
+      limiter.setMax(2U);
+    });
+
+  // When
+  const InFlightLimiter::Permit waited = limiter.acquire(std::chrono::system_clock::now() + std::chrono::seconds(10));
+  raiser.join();
+
+  // Then
+  EXPECT_TRUE(waited);
+  EXPECT_EQ(limiter.getMax(), 2U);
+  EXPECT_EQ(limiter.getInFlight(), 2U);
+}
@@ -0,0 +1,92 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "Logger.h"
+
+#include <gtest/gtest.h>
+#include <log4cxx/logger.h>
+#include <string>
+
+using namespace Hiero;
+
+class LoggerUnitTests : public ::testing::Test
+{
+protected:
+  void SetUp() override { mLogger.setLogger(log4cxx::Logger::getLogger("LoggerUnitTests")); }
+
+  [[nodiscard]] inline Logger& getTestLogger() { return mLogger; }
+
+private:
+  Logger mLogger;
+};
+
+//-----
+TEST_F(LoggerUnitTests, IsEnabled)
+{
+  // Given
+  getTestLogger().setLevel(Logger::LoggingLevel::INFO);
+
+  // When / Then
+  EXPECT_FALSE(getTestLogger().isEnabled(Logger::LoggingLevel::TRACE));
+  EXPECT_FALSE(getTestLogger().isEnabled(Logger::LoggingLevel::DEBUG));
+  EXPECT_TRUE(getTestLogger().isEnabled(Logger::LoggingLevel::INFO));
+  EXPECT_TRUE(getTestLogger().isEnabled(Logger::LoggingLevel::WARN));
+  EXPECT_TRUE(getTestLogger().isEnabled(Logger::LoggingLevel::ERROR));
+}
+
+//-----
+TEST_F(LoggerUnitTests, MessageIsNotBuiltBelowLevel)
+{
+  // Given
+  getTestLogger().setLevel(Logger::LoggingLevel::INFO);
+  bool built = false;
+
+  // When
+  getTestLogger().trace(
+    [&built]()
+    {
+      built = true;
+      return std::string("trace");
+    });
+
+  // Then
+  EXPECT_FALSE(built);
+}
+
+//-----
+TEST_F(LoggerUnitTests, MessageIsBuiltAtLevel)
+{
+  // Given
+  getTestLogger().setLevel(Logger::LoggingLevel::INFO);
+  bool built = false;
+
+  // When
+  getTestLogger().warn(
+    [&built]()
+    {
+      built = true;
+      return std::string("warn");
+    });
+
+  // Then
+  EXPECT_TRUE(built);
+}
+
+//-----
+TEST_F(LoggerUnitTests, MessageIsNotBuiltWhenSilent)
+{
+  // Given
+  getTestLogger().setLevel(Logger::LoggingLevel::TRACE);
+  getTestLogger().setSilent(true);
+  bool built = false;
+
+  // When
+  getTestLogger().error(
+    [&built]()
+    {
+      built = true;
+      return std::string("error");
+    });
+
+  // Then
+  EXPECT_FALSE(built);
+  EXPECT_FALSE(getTestLogger().isEnabled(Logger::LoggingLevel::ERROR));
+}
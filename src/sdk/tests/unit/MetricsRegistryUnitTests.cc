@@ -0,0 +1,208 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "MetricsSnapshot.h"
+#include "Status.h"
+#include "impl/LatencyHistogram.h"
+#include "impl/MetricsRegistry.h"
+
+#include <chrono>
+#include <gtest/gtest.h>
+#include <string>
+
+using namespace Hiero;
+using namespace Hiero::internal;
+
+class MetricsRegistryUnitTests : public ::testing::Test
+{
+};
+
+//-----
+TEST_F(MetricsRegistryUnitTests, GetBucketIndex)
+{
+  // Given / When / Then
+  EXPECT_EQ(LatencyHistogram::getBucketIndex(std::chrono::nanoseconds(-1)), 0ULL);
+  EXPECT_EQ(LatencyHistogram::getBucketIndex(std::chrono::nanoseconds(1023)), 0ULL);
+  EXPECT_EQ(LatencyHistogram::getBucketIndex(std::chrono::nanoseconds(1024)), 1ULL);
+  EXPECT_EQ(LatencyHistogram::getBucketIndex(std::chrono::nanoseconds(1279)), 1ULL);
+  EXPECT_EQ(LatencyHistogram::getBucketIndex(std::chrono::nanoseconds(1280)), 2ULL);
+  EXPECT_EQ(LatencyHistogram::getBucketIndex(std::chrono::nanoseconds(2047)), 4ULL);
+  EXPECT_EQ(LatencyHistogram::getBucketIndex(std::chrono::nanoseconds(2048)), 5ULL);
+  EXPECT_EQ(LatencyHistogram::getBucketIndex(std::chrono::nanoseconds(1LL << 37)), LatencyHistogram::BUCKETS - 1ULL);
+  EXPECT_EQ(LatencyHistogram::getBucketIndex(std::chrono::nanoseconds::max()), LatencyHistogram::BUCKETS - 1ULL);
+}
+
+//-----
+TEST_F(MetricsRegistryUnitTests, GetBucketUpperBound)
+{
+  // Given / When / Then
+  EXPECT_EQ(LatencyHistogram::getBucketUpperBound(0ULL), std::chrono::nanoseconds(1024));
+  EXPECT_EQ(LatencyHistogram::getBucketUpperBound(1ULL), std::chrono::nanoseconds(1280));
+  EXPECT_EQ(LatencyHistogram::getBucketUpperBound(4ULL), std::chrono::nanoseconds(2048));
+  EXPECT_EQ(LatencyHistogram::getBucketUpperBound(LatencyHistogram::BUCKETS - 2ULL),
+            std::chrono::nanoseconds(1LL << 37));
+  EXPECT_EQ(LatencyHistogram::getBucketUpperBound(LatencyHistogram::BUCKETS - 1ULL), std::chrono::nanoseconds::max());
+}
+
+//-----
+TEST_F(MetricsRegistryUnitTests, HistogramPercentiles)
+{
+  // Given
+  LatencyHistogram histogram;
+
+  // When
+  for (int i = 0; i < 90; ++i)
+  {
+    histogram.record(std::chrono::milliseconds(1));
+  }
+
+  for (int i = 0; i < 10; ++i)
+  {
+    histogram.record(std::chrono::milliseconds(100));
+  }
+
+  // Then
+  const MetricsSnapshot::Histogram snapshot = histogram.getSnapshot();
+  EXPECT_EQ(snapshot.mCount, 100ULL);
+  EXPECT_EQ(snapshot.mSum, std::chrono::milliseconds(1090));
+  EXPECT_EQ(snapshot.mBuckets.size(), 2ULL);
+
+  // Each percentile is within a quarter of the recorded durations above them.
+  EXPECT_GT(snapshot.getPercentile(50.0), std::chrono::milliseconds(1));
+  EXPECT_LE(snapshot.getPercentile(50.0), std::chrono::microseconds(1250));
+  EXPECT_EQ(snapshot.getPercentile(90.0), snapshot.getPercentile(50.0));
+  EXPECT_GT(snapshot.getPercentile(99.0), std::chrono::milliseconds(100));
+  EXPECT_LE(snapshot.getPercentile(99.0), std::chrono::milliseconds(125));
+}
+
+//-----
+TEST_F(MetricsRegistryUnitTests, EmptyHistogramPercentileIsZero)
+{
+  // Given
+  const LatencyHistogram histogram;
+
+  // When
+  const MetricsSnapshot::Histogram snapshot = histogram.getSnapshot();
+
+  // Then
+  EXPECT_EQ(snapshot.mCount, 0ULL);
+  EXPECT_TRUE(snapshot.mBuckets.empty());
+  EXPECT_EQ(snapshot.getPercentile(99.0), std::chrono::nanoseconds(0));
+}
+
+//-----
+TEST_F(MetricsRegistryUnitTests, RecordNodeRequestMetrics)
+{
+  // Given
+  MetricsRegistry registry;
+  MetricsRegistry::NodeRequestMetrics& metrics = registry.getNodeRequestMetrics("cryptoTransfer", "0.0.3");
+
+  // When
+  metrics.recordAttempt();
+  metrics.recordGrpcStatus(grpc::StatusCode::UNAVAILABLE);
+  metrics.recordRetry();
+  metrics.recordAttempt();
+  metrics.recordGrpcStatus(grpc::StatusCode::OK);
+  metrics.recordLatency(std::chrono::milliseconds(5));
+  metrics.recordPrecheckStatus(Status::BUSY);
+  metrics.recordRetry();
+  metrics.recordBackoff(std::chrono::milliseconds(250));
+
+  // Then
+  const MetricsSnapshot snapshot = registry.getSnapshot();
+  ASSERT_EQ(snapshot.mNodeRequests.size(), 1ULL);
+
+  const MetricsSnapshot::NodeRequestMetrics& node = snapshot.mNodeRequests.front();
+  EXPECT_EQ(node.mRequestType, "cryptoTransfer");
+  EXPECT_EQ(node.mNode, "0.0.3");
+  EXPECT_EQ(node.mAttempts, 2ULL);
+  EXPECT_EQ(node.mGrpcStatuses.at("OK"), 1ULL);
+  EXPECT_EQ(node.mGrpcStatuses.at("UNAVAILABLE"), 1ULL);
+  EXPECT_EQ(node.mPrecheckStatuses.size(), 1ULL);
+  EXPECT_EQ(node.mPrecheckStatuses.at(Status::BUSY), 1ULL);
+  EXPECT_EQ(node.mRetries, 2ULL);
+  EXPECT_EQ(node.mBackoffs, 1ULL);
+  EXPECT_EQ(node.mBackoffTime, std::chrono::milliseconds(250));
+  EXPECT_EQ(node.mLatency.mCount, 1ULL);
+}
+
+//-----
+TEST_F(MetricsRegistryUnitTests, SameMetricsAreReturnedForSameRequestTypeAndNode)
+{
+  // Given
+  MetricsRegistry registry;
+
+  // When
+  MetricsRegistry::NodeRequestMetrics& first = registry.getNodeRequestMetrics("cryptoTransfer", "0.0.3");
+  MetricsRegistry::NodeRequestMetrics& second = registry.getNodeRequestMetrics("cryptoTransfer", "0.0.3");
+  MetricsRegistry::NodeRequestMetrics& third = registry.getNodeRequestMetrics("cryptoTransfer", "0.0.4");
+
+  // Then
+  EXPECT_EQ(&first, &second);
+  EXPECT_NE(&first, &third);
+}
+
+//-----
+TEST_F(MetricsRegistryUnitTests, RecordExecutionsAndNodeBackoffs)
+{
+  // Given
+  MetricsRegistry registry;
+
+  // When
+  registry.recordExecution("cryptoTransfer", std::chrono::milliseconds(10), true);
+  registry.recordExecution("cryptoTransfer", std::chrono::milliseconds(20), true);
+  registry.recordExecution("cryptoTransfer", std::chrono::milliseconds(30), false);
+  registry.recordNodeBackoff("0.0.3");
+  registry.recordNodeBackoff("0.0.3");
+
+  // Then
+  const MetricsSnapshot snapshot = registry.getSnapshot();
+  ASSERT_EQ(snapshot.mRequests.size(), 1ULL);
+  EXPECT_EQ(snapshot.mRequests.front().mRequestType, "cryptoTransfer");
+  EXPECT_EQ(snapshot.mRequests.front().mSucceeded, 2ULL);
+  EXPECT_EQ(snapshot.mRequests.front().mFailed, 1ULL);
+  EXPECT_EQ(snapshot.mRequests.front().mLatency.mCount, 3ULL);
+  EXPECT_EQ(snapshot.mRequests.front().mLatency.mSum, std::chrono::milliseconds(60));
+  EXPECT_EQ(snapshot.mNodeBackoffs.at("0.0.3"), 2ULL);
+}
+
+//-----
+TEST_F(MetricsRegistryUnitTests, ToPrometheus)
+{
+  // Given
+  MetricsRegistry registry;
+  registry.recordExecution("cryptoTransfer", std::chrono::milliseconds(1500), true);
+  MetricsRegistry::NodeRequestMetrics& metrics = registry.getNodeRequestMetrics("cryptoTransfer", "0.0.3");
+  metrics.recordAttempt();
+  metrics.recordGrpcStatus(grpc::StatusCode::OK);
+  metrics.recordPrecheckStatus(Status::OK);
+  metrics.recordBackoff(std::chrono::milliseconds(250));
+  registry.recordNodeBackoff("0.0.3");
+
+  // When
+  const std::string text = registry.getSnapshot().toPrometheus();
+
+  // Then
+  EXPECT_NE(text.find("# TYPE hiero_sdk_requests_total counter\n"), std::string::npos);
+  EXPECT_NE(text.find("hiero_sdk_requests_total{request_type=\"cryptoTransfer\",outcome=\"success\"} 1\n"),
+            std::string::npos);
+  EXPECT_NE(text.find("hiero_sdk_requests_total{request_type=\"cryptoTransfer\",outcome=\"failure\"} 0\n"),
+            std::string::npos);
+  EXPECT_NE(text.find("# TYPE hiero_sdk_request_duration_seconds histogram\n"), std::string::npos);
+  EXPECT_NE(text.find("hiero_sdk_request_duration_seconds_sum{request_type=\"cryptoTransfer\"} 1.500000000\n"),
+            std::string::npos);
+  EXPECT_NE(text.find("hiero_sdk_request_duration_seconds_bucket{request_type=\"cryptoTransfer\",le=\"+Inf\"} 1\n"),
+            std::string::npos);
+  EXPECT_NE(text.find("hiero_sdk_attempts_total{request_type=\"cryptoTransfer\",node=\"0.0.3\"} 1\n"),
+            std::string::npos);
+  EXPECT_NE(text.find("hiero_sdk_grpc_status_total{request_type=\"cryptoTransfer\",node=\"0.0.3\",code=\"OK\"} 1\n"),
+            std::string::npos);
+  EXPECT_NE(
+    text.find("hiero_sdk_precheck_status_total{request_type=\"cryptoTransfer\",node=\"0.0.3\",status=\"OK\"} 1\n"),
+    std::string::npos);
+  EXPECT_NE(text.find("hiero_sdk_backoff_seconds_total{request_type=\"cryptoTransfer\",node=\"0.0.3\"} 0.250000000\n"),
+            std::string::npos);
+  EXPECT_NE(text.find("hiero_sdk_node_backoffs_total{node=\"0.0.3\"} 1\n"), std::string::npos);
+
+  // The samples of every metric follow its own header.
+  EXPECT_LT(text.find("# TYPE hiero_sdk_attempts_total"), text.find("hiero_sdk_attempts_total{"));
+  EXPECT_LT(text.find("hiero_sdk_attempts_total{"), text.find("# TYPE hiero_sdk_grpc_status_total"));
+}
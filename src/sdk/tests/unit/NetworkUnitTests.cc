@@ -1,6 +1,9 @@
 // SPDX-License-Identifier: Apache-2.0
 #include "AccountId.h"
+#include "Defaults.h"
+#include "NodeSelectionPolicy.h"
 #include "impl/Network.h"
+#include "impl/Node.h"
 
 #include <gtest/gtest.h>
 #include <string>
@@ -154,4 +157,116 @@ TEST_F(NetworkUnitTests, VerifyCertificates)
 
   // Clean up
   testnetNetwork.close();
-}
\ No newline at end of file
+}
+TEST_F(NetworkUnitTests, SelectionSkipsNodesInBackoff)
+{
+  // Given
+  Hiero::internal::Network customNetwork = Hiero::internal::Network::forNetwork({
+    {"127.0.0.1:50211",  AccountId(3ULL)},
+    { "127.0.0.1:50212", AccountId(4ULL)}
+  });
+  customNetwork.setMaxNodesPerRequest(1U);
+  customNetwork.getNodeProxies(AccountId(3ULL)).front()->increaseBackoff();
+
+  // When
+  const std::vector<AccountId> nodeAccountIds = customNetwork.getNodeAccountIdsForExecute();
+
+  // Then
+  ASSERT_EQ(nodeAccountIds.size(), 1);
+  EXPECT_EQ(nodeAccountIds.front(), AccountId(4ULL));
+
+  // Clean up
+  customNetwork.close();
+}
+
+TEST_F(NetworkUnitTests, SelectionRemovesNodesOverMaxNodeAttempts)
+{
+  // Given
+  Hiero::internal::Network customNetwork = Hiero::internal::Network::forNetwork({
+    {"127.0.0.1:50211",  AccountId(3ULL)},
+    { "127.0.0.1:50212", AccountId(4ULL)}
+  });
+  customNetwork.setMaxNodeAttempts(1U);
+  customNetwork.getNodeProxies(AccountId(3ULL)).front()->increaseBackoff();
+
+  // When
+  const std::vector<AccountId> nodeAccountIds = customNetwork.getNodeAccountIdsForExecute();
+
+  // Then
+  ASSERT_EQ(nodeAccountIds.size(), 1);
+  EXPECT_EQ(nodeAccountIds.front(), AccountId(4ULL));
+  EXPECT_TRUE(customNetwork.getNodeProxies(AccountId(3ULL)).empty());
+
+  // Clean up
+  customNetwork.close();
+}
+
+//-----
+TEST_F(NetworkUnitTests, SetChannelPoolSize)
+{
+  // Given
+  Hiero::internal::Network customNetwork = Hiero::internal::Network::forNetwork({
+    {"127.0.0.1:50211", AccountId(3ULL)}
+  });
+
+  // When
+  customNetwork.setChannelPoolSize(4U);
+
+  // Then
+  EXPECT_EQ(customNetwork.getChannelPoolSize(), 4U);
+  EXPECT_EQ(customNetwork.getNodeProxies(AccountId(3ULL)).front()->getChannelPoolSize(), 4U);
+  EXPECT_THROW(customNetwork.setChannelPoolSize(0U), std::invalid_argument); // INVALID_ARGUMENT
+
+  // Clean up
+  customNetwork.close();
+}
+
+//-----
+TEST_F(NetworkUnitTests, SetMaxRequestsInFlightPerNode)
+{
+  // Given
+  Hiero::internal::Network customNetwork = Hiero::internal::Network::forNetwork({
+    {"127.0.0.1:50211", AccountId(3ULL)}
+  });
+  EXPECT_EQ(customNetwork.getMaxRequestsInFlightPerNode(), DEFAULT_MAX_REQUESTS_IN_FLIGHT_PER_NODE);
+
+  // When
+  customNetwork.setMaxRequestsInFlightPerNode(8U);
+
+  // Then
+  EXPECT_EQ(customNetwork.getMaxRequestsInFlightPerNode(), 8U);
+  EXPECT_EQ(customNetwork.getNodeProxies(AccountId(3ULL)).front()->getMaxRequestsInFlight(), 8U);
+  EXPECT_THROW(customNetwork.setMaxRequestsInFlightPerNode(0U), std::invalid_argument); // INVALID_ARGUMENT
+
+  // Clean up
+  customNetwork.close();
+}
+
+//-----
+TEST_F(NetworkUnitTests, SelectionPolicySkipsNodesInBackoff)
+{
+  // Given
+  Hiero::internal::Network customNetwork = Hiero::internal::Network::forNetwork({
+    {"127.0.0.1:50211",  AccountId(3ULL)},
+    { "127.0.0.1:50212", AccountId(4ULL)}
+  });
+  customNetwork.setMaxNodesPerRequest(1U);
+  customNetwork.getNodeProxies(AccountId(3ULL)).front()->increaseBackoff();
+
+  for (const NodeSelectionPolicy policy : { NodeSelectionPolicy::POWER_OF_TWO_CHOICES,
+                                            NodeSelectionPolicy::LEAST_OUTSTANDING_REQUESTS,
+                                            NodeSelectionPolicy::LATENCY_WEIGHTED })
+  {
+    // When
+    customNetwork.setNodeSelectionPolicy(policy);
+    const std::vector<AccountId> nodeAccountIds = customNetwork.getNodeAccountIdsForExecute();
+
+    // Then
+    EXPECT_EQ(customNetwork.getNodeSelectionPolicy(), policy);
+    ASSERT_EQ(nodeAccountIds.size(), 1);
+    EXPECT_EQ(nodeAccountIds.front(), AccountId(4ULL));
+  }
+
+  // Clean up
+  customNetwork.close();
+}
@@ -0,0 +1,102 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "impl/NodeStats.h"
+
+#include <chrono>
+#include <gtest/gtest.h>
+
+using namespace Hiero::internal;
+
+class NodeStatsUnitTests : public ::testing::Test
+{
+};
+
+//-----
+TEST_F(NodeStatsUnitTests, TrackOutstandingRequests)
+{
+  // Given
+  NodeStats stats;
+
+  // When
+  const std::chrono::steady_clock::time_point first = stats.startRequest();
+  const std::chrono::steady_clock::time_point second = stats.startRequest();
+
+  // Then
+  EXPECT_EQ(stats.getOutstandingRequests(), 2U);
+  stats.endRequest(first, false);
+  stats.endRequest(second, false);
+  EXPECT_EQ(stats.getOutstandingRequests(), 0U);
+}
+
+//-----
+TEST_F(NodeStatsUnitTests, CancelledRequestIsNotRecorded)
+{
+  // Given
+  NodeStats stats;
+  const std::chrono::nanoseconds initialLatency = stats.getAverageLatency();
+
+  // When
+  static_cast<void>(stats.startRequest());
+  stats.cancelRequest();
+
+  // Then
+  EXPECT_EQ(stats.getOutstandingRequests(), 0U);
+  EXPECT_EQ(stats.getAverageLatency(), initialLatency);
+  EXPECT_EQ(stats.getLatencyPercentile(50.0), std::chrono::nanoseconds(0));
+  EXPECT_DOUBLE_EQ(stats.getErrorRate(), 0.0);
+}
+
+//-----
+TEST_F(NodeStatsUnitTests, FirstResponseReplacesInitialLatency)
+{
+  // Given
+  NodeStats stats;
+  EXPECT_EQ(stats.getLatencyPercentile(50.0), std::chrono::nanoseconds(0));
+
+  // When
+  stats.endRequest(stats.startRequest() - std::chrono::milliseconds(5), false);
+
+  // Then
+  EXPECT_GE(stats.getAverageLatency(), std::chrono::milliseconds(5));
+  EXPECT_LT(stats.getAverageLatency(), std::chrono::milliseconds(100));
+  EXPECT_GE(stats.getLatencyPercentile(50.0), std::chrono::milliseconds(5));
+  EXPECT_LE(stats.getLatencyPercentile(50.0), std::chrono::milliseconds(20));
+}
+
+//-----
+TEST_F(NodeStatsUnitTests, ErrorsRaiseErrorRateAndExpectedCost)
+{
+  // Given
+  NodeStats healthy;
+  NodeStats failing;
+
+  // When
+  // Both nodes answer with the same latency, so only their error rates differ.
+  for (int i = 0; i < 10; ++i)
+  {
+    healthy.endRequest(healthy.startRequest() - std::chrono::milliseconds(10), false);
+    failing.endRequest(failing.startRequest() - std::chrono::milliseconds(10), true);
+  }
+
+  // Then
+  EXPECT_DOUBLE_EQ(healthy.getErrorRate(), 0.0);
+  EXPECT_GT(failing.getErrorRate(), 0.5);
+  EXPECT_LE(failing.getErrorRate(), 1.0);
+
+  // A success rate below one half at least doubles the expected cost.
+  EXPECT_GT(failing.getExpectedCost(), 1.5 * healthy.getExpectedCost());
+}
+
+//-----
+TEST_F(NodeStatsUnitTests, OutstandingRequestsRaiseExpectedCost)
+{
+  // Given
+  NodeStats idle;
+  NodeStats busy;
+
+  // When
+  const std::chrono::steady_clock::time_point start = busy.startRequest();
+
+  // Then
+  EXPECT_LT(idle.getExpectedCost(), busy.getExpectedCost());
+  busy.endRequest(start, false);
+}
@@ -0,0 +1,142 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "AccountId.h"
+#include "Client.h"
+#include "ED25519PrivateKey.h"
+#include "Hbar.h"
+#include "exceptions/UninitializedException.h"
+#include "impl/PaymentTransactionPool.h"
+
+#include <chrono>
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+#include <transaction.pb.h>
+#include <unordered_set>
+
+using namespace Hiero;
+using namespace Hiero::internal;
+
+class PaymentTransactionPoolUnitTests : public ::testing::Test
+{
+protected:
+  void SetUp() override { mClient.setOperator(AccountId(2ULL), ED25519PrivateKey::generatePrivateKey()); }
+
+  [[nodiscard]] inline const Client& getTestClient() const { return mClient; }
+  [[nodiscard]] inline const AccountId& getTestNodeAccountId() const { return mNodeAccountId; }
+  [[nodiscard]] inline const Hbar& getTestAmount() const { return mAmount; }
+
+  // Wait for the background thread of a pool to have a number of payments ready.
+  [[nodiscard]] static bool waitForSize(const PaymentTransactionPool& pool, std::size_t size)
+  {
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (pool.size() < size)
+    {
+      if (std::chrono::steady_clock::now() > deadline)
+      {
+        return false;
+      }
+
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    return true;
+  }
+
+private:
+  Client mClient;
+  const AccountId mNodeAccountId = AccountId(3ULL);
+  const Hbar mAmount = Hbar(1LL);
+};
+
+//-----
+TEST_F(PaymentTransactionPoolUnitTests, TakeBuildsPaymentWhenNoneIsReady)
+{
+  // Given
+  PaymentTransactionPool pool(2U);
+
+  // When
+  const proto::Transaction payment = pool.take(getTestClient(), getTestNodeAccountId(), getTestAmount());
+
+  // Then
+  EXPECT_FALSE(payment.signedtransactionbytes().empty());
+  EXPECT_EQ(pool.getStatistics().mHits, 0ULL);
+  EXPECT_EQ(pool.getStatistics().mMisses, 1ULL);
+}
+
+//-----
+TEST_F(PaymentTransactionPoolUnitTests, TakePaymentSignedAheadOfTime)
+{
+  // Given
+  PaymentTransactionPool pool(2U);
+  const proto::Transaction first = pool.take(getTestClient(), getTestNodeAccountId(), getTestAmount());
+  ASSERT_TRUE(waitForSize(pool, 2U));
+
+  // When
+  const proto::Transaction second = pool.take(getTestClient(), getTestNodeAccountId(), getTestAmount());
+
+  // Then
+  EXPECT_FALSE(second.signedtransactionbytes().empty());
+  EXPECT_EQ(pool.getStatistics().mHits, 1ULL);
+  EXPECT_EQ(pool.getStatistics().mMisses, 1ULL);
+}
+
+//-----
+TEST_F(PaymentTransactionPoolUnitTests, PaymentsAreHandedOutOnce)
+{
+  // Given
+  PaymentTransactionPool pool(4U);
+  std::unordered_set<std::string> payments;
+
+  // When
+  for (int i = 0; i < 20; ++i)
+  {
+    payments.insert(pool.take(getTestClient(), getTestNodeAccountId(), getTestAmount()).SerializeAsString());
+  }
+
+  // Then
+  EXPECT_EQ(payments.size(), 20U);
+}
+
+//-----
+TEST_F(PaymentTransactionPoolUnitTests, ExpiredPaymentsAreDropped)
+{
+  // Given
+  PaymentTransactionPool pool(2U, std::chrono::seconds(1), std::chrono::seconds(1));
+  const proto::Transaction first = pool.take(getTestClient(), getTestNodeAccountId(), getTestAmount());
+  ASSERT_TRUE(waitForSize(pool, 2U));
+
+  // When
+  const proto::Transaction second = pool.take(getTestClient(), getTestNodeAccountId(), getTestAmount());
+
+  // Then
+  EXPECT_EQ(pool.getStatistics().mHits, 0ULL);
+  EXPECT_EQ(pool.getStatistics().mMisses, 2ULL);
+  EXPECT_EQ(pool.getStatistics().mExpired, 2ULL);
+}
+
+//-----
+TEST_F(PaymentTransactionPoolUnitTests, TakeAfterClose)
+{
+  // Given
+  PaymentTransactionPool pool(2U);
+  pool.close();
+
+  // When
+  const proto::Transaction payment = pool.take(getTestClient(), getTestNodeAccountId(), getTestAmount());
+
+  // Then
+  EXPECT_FALSE(payment.signedtransactionbytes().empty());
+  EXPECT_EQ(pool.size(), 0U);
+}
+
+//-----
+TEST_F(PaymentTransactionPoolUnitTests, TakeWithoutOperator)
+{
+  // Given
+  PaymentTransactionPool pool(2U);
+  const Client client;
+
+  // When / Then
+  EXPECT_THROW(auto payment = pool.take(client, getTestNodeAccountId(), getTestAmount()),
+               UninitializedException); // UNINITIALIZED_EXCEPTION
+}
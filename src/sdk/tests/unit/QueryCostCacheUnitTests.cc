@@ -0,0 +1,83 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "Hbar.h"
+#include "impl/QueryCostCache.h"
+
+#include <chrono>
+#include <gtest/gtest.h>
+#include <string>
+
+using namespace Hiero;
+using namespace Hiero::internal;
+
+class QueryCostCacheUnitTests : public ::testing::Test
+{
+protected:
+  [[nodiscard]] inline const std::string& getTestKey() const { return mKey; }
+  [[nodiscard]] inline const Hbar& getTestCost() const { return mCost; }
+  [[nodiscard]] inline const std::chrono::system_clock::time_point& getTestTime() const { return mTime; }
+
+private:
+  const std::string mKey = "query";
+  const Hbar mCost = Hbar(25LL, HbarUnit::TINYBAR());
+  const std::chrono::system_clock::time_point mTime = std::chrono::system_clock::now();
+};
+
+//-----
+TEST_F(QueryCostCacheUnitTests, GetRememberedCost)
+{
+  // Given
+  QueryCostCache cache(std::chrono::minutes(1));
+
+  // When
+  cache.put(getTestKey(), getTestCost(), getTestTime());
+
+  // Then
+  ASSERT_TRUE(cache.get(getTestKey(), getTestTime()).has_value());
+  EXPECT_EQ(cache.get(getTestKey(), getTestTime()).value(), getTestCost());
+  EXPECT_FALSE(cache.get("other query", getTestTime()).has_value());
+}
+
+//-----
+TEST_F(QueryCostCacheUnitTests, CostIsForgottenAfterDuration)
+{
+  // Given
+  QueryCostCache cache(std::chrono::minutes(1));
+  cache.put(getTestKey(), getTestCost(), getTestTime());
+
+  // When / Then
+  EXPECT_TRUE(cache.get(getTestKey(), getTestTime() + std::chrono::seconds(59)).has_value());
+  EXPECT_FALSE(cache.get(getTestKey(), getTestTime() + std::chrono::minutes(1)).has_value());
+}
+
+//-----
+TEST_F(QueryCostCacheUnitTests, EraseCost)
+{
+  // Given
+  QueryCostCache cache(std::chrono::minutes(1));
+  cache.put(getTestKey(), getTestCost(), getTestTime());
+
+  // When
+  cache.erase(getTestKey());
+
+  // Then
+  EXPECT_FALSE(cache.get(getTestKey(), getTestTime()).has_value());
+  EXPECT_EQ(cache.size(), 0U);
+}
+
+//-----
+TEST_F(QueryCostCacheUnitTests, PutBeyondMaxEntries)
+{
+  // Given
+  QueryCostCache cache(std::chrono::minutes(1), 2U);
+  cache.put("first", getTestCost(), getTestTime());
+  cache.put("second", getTestCost(), getTestTime() + std::chrono::minutes(1));
+
+  // When
+  cache.put(getTestKey(), getTestCost(), getTestTime() + std::chrono::minutes(1));
+
+  // Then
+  EXPECT_EQ(cache.size(), 2U);
+  EXPECT_FALSE(cache.get("first", getTestTime() + std::chrono::minutes(1)).has_value());
+  EXPECT_TRUE(cache.get("second", getTestTime() + std::chrono::minutes(1)).has_value());
+  EXPECT_TRUE(cache.get(getTestKey(), getTestTime() + std::chrono::minutes(1)).has_value());
+}
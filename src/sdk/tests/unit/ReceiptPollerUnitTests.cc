@@ -0,0 +1,118 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "AccountId.h"
+#include "Client.h"
+#include "Defaults.h"
+#include "ReceiptPoller.h"
+#include "TransactionId.h"
+#include "TransactionReceipt.h"
+#include "exceptions/IllegalStateException.h"
+#include "exceptions/UninitializedException.h"
+
+#include <gtest/gtest.h>
+
+using namespace Hiero;
+
+class ReceiptPollerUnitTests : public ::testing::Test
+{
+protected:
+  void SetUp() override { mClient = Client::forNetwork({ { "127.0.0.1:50211", AccountId(3ULL) } }); }
+
+  [[nodiscard]] inline Client& getTestClient() { return mClient; }
+  [[nodiscard]] inline const AccountId& getTestNodeAccountId() const { return mNodeAccountId; }
+  [[nodiscard]] inline const TransactionId& getTestTransactionId() const { return mTransactionId; }
+
+private:
+  Client mClient;
+  const AccountId mNodeAccountId = AccountId(3ULL);
+  const TransactionId mTransactionId = TransactionId::generate(AccountId(1001ULL));
+};
+
+//-----
+TEST_F(ReceiptPollerUnitTests, ConstructReceiptPoller)
+{
+  // Given / When
+  const ReceiptPoller receiptPoller(getTestClient());
+
+  // Then
+  EXPECT_EQ(receiptPoller.getPollInterval(), DEFAULT_RECEIPT_POLL_INTERVAL);
+  EXPECT_EQ(receiptPoller.getMaxInFlightPerNode(), DEFAULT_MAX_RECEIPT_POLLS_IN_FLIGHT_PER_NODE);
+  EXPECT_EQ(receiptPoller.getPendingCount(), 0ULL);
+}
+
+//-----
+TEST_F(ReceiptPollerUnitTests, ConstructWithoutNetwork)
+{
+  // Given
+  const Client client;
+
+  // When / Then
+  EXPECT_THROW(const ReceiptPoller receiptPoller(client), UninitializedException);
+}
+
+//-----
+TEST_F(ReceiptPollerUnitTests, SetPollInterval)
+{
+  // Given
+  ReceiptPoller receiptPoller(getTestClient());
+
+  // When
+  receiptPoller.setPollInterval(std::chrono::milliseconds(10));
+
+  // Then
+  EXPECT_EQ(receiptPoller.getPollInterval(), std::chrono::milliseconds(10));
+  EXPECT_THROW(receiptPoller.setPollInterval(std::chrono::milliseconds(0)), std::invalid_argument);
+  EXPECT_THROW(receiptPoller.setPollInterval(std::chrono::milliseconds(-1)), std::invalid_argument);
+}
+
+//-----
+TEST_F(ReceiptPollerUnitTests, SetMaxInFlightPerNode)
+{
+  // Given
+  ReceiptPoller receiptPoller(getTestClient());
+
+  // When
+  receiptPoller.setMaxInFlightPerNode(4U);
+
+  // Then
+  EXPECT_EQ(receiptPoller.getMaxInFlightPerNode(), 4U);
+  EXPECT_THROW(receiptPoller.setMaxInFlightPerNode(0U), std::invalid_argument);
+}
+
+//-----
+TEST_F(ReceiptPollerUnitTests, PollAfterClose)
+{
+  // Given
+  ReceiptPoller receiptPoller(getTestClient());
+  receiptPoller.close();
+
+  // When
+  std::future<TransactionReceipt> future = receiptPoller.poll(getTestTransactionId(), getTestNodeAccountId());
+
+  // Then
+  EXPECT_THROW(future.get(), IllegalStateException);
+  EXPECT_EQ(receiptPoller.getPendingCount(), 0ULL);
+}
+
+//-----
+TEST_F(ReceiptPollerUnitTests, ClientSharesReceiptPoller)
+{
+  // Given / When
+  const std::shared_ptr<ReceiptPoller> receiptPoller = getTestClient().getReceiptPoller();
+
+  // Then
+  EXPECT_EQ(getTestClient().getReceiptPoller(), receiptPoller);
+}
+
+//-----
+TEST_F(ReceiptPollerUnitTests, ClientCloseClosesReceiptPoller)
+{
+  // Given
+  const std::shared_ptr<ReceiptPoller> receiptPoller = getTestClient().getReceiptPoller();
+
+  // When
+  getTestClient().close();
+
+  // Then
+  EXPECT_THROW(receiptPoller->poll(getTestTransactionId(), getTestNodeAccountId()).get(), IllegalStateException);
+  EXPECT_NE(getTestClient().getReceiptPoller(), receiptPoller);
+}
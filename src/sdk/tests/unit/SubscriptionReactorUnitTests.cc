@@ -0,0 +1,84 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "impl/CompletionQueueDriver.h"
+#include "impl/SubscriptionReactor.h"
+
+#include <atomic>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <memory>
+
+using namespace Hiero::internal;
+
+class SubscriptionReactorUnitTests : public ::testing::Test
+{
+protected:
+  // A subscription that stays open until it is cancelled.
+  class TestSubscription : public SubscriptionReactor::Subscription
+  {
+  public:
+    void cancel() override { mCancelled = true; }
+
+    std::atomic<bool> mCancelled = false;
+  };
+};
+
+//-----
+TEST_F(SubscriptionReactorUnitTests, AddSpreadsSubscriptionsAcrossQueues)
+{
+  // Given
+  SubscriptionReactor reactor(2U);
+  const auto first = std::make_shared<TestSubscription>();
+  const auto second = std::make_shared<TestSubscription>();
+  const auto third = std::make_shared<TestSubscription>();
+
+  // When
+  const std::shared_ptr<CompletionQueueDriver> firstDriver = reactor.add(first);
+  const std::shared_ptr<CompletionQueueDriver> secondDriver = reactor.add(second);
+  const std::shared_ptr<CompletionQueueDriver> thirdDriver = reactor.add(third);
+
+  // Then
+  ASSERT_NE(firstDriver, nullptr);
+  ASSERT_NE(secondDriver, nullptr);
+  EXPECT_NE(firstDriver, secondDriver);
+  EXPECT_EQ(firstDriver, thirdDriver);
+  EXPECT_EQ(reactor.size(), 3U);
+}
+
+//-----
+TEST_F(SubscriptionReactorUnitTests, RemoveSubscription)
+{
+  // Given
+  SubscriptionReactor reactor(1U);
+  const auto subscription = std::make_shared<TestSubscription>();
+  ASSERT_NE(reactor.add(subscription), nullptr);
+
+  // When
+  reactor.remove(subscription.get());
+
+  // Then
+  EXPECT_EQ(reactor.size(), 0U);
+}
+
+//-----
+TEST_F(SubscriptionReactorUnitTests, ShutdownCancelsSubscriptions)
+{
+  // Given
+  SubscriptionReactor reactor(1U);
+  const auto subscription = std::make_shared<TestSubscription>();
+  const std::shared_ptr<CompletionQueueDriver> driver = reactor.add(subscription);
+  ASSERT_NE(driver, nullptr);
+
+  // An outstanding event that would keep the driver from draining.
+  std::atomic<bool> fired = true;
+  ASSERT_TRUE(driver->schedule(std::chrono::system_clock::now() + std::chrono::hours(1),
+                               [&fired](bool ok) { fired = ok; }));
+
+  // When
+  reactor.shutdown();
+
+  // Then
+  EXPECT_TRUE(subscription->mCancelled);
+  EXPECT_FALSE(fired);
+  EXPECT_TRUE(driver->isShutdown());
+  EXPECT_EQ(reactor.add(std::make_shared<TestSubscription>()), nullptr);
+}
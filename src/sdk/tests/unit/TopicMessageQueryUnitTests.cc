@@ -1,5 +1,6 @@
 // SPDX-License-Identifier: Apache-2.0
 #include "Client.h"
+#include "Defaults.h"
 #include "ECDSAsecp256k1PrivateKey.h"
 #include "TopicId.h"
 #include "TopicMessageQuery.h"
@@ -201,3 +202,48 @@ TEST_F(TopicMessageQueryUnitTests, GetSetMaxBackoff)
   // Then
   EXPECT_EQ(query.getMaxBackoff(), getTestMaxBackoff());
 }
+
+//-----
+TEST_F(TopicMessageQueryUnitTests, GetSetMaxPendingChunkBytes)
+{
+  // Given
+  TopicMessageQuery query;
+  EXPECT_EQ(query.getMaxPendingChunkBytes(), DEFAULT_MAX_PENDING_CHUNK_BYTES);
+
+  // When
+  query.setMaxPendingChunkBytes(1024U);
+
+  // Then
+  EXPECT_EQ(query.getMaxPendingChunkBytes(), 1024U);
+}
+
+//-----
+TEST_F(TopicMessageQueryUnitTests, GetSetChunkReassemblyTimeout)
+{
+  // Given
+  TopicMessageQuery query;
+  EXPECT_EQ(query.getChunkReassemblyTimeout(), DEFAULT_CHUNK_REASSEMBLY_TIMEOUT);
+
+  // When
+  query.setChunkReassemblyTimeout(std::chrono::seconds(8));
+
+  // Then
+  EXPECT_EQ(query.getChunkReassemblyTimeout(), std::chrono::seconds(8));
+}
+
+//-----
+TEST_F(TopicMessageQueryUnitTests, ChunkStatisticsStartAtZero)
+{
+  // Given
+  const TopicMessageQuery query;
+
+  // When
+  const TopicMessageQuery::ChunkStatistics statistics = query.getChunkStatistics();
+
+  // Then
+  EXPECT_EQ(statistics.mCompletedMessages, 0ULL);
+  EXPECT_EQ(statistics.mDuplicateChunks, 0ULL);
+  EXPECT_EQ(statistics.mInvalidChunks, 0ULL);
+  EXPECT_EQ(statistics.mExpiredMessages, 0ULL);
+  EXPECT_EQ(statistics.mEvictedMessages, 0ULL);
+}
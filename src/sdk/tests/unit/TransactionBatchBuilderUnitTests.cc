@@ -0,0 +1,302 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "AccountId.h"
+#include "Client.h"
+#include "ED25519PrivateKey.h"
+#include "Hbar.h"
+#include "PrivateKey.h"
+#include "PublicKey.h"
+#include "TransactionBatchBuilder.h"
+#include "TransactionId.h"
+#include "TransferTransaction.h"
+#include "exceptions/UninitializedException.h"
+#include "impl/Utilities.h"
+
+#include <basic_types.pb.h>
+#include <crypto_transfer.pb.h>
+#include <gtest/gtest.h>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <transaction.pb.h>
+#include <transaction_body.pb.h>
+#include <transaction_contents.pb.h>
+#include <unordered_map>
+#include <vector>
+
+using namespace Hiero;
+
+class TransactionBatchBuilderUnitTests : public ::testing::Test
+{
+protected:
+  void SetUp() override { mClient.setOperator(mOperatorAccountId, mOperatorKey); }
+
+  [[nodiscard]] inline const Client& getTestClient() const { return mClient; }
+  [[nodiscard]] inline const AccountId& getTestOperatorAccountId() const { return mOperatorAccountId; }
+  [[nodiscard]] inline const std::shared_ptr<PrivateKey>& getTestOperatorKey() const { return mOperatorKey; }
+  [[nodiscard]] inline const std::vector<AccountId>& getTestNodeAccountIds() const { return mNodeAccountIds; }
+
+  // Get a builder of transfers of 1, 2, 3, ... tinybars to the accounts 0.0.1000, 0.0.1001, 0.0.1002, ...
+  [[nodiscard]] TransactionBatchBuilder getTestBuilder(unsigned int transfers) const
+  {
+    TransferTransaction prototype;
+    prototype.setNodeAccountIds(mNodeAccountIds).setMaxTransactionFee(Hbar(1LL));
+
+    std::vector<AccountId> recipients;
+    std::vector<Hbar> amounts;
+    for (unsigned int i = 0U; i < transfers; ++i)
+    {
+      recipients.emplace_back(1000ULL + i);
+      amounts.emplace_back(static_cast<int64_t>(i) + 1LL, HbarUnit::TINYBAR());
+    }
+
+    TransactionBatchBuilder builder(prototype);
+    builder.setRecipients(recipients).setAmounts(amounts);
+    return builder;
+  }
+
+  // Get the SignedTransaction protobuf object of a Transaction protobuf object.
+  [[nodiscard]] static proto::SignedTransaction getSignedTransaction(const proto::Transaction& transaction)
+  {
+    proto::SignedTransaction signedTransaction;
+    signedTransaction.ParseFromString(transaction.signedtransactionbytes());
+    return signedTransaction;
+  }
+
+  // Get the TransactionBody protobuf object of a Transaction protobuf object.
+  [[nodiscard]] static proto::TransactionBody getTransactionBody(const proto::Transaction& transaction)
+  {
+    proto::TransactionBody body;
+    body.ParseFromString(getSignedTransaction(transaction).bodybytes());
+    return body;
+  }
+
+private:
+  Client mClient;
+  const AccountId mOperatorAccountId = AccountId(2ULL);
+  const std::shared_ptr<PrivateKey> mOperatorKey = ED25519PrivateKey::generatePrivateKey();
+  const std::vector<AccountId> mNodeAccountIds = { AccountId(3ULL), AccountId(4ULL) };
+};
+
+//-----
+TEST_F(TransactionBatchBuilderUnitTests, BuildsTransferForEachRecipientAndNode)
+{
+  // Given
+  const TransactionBatchBuilder builder = getTestBuilder(100U);
+
+  // When
+  const TransactionBatchBuilder::Batch batch = builder.build(getTestClient());
+
+  // Then
+  EXPECT_EQ(batch.mNodeAccountIds, getTestNodeAccountIds());
+  ASSERT_EQ(batch.mTransfers.size(), 100ULL);
+  for (std::size_t i = 0; i < batch.mTransfers.size(); ++i)
+  {
+    const TransactionBatchBuilder::SignedTransfer& transfer = batch.mTransfers[i];
+    ASSERT_EQ(transfer.mTransactions.size(), getTestNodeAccountIds().size());
+
+    for (std::size_t node = 0; node < getTestNodeAccountIds().size(); ++node)
+    {
+      const proto::TransactionBody body = getTransactionBody(transfer.mTransactions[node]);
+      EXPECT_EQ(AccountId::fromProtobuf(body.nodeaccountid()), getTestNodeAccountIds()[node]);
+      EXPECT_EQ(TransactionId::fromProtobuf(body.transactionid()), transfer.mTransactionId);
+      EXPECT_EQ(body.transactionfee(), static_cast<uint64_t>(Hbar(1LL).toTinybars()));
+
+      std::unordered_map<AccountId, int64_t> amounts;
+      for (const proto::AccountAmount& accountAmount : body.cryptotransfer().transfers().accountamounts())
+      {
+        amounts[AccountId::fromProtobuf(accountAmount.accountid())] += accountAmount.amount();
+      }
+
+      EXPECT_EQ(body.cryptotransfer().transfers().accountamounts_size(), 2);
+      EXPECT_EQ(amounts.size(), 2ULL);
+      EXPECT_EQ(amounts[getTestOperatorAccountId()], -static_cast<int64_t>(i + 1ULL));
+      EXPECT_EQ(amounts[AccountId(1000ULL + i)], static_cast<int64_t>(i + 1ULL));
+    }
+  }
+}
+
+//-----
+TEST_F(TransactionBatchBuilderUnitTests, SignsEachTransactionWithOperator)
+{
+  // Given
+  const TransactionBatchBuilder builder = getTestBuilder(3U);
+
+  // When
+  const TransactionBatchBuilder::Batch batch = builder.build(getTestClient());
+
+  // Then
+  for (const TransactionBatchBuilder::SignedTransfer& transfer : batch.mTransfers)
+  {
+    for (const proto::Transaction& transaction : transfer.mTransactions)
+    {
+      const proto::SignedTransaction signedTransaction = getSignedTransaction(transaction);
+      ASSERT_EQ(signedTransaction.sigmap().sigpair_size(), 1);
+      EXPECT_TRUE(getTestOperatorKey()->getPublicKey()->verifySignature(
+        internal::Utilities::stringToByteVector(signedTransaction.sigmap().sigpair(0).ed25519()),
+        internal::Utilities::stringToByteVector(signedTransaction.bodybytes())));
+    }
+  }
+}
+
+//-----
+TEST_F(TransactionBatchBuilderUnitTests, TransactionIdsAreIncreasing)
+{
+  // Given
+  const TransactionBatchBuilder builder = getTestBuilder(100U);
+
+  // When
+  const TransactionBatchBuilder::Batch batch = builder.build(getTestClient());
+
+  // Then
+  for (std::size_t i = 1; i < batch.mTransfers.size(); ++i)
+  {
+    EXPECT_EQ(batch.mTransfers[i].mTransactionId.mAccountId, getTestOperatorAccountId());
+    EXPECT_GT(batch.mTransfers[i].mTransactionId.mValidTransactionTime,
+              batch.mTransfers[i - 1].mTransactionId.mValidTransactionTime);
+  }
+}
+
+//-----
+TEST_F(TransactionBatchBuilderUnitTests, SetSenderAndMemos)
+{
+  // Given
+  TransactionBatchBuilder builder = getTestBuilder(2U);
+  builder.setSender(AccountId(5ULL)).setMemos({ "first", "second" });
+
+  // When
+  const TransactionBatchBuilder::Batch batch = builder.build(getTestClient());
+
+  // Then
+  const proto::TransactionBody first = getTransactionBody(batch.mTransfers[0].mTransactions[0]);
+  const proto::TransactionBody second = getTransactionBody(batch.mTransfers[1].mTransactions[0]);
+  EXPECT_EQ(first.memo(), "first");
+  EXPECT_EQ(second.memo(), "second");
+  EXPECT_EQ(AccountId::fromProtobuf(first.transactionid().accountid()), getTestOperatorAccountId());
+  EXPECT_EQ(AccountId::fromProtobuf(first.cryptotransfer().transfers().accountamounts(0).accountid()), AccountId(5ULL));
+}
+
+//-----
+TEST_F(TransactionBatchBuilderUnitTests, TransferCanBeLoadedIntoTransferTransaction)
+{
+  // Given
+  const TransactionBatchBuilder::Batch batch = getTestBuilder(1U).build(getTestClient());
+  const TransactionBatchBuilder::SignedTransfer& transfer = batch.mTransfers.front();
+
+  std::map<AccountId, proto::Transaction> transactions;
+  for (std::size_t node = 0; node < batch.mNodeAccountIds.size(); ++node)
+  {
+    transactions.emplace(batch.mNodeAccountIds[node], transfer.mTransactions[node]);
+  }
+
+  // When
+  const TransferTransaction transaction(
+    std::map<TransactionId, std::map<AccountId, proto::Transaction>>{ { transfer.mTransactionId, transactions } });
+
+  // Then
+  EXPECT_EQ(transaction.getTransactionId(), transfer.mTransactionId);
+  EXPECT_EQ(transaction.getNodeAccountIds(), getTestNodeAccountIds());
+  EXPECT_EQ(transaction.getHbarTransfers().at(AccountId(1000ULL)), Hbar(1LL, HbarUnit::TINYBAR()));
+}
+
+//-----
+TEST_F(TransactionBatchBuilderUnitTests, MergesPrototypeTransfersPerAccount)
+{
+  // Given
+  TransferTransaction prototype;
+  prototype.setNodeAccountIds(getTestNodeAccountIds())
+    .addHbarTransfer(getTestOperatorAccountId(), Hbar(-10LL, HbarUnit::TINYBAR()))
+    .addHbarTransfer(AccountId(1000ULL), Hbar(5LL, HbarUnit::TINYBAR()))
+    .addHbarTransfer(AccountId(98ULL), Hbar(5LL, HbarUnit::TINYBAR()));
+
+  TransactionBatchBuilder builder(prototype);
+  builder.setRecipients({ AccountId(1000ULL), AccountId(1001ULL) })
+    .setAmounts({ Hbar(1LL, HbarUnit::TINYBAR()), Hbar(2LL, HbarUnit::TINYBAR()) });
+
+  // When
+  const TransactionBatchBuilder::Batch batch = builder.build(getTestClient());
+
+  // Then
+  const std::vector<std::map<AccountId, int64_t>> expected = {
+    { { getTestOperatorAccountId(), -11LL }, { AccountId(1000ULL), 6LL }, { AccountId(98ULL), 5LL } },
+    { { getTestOperatorAccountId(), -12LL },
+     { AccountId(1000ULL), 5LL },
+     { AccountId(98ULL), 5LL },
+     { AccountId(1001ULL), 2LL } }
+  };
+
+  for (std::size_t i = 0; i < batch.mTransfers.size(); ++i)
+  {
+    std::map<AccountId, int64_t> amounts;
+    for (const proto::AccountAmount& accountAmount :
+         getTransactionBody(batch.mTransfers[i].mTransactions[0]).cryptotransfer().transfers().accountamounts())
+    {
+      // Each account appears only once.
+      EXPECT_TRUE(amounts.emplace(AccountId::fromProtobuf(accountAmount.accountid()), accountAmount.amount()).second);
+    }
+
+    EXPECT_EQ(amounts, expected[i]);
+  }
+}
+
+//-----
+TEST_F(TransactionBatchBuilderUnitTests, UsesClientMaxTransactionFeeIfPrototypeHasNone)
+{
+  // Given
+  Client client;
+  client.setOperator(getTestOperatorAccountId(), getTestOperatorKey());
+  client.setMaxTransactionFee(Hbar(3LL));
+
+  TransferTransaction prototype;
+  prototype.setNodeAccountIds(getTestNodeAccountIds());
+  TransactionBatchBuilder builder(prototype);
+  builder.setRecipients({ AccountId(1000ULL) }).setAmounts({ Hbar(1LL, HbarUnit::TINYBAR()) });
+
+  // When
+  const TransactionBatchBuilder::Batch batch = builder.build(client);
+  const TransactionBatchBuilder::Batch batchWithPrototypeFee = getTestBuilder(1U).build(client);
+
+  // Then
+  EXPECT_EQ(getTransactionBody(batch.mTransfers[0].mTransactions[0]).transactionfee(),
+            static_cast<uint64_t>(Hbar(3LL).toTinybars()));
+  EXPECT_EQ(getTransactionBody(batchWithPrototypeFee.mTransfers[0].mTransactions[0]).transactionfee(),
+            static_cast<uint64_t>(Hbar(1LL).toTinybars()));
+}
+
+//-----
+TEST_F(TransactionBatchBuilderUnitTests, BuildWithSenderAsRecipient)
+{
+  // Given
+  TransactionBatchBuilder builder = getTestBuilder(2U);
+  builder.setRecipients({ AccountId(1000ULL), getTestOperatorAccountId() });
+
+  // When / Then
+  EXPECT_THROW(auto batch = builder.build(getTestClient()), std::invalid_argument);
+
+  builder.setSender(AccountId(1000ULL));
+  EXPECT_THROW(auto batch = builder.build(getTestClient()), std::invalid_argument);
+}
+
+//-----
+TEST_F(TransactionBatchBuilderUnitTests, BuildWithMismatchedColumns)
+{
+  // Given
+  TransactionBatchBuilder builder = getTestBuilder(2U);
+
+  // When / Then
+  builder.setAmounts({ Hbar(1LL) });
+  EXPECT_THROW(auto batch = builder.build(getTestClient()), std::invalid_argument);
+
+  builder.setAmounts({ Hbar(1LL), Hbar(2LL) }).setMemos({ "memo" });
+  EXPECT_THROW(auto batch = builder.build(getTestClient()), std::invalid_argument);
+}
+
+//-----
+TEST_F(TransactionBatchBuilderUnitTests, BuildWithoutOperator)
+{
+  // Given
+  const TransactionBatchBuilder builder = getTestBuilder(1U);
+
+  // When / Then
+  EXPECT_THROW(auto batch = builder.build(Client()), UninitializedException);
+}
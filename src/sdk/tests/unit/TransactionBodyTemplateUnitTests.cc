@@ -0,0 +1,83 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "AccountId.h"
+#include "impl/TransactionBodyTemplate.h"
+
+#include <basic_types.pb.h>
+#include <gtest/gtest.h>
+#include <string>
+#include <transaction_body.pb.h>
+
+using namespace Hiero;
+using namespace Hiero::internal;
+
+class TransactionBodyTemplateUnitTests : public ::testing::Test
+{
+protected:
+  [[nodiscard]] inline const proto::TransactionBody& getTestTransactionBody() const { return mTransactionBody; }
+
+  void SetUp() override
+  {
+    proto::TransactionID* transactionId = mTransactionBody.mutable_transactionid();
+    transactionId->mutable_accountid()->set_accountnum(2LL);
+    transactionId->mutable_transactionvalidstart()->set_seconds(1700000000LL);
+    transactionId->mutable_transactionvalidstart()->set_nanos(123);
+    mTransactionBody.set_transactionfee(100000000ULL);
+    mTransactionBody.mutable_transactionvalidduration()->set_seconds(120LL);
+    mTransactionBody.set_memo("memo");
+  }
+
+private:
+  proto::TransactionBody mTransactionBody;
+};
+
+//-----
+TEST_F(TransactionBodyTemplateUnitTests, GetBodyBytesMatchesSerializedBody)
+{
+  // Given
+  const TransactionBodyTemplate bodyTemplate(getTestTransactionBody());
+
+  for (const AccountId& nodeAccountId : { AccountId(3ULL), AccountId(1ULL, 2ULL, 1000000ULL) })
+  {
+    proto::TransactionBody body = getTestTransactionBody();
+    body.set_allocated_nodeaccountid(nodeAccountId.toProtobuf().release());
+
+    // When
+    const std::string bytes = bodyTemplate.getBodyBytes(nodeAccountId);
+
+    // Then
+    EXPECT_EQ(bytes, body.SerializeAsString());
+  }
+}
+
+//-----
+TEST_F(TransactionBodyTemplateUnitTests, GetBodyBytesReplacesNodeAccountId)
+{
+  // Given
+  proto::TransactionBody body = getTestTransactionBody();
+  body.set_allocated_nodeaccountid(AccountId(3ULL).toProtobuf().release());
+  const TransactionBodyTemplate bodyTemplate(body);
+
+  // When
+  proto::TransactionBody parsed;
+  ASSERT_TRUE(parsed.ParseFromString(bodyTemplate.getBodyBytes(AccountId(4ULL))));
+
+  // Then
+  EXPECT_EQ(AccountId::fromProtobuf(parsed.nodeaccountid()), AccountId(4ULL));
+  EXPECT_EQ(parsed.memo(), "memo");
+}
+
+//-----
+TEST_F(TransactionBodyTemplateUnitTests, GetBodyBytesWithoutTransactionId)
+{
+  // Given
+  proto::TransactionBody body = getTestTransactionBody();
+  body.clear_transactionid();
+  const TransactionBodyTemplate bodyTemplate(body);
+
+  // When
+  const std::string bytes = bodyTemplate.getBodyBytes(AccountId(3ULL));
+
+  // Then
+  body.set_allocated_nodeaccountid(AccountId(3ULL).toProtobuf().release());
+  EXPECT_EQ(bytes, body.SerializeAsString());
+}
@@ -0,0 +1,108 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "AccountId.h"
+#include "impl/TransactionIdGenerator.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+using namespace Hiero;
+using namespace Hiero::internal;
+
+class TransactionIdGeneratorUnitTests : public ::testing::Test
+{
+protected:
+  [[nodiscard]] inline const AccountId& getTestAccountId() const { return mAccountId; }
+
+private:
+  const AccountId mAccountId = AccountId(1ULL, 2ULL, 3ULL);
+};
+
+//-----
+TEST_F(TransactionIdGeneratorUnitTests, NextIsStrictlyIncreasing)
+{
+  // Given
+  TransactionIdGenerator generator;
+  std::chrono::system_clock::time_point previous = generator.next(getTestAccountId());
+
+  // When / Then
+  for (int i = 0; i < 10000; ++i)
+  {
+    const std::chrono::system_clock::time_point current = generator.next(getTestAccountId());
+    ASSERT_GT(current, previous);
+    previous = current;
+  }
+}
+
+//-----
+TEST_F(TransactionIdGeneratorUnitTests, NextReservesConsecutiveValidStarts)
+{
+  // Given
+  TransactionIdGenerator generator;
+
+  // When
+  const std::chrono::system_clock::time_point first = generator.next(getTestAccountId(), 5U);
+  const std::chrono::system_clock::time_point second = generator.next(getTestAccountId());
+
+  // Then
+  EXPECT_GE(second - first, std::chrono::system_clock::duration(5));
+}
+
+//-----
+TEST_F(TransactionIdGeneratorUnitTests, NextWithBackdate)
+{
+  // Given
+  TransactionIdGenerator generator;
+  const std::chrono::system_clock::time_point now = std::chrono::system_clock::now();
+
+  // When
+  const std::chrono::system_clock::time_point start =
+    generator.next(AccountId(4ULL, 5ULL, 6ULL), 1U, std::chrono::seconds(5));
+
+  // Then
+  EXPECT_LE(start, now - std::chrono::seconds(4));
+  EXPECT_GE(start, now - std::chrono::seconds(6));
+}
+
+//-----
+TEST_F(TransactionIdGeneratorUnitTests, NextIsUniqueAcrossThreads)
+{
+  // Given
+  TransactionIdGenerator generator;
+  const unsigned int threads = std::max(std::thread::hardware_concurrency(), 4U);
+  constexpr int idsPerThread = 250000;
+  std::vector<std::vector<int64_t>> starts(threads);
+
+  // When
+  std::vector<std::thread> workers;
+  workers.reserve(threads);
+  for (unsigned int i = 0U; i < threads; ++i)
+  {
+    workers.emplace_back(
+      [&generator, &starts, i, this]()
+      {
+        starts[i].reserve(idsPerThread);
+        for (int j = 0; j < idsPerThread; ++j)
+        {
+          starts[i].push_back(generator.next(getTestAccountId()).time_since_epoch().count());
+        }
+      });
+  }
+
+  std::for_each(workers.begin(), workers.end(), [](std::thread& worker) { worker.join(); });
+
+  // Then
+  std::vector<int64_t> all;
+  all.reserve(static_cast<std::size_t>(threads) * idsPerThread);
+  for (const std::vector<int64_t>& thread : starts)
+  {
+    EXPECT_TRUE(std::is_sorted(thread.begin(), thread.end()));
+    all.insert(all.end(), thread.begin(), thread.end());
+  }
+
+  std::sort(all.begin(), all.end());
+  EXPECT_EQ(std::adjacent_find(all.begin(), all.end()), all.end());
+}
@@ -8,12 +8,14 @@
 #include "ContractDeleteTransaction.h"
 #include "ContractExecuteTransaction.h"
 #include "ContractUpdateTransaction.h"
+#include "ED25519PrivateKey.h"
 #include "EthereumTransaction.h"
 #include "FileAppendTransaction.h"
 #include "FileCreateTransaction.h"
 #include "FileDeleteTransaction.h"
 #include "FileUpdateTransaction.h"
 #include "FreezeTransaction.h"
+#include "PublicKey.h"
 #include "ScheduleCreateTransaction.h"
 #include "ScheduleDeleteTransaction.h"
 #include "ScheduleSignTransaction.h"
@@ -43,7 +45,9 @@
 #include "TransferTransaction.h"
 #include "WrappedTransaction.h"
 #include "impl/Utilities.h"
+#include "impl/openssl_utils/OpenSSLUtils.h"
 
+#include <algorithm>
 #include <gtest/gtest.h>
 #include <transaction.pb.h>
 #include <transaction_body.pb.h>
@@ -2719,3 +2723,166 @@ TEST_F(TransactionUnitTests, TransferTransactionFromTransactionListBytes)
   ASSERT_EQ(wrappedTx.getTransactionType(), TransactionType::TRANSFER_TRANSACTION);
   EXPECT_NE(wrappedTx.getTransaction<TransferTransaction>(), nullptr);
 }
+
+//-----
+TEST_F(TransactionUnitTests, ParallelSigningMatchesSequentialSigning)
+{
+  // Given
+  const std::vector<AccountId> nodeAccountIds = { AccountId(3ULL), AccountId(4ULL), AccountId(5ULL), AccountId(6ULL) };
+  const TransactionId transactionId = TransactionId::generate(AccountId(1ULL));
+  const std::vector<std::shared_ptr<PrivateKey>> keys = { ED25519PrivateKey::generatePrivateKey(),
+                                                          ED25519PrivateKey::generatePrivateKey(),
+                                                          ED25519PrivateKey::generatePrivateKey() };
+
+  TransferTransaction sequentialTransaction =
+    TransferTransaction().setNodeAccountIds(nodeAccountIds).setTransactionId(transactionId).freeze();
+  TransferTransaction parallelTransaction = TransferTransaction()
+                                              .setNodeAccountIds(nodeAccountIds)
+                                              .setTransactionId(transactionId)
+                                              .setParallelSigning(true)
+                                              .freeze();
+  for (const auto& key : keys)
+  {
+    sequentialTransaction.sign(key);
+    parallelTransaction.sign(key);
+  }
+
+  // When
+  const std::vector<std::byte> sequentialBytes = sequentialTransaction.toBytes();
+  const std::vector<std::byte> parallelBytes = parallelTransaction.toBytes();
+
+  // Then
+  EXPECT_TRUE(parallelTransaction.getParallelSigning());
+  EXPECT_EQ(sequentialBytes, parallelBytes);
+
+  proto::TransactionList txList;
+  ASSERT_TRUE(txList.ParseFromArray(parallelBytes.data(), static_cast<int>(parallelBytes.size())));
+  ASSERT_EQ(txList.transaction_list_size(), static_cast<int>(nodeAccountIds.size()));
+
+  for (const proto::Transaction& tx : txList.transaction_list())
+  {
+    proto::SignedTransaction signedTx;
+    ASSERT_TRUE(signedTx.ParseFromString(tx.signedtransactionbytes()));
+    ASSERT_EQ(signedTx.sigmap().sigpair_size(), static_cast<int>(keys.size()));
+
+    for (const auto& key : keys)
+    {
+      const std::string publicKeyPrefix = internal::Utilities::byteVectorToString(key->getPublicKey()->toBytesRaw());
+      const auto signaturePair = std::find_if(signedTx.sigmap().sigpair().cbegin(),
+                                              signedTx.sigmap().sigpair().cend(),
+                                              [&publicKeyPrefix](const proto::SignaturePair& pair)
+                                              { return pair.pubkeyprefix() == publicKeyPrefix; });
+      ASSERT_NE(signaturePair, signedTx.sigmap().sigpair().cend());
+      EXPECT_TRUE(
+        key->getPublicKey()->verifySignature(internal::Utilities::stringToByteVector(signaturePair->ed25519()),
+                                             internal::Utilities::stringToByteVector(signedTx.bodybytes())));
+    }
+  }
+}
+
+//-----
+TEST_F(TransactionUnitTests, ParallelSigningDoesNotSignTwice)
+{
+  // Given
+  const std::shared_ptr<PrivateKey> firstKey = ED25519PrivateKey::generatePrivateKey();
+  const std::shared_ptr<PrivateKey> secondKey = ED25519PrivateKey::generatePrivateKey();
+  int firstKeySignatures = 0;
+
+  TransferTransaction transaction = TransferTransaction()
+                                      .setNodeAccountIds({ AccountId(3ULL), AccountId(4ULL) })
+                                      .setTransactionId(TransactionId::generate(AccountId(1ULL)))
+                                      .setParallelSigning(true)
+                                      .freeze();
+  transaction.signWith(firstKey->getPublicKey(),
+                       [&firstKey, &firstKeySignatures](const std::vector<std::byte>& bytes)
+                       {
+                         ++firstKeySignatures;
+                         return firstKey->sign(bytes);
+                       });
+  ASSERT_NO_THROW(static_cast<void>(transaction.toBytes()));
+
+  // When
+  transaction.sign(secondKey);
+  const std::vector<std::byte> bytes = transaction.toBytes();
+
+  // Then
+  EXPECT_EQ(firstKeySignatures, 2);
+
+  proto::TransactionList txList;
+  ASSERT_TRUE(txList.ParseFromArray(bytes.data(), static_cast<int>(bytes.size())));
+  for (const proto::Transaction& tx : txList.transaction_list())
+  {
+    proto::SignedTransaction signedTx;
+    ASSERT_TRUE(signedTx.ParseFromString(tx.signedtransactionbytes()));
+    EXPECT_EQ(signedTx.sigmap().sigpair_size(), 2);
+  }
+}
+
+//-----
+TEST_F(TransactionUnitTests, ParallelSigningMatchesSequentialSigningAfterSecondSign)
+{
+  // Given
+  const std::vector<AccountId> nodeAccountIds = { AccountId(3ULL), AccountId(4ULL) };
+  const TransactionId transactionId = TransactionId::generate(AccountId(1ULL));
+  const std::shared_ptr<PrivateKey> firstKey = ED25519PrivateKey::generatePrivateKey();
+  const std::shared_ptr<PrivateKey> secondKey = ED25519PrivateKey::generatePrivateKey();
+
+  TransferTransaction sequentialTransaction =
+    TransferTransaction().setNodeAccountIds(nodeAccountIds).setTransactionId(transactionId).freeze();
+  TransferTransaction parallelTransaction = TransferTransaction()
+                                              .setNodeAccountIds(nodeAccountIds)
+                                              .setTransactionId(transactionId)
+                                              .setParallelSigning(true)
+                                              .freeze();
+  sequentialTransaction.sign(firstKey);
+  parallelTransaction.sign(firstKey);
+  ASSERT_EQ(sequentialTransaction.toBytes(), parallelTransaction.toBytes());
+
+  // When
+  sequentialTransaction.sign(secondKey);
+  parallelTransaction.sign(secondKey);
+  const std::vector<std::byte> sequentialBytes = sequentialTransaction.toBytes();
+  const std::vector<std::byte> parallelBytes = parallelTransaction.toBytes();
+
+  // Then
+  EXPECT_EQ(sequentialBytes, parallelBytes);
+
+  proto::TransactionList txList;
+  ASSERT_TRUE(txList.ParseFromArray(sequentialBytes.data(), static_cast<int>(sequentialBytes.size())));
+  for (const proto::Transaction& tx : txList.transaction_list())
+  {
+    proto::SignedTransaction signedTx;
+    ASSERT_TRUE(signedTx.ParseFromString(tx.signedtransactionbytes()));
+    EXPECT_EQ(signedTx.sigmap().sigpair_size(), 2);
+  }
+}
+
+//-----
+TEST_F(TransactionUnitTests, TransactionHashesMatchSignedTransactionBytes)
+{
+  // Given
+  TransferTransaction transaction = TransferTransaction()
+                                      .setNodeAccountIds({ AccountId(3ULL), AccountId(4ULL) })
+                                      .setTransactionId(TransactionId::generate(AccountId(1ULL)))
+                                      .freeze();
+  transaction.sign(ED25519PrivateKey::generatePrivateKey());
+  const std::map<AccountId, std::vector<std::byte>> singleSignatureHashes = transaction.getTransactionHashPerNode();
+
+  // When
+  transaction.sign(ED25519PrivateKey::generatePrivateKey());
+  const std::map<AccountId, std::vector<std::byte>> hashes = transaction.getTransactionHashPerNode();
+  const std::vector<std::byte> bytes = transaction.toBytes();
+
+  // Then
+  proto::TransactionList txList;
+  ASSERT_TRUE(txList.ParseFromArray(bytes.data(), static_cast<int>(bytes.size())));
+  ASSERT_EQ(txList.transaction_list_size(), 2);
+  EXPECT_EQ(hashes.at(AccountId(3ULL)),
+            internal::OpenSSLUtils::computeSHA384(
+              internal::Utilities::stringToByteVector(txList.transaction_list(0).signedtransactionbytes())));
+  EXPECT_EQ(hashes.at(AccountId(4ULL)),
+            internal::OpenSSLUtils::computeSHA384(
+              internal::Utilities::stringToByteVector(txList.transaction_list(1).signedtransactionbytes())));
+  EXPECT_EQ(transaction.getTransactionHash(), hashes.at(AccountId(3ULL)));
+  EXPECT_NE(singleSignatureHashes.at(AccountId(3ULL)), hashes.at(AccountId(3ULL)));
+}